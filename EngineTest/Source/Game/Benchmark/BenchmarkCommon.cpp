@@ -0,0 +1,144 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include <algorithm>
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// FNV-1a, good enough to tell two simulation end states apart
+uint64_t HashBytes(const void* data, size_t byteCount, uint64_t hash /*= BENCHMARK_HASH_SEED*/)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+
+	for (size_t byteIndex = 0; byteIndex < byteCount; ++byteIndex)
+	{
+		hash ^= (uint64_t)bytes[byteIndex];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Hashes the bit pattern, so -0 and 0 differ; we want bit-identical results, not just equal ones
+uint64_t HashFloat(float value, uint64_t hash /*= BENCHMARK_HASH_SEED*/)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	return HashBytes(&bits, sizeof(bits), hash);
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+double TimingSamples::GetTotal() const
+{
+	double total = 0.0;
+
+	for (double sample : m_samples)
+	{
+		total += sample;
+	}
+
+	return total;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+double TimingSamples::GetAverage() const
+{
+	if (m_samples.size() == 0)
+	{
+		return 0.0;
+	}
+
+	return GetTotal() / (double)m_samples.size();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+double TimingSamples::GetMax() const
+{
+	double maxSample = 0.0;
+
+	for (double sample : m_samples)
+	{
+		maxSample = std::max(maxSample, sample);
+	}
+
+	return maxSample;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Percentile in the range [0, 100], using nearest rank
+double TimingSamples::GetPercentile(float percentile) const
+{
+	if (m_samples.size() == 0)
+	{
+		return 0.0;
+	}
+
+	std::vector<double> sorted = m_samples;
+	std::sort(sorted.begin(), sorted.end());
+
+	const float clampedPercentile = std::min(std::max(percentile, 0.f), 100.f);
+	const size_t rank = (size_t)((clampedPercentile / 100.f) * (float)(sorted.size() - 1) + 0.5f);
+
+	return sorted[rank];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+uint32_t BenchmarkRandom::GetNext()
+{
+	m_state ^= (m_state << 13);
+	m_state ^= (m_state >> 17);
+	m_state ^= (m_state << 5);
+
+	return m_state;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+float BenchmarkRandom::GetFloatInRange(float minInclusive, float maxInclusive)
+{
+	const float normalized = (float)(GetNext() & 0xFFFFFF) / (float)0xFFFFFF;
+	return minInclusive + normalized * (maxInclusive - minInclusive);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+int BenchmarkRandom::GetIntInRange(int minInclusive, int maxInclusive)
+{
+	const uint32_t range = (uint32_t)(maxInclusive - minInclusive + 1);
+	return minInclusive + (int)(GetNext() % range);
+}
@@ -0,0 +1,84 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Timing, hashing and random helpers shared by the headless benchmarks
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+const uint64_t BENCHMARK_HASH_SEED = 14695981039346656037ULL; // FNV-1a offset basis
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Collects per-frame timings so we can report more than just the average
+class TimingSamples
+{
+public:
+	//-----Public Methods-----
+
+	void	Reserve(int count) { m_samples.reserve(count); }
+	void	Clear() { m_samples.clear(); }
+	void	AddSample(double seconds) { m_samples.push_back(seconds); }
+
+	int		GetCount() const { return (int)m_samples.size(); }
+	double	GetTotal() const;
+	double	GetAverage() const;
+	double	GetMax() const;
+	double	GetPercentile(float percentile) const;
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<double> m_samples;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Small xorshift generator, so benchmark scenes are identical on every platform and standard library
+class BenchmarkRandom
+{
+public:
+	//-----Public Methods-----
+
+	BenchmarkRandom(uint32_t seed) : m_state(seed != 0 ? seed : 1) {}
+
+	uint32_t	GetNext();
+	float		GetFloatInRange(float minInclusive, float maxInclusive);
+	int			GetIntInRange(int minInclusive, int maxInclusive);
+
+
+private:
+	//-----Private Data-----
+
+	uint32_t m_state = 1;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+uint64_t	HashBytes(const void* data, size_t byteCount, uint64_t hash = BENCHMARK_HASH_SEED);
+uint64_t	HashFloat(float value, uint64_t hash = BENCHMARK_HASH_SEED);
@@ -0,0 +1,264 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description:
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/DebugDrawBenchmark.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Render/DebugDraw.h"
+#include "Game/Render/DebugDrawBackend.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Job/Job.h"
+#include <algorithm>
+#include <cstdio>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Draws a range of the scene's colliders, with their contacts and tree nodes
+class DebugDrawSceneJob : public Job
+{
+public:
+	DebugDrawSceneJob(const DebugDrawBenchmarkScene* scene, int firstIndex, int endIndex)
+		: m_scene(scene), m_firstIndex(firstIndex), m_endIndex(endIndex) {}
+
+	virtual void Execute() override;
+	virtual void Finalize() override {}
+
+private:
+	const DebugDrawBenchmarkScene*	m_scene = nullptr;
+	int								m_firstIndex = 0;
+	int								m_endIndex = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const uint32_t	s_benchmarkSeed = 0x5EED0024;
+static const float		s_sceneHalfSize = 100.f;
+static const float		s_contactSize = 0.1f;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static double SecondsToMs(double seconds)
+{
+	return seconds * 1000.0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static void DrawSceneRange(const DebugDrawBenchmarkScene& scene, int firstIndex, int endIndex)
+{
+	const int treeNodeCount = (int)scene.treeNodeBounds.size();
+
+	for (int index = firstIndex; index < endIndex; ++index)
+	{
+		if (scene.colliderIsSphere[index])
+		{
+			g_debugDraw->DrawWireSphere(scene.colliderCenters[index], scene.colliderHalfExtents[index].x, DEBUG_DRAW_GREEN);
+		}
+		else
+		{
+			g_debugDraw->DrawWireBox(scene.colliderCenters[index], scene.colliderHalfExtents[index], scene.colliderRotations[index], DEBUG_DRAW_GREEN);
+		}
+
+		g_debugDraw->DrawContact(scene.contactPositions[index], scene.contactNormals[index], s_contactSize, DEBUG_DRAW_RED);
+
+		if (index < treeNodeCount)
+		{
+			g_debugDraw->DrawWireAabb(scene.treeNodeBounds[index], DEBUG_DRAW_YELLOW);
+		}
+	}
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void DebugDrawSceneJob::Execute()
+{
+	DrawSceneRange(*m_scene, m_firstIndex, m_endIndex);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+DebugDrawBenchmark::DebugDrawBenchmark(const DebugDrawBenchmarkSettings& settings)
+	: m_settings(settings)
+{
+	m_settings.colliderCount = std::max(m_settings.colliderCount, 1);
+	m_settings.jobsPerWorker = std::max(m_settings.jobsPerWorker, 1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Every frame draws the scene from the jobs and flushes it to the instanced backend, then draws it again from the
+// jobs for the expanded backend, then again from this thread alone, which is discarded
+bool DebugDrawBenchmark::Run()
+{
+	ASSERT_OR_DIE(g_debugDraw != nullptr && g_jobScheduler != nullptr, "Debug draw benchmark needs the App initialized!");
+
+	BuildScene();
+
+	const int colliderCount = m_settings.colliderCount;
+	const int jobCount = std::min((g_jobScheduler->GetWorkerCount() + 1) * m_settings.jobsPerWorker, colliderCount);
+	const int frameCount = m_settings.frameCount;
+
+	std::vector<DebugDrawSceneJob> jobs;
+	jobs.reserve(jobCount);
+	for (int jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+	{
+		jobs.emplace_back(&m_scene, (colliderCount * jobIndex) / jobCount, (colliderCount * (jobIndex + 1)) / jobCount);
+	}
+
+	printf("Debug draw: %d colliders, %d contacts, %d tree nodes, %d jobs, %d frames, times are ms\n",
+		colliderCount, colliderCount, (int)m_scene.treeNodeBounds.size(), jobCount, frameCount);
+
+	NullDebugDrawBackend instancedBackend(true);
+	NullDebugDrawBackend expandedBackend(false);
+
+	TimingSamples jobDrawSamples;
+	TimingSamples serialDrawSamples;
+	TimingSamples instancedFlushSamples;
+	TimingSamples expandedFlushSamples;
+
+	jobDrawSamples.Reserve(frameCount);
+	serialDrawSamples.Reserve(frameCount);
+	instancedFlushSamples.Reserve(frameCount);
+	expandedFlushSamples.Reserve(frameCount);
+
+	DebugDrawStats instancedStats;
+	DebugDrawStats expandedStats;
+	int mismatchedFrameCount = 0;
+
+	for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+	{
+		// Instanced
+		double startTime = Profiler::GetSeconds();
+
+		for (DebugDrawSceneJob& job : jobs)
+		{
+			g_jobScheduler->Submit(&job);
+		}
+		g_jobScheduler->WaitForAll();
+
+		double drawEndTime = Profiler::GetSeconds();
+		instancedStats = g_debugDraw->Flush(instancedBackend);
+		double flushEndTime = Profiler::GetSeconds();
+
+		jobDrawSamples.AddSample(drawEndTime - startTime);
+		instancedFlushSamples.AddSample(flushEndTime - drawEndTime);
+
+		// Expanded
+		for (DebugDrawSceneJob& job : jobs)
+		{
+			g_jobScheduler->Submit(&job);
+		}
+		g_jobScheduler->WaitForAll();
+
+		drawEndTime = Profiler::GetSeconds();
+		expandedStats = g_debugDraw->Flush(expandedBackend);
+		flushEndTime = Profiler::GetSeconds();
+
+		expandedFlushSamples.AddSample(flushEndTime - drawEndTime);
+
+		// Serial
+		startTime = Profiler::GetSeconds();
+		DrawSceneRange(m_scene, 0, colliderCount);
+		serialDrawSamples.AddSample(Profiler::GetSeconds() - startTime);
+		g_debugDraw->Discard();
+
+		// What the backends saw has to be what the flush says it sent, and the same vertices either way
+		const bool matches = (instancedStats.primitiveCount == expandedStats.primitiveCount)
+			&& (instancedStats.vertexCount == expandedStats.vertexCount)
+			&& (instancedBackend.GetDrawCount() == instancedStats.drawCount)
+			&& (instancedBackend.GetInstanceCount() == instancedStats.primitiveCount)
+			&& (instancedBackend.GetVertexCount() == instancedStats.vertexCount)
+			&& (expandedBackend.GetDrawCount() == expandedStats.drawCount)
+			&& (expandedBackend.GetVertexCount() == expandedStats.vertexCount);
+
+		mismatchedFrameCount += (matches ? 0 : 1);
+	}
+
+	printf("%-10s | draw %8.3f avg %8.3f p95\n", "jobs", SecondsToMs(jobDrawSamples.GetAverage()), SecondsToMs(jobDrawSamples.GetPercentile(95.f)));
+	printf("%-10s | draw %8.3f avg %8.3f p95\n", "serial", SecondsToMs(serialDrawSamples.GetAverage()), SecondsToMs(serialDrawSamples.GetPercentile(95.f)));
+	printf("%-10s | flush %8.3f avg %8.3f p95 | %6d draws | %8d instances | %9d vertices\n", "instanced",
+		SecondsToMs(instancedFlushSamples.GetAverage()), SecondsToMs(instancedFlushSamples.GetPercentile(95.f)),
+		instancedStats.drawCount, instancedStats.instanceCount, instancedStats.vertexCount);
+	printf("%-10s | flush %8.3f avg %8.3f p95 | %6d draws | %8d instances | %9d vertices\n", "expanded",
+		SecondsToMs(expandedFlushSamples.GetAverage()), SecondsToMs(expandedFlushSamples.GetPercentile(95.f)),
+		expandedStats.drawCount, expandedStats.instanceCount, expandedStats.vertexCount);
+	printf("%d primitives a frame, from %d threads, would have been %d draws one at a time\n",
+		instancedStats.primitiveCount, instancedStats.threadCount, instancedStats.primitiveCount);
+	printf("%s\n", (mismatchedFrameCount == 0 ? "Every frame's flushes matched" : "Some frames' flushes didn't match"));
+	return (mismatchedFrameCount == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Colliders scattered with random sizes and orientations, a contact on each, and a tree built by pairing
+// neighbouring bounds up level by level, the way a balanced tree over sorted leaves would come out
+void DebugDrawBenchmark::BuildScene()
+{
+	const int colliderCount = m_settings.colliderCount;
+	BenchmarkRandom random(s_benchmarkSeed);
+
+	m_scene = DebugDrawBenchmarkScene();
+	std::vector<FloatAabb> levelBounds;
+	levelBounds.reserve(colliderCount);
+
+	for (int colliderIndex = 0; colliderIndex < colliderCount; ++colliderIndex)
+	{
+		const Float3 center = Float3(random.GetFloatInRange(-s_sceneHalfSize, s_sceneHalfSize), random.GetFloatInRange(0.f, 20.f), random.GetFloatInRange(-s_sceneHalfSize, s_sceneHalfSize));
+		const Float3 halfExtents = Float3(random.GetFloatInRange(0.25f, 1.f), random.GetFloatInRange(0.25f, 1.f), random.GetFloatInRange(0.25f, 1.f));
+		const Float3 axis = SafeNormalize(Float3(random.GetFloatInRange(-1.f, 1.f), random.GetFloatInRange(-1.f, 1.f), random.GetFloatInRange(-1.f, 1.f)), Float3(0.f, 1.f, 0.f));
+		const FloatQuat rotation = CreateQuatFromAxisAngle(axis, random.GetFloatInRange(0.f, 2.f * PHYSICS_PI));
+		const bool isSphere = (random.GetIntInRange(0, 1) == 0);
+
+		m_scene.colliderCenters.push_back(center);
+		m_scene.colliderHalfExtents.push_back(halfExtents);
+		m_scene.colliderRotations.push_back(rotation);
+		m_scene.colliderIsSphere.push_back(isSphere);
+		m_scene.contactPositions.push_back(center - Float3(0.f, halfExtents.y, 0.f));
+		m_scene.contactNormals.push_back(Float3(0.f, 1.f, 0.f));
+
+		// Loose enough for any rotation
+		const float radius = std::max(halfExtents.x, std::max(halfExtents.y, halfExtents.z)) * (isSphere ? 1.f : 1.7321f);
+		levelBounds.push_back(FloatAabb(center - Float3(radius, radius, radius), center + Float3(radius, radius, radius)));
+	}
+
+	while (levelBounds.size() > 1)
+	{
+		std::vector<FloatAabb> parentBounds;
+		parentBounds.reserve((levelBounds.size() + 1) / 2);
+
+		for (size_t childIndex = 0; childIndex + 1 < levelBounds.size(); childIndex += 2)
+		{
+			parentBounds.push_back(Union(levelBounds[childIndex], levelBounds[childIndex + 1]));
+			m_scene.treeNodeBounds.push_back(parentBounds.back());
+		}
+
+		// An odd one out moves up a level as it is
+		if ((levelBounds.size() % 2) != 0)
+		{
+			parentBounds.push_back(levelBounds.back());
+		}
+
+		levelBounds.swap(parentBounds);
+	}
+}
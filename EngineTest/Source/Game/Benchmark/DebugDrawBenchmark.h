@@ -0,0 +1,81 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: Thousands of colliders, contacts and tree nodes debug drawn from jobs and flushed to null backends
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include "Game/Physics/PhysicsMath.h"
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct DebugDrawBenchmarkSettings
+{
+	int		frameCount = 120;
+	int		colliderCount = 10000;		// Each also has a contact, and the tree over them has colliderCount - 1 inner nodes
+	int		jobsPerWorker = 4;
+};
+
+// What a frame visualizes; made up, so no physics has to run
+struct DebugDrawBenchmarkScene
+{
+	std::vector<Float3>		colliderCenters;
+	std::vector<Float3>		colliderHalfExtents;	// Sphere radius in x
+	std::vector<FloatQuat>	colliderRotations;
+	std::vector<bool>		colliderIsSphere;
+	std::vector<Float3>		contactPositions;
+	std::vector<Float3>		contactNormals;
+	std::vector<FloatAabb>	treeNodeBounds;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Each frame draws the whole scene into g_debugDraw, split across jobs, and flushes it once to a null backend
+// that instances and once to one that doesn't. Reports how many draws the batches came to against drawing every
+// primitive on its own, and checks both flushes came to the same vertices. Drawing from one thread is timed
+// too, to show what the per thread streams get from the jobs
+class DebugDrawBenchmark
+{
+public:
+	//-----Public Methods-----
+
+	DebugDrawBenchmark(const DebugDrawBenchmarkSettings& settings);
+
+	bool Run();		// False if any frame's flushes didn't match
+
+
+private:
+	//-----Private Methods-----
+
+	void	BuildScene();
+
+
+private:
+	//-----Private Data-----
+
+	DebugDrawBenchmarkSettings	m_settings;
+	DebugDrawBenchmarkScene		m_scene;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
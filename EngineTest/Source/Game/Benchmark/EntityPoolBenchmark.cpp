@@ -0,0 +1,270 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/EntityPoolBenchmark.h"
+#include "Game/Framework/AllocationCounter.h"
+#include "Game/Framework/FrameArena.h"
+#include "Game/Framework/Game.h"
+#include "Game/Framework/ObjectPool.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Physics/BodyScene.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Core/Entity.h"
+#include <cstdio>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const uint32_t	s_benchmarkSeed = 0x5EED0021;
+static const float		s_spawnAreaHalfSize = 40.f;
+static const float		s_shapeHalfSize = 0.5f;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static double SecondsToMs(double seconds)
+{
+	return seconds * 1000.0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static double SecondsToNs(double seconds)
+{
+	return seconds * 1000000000.0;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+EntityPoolBenchmark::EntityPoolBenchmark(const EntityPoolBenchmarkSettings& settings)
+	: m_settings(settings)
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool EntityPoolBenchmark::Run()
+{
+	if (!IsAllocationCounterEnabled())
+	{
+		printf("Allocation counting is compiled out of this build (see ALLOCATION_COUNTER_ENABLED), so allocations read 0\n");
+	}
+
+	RunChurnComparison();
+	return RunSpawnStress();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Both sides fill up to the object count first and then replace a random live object per operation, so the
+// timed part is steady state churn. The pool side grows while filling and shouldn't allocate after
+void EntityPoolBenchmark::RunChurnComparison() const
+{
+	const int objectCount = (m_settings.churnObjectCount > 0 ? m_settings.churnObjectCount : 1);
+	const int operationCount = m_settings.churnOperationCount;
+
+	printf("Entity churn: %d live entities, %d replacements, times are ns per despawn + spawn\n", objectCount, operationCount);
+
+	// Pool
+	{
+		ObjectPool<Entity> pool;
+		for (int objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+		{
+			pool.Create();
+		}
+
+		BenchmarkRandom random(s_benchmarkSeed);
+		const uint64_t startAllocations = GetAllocationCount();
+		const double startTime = Profiler::GetSeconds();
+
+		for (int operationIndex = 0; operationIndex < operationCount; ++operationIndex)
+		{
+			const int index = random.GetIntInRange(0, pool.GetCount() - 1);
+			pool.Destroy(pool.GetHandleAt(index));
+			pool.Create();
+		}
+
+		const double totalSeconds = Profiler::GetSeconds() - startTime;
+		const uint64_t allocationCount = GetAllocationCount() - startAllocations;
+
+		printf("%-12s | %8.1f ns | %10llu allocations | %d slots\n", "ObjectPool",
+			SecondsToNs(totalSeconds / (double)(operationCount > 0 ? operationCount : 1)), (unsigned long long)allocationCount, pool.GetSlotCount());
+	}
+
+	// Heap
+	{
+		std::vector<Entity*> entities;
+		entities.reserve(objectCount);
+		for (int objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+		{
+			entities.push_back(new Entity());
+		}
+
+		BenchmarkRandom random(s_benchmarkSeed);
+		const uint64_t startAllocations = GetAllocationCount();
+		const double startTime = Profiler::GetSeconds();
+
+		for (int operationIndex = 0; operationIndex < operationCount; ++operationIndex)
+		{
+			const int index = random.GetIntInRange(0, (int)entities.size() - 1);
+			delete entities[index];
+			entities[index] = new Entity();
+		}
+
+		const double totalSeconds = Profiler::GetSeconds() - startTime;
+		const uint64_t allocationCount = GetAllocationCount() - startAllocations;
+
+		printf("%-12s | %8.1f ns | %10llu allocations\n", "new/delete",
+			SecondsToNs(totalSeconds / (double)(operationCount > 0 ? operationCount : 1)), (unsigned long long)allocationCount);
+
+		for (Entity* entity : entities)
+		{
+			delete entity;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Spawns at spawnsPerSecond, despawning the oldest once at the cap, so once full it despawns just as fast.
+// Physics is stepped the way Game::Update does it, so both scenes and the frame arena see the churn too.
+// Allocations are only checked over the second half, after the pools and scenes have had time to grow. Fails if a
+// despawned entity's handle was still valid
+bool EntityPoolBenchmark::RunSpawnStress()
+{
+	const int maxBodyCount = (m_settings.maxBodyCount > 0 ? m_settings.maxBodyCount : 1);
+	const int frameCount = m_settings.frameCount;
+	const int steadyFrameIndex = frameCount / 2;
+
+	printf("Spawn stress: %d spawns per second, %d bodies max, %d frames at %.4fs\n", m_settings.spawnsPerSecond, maxBodyCount, frameCount, m_settings.deltaSeconds);
+
+	m_game = new Game();
+	m_game->ResetScene();
+	m_game->SetFixedDeltaSeconds(m_settings.deltaSeconds);
+	m_game->SpawnGround();
+
+	// Oldest first, used as a ring
+	std::vector<EntityHandle> liveHandles(maxBodyCount);
+	int firstLiveIndex = 0;
+	int liveCount = 0;
+
+	BenchmarkRandom random(s_benchmarkSeed);
+	float spawnAccumulator = 0.f;
+	int totalSpawnCount = 0;
+	int totalDespawnCount = 0;
+	int staleHandleFailures = 0;
+	uint64_t steadyAllocationCount = 0;
+	uint64_t maxSteadyFrameAllocations = 0;
+
+	TimingSamples despawnSamples;
+	TimingSamples spawnSamples;
+	TimingSamples stepSamples;
+	TimingSamples frameSamples;
+
+	despawnSamples.Reserve(frameCount);
+	spawnSamples.Reserve(frameCount);
+	stepSamples.Reserve(frameCount);
+	frameSamples.Reserve(frameCount);
+
+	for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+	{
+		// Stands in for App::RunFrame
+		g_frameArena->BeginFrame();
+
+		spawnAccumulator += (float)m_settings.spawnsPerSecond * m_settings.deltaSeconds;
+		const int spawnCount = (int)spawnAccumulator;
+		spawnAccumulator -= (float)spawnCount;
+
+		const int despawnCount = (liveCount + spawnCount > maxBodyCount ? liveCount + spawnCount - maxBodyCount : 0);
+
+		const uint64_t startAllocations = GetAllocationCount();
+		const double startTime = Profiler::GetSeconds();
+
+		for (int despawnIndex = 0; despawnIndex < despawnCount && liveCount > 0; ++despawnIndex)
+		{
+			const EntityHandle handle = liveHandles[firstLiveIndex];
+			m_game->DespawnEntity(handle);
+
+			staleHandleFailures += (m_game->m_entities.IsValid(handle) ? 1 : 0);
+			firstLiveIndex = (firstLiveIndex + 1) % maxBodyCount;
+			liveCount--;
+			totalDespawnCount++;
+		}
+
+		const double despawnEndTime = Profiler::GetSeconds();
+
+		for (int spawnIndex = 0; spawnIndex < spawnCount && liveCount < maxBodyCount; ++spawnIndex)
+		{
+			liveHandles[(firstLiveIndex + liveCount) % maxBodyCount] = SpawnRandomBody(random);
+			liveCount++;
+			totalSpawnCount++;
+		}
+
+		const double spawnEndTime = Profiler::GetSeconds();
+
+		m_game->StepPhysics();
+
+		const double stepEndTime = Profiler::GetSeconds();
+		const uint64_t frameAllocations = GetAllocationCount() - startAllocations;
+
+		if (frameIndex >= steadyFrameIndex)
+		{
+			steadyAllocationCount += frameAllocations;
+			maxSteadyFrameAllocations = (frameAllocations > maxSteadyFrameAllocations ? frameAllocations : maxSteadyFrameAllocations);
+		}
+
+		despawnSamples.AddSample(despawnEndTime - startTime);
+		spawnSamples.AddSample(spawnEndTime - despawnEndTime);
+		stepSamples.AddSample(stepEndTime - spawnEndTime);
+		frameSamples.AddSample(stepEndTime - startTime);
+	}
+
+	const int steadyFrameCount = frameCount - steadyFrameIndex;
+
+	printf("despawn %8.3f | spawn %8.3f | step %8.3f | frame %8.3f avg %8.3f p95 %8.3f max ms\n",
+		SecondsToMs(despawnSamples.GetAverage()), SecondsToMs(spawnSamples.GetAverage()), SecondsToMs(stepSamples.GetAverage()),
+		SecondsToMs(frameSamples.GetAverage()), SecondsToMs(frameSamples.GetPercentile(95.f)), SecondsToMs(frameSamples.GetMax()));
+	printf("%d spawned, %d despawned, %d live | %d entity slots, %d body slots | %.1f avg %llu max allocations per frame over the last %d frames\n",
+		totalSpawnCount, totalDespawnCount, liveCount, m_game->m_entities.GetSlotCount(), m_game->m_bodyScene->GetStore().GetSlotCount(),
+		(double)steadyAllocationCount / (double)(steadyFrameCount > 0 ? steadyFrameCount : 1), (unsigned long long)maxSteadyFrameAllocations, steadyFrameCount);
+	printf("%s\n", (staleHandleFailures == 0 ? "Every despawned handle went stale" : "Some despawned handles were still valid"));
+
+	SAFE_DELETE(m_game);
+	return (staleHandleFailures == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+PoolHandle EntityPoolBenchmark::SpawnRandomBody(BenchmarkRandom& random)
+{
+	const Vector3 position = Vector3(random.GetFloatInRange(-s_spawnAreaHalfSize, s_spawnAreaHalfSize), random.GetFloatInRange(2.f, 20.f), random.GetFloatInRange(-s_spawnAreaHalfSize, s_spawnAreaHalfSize));
+	const Vector3 velocity = Vector3(random.GetFloatInRange(-2.f, 2.f), random.GetFloatInRange(-5.f, 0.f), random.GetFloatInRange(-2.f, 2.f));
+
+	switch (random.GetIntInRange(0, 2))
+	{
+	case 0:		return m_game->SpawnBox(Vector3(s_shapeHalfSize), 1.f, position, Vector3::ZERO, velocity);
+	case 1:		return m_game->SpawnSphere(s_shapeHalfSize, 1.f, position, Vector3::ZERO, velocity);
+	default:	return m_game->SpawnCapsule(s_shapeHalfSize, s_shapeHalfSize, 1.f, position, Vector3::ZERO, velocity);
+	}
+}
@@ -0,0 +1,74 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Spawn and despawn churn through the Game's entity and collider pools, timed headlessly
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include "Game/Framework/ObjectPool.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class Game;
+
+struct EntityPoolBenchmarkSettings
+{
+	int		frameCount = 600;
+	int		maxBodyCount = 5000;			// Live bodies; past this the oldest are despawned to make room
+	int		spawnsPerSecond = 10000;
+	float	deltaSeconds = (1.f / 60.f);
+	int		churnObjectCount = 10000;		// Live objects in the pool vs heap comparison
+	int		churnOperationCount = 1000000;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// First replaces random entities over and over, once through an ObjectPool and once with new/delete, to compare
+// the cost of a spawn and despawn alone. Then runs the stress test: a Game spawning and despawning bodies at
+// spawnsPerSecond while stepping physics, checking that despawned handles go stale and that once the pools have
+// grown to fit, frames stop allocating
+class EntityPoolBenchmark
+{
+public:
+	//-----Public Methods-----
+
+	EntityPoolBenchmark(const EntityPoolBenchmarkSettings& settings);
+
+	bool Run();
+
+
+private:
+	//-----Private Methods-----
+
+	void		RunChurnComparison() const;
+	bool		RunSpawnStress();
+	PoolHandle	SpawnRandomBody(BenchmarkRandom& random);
+
+
+private:
+	//-----Private Data-----
+
+	EntityPoolBenchmarkSettings	m_settings;
+	Game*						m_game = nullptr;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
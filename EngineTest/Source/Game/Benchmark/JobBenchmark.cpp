@@ -0,0 +1,259 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/JobBenchmark.h"
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/Profiler.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Job/Job.h"
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Does nothing, so all we measure is the scheduler
+class EmptyJob : public Job
+{
+public:
+	virtual void Execute() override {}
+	virtual void Finalize() override {}
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Submits its children from inside Execute, the way jobs split up work they're given
+class SpawnChildrenJob : public Job
+{
+public:
+	SpawnChildrenJob(EmptyJob* children, int childCount) : m_children(children), m_childCount(childCount) {}
+
+	virtual void Execute() override;
+	virtual void Finalize() override {}
+
+private:
+	EmptyJob*	m_children = nullptr;
+	int			m_childCount = 0;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Fixed amount of integer busy work, kept in m_result so it can't be optimized out
+class BusyWorkJob : public Job
+{
+public:
+	virtual void Execute() override;
+	virtual void Finalize() override {}
+
+	int			m_iterations = 0;
+	uint32_t	m_result = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void SpawnChildrenJob::Execute()
+{
+	const JobHandle thisJob = JobScheduler::GetCurrentJob();
+
+	for (int childIndex = 0; childIndex < m_childCount; ++childIndex)
+	{
+		g_jobScheduler->Submit(&m_children[childIndex], thisJob);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BusyWorkJob::Execute()
+{
+	uint32_t state = 2463534242u;
+
+	for (int iteration = 0; iteration < m_iterations; ++iteration)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+	}
+
+	m_result = state;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+JobBenchmark::JobBenchmark(const JobBenchmarkSettings& settings)
+	: m_settings(settings)
+{
+	m_settings.jobsPerWait = std::max(m_settings.jobsPerWait, 2);
+	m_settings.repeatCount = std::max(m_settings.repeatCount, 1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Overheads are per job, from submit until the waiting thread sees it complete; the work column is the
+// scaling test's total time, compared against the single thread run
+bool JobBenchmark::Run()
+{
+	const int originalWorkerCount = (g_jobScheduler != nullptr ? g_jobScheduler->GetWorkerCount() : JobScheduler::GetDefaultWorkerCount());
+	const int coreCount = std::max((int)std::thread::hardware_concurrency(), 1);
+	const int maxThreadCount = (m_settings.maxThreadCount > 0 ? m_settings.maxThreadCount : coreCount);
+
+	printf("Job benchmark: %d empty jobs per overhead test (waiting every %d), %d jobs x %d iterations of work, best of %d\n",
+		m_settings.jobCount, m_settings.jobsPerWait, m_settings.workJobCount, m_settings.workIterations, m_settings.repeatCount);
+	printf("Overheads are ns per job, work is ms in total\n");
+
+	double singleThreadWorkSeconds = 0.0;
+
+	for (int threadCount = 1; threadCount <= maxThreadCount; ++threadCount)
+	{
+		JobScheduler::Shutdown();
+		JobScheduler::Initialize(threadCount - 1);
+
+		const double independentSeconds = GetBestSeconds(&JobBenchmark::RunIndependentJobs);
+		const double childSeconds = GetBestSeconds(&JobBenchmark::RunChildJobs);
+		const double chainSeconds = GetBestSeconds(&JobBenchmark::RunContinuationChain);
+		const double workSeconds = GetBestSeconds(&JobBenchmark::RunWorkJobs);
+
+		if (threadCount == 1)
+		{
+			singleThreadWorkSeconds = workSeconds;
+		}
+
+		const double speedup = (workSeconds > 0.0 ? singleThreadWorkSeconds / workSeconds : 0.0);
+		const double nsPerJob = 1e9 / (double)std::max(m_settings.jobCount, 1);
+
+		printf("%3d threads | independent %8.1f | children %8.1f | chain %8.1f | work %9.3f | speedup %5.2fx | efficiency %5.1f%%\n",
+			threadCount, independentSeconds * nsPerJob, childSeconds * nsPerJob, chainSeconds * nsPerJob,
+			workSeconds * 1000.0, speedup, 100.0 * speedup / (double)threadCount);
+	}
+
+	JobScheduler::Shutdown();
+	JobScheduler::Initialize(originalWorkerCount);
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Every job submitted from the waiting thread, nothing depending on anything
+double JobBenchmark::RunIndependentJobs() const
+{
+	std::vector<EmptyJob> jobs(m_settings.jobsPerWait);
+	const double startTime = Profiler::GetSeconds();
+
+	for (int jobsLeft = m_settings.jobCount; jobsLeft > 0; jobsLeft -= m_settings.jobsPerWait)
+	{
+		const int roundJobCount = std::min(jobsLeft, m_settings.jobsPerWait);
+		for (int jobIndex = 0; jobIndex < roundJobCount; ++jobIndex)
+		{
+			g_jobScheduler->Submit(&jobs[jobIndex]);
+		}
+
+		g_jobScheduler->WaitForAll();
+	}
+
+	return Profiler::GetSeconds() - startTime;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// One parent per round submitting the rest as its children, then waiting on the parent
+double JobBenchmark::RunChildJobs() const
+{
+	std::vector<EmptyJob> children(m_settings.jobsPerWait - 1);
+	const double startTime = Profiler::GetSeconds();
+
+	for (int jobsLeft = m_settings.jobCount; jobsLeft > 0; jobsLeft -= m_settings.jobsPerWait)
+	{
+		const int roundJobCount = std::min(jobsLeft, m_settings.jobsPerWait);
+
+		SpawnChildrenJob parentJob(children.data(), roundJobCount - 1);
+		g_jobScheduler->Wait(g_jobScheduler->Submit(&parentJob));
+	}
+
+	return Profiler::GetSeconds() - startTime;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Each job a continuation of the last, so this is the cost of resolving a dependency, with no parallelism at all
+double JobBenchmark::RunContinuationChain() const
+{
+	std::vector<EmptyJob> jobs(m_settings.jobsPerWait);
+	const double startTime = Profiler::GetSeconds();
+
+	for (int jobsLeft = m_settings.jobCount; jobsLeft > 0; jobsLeft -= m_settings.jobsPerWait)
+	{
+		const int roundJobCount = std::min(jobsLeft, m_settings.jobsPerWait);
+
+		JobHandle previousJob = g_jobScheduler->Submit(&jobs[0]);
+		for (int jobIndex = 1; jobIndex < roundJobCount; ++jobIndex)
+		{
+			previousJob = g_jobScheduler->SubmitContinuation(&jobs[jobIndex], previousJob);
+		}
+
+		g_jobScheduler->Wait(previousJob);
+	}
+
+	return Profiler::GetSeconds() - startTime;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+double JobBenchmark::RunWorkJobs() const
+{
+	std::vector<BusyWorkJob> jobs(m_settings.workJobCount);
+	for (BusyWorkJob& job : jobs)
+	{
+		job.m_iterations = m_settings.workIterations;
+	}
+
+	const double startTime = Profiler::GetSeconds();
+
+	for (BusyWorkJob& job : jobs)
+	{
+		g_jobScheduler->Submit(&job);
+	}
+
+	g_jobScheduler->WaitForAll();
+
+	return Profiler::GetSeconds() - startTime;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+double JobBenchmark::GetBestSeconds(double (JobBenchmark::*test)() const) const
+{
+	double bestSeconds = (this->*test)();
+
+	for (int repeatIndex = 1; repeatIndex < m_settings.repeatCount; ++repeatIndex)
+	{
+		bestSeconds = std::min(bestSeconds, (this->*test)());
+	}
+
+	return bestSeconds;
+}
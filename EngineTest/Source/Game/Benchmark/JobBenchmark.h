@@ -0,0 +1,69 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Measures JobScheduler overhead per job and how a fixed amount of work scales with thread count
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct JobBenchmarkSettings
+{
+	int	jobCount = 100000;			// Empty jobs per overhead test
+	int	jobsPerWait = 4096;			// Overhead tests submit this many, then wait, so the scheduler's ring never fills
+	int	workJobCount = 1024;		// Jobs in the scaling test
+	int	workIterations = 20000;		// Busy work per scaling job
+	int	maxThreadCount = 0;			// <= 0 for one per core
+	int	repeatCount = 3;			// Best of this many runs is reported
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Recreates g_jobScheduler with 1 to N threads (the waiting thread plus workers), putting the original back when done
+class JobBenchmark
+{
+public:
+	//-----Public Methods-----
+
+	JobBenchmark(const JobBenchmarkSettings& settings);
+
+	bool Run();		// Only measures, so always succeeds
+
+
+private:
+	//-----Private Methods-----
+
+	double RunIndependentJobs() const;
+	double RunChildJobs() const;
+	double RunContinuationChain() const;
+	double RunWorkJobs() const;
+	double GetBestSeconds(double (JobBenchmark::*test)() const) const;
+
+
+private:
+	//-----Private Data-----
+
+	JobBenchmarkSettings m_settings;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,1095 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/PhysicsBenchmark.h"
+#include "Game/Framework/Game.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Physics/BodyBroadphase.h"
+#include "Game/Physics/BodyEngineConversions.h"
+#include "Game/Physics/BodyScene.h"
+#include "Game/Physics/BodySnapshot.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Core/Entity.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// One way of solving contacts, for RunWarmStartComparison
+struct WarmStartConfig
+{
+	const char*	name;
+	int			velocityIterations;
+	bool		useContactCache;	// Reuse manifolds and warm start from them, otherwise every step starts cold
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const PhysicsBenchmarkScene s_scenes[] =
+{
+	{ "scatter_1k",		PHYSICS_BENCHMARK_SCATTER,	1000 },
+	{ "scatter_10k",	PHYSICS_BENCHMARK_SCATTER,	10000 },
+	{ "scatter_100k",	PHYSICS_BENCHMARK_SCATTER,	100000 },
+	{ "pile_1k",		PHYSICS_BENCHMARK_PILE,		1000 },
+	{ "pile_10k",		PHYSICS_BENCHMARK_PILE,		10000 },
+	{ "pile_100k",		PHYSICS_BENCHMARK_PILE,		100000 },
+	{ "rain_1k",		PHYSICS_BENCHMARK_RAIN,		1000 },
+	{ "rain_10k",		PHYSICS_BENCHMARK_RAIN,		10000 },
+	{ "rain_100k",		PHYSICS_BENCHMARK_RAIN,		100000 },
+	{ "towers_1k",		PHYSICS_BENCHMARK_TOWERS,	1000 },
+	{ "towers_10k",		PHYSICS_BENCHMARK_TOWERS,	10000 },
+	{ "towers_100k",	PHYSICS_BENCHMARK_TOWERS,	100000 }
+};
+
+static const uint32_t	s_sceneSeed = 1337;
+static const float		s_shapeHalfSize = 0.5f;
+static const float		s_gridSpacing = 3.f;
+static const int		s_pileHeight = 10;
+static const int		s_towerHeight = 9;
+static const float		s_towerSpacing = 10.f;
+
+static const float		s_projectileSpeeds[] = { 20.f, 60.f };					// Game::ProcessInput fires at 20
+static const float		s_projectileSteps[] = { (1.f / 60.f), (1.f / 15.f) };
+static const int		s_projectileGridSize = 10;
+static const int		s_projectileTargetCount = 20;
+static const float		s_projectileTargetDistance = 10.f;
+static const float		s_projectileWallHalfThickness = 0.05f;
+static const float		s_projectileRunSeconds = 2.f;
+
+// Rollback is meant for networked sessions, so these are sized for those rather than for stress
+static const PhysicsBenchmarkScene s_rollbackScenes[] =
+{
+	{ "scatter_5k",		PHYSICS_BENCHMARK_SCATTER,	5000 },
+	{ "pile_5k",		PHYSICS_BENCHMARK_PILE,		5000 },
+	{ "rain_5k",		PHYSICS_BENCHMARK_RAIN,		5000 },
+	{ "towers_5k",		PHYSICS_BENCHMARK_TOWERS,	5000 }
+};
+
+static const int		s_rollbackFrameCount = 8;
+static const int		s_rollbackInterval = 10;		// Frames between rollbacks
+static const int		s_rollbackDespawnFrame = 5;		// Into each interval, so every rollback has an entity to respawn
+static const int		s_rollbackWarmupFrames = 60;	// Stepped before the run, so piles have settled into contact
+static const float		s_deltaPositionTolerance = (1.f / 1024.f);	// The delta codec quantizes positions to 1/1024
+
+static const WarmStartConfig s_warmStartConfigs[] =
+{
+	{ "cold x8",	8,	false },
+	{ "cold x4",	4,	false },
+	{ "warm x4",	4,	true },
+	{ "warm x8",	8,	true }
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Returns the position of the cell at index in a square grid centered on the origin
+static Vector3 GetGridPosition(int index, int totalCount, float spacing, float height)
+{
+	const int side = (int)ceilf(sqrtf((float)totalCount));
+	const float offset = -0.5f * (float)(side - 1) * spacing;
+
+	return Vector3(offset + (float)(index % side) * spacing, height, offset + (float)(index / side) * spacing);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static Vector3 GetRandomEulerDegrees(BenchmarkRandom& random)
+{
+	return Vector3(random.GetFloatInRange(0.f, 360.f), random.GetFloatInRange(0.f, 360.f), random.GetFloatInRange(0.f, 360.f));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static double SecondsToMs(double seconds)
+{
+	return 1000.0 * seconds;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+PhysicsBenchmark::PhysicsBenchmark(const PhysicsBenchmarkSettings& settings)
+	: m_settings(settings)
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool PhysicsBenchmark::Run()
+{
+	const bool isSoA = (m_settings.backend == PHYSICS_BENCHMARK_BACKEND_SOA);
+	const std::string backendName = std::string(isSoA ? "soa (" : "game (") + GetBodySimdModeName(m_settings.simdMode) + ", " + GetBodyBroadphaseTypeName(m_settings.broadphaseType) + ")";
+
+	const int workerCount = (g_jobScheduler != nullptr ? g_jobScheduler->GetWorkerCount() : 0);
+
+	printf("Physics benchmark: %s backend, %d frames per scene at %.4fs, max %d bodies, %d worker threads\n", backendName.c_str(), m_settings.frameCount, m_settings.deltaSeconds, m_settings.maxBodyCount, workerCount);
+	printf("All times are ms per frame\n");
+
+	const int sceneCount = (int)(sizeof(s_scenes) / sizeof(s_scenes[0]));
+	for (int sceneIndex = 0; sceneIndex < sceneCount; ++sceneIndex)
+	{
+		const PhysicsBenchmarkScene& scene = s_scenes[sceneIndex];
+
+		if (!ShouldRunScene(scene))
+		{
+			continue;
+		}
+
+		if (isSoA)
+		{
+			RunSoAScene(scene);
+		}
+		else
+		{
+			RunGameScene(scene);
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Steps every scene in a scalar and a SIMD BodyScene side by side, checking they stay within tolerance
+bool PhysicsBenchmark::RunSimdComparison()
+{
+	if (!IsBodySimdModeSupported(BODY_SIMD_SSE))
+	{
+		printf("SIMD comparison: SSE isn't available in this build, nothing to compare\n");
+		return true;
+	}
+
+	printf("SIMD comparison: scalar vs sse, %d frames per scene at %.4fs, max %d bodies, tolerance %g\n", m_settings.frameCount, m_settings.deltaSeconds, m_settings.maxBodyCount, m_settings.simdTolerance);
+	printf("All times are ms per frame\n");
+
+	int failCount = 0;
+	const int sceneCount = (int)(sizeof(s_scenes) / sizeof(s_scenes[0]));
+	for (int sceneIndex = 0; sceneIndex < sceneCount; ++sceneIndex)
+	{
+		const PhysicsBenchmarkScene& scene = s_scenes[sceneIndex];
+
+		if (ShouldRunScene(scene) && !RunSimdComparisonScene(scene))
+		{
+			failCount++;
+		}
+	}
+
+	printf("%s\n", (failCount == 0 ? "All scenes match" : "Some scenes diverged past the tolerance"));
+	return (failCount == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Steps each scene once and runs every broadphase on the same bounds each frame, comparing pair counts and time.
+// sphere_bounds gives the pairs CollisionScene<BoundingVolumeSphere> would, the rest should all agree exactly.
+// Time per body is there to compare across the 1k/10k/100k scenes, to see which broadphases stay close to linear
+bool PhysicsBenchmark::RunBroadphaseComparison()
+{
+	printf("Broadphase comparison: %d frames per scene at %.4fs, max %d bodies\n", m_settings.frameCount, m_settings.deltaSeconds, m_settings.maxBodyCount);
+	printf("All times are ms per frame\n");
+
+	int failCount = 0;
+	const int sceneCount = (int)(sizeof(s_scenes) / sizeof(s_scenes[0]));
+	for (int sceneIndex = 0; sceneIndex < sceneCount; ++sceneIndex)
+	{
+		const PhysicsBenchmarkScene& scene = s_scenes[sceneIndex];
+
+		if (ShouldRunScene(scene) && !RunBroadphaseComparisonScene(scene))
+		{
+			failCount++;
+		}
+	}
+
+	printf("%s\n", (failCount == 0 ? "All AABB broadphases agree" : "Some AABB broadphases found different pairs"));
+	return (failCount == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Runs each scene with and without the contact cache, at the default and half the solver iterations.
+// Bodies that end up more than half a box from where they spawned count as fallen, which only means
+// something for pile and towers, as everything else is meant to move
+bool PhysicsBenchmark::RunWarmStartComparison()
+{
+	printf("Warm start comparison: %d frames per scene at %.4fs, max %d bodies\n", m_settings.frameCount, m_settings.deltaSeconds, m_settings.maxBodyCount);
+	printf("All times are ms per frame\n");
+
+	const int sceneCount = (int)(sizeof(s_scenes) / sizeof(s_scenes[0]));
+	for (int sceneIndex = 0; sceneIndex < sceneCount; ++sceneIndex)
+	{
+		const PhysicsBenchmarkScene& scene = s_scenes[sceneIndex];
+
+		if (ShouldRunScene(scene))
+		{
+			RunWarmStartComparisonScene(scene);
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Fires small shapes at a thin wall and at player sized capsules, with and without continuous collision,
+// at each speed and step size. Anything that ends up behind its target went through it
+bool PhysicsBenchmark::RunContinuousCollisionComparison()
+{
+	printf("Continuous collision comparison: %d projectiles at a %.2f thick wall, %d at capsules, %.1fs per run\n",
+		s_projectileGridSize * s_projectileGridSize, 2.f * s_projectileWallHalfThickness, s_projectileTargetCount, s_projectileRunSeconds);
+	printf("Times are ms per frame\n");
+
+	for (float deltaSeconds : s_projectileSteps)
+	{
+		for (float speed : s_projectileSpeeds)
+		{
+			RunProjectileScene(deltaSeconds, speed, false);
+			RunProjectileScene(deltaSeconds, speed, true);
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Snapshots a Game every frame of each scene, and every few frames rolls back to the snapshot from
+// s_rollbackFrameCount frames ago and steps forward again. The resimulated Game has to hash the same as the
+// snapshot taken the first time through. Each frame's bodies are also sent through the delta codec
+bool PhysicsBenchmark::RunRollbackComparison()
+{
+	printf("Rollback comparison: %d frames per scene at %.4fs, rolling back %d frames every %d, max %d bodies\n",
+		m_settings.frameCount, m_settings.deltaSeconds, s_rollbackFrameCount, s_rollbackInterval, m_settings.maxBodyCount);
+	printf("Times are ms, sizes are KB\n");
+
+	int failCount = 0;
+	const int sceneCount = (int)(sizeof(s_rollbackScenes) / sizeof(s_rollbackScenes[0]));
+	for (int sceneIndex = 0; sceneIndex < sceneCount; ++sceneIndex)
+	{
+		const PhysicsBenchmarkScene& scene = s_rollbackScenes[sceneIndex];
+
+		if (ShouldRunScene(scene) && !RunRollbackScene(scene))
+		{
+			failCount++;
+		}
+	}
+
+	printf("%s\n", (failCount == 0 ? "Every rollback resimulated to the same state, and every delta decoded within tolerance" : "Some rollbacks diverged, or deltas didn't decode"));
+	return (failCount == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool PhysicsBenchmark::ShouldRunScene(const PhysicsBenchmarkScene& scene) const
+{
+	const bool tooManyBodies = (m_settings.maxBodyCount > 0 && scene.bodyCount > m_settings.maxBodyCount);
+	const bool filteredOut = (m_settings.sceneFilter.size() > 0 && std::string(scene.name).find(m_settings.sceneFilter) == std::string::npos);
+
+	return !tooManyBodies && !filteredOut;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Steps the scene the same way Game::StepPhysics does, timing each piece of it. The Game's bodies are
+// built in the same order as the soa backend's, so with the same settings both end on the same hash
+void PhysicsBenchmark::RunGameScene(const PhysicsBenchmarkScene& scene)
+{
+	m_game = new Game();
+	m_game->ResetScene();
+
+	BodyScene* bodyScene = m_game->m_bodyScene;
+	bodyScene->GetSettings().simdMode = m_settings.simdMode;
+	bodyScene->SetBroadphase(m_settings.broadphaseType);
+	bodyScene->GetStore().Reserve(scene.bodyCount);
+
+	m_game->SpawnGround();
+	BuildScene(scene);
+
+	TimingSamples updateSamples;
+	TimingSamples stepSamples;
+	TimingSamples copySamples;
+	TimingSamples frameSamples;
+
+	updateSamples.Reserve(m_settings.frameCount);
+	stepSamples.Reserve(m_settings.frameCount);
+	copySamples.Reserve(m_settings.frameCount);
+	frameSamples.Reserve(m_settings.frameCount);
+
+	for (int frameIndex = 0; frameIndex < m_settings.frameCount; ++frameIndex)
+	{
+		const double startTime = Profiler::GetSeconds();
+
+		for (Entity* entity : m_game->m_entities)
+		{
+			entity->Update(m_settings.deltaSeconds);
+		}
+
+		const double updateEndTime = Profiler::GetSeconds();
+
+		bodyScene->DoPhysicsStep(m_settings.deltaSeconds);
+
+		const double stepEndTime = Profiler::GetSeconds();
+
+		m_game->CopyBodyPosesToEntities();
+
+		const double copyEndTime = Profiler::GetSeconds();
+
+		updateSamples.AddSample(updateEndTime - startTime);
+		stepSamples.AddSample(stepEndTime - updateEndTime);
+		copySamples.AddSample(copyEndTime - stepEndTime);
+		frameSamples.AddSample(copyEndTime - startTime);
+	}
+
+	const uint64_t stateHash = HashBodySceneState(*bodyScene);
+
+	printf("%-14s %7d bodies | update %8.3f | step %8.3f | copy %8.3f | frame %8.3f avg %8.3f p50 %8.3f p95 %8.3f max | total %7.2fs | hash %016llx\n",
+		scene.name, scene.bodyCount,
+		SecondsToMs(updateSamples.GetAverage()), SecondsToMs(stepSamples.GetAverage()), SecondsToMs(copySamples.GetAverage()),
+		SecondsToMs(frameSamples.GetAverage()), SecondsToMs(frameSamples.GetPercentile(50.f)), SecondsToMs(frameSamples.GetPercentile(95.f)), SecondsToMs(frameSamples.GetMax()),
+		frameSamples.GetTotal(), (unsigned long long)stateHash);
+
+	SAFE_DELETE(m_game);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Same scene in a BodyScene, which can report its step per phase along with pair and contact counts
+void PhysicsBenchmark::RunSoAScene(const PhysicsBenchmarkScene& scene)
+{
+	m_bodyScene = CreateSoAScene(scene, m_settings.simdMode);
+
+	TimingSamples integrateSamples;
+	TimingSamples broadphaseSamples;
+	TimingSamples narrowphaseSamples;
+	TimingSamples solveSamples;
+	TimingSamples frameSamples;
+
+	integrateSamples.Reserve(m_settings.frameCount);
+	broadphaseSamples.Reserve(m_settings.frameCount);
+	narrowphaseSamples.Reserve(m_settings.frameCount);
+	solveSamples.Reserve(m_settings.frameCount);
+	frameSamples.Reserve(m_settings.frameCount);
+
+	int64_t totalPairCount = 0;
+	int64_t totalContactCount = 0;
+	int64_t totalIslandCount = 0;
+
+	for (int frameIndex = 0; frameIndex < m_settings.frameCount; ++frameIndex)
+	{
+		const double startTime = Profiler::GetSeconds();
+
+		m_bodyScene->DoPhysicsStep(m_settings.deltaSeconds);
+
+		const double endTime = Profiler::GetSeconds();
+		const BodySceneStats& stats = m_bodyScene->GetLastStepStats();
+
+		integrateSamples.AddSample(stats.integrateSeconds);
+		broadphaseSamples.AddSample(stats.broadphaseSeconds);
+		narrowphaseSamples.AddSample(stats.narrowphaseSeconds);
+		solveSamples.AddSample(stats.solveSeconds);
+		frameSamples.AddSample(endTime - startTime);
+
+		totalPairCount += stats.pairCount;
+		totalContactCount += stats.contactCount;
+		totalIslandCount += stats.islandCount;
+	}
+
+	const uint64_t stateHash = HashBodySceneState(*m_bodyScene);
+	const double frameCount = (double)(m_settings.frameCount > 0 ? m_settings.frameCount : 1);
+
+	printf("%-14s %7d bodies | integrate %8.3f | broad (%s) %8.3f | narrow %8.3f | solve %8.3f | frame %8.3f avg %8.3f p50 %8.3f p95 %8.3f max | %9.1f pairs %9.1f contacts %8.1f islands %7d asleep | total %7.2fs | hash %016llx\n",
+		scene.name, scene.bodyCount,
+		SecondsToMs(integrateSamples.GetAverage()), m_bodyScene->GetBroadphase()->GetName(), SecondsToMs(broadphaseSamples.GetAverage()),
+		SecondsToMs(narrowphaseSamples.GetAverage()), SecondsToMs(solveSamples.GetAverage()),
+		SecondsToMs(frameSamples.GetAverage()), SecondsToMs(frameSamples.GetPercentile(50.f)), SecondsToMs(frameSamples.GetPercentile(95.f)), SecondsToMs(frameSamples.GetMax()),
+		(double)totalPairCount / frameCount, (double)totalContactCount / frameCount, (double)totalIslandCount / frameCount, m_bodyScene->GetLastStepStats().sleepingBodyCount,
+		frameSamples.GetTotal(), (unsigned long long)stateHash);
+
+	SAFE_DELETE(m_bodyScene);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Positions and rotations should agree to within float noise, as both modes run the same operations per body
+bool PhysicsBenchmark::RunSimdComparisonScene(const PhysicsBenchmarkScene& scene)
+{
+	BodyScene* scalarScene = CreateSoAScene(scene, BODY_SIMD_SCALAR);
+	BodyScene* simdScene = CreateSoAScene(scene, BODY_SIMD_SSE);
+
+	TimingSamples scalarSamples;
+	TimingSamples simdSamples;
+	scalarSamples.Reserve(m_settings.frameCount);
+	simdSamples.Reserve(m_settings.frameCount);
+
+	float maxDifference = 0.f;
+	const BodyStore& scalarStore = scalarScene->GetStore();
+	const BodyStore& simdStore = simdScene->GetStore();
+
+	for (int frameIndex = 0; frameIndex < m_settings.frameCount; ++frameIndex)
+	{
+		const double startTime = Profiler::GetSeconds();
+		scalarScene->DoPhysicsStep(m_settings.deltaSeconds);
+		const double scalarEndTime = Profiler::GetSeconds();
+		simdScene->DoPhysicsStep(m_settings.deltaSeconds);
+		const double simdEndTime = Profiler::GetSeconds();
+
+		scalarSamples.AddSample(scalarEndTime - startTime);
+		simdSamples.AddSample(simdEndTime - scalarEndTime);
+
+		for (int bodyIndex = 0; bodyIndex < scalarStore.GetCount(); ++bodyIndex)
+		{
+			const float difference = Length(scalarStore.GetFloat3(bodyIndex, BODY_POSITION_X) - simdStore.GetFloat3(bodyIndex, BODY_POSITION_X));
+			maxDifference = (difference > maxDifference ? difference : maxDifference);
+		}
+	}
+
+	const bool withinTolerance = (maxDifference <= m_settings.simdTolerance);
+	const double simdAverage = simdSamples.GetAverage();
+
+	printf("%-14s %7d bodies | scalar %8.3f | sse %8.3f | speedup %5.2fx | max position difference %g %s\n",
+		scene.name, scene.bodyCount, SecondsToMs(scalarSamples.GetAverage()), SecondsToMs(simdAverage),
+		(simdAverage > 0.0 ? scalarSamples.GetAverage() / simdAverage : 0.0), maxDifference, (withinTolerance ? "ok" : "DIVERGED"));
+
+	SAFE_DELETE(scalarScene);
+	SAFE_DELETE(simdScene);
+
+	return withinTolerance;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The scene steps with its own broadphase; the ones being compared only ever see its bounds, so they can't
+// change the simulation. Pair lists are sorted before hashing, as each broadphase finds them in its own order
+bool PhysicsBenchmark::RunBroadphaseComparisonScene(const PhysicsBenchmarkScene& scene)
+{
+	BodyScene* bodyScene = CreateSoAScene(scene, m_settings.simdMode);
+
+	BodyBroadphase* broadphases[NUM_BODY_BROADPHASE_TYPES];
+	TimingSamples samples[NUM_BODY_BROADPHASE_TYPES];
+	int64_t totalPairCounts[NUM_BODY_BROADPHASE_TYPES] = {};
+	bool pairsMatch[NUM_BODY_BROADPHASE_TYPES];
+
+	for (int typeIndex = 0; typeIndex < NUM_BODY_BROADPHASE_TYPES; ++typeIndex)
+	{
+		broadphases[typeIndex] = CreateBodyBroadphase((BodyBroadphaseType)typeIndex);
+		samples[typeIndex].Reserve(m_settings.frameCount);
+		pairsMatch[typeIndex] = true;
+	}
+
+	std::vector<BodyPair> pairs;
+	for (int frameIndex = 0; frameIndex < m_settings.frameCount; ++frameIndex)
+	{
+		bodyScene->DoPhysicsStep(m_settings.deltaSeconds);
+
+		uint64_t referenceHash = 0;
+		for (int typeIndex = 0; typeIndex < NUM_BODY_BROADPHASE_TYPES; ++typeIndex)
+		{
+			pairs.clear();
+
+			const double startTime = Profiler::GetSeconds();
+			broadphases[typeIndex]->FindPairs(bodyScene->GetStore(), pairs);
+			samples[typeIndex].AddSample(Profiler::GetSeconds() - startTime);
+
+			totalPairCounts[typeIndex] += (int64_t)pairs.size();
+
+			std::sort(pairs.begin(), pairs.end(), [](const BodyPair& a, const BodyPair& b)
+			{
+				return (a.bodyA < b.bodyA) || (a.bodyA == b.bodyA && a.bodyB < b.bodyB);
+			});
+
+			const uint64_t pairHash = HashBytes(pairs.data(), pairs.size() * sizeof(BodyPair));
+			if (typeIndex == BODY_BROADPHASE_SORT_AND_SWEEP)
+			{
+				referenceHash = pairHash;
+			}
+			else if (typeIndex != BODY_BROADPHASE_SPHERE_BOUNDS && pairHash != referenceHash)
+			{
+				pairsMatch[typeIndex] = false;
+			}
+		}
+	}
+
+	const double frameCount = (double)(m_settings.frameCount > 0 ? m_settings.frameCount : 1);
+	const double exactPairCount = (double)totalPairCounts[BODY_BROADPHASE_SORT_AND_SWEEP] / frameCount;
+	bool allMatch = true;
+
+	for (int typeIndex = 0; typeIndex < NUM_BODY_BROADPHASE_TYPES; ++typeIndex)
+	{
+		const double pairCount = (double)totalPairCounts[typeIndex] / frameCount;
+		std::string note;
+
+		if (typeIndex == BODY_BROADPHASE_SPHERE_BOUNDS)
+		{
+			char buffer[64];
+			snprintf(buffer, sizeof(buffer), "%+.1f%% pairs vs AABBs", (exactPairCount > 0.0 ? 100.0 * (pairCount - exactPairCount) / exactPairCount : 0.0));
+			note = buffer;
+		}
+		else
+		{
+			note = (pairsMatch[typeIndex] ? "same pairs" : "DIFFERENT PAIRS");
+			allMatch = allMatch && pairsMatch[typeIndex];
+		}
+
+		printf("%-14s %7d bodies | %-15s | %10.1f pairs | broad %8.3f avg %8.3f p95 %8.3f max | %7.3f us per body | %s\n",
+			scene.name, scene.bodyCount, broadphases[typeIndex]->GetName(), pairCount,
+			SecondsToMs(samples[typeIndex].GetAverage()), SecondsToMs(samples[typeIndex].GetPercentile(95.f)), SecondsToMs(samples[typeIndex].GetMax()),
+			1e6 * samples[typeIndex].GetAverage() / (double)std::max(scene.bodyCount, 1), note.c_str());
+
+		SAFE_DELETE(broadphases[typeIndex]);
+	}
+
+	SAFE_DELETE(bodyScene);
+	return allMatch;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Each config gets a fresh copy of the scene, so they all start from the same spawn positions
+void PhysicsBenchmark::RunWarmStartComparisonScene(const PhysicsBenchmarkScene& scene)
+{
+	const int configCount = (int)(sizeof(s_warmStartConfigs) / sizeof(s_warmStartConfigs[0]));
+	for (int configIndex = 0; configIndex < configCount; ++configIndex)
+	{
+		const WarmStartConfig& config = s_warmStartConfigs[configIndex];
+
+		BodyScene* bodyScene = CreateSoAScene(scene, m_settings.simdMode);
+		bodyScene->GetSettings().solver.velocityIterations = config.velocityIterations;
+		bodyScene->GetSettings().solver.warmStarting = config.useContactCache;
+		bodyScene->GetSettings().contactCache.isEnabled = config.useContactCache;
+
+		const BodyStore& store = bodyScene->GetStore();
+		std::vector<Float3> spawnPositions(store.GetCount());
+		for (int bodyIndex = 0; bodyIndex < store.GetCount(); ++bodyIndex)
+		{
+			spawnPositions[bodyIndex] = store.GetFloat3(bodyIndex, BODY_POSITION_X);
+		}
+
+		TimingSamples narrowphaseSamples;
+		TimingSamples solveSamples;
+		TimingSamples frameSamples;
+		narrowphaseSamples.Reserve(m_settings.frameCount);
+		solveSamples.Reserve(m_settings.frameCount);
+		frameSamples.Reserve(m_settings.frameCount);
+
+		int64_t totalContactCount = 0;
+		int64_t totalReusedManifoldCount = 0;
+		int64_t totalWarmStartedContactCount = 0;
+
+		for (int frameIndex = 0; frameIndex < m_settings.frameCount; ++frameIndex)
+		{
+			const double startTime = Profiler::GetSeconds();
+			bodyScene->DoPhysicsStep(m_settings.deltaSeconds);
+			frameSamples.AddSample(Profiler::GetSeconds() - startTime);
+
+			const BodySceneStats& stats = bodyScene->GetLastStepStats();
+			narrowphaseSamples.AddSample(stats.narrowphaseSeconds);
+			solveSamples.AddSample(stats.solveSeconds);
+
+			totalContactCount += stats.contactCount;
+			totalReusedManifoldCount += stats.reusedManifoldCount;
+			totalWarmStartedContactCount += stats.warmStartedContactCount;
+		}
+
+		int fallenCount = 0;
+		float maxDrift = 0.f;
+		for (int bodyIndex = 0; bodyIndex < store.GetCount(); ++bodyIndex)
+		{
+			const float drift = Length(store.GetFloat3(bodyIndex, BODY_POSITION_X) - spawnPositions[bodyIndex]);
+			fallenCount += (drift > s_shapeHalfSize ? 1 : 0);
+			maxDrift = std::max(maxDrift, drift);
+		}
+
+		const double frameCount = (double)(m_settings.frameCount > 0 ? m_settings.frameCount : 1);
+
+		printf("%-14s %7d bodies | %-7s | narrow %8.3f | solve %8.3f | frame %8.3f | %9.1f contacts %8.1f reused manifolds %9.1f warm started | %7d fallen %7d asleep | max drift %7.3f\n",
+			scene.name, scene.bodyCount, config.name,
+			SecondsToMs(narrowphaseSamples.GetAverage()), SecondsToMs(solveSamples.GetAverage()), SecondsToMs(frameSamples.GetAverage()),
+			(double)totalContactCount / frameCount, (double)totalReusedManifoldCount / frameCount, (double)totalWarmStartedContactCount / frameCount,
+			fallenCount, bodyScene->GetLastStepStats().sleepingBodyCount, maxDrift);
+
+		SAFE_DELETE(bodyScene);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Targets are immovable, and projectiles don't fall, so every one of them is headed straight for its target
+void PhysicsBenchmark::RunProjectileScene(float deltaSeconds, float speed, bool useContinuousCollision)
+{
+	BodyScene* bodyScene = new BodyScene();
+	bodyScene->GetSettings().simdMode = m_settings.simdMode;
+	bodyScene->SetBroadphase(m_settings.broadphaseType);
+	bodyScene->AddPlane(Float3(0.f, 1.f, 0.f), 0.f);
+	bodyScene->AddBox(Float3(10.f, 5.f, s_projectileWallHalfThickness), 0.f, Float3(0.f, 5.f, s_projectileTargetDistance));
+
+	BodyDefinition projectile;
+	projectile.halfExtents = Float3(0.5f * s_shapeHalfSize, 0.5f * s_shapeHalfSize, 0.5f * s_shapeHalfSize);
+	projectile.radius = 0.5f * s_shapeHalfSize;
+	projectile.halfHeight = 0.5f * s_shapeHalfSize;
+	projectile.velocity = Float3(0.f, 0.f, speed);
+	projectile.affectedByGravity = false;
+	projectile.continuousCollision = useContinuousCollision;
+
+	std::vector<BodyHandle> projectiles;
+	for (int projectileIndex = 0; projectileIndex < s_projectileGridSize * s_projectileGridSize; ++projectileIndex)
+	{
+		projectile.shapeType = (BodyShapeType)(projectileIndex % 3);
+		projectile.position = Float3(-8.f + 1.6f * (float)(projectileIndex % s_projectileGridSize), 1.f + 0.8f * (float)(projectileIndex / s_projectileGridSize), 0.f);
+		projectiles.push_back(bodyScene->AddBody(projectile));
+	}
+
+	for (int targetIndex = 0; targetIndex < s_projectileTargetCount; ++targetIndex)
+	{
+		const float x = 20.f + 2.f * (float)targetIndex;
+		bodyScene->AddCapsule(2.f * s_shapeHalfSize, s_shapeHalfSize, 0.f, Float3(x, 1.f, s_projectileTargetDistance), Float3(), Float3(), Float3(), false);
+
+		projectile.shapeType = (BodyShapeType)(targetIndex % 3);
+		projectile.position = Float3(x, 1.f, 0.f);
+		projectiles.push_back(bodyScene->AddBody(projectile));
+	}
+
+	TimingSamples timeOfImpactSamples;
+	TimingSamples frameSamples;
+	int64_t totalSweptCount = 0;
+	int64_t totalHitCount = 0;
+
+	const int frameCount = (int)(s_projectileRunSeconds / deltaSeconds);
+	for (int frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+	{
+		const double startTime = Profiler::GetSeconds();
+		bodyScene->DoPhysicsStep(deltaSeconds);
+		frameSamples.AddSample(Profiler::GetSeconds() - startTime);
+
+		const BodySceneStats& stats = bodyScene->GetLastStepStats();
+		timeOfImpactSamples.AddSample(stats.timeOfImpactSeconds);
+		totalSweptCount += stats.sweptBodyCount;
+		totalHitCount += stats.timeOfImpactCount;
+	}
+
+	int tunneledCount = 0;
+	for (BodyHandle handle : projectiles)
+	{
+		const int index = bodyScene->GetStore().GetIndex(handle);
+		tunneledCount += (bodyScene->GetStore().GetFloat3(index, BODY_POSITION_X).z > s_projectileTargetDistance ? 1 : 0);
+	}
+
+	printf("1/%-3.0f s step | %4.0f m/s | %-10s | %4d/%d tunneled | %7lld swept %5lld hits | toi %8.3f | frame %8.3f\n",
+		1.f / deltaSeconds, speed, (useContinuousCollision ? "continuous" : "discrete"), tunneledCount, (int)projectiles.size(),
+		(long long)totalSweptCount, (long long)totalHitCount, SecondsToMs(timeOfImpactSamples.GetAverage()), SecondsToMs(frameSamples.GetAverage()));
+
+	SAFE_DELETE(bodyScene);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Snapshots are kept in a ring one longer than the rollback, so the one to go back to is always still there.
+// The deltas go to a second BodyScene standing in for the other end of a connection, each encoded against what
+// it decoded the frame before; it has to restore every one, with the same flags and positions within tolerance.
+// Returns false if any rollback diverged or any delta didn't make it across
+bool PhysicsBenchmark::RunRollbackScene(const PhysicsBenchmarkScene& scene)
+{
+	m_game = new Game();
+	m_game->ResetScene();
+	m_game->SetFixedDeltaSeconds(m_settings.deltaSeconds);
+
+	BodyScene* bodyScene = m_game->m_bodyScene;
+	bodyScene->GetSettings().simdMode = m_settings.simdMode;
+	bodyScene->SetBroadphase(m_settings.broadphaseType);
+	bodyScene->GetStore().Reserve(scene.bodyCount);
+
+	m_game->SpawnGround();
+	BuildScene(scene);
+
+	for (int frameIndex = 0; frameIndex < s_rollbackWarmupFrames; ++frameIndex)
+	{
+		m_game->Update();
+	}
+
+	const int ringSize = s_rollbackFrameCount + 1;
+	std::vector<GameSnapshot> snapshots(ringSize);
+	std::vector<uint64_t> snapshotHashes(ringSize, 0);
+	GameSnapshot resimulatedSnapshot;
+
+	BodyScene* receiverScene = new BodyScene();
+	BodySnapshot receivedSnapshot;
+	BodySnapshot decodedSnapshot;
+	BodySnapshotDeltaCodec deltaCodec;
+	std::vector<uint8_t> delta;
+
+	TimingSamples saveSamples;
+	TimingSamples restoreSamples;
+	TimingSamples encodeSamples;
+	TimingSamples decodeSamples;
+	saveSamples.Reserve(m_settings.frameCount);
+	encodeSamples.Reserve(m_settings.frameCount);
+	decodeSamples.Reserve(m_settings.frameCount);
+
+	int64_t totalDeltaSize = 0;
+	int deltaFailCount = 0;
+	float maxDeltaError = 0.f;
+	int rollbackCount = 0;
+	int rollbackFailCount = 0;
+
+	for (int frameIndex = 0; frameIndex < m_settings.frameCount; ++frameIndex)
+	{
+		StepRollbackFrame(frameIndex);
+
+		GameSnapshot& snapshot = snapshots[frameIndex % ringSize];
+		const double saveStartTime = Profiler::GetSeconds();
+		m_game->SaveSnapshot(snapshot);
+		saveSamples.AddSample(Profiler::GetSeconds() - saveStartTime);
+
+		snapshotHashes[frameIndex % ringSize] = HashGameState(snapshot);
+
+		const double encodeStartTime = Profiler::GetSeconds();
+		const bool encoded = deltaCodec.Encode(receivedSnapshot, snapshot.bodies, delta);
+		const double decodeStartTime = Profiler::GetSeconds();
+		const bool decoded = deltaCodec.Decode(receivedSnapshot, delta.data(), delta.size(), decodedSnapshot);
+		const double decodeEndTime = Profiler::GetSeconds();
+
+		encodeSamples.AddSample(decodeStartTime - encodeStartTime);
+		decodeSamples.AddSample(decodeEndTime - decodeStartTime);
+		totalDeltaSize += (int64_t)delta.size();
+
+		bool deltaMatches = (encoded && decoded && receiverScene->RestoreSnapshot(decodedSnapshot));
+		if (deltaMatches)
+		{
+			const float error = GetMaxPositionDifference(*bodyScene, *receiverScene);
+			const BodyStore& store = bodyScene->GetStore();
+			const BodyStore& receiverStore = receiverScene->GetStore();
+
+			deltaMatches = (error <= s_deltaPositionTolerance && memcmp(store.GetFlags(), receiverStore.GetFlags(), store.GetCount()) == 0);
+			maxDeltaError = std::max(maxDeltaError, error);
+		}
+
+		deltaFailCount += (deltaMatches ? 0 : 1);
+		std::swap(receivedSnapshot, decodedSnapshot);
+
+		if (frameIndex >= s_rollbackFrameCount && (frameIndex % s_rollbackInterval) == 0)
+		{
+			const double restoreStartTime = Profiler::GetSeconds();
+			const bool restored = m_game->RestoreSnapshot(snapshots[(frameIndex - s_rollbackFrameCount) % ringSize]);
+			restoreSamples.AddSample(Profiler::GetSeconds() - restoreStartTime);
+
+			for (int resimulatedFrameIndex = frameIndex - s_rollbackFrameCount + 1; resimulatedFrameIndex <= frameIndex; ++resimulatedFrameIndex)
+			{
+				StepRollbackFrame(resimulatedFrameIndex);
+			}
+
+			m_game->SaveSnapshot(resimulatedSnapshot);
+
+			const bool matches = (restored && HashGameState(resimulatedSnapshot) == snapshotHashes[frameIndex % ringSize]);
+			rollbackFailCount += (matches ? 0 : 1);
+			rollbackCount++;
+		}
+	}
+
+	const double deltaCount = (double)(encodeSamples.GetCount() > 0 ? encodeSamples.GetCount() : 1);
+	const double snapshotKb = (double)snapshots[0].bodies.GetSize() / 1024.0;
+	const double averageDeltaKb = (double)totalDeltaSize / deltaCount / 1024.0;
+	const bool passed = (rollbackFailCount == 0 && deltaFailCount == 0);
+
+	printf("%-14s %7d bodies | snapshot %8.1f | save %6.3f avg %6.3f max | restore %6.3f avg %6.3f max | delta %8.1f (%4.1f%%) encode %6.3f decode %6.3f max error %.5f | %3d/%d rollbacks matched %s\n",
+		scene.name, scene.bodyCount, snapshotKb,
+		SecondsToMs(saveSamples.GetAverage()), SecondsToMs(saveSamples.GetMax()), SecondsToMs(restoreSamples.GetAverage()), SecondsToMs(restoreSamples.GetMax()),
+		averageDeltaKb, (snapshotKb > 0.0 ? 100.0 * averageDeltaKb / snapshotKb : 0.0), SecondsToMs(encodeSamples.GetAverage()), SecondsToMs(decodeSamples.GetAverage()), maxDeltaError,
+		rollbackCount - rollbackFailCount, rollbackCount, (deltaFailCount == 0 ? "" : "| DELTA MISMATCH"));
+
+	SAFE_DELETE(receiverScene);
+	SAFE_DELETE(m_game);
+	return passed;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// One frame of RunRollbackScene, the same the first time through as when it's resimulated. Partway through
+// each interval an entity from the middle of the pool is despawned, so restoring has to respawn it and put the
+// pool's order back
+void PhysicsBenchmark::StepRollbackFrame(int frameIndex)
+{
+	if ((frameIndex % s_rollbackInterval) == s_rollbackDespawnFrame && m_game->m_entities.GetCount() > 1)
+	{
+		m_game->DespawnEntity(m_game->m_entities.GetHandleAt(m_game->m_entities.GetCount() / 2));
+	}
+
+	m_game->Update();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyScene* PhysicsBenchmark::CreateSoAScene(const PhysicsBenchmarkScene& scene, BodySimdMode simdMode)
+{
+	BodyScene* bodyScene = new BodyScene();
+	bodyScene->GetSettings().simdMode = simdMode;
+	bodyScene->SetBroadphase(m_settings.broadphaseType);
+	bodyScene->GetStore().Reserve(scene.bodyCount);
+	bodyScene->AddPlane(Float3(0.f, 1.f, 0.f), 0.f);
+
+	m_bodyScene = bodyScene;
+	BuildScene(scene);
+	m_bodyScene = nullptr;
+
+	return bodyScene;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void PhysicsBenchmark::BuildScene(const PhysicsBenchmarkScene& scene)
+{
+	switch (scene.type)
+	{
+	case PHYSICS_BENCHMARK_SCATTER:	BuildScatter(scene.bodyCount);	break;
+	case PHYSICS_BENCHMARK_PILE:	BuildPile(scene.bodyCount);		break;
+	case PHYSICS_BENCHMARK_RAIN:	BuildRain(scene.bodyCount);		break;
+	case PHYSICS_BENCHMARK_TOWERS:	BuildTowers(scene.bodyCount);	break;
+	default:
+		break;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Boxes, spheres and capsules in turn, each dropped from just above the ground with a random orientation
+void PhysicsBenchmark::BuildScatter(int bodyCount)
+{
+	BenchmarkRandom random(s_sceneSeed);
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const Vector3 position = GetGridPosition(bodyIndex, bodyCount, s_gridSpacing, random.GetFloatInRange(1.5f, 3.5f));
+		const Vector3 rotation = GetRandomEulerDegrees(random);
+
+		switch (bodyIndex % 3)
+		{
+		case 0: SpawnBox(Vector3(s_shapeHalfSize), 1.f, position, rotation); break;
+		case 1: SpawnSphere(s_shapeHalfSize, 1.f, position, rotation); break;
+		case 2: SpawnCapsule(s_shapeHalfSize, s_shapeHalfSize, 1.f, position, rotation); break;
+		default:
+			break;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Columns of one shape type each, spawned already touching so the solver has to hold them up from frame one
+void PhysicsBenchmark::BuildPile(int bodyCount)
+{
+	const int columnCount = (bodyCount + s_pileHeight - 1) / s_pileHeight;
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const int columnIndex = bodyIndex / s_pileHeight;
+		const int level = bodyIndex % s_pileHeight;
+		const int shapeType = columnIndex % 3;
+
+		// Capsules stand upright, so they are twice as tall as the other shapes
+		const float shapeHeight = (shapeType == 2 ? 4.f : 2.f) * s_shapeHalfSize;
+		const float height = ((float)level + 0.5f) * shapeHeight + (float)level * 0.01f;
+		const Vector3 position = GetGridPosition(columnIndex, columnCount, s_gridSpacing, height);
+
+		switch (shapeType)
+		{
+		case 0: SpawnBox(Vector3(s_shapeHalfSize), 1.f, position); break;
+		case 1: SpawnSphere(s_shapeHalfSize, 1.f, position); break;
+		case 2: SpawnCapsule(s_shapeHalfSize, s_shapeHalfSize, 1.f, position); break;
+		default:
+			break;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shapes scattered over an area that grows with the body count, falling and spinning
+void PhysicsBenchmark::BuildRain(int bodyCount)
+{
+	BenchmarkRandom random(s_sceneSeed);
+	const float halfArea = sqrtf((float)bodyCount);
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const Vector3 position = Vector3(random.GetFloatInRange(-halfArea, halfArea), random.GetFloatInRange(5.f, 50.f), random.GetFloatInRange(-halfArea, halfArea));
+		const Vector3 rotation = GetRandomEulerDegrees(random);
+		const Vector3 velocity = Vector3(random.GetFloatInRange(-1.f, 1.f), random.GetFloatInRange(-20.f, 0.f), random.GetFloatInRange(-1.f, 1.f));
+		const Vector3 angularVelocity = Vector3(random.GetFloatInRange(-180.f, 180.f), random.GetFloatInRange(-180.f, 180.f), random.GetFloatInRange(-180.f, 180.f));
+
+		switch (bodyIndex % 3)
+		{
+		case 0: SpawnBox(Vector3(s_shapeHalfSize), 1.f, position, rotation, velocity, angularVelocity); break;
+		case 1: SpawnSphere(s_shapeHalfSize, 1.f, position, rotation, velocity, angularVelocity); break;
+		case 2: SpawnCapsule(s_shapeHalfSize, s_shapeHalfSize, 1.f, position, rotation, velocity, angularVelocity); break;
+		default:
+			break;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Same density boxes as SpawnEntities (1/1, 1/8, 1/64 inverse mass), stacked light-on-heavy, heavy-on-light
+// and in a random order, since large mass ratios are what make stacks hard to settle
+void PhysicsBenchmark::BuildTowers(int bodyCount)
+{
+	static const float s_extents[3] = { s_shapeHalfSize, 2.f * s_shapeHalfSize, 4.f * s_shapeHalfSize };
+	static const float s_inverseMasses[3] = { (1.f / 1.f), (1.f / 8.f), (1.f / 64.f) };
+
+	BenchmarkRandom random(s_sceneSeed);
+	const int towerCount = (bodyCount + s_towerHeight - 1) / s_towerHeight;
+
+	int bodiesSpawned = 0;
+	for (int towerIndex = 0; towerIndex < towerCount; ++towerIndex)
+	{
+		float height = 0.f;
+		for (int level = 0; level < s_towerHeight && bodiesSpawned < bodyCount; ++level)
+		{
+			int boxType = 0;
+			switch (towerIndex % 3)
+			{
+			case 0: boxType = (level * 3) / s_towerHeight; break;			// Heaviest on top
+			case 1: boxType = 2 - ((level * 3) / s_towerHeight); break;		// Heaviest on the bottom
+			default: boxType = random.GetIntInRange(0, 2); break;
+			}
+
+			const float extent = s_extents[boxType];
+			const Vector3 position = GetGridPosition(towerIndex, towerCount, s_towerSpacing, height + extent);
+
+			SpawnBox(Vector3(extent), s_inverseMasses[boxType], position);
+
+			height += 2.f * extent + 0.01f;
+			bodiesSpawned++;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void PhysicsBenchmark::SpawnBox(const Vector3& extents, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/)
+{
+	if (m_bodyScene != nullptr)
+	{
+		m_bodyScene->AddBox(ToFloat3(extents), inverseMass, ToFloat3(position), ToFloat3(rotationDegrees), ToFloat3(velocity), ToFloat3(angularVelocityDegrees));
+	}
+	else
+	{
+		m_game->SpawnBox(extents, inverseMass, position, rotationDegrees, velocity, angularVelocityDegrees);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void PhysicsBenchmark::SpawnSphere(float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/)
+{
+	if (m_bodyScene != nullptr)
+	{
+		m_bodyScene->AddSphere(radius, inverseMass, ToFloat3(position), ToFloat3(rotationDegrees), ToFloat3(velocity), ToFloat3(angularVelocityDegrees));
+	}
+	else
+	{
+		m_game->SpawnSphere(radius, inverseMass, position, rotationDegrees, velocity, angularVelocityDegrees);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void PhysicsBenchmark::SpawnCapsule(float cylinderHeight, float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/)
+{
+	if (m_bodyScene != nullptr)
+	{
+		m_bodyScene->AddCapsule(cylinderHeight, radius, inverseMass, ToFloat3(position), ToFloat3(rotationDegrees), ToFloat3(velocity), ToFloat3(angularVelocityDegrees));
+	}
+	else
+	{
+		m_game->SpawnCapsule(cylinderHeight, radius, inverseMass, position, rotationDegrees, velocity, angularVelocityDegrees);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Hashes the position and rotation fields directly, so two runs (or two builds) can be compared for divergence
+uint64_t PhysicsBenchmark::HashBodySceneState(const BodyScene& bodyScene) const
+{
+	static const BodyField s_hashedFields[] =
+	{
+		BODY_POSITION_X, BODY_POSITION_Y, BODY_POSITION_Z,
+		BODY_ROTATION_W, BODY_ROTATION_X, BODY_ROTATION_Y, BODY_ROTATION_Z
+	};
+
+	const BodyStore& store = bodyScene.GetStore();
+	uint64_t hash = BENCHMARK_HASH_SEED;
+
+	for (BodyField field : s_hashedFields)
+	{
+		hash = HashBytes(store.GetField(field), sizeof(float) * store.GetCount(), hash);
+	}
+
+	return hash;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Everything in the snapshot but the collider handles, which respawned entities get new ones of
+uint64_t PhysicsBenchmark::HashGameState(const GameSnapshot& snapshot) const
+{
+	uint64_t hash = HashBytes(snapshot.bodies.GetData(), snapshot.bodies.GetSize());
+	hash = HashBytes(&snapshot.gameSeconds, sizeof(snapshot.gameSeconds), hash);
+	hash = HashBytes(&snapshot.physicsAccumulator, sizeof(snapshot.physicsAccumulator), hash);
+	hash = HashBytes(snapshot.entityLayout.generations.data(), sizeof(uint32_t) * snapshot.entityLayout.generations.size(), hash);
+	hash = HashBytes(snapshot.entityLayout.freeSlots.data(), sizeof(uint32_t) * snapshot.entityLayout.freeSlots.size(), hash);
+	hash = HashBytes(snapshot.entityLayout.objectSlots.data(), sizeof(uint32_t) * snapshot.entityLayout.objectSlots.size(), hash);
+
+	for (const GameSnapshotEntity& entity : snapshot.entities)
+	{
+		const int colliderType = (int)entity.components.colliderType;
+
+		hash = HashBytes(&entity.handle, sizeof(entity.handle), hash);
+		hash = HashBytes(&entity.components.body, sizeof(entity.components.body), hash);
+		hash = HashBytes(&colliderType, sizeof(colliderType), hash);
+		hash = HashBytes(&entity.position, sizeof(entity.position), hash);
+		hash = HashBytes(&entity.rotation, sizeof(entity.rotation), hash);
+	}
+
+	return hash;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Over bodies at the same index in each; the scenes have to hold the same number of bodies
+float PhysicsBenchmark::GetMaxPositionDifference(const BodyScene& bodyScene, const BodyScene& otherScene) const
+{
+	const BodyStore& store = bodyScene.GetStore();
+	const BodyStore& otherStore = otherScene.GetStore();
+	if (store.GetCount() != otherStore.GetCount())
+	{
+		return FLT_MAX;
+	}
+
+	float maxDifference = 0.f;
+	for (int bodyIndex = 0; bodyIndex < store.GetCount(); ++bodyIndex)
+	{
+		maxDifference = std::max(maxDifference, Length(store.GetFloat3(bodyIndex, BODY_POSITION_X) - otherStore.GetFloat3(bodyIndex, BODY_POSITION_X)));
+	}
+
+	return maxDifference;
+}
@@ -0,0 +1,130 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Deterministic physics scenes built through the Game spawn helpers, stepped and timed headlessly
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include "Game/Physics/BodyBroadphase.h"
+#include "Game/Physics/BodySimd.h"
+#include "Engine/Math/Vector3.h"
+#include <string>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodyScene;
+class Game;
+struct GameSnapshot;
+
+enum PhysicsBenchmarkBackend
+{
+	PHYSICS_BENCHMARK_BACKEND_GAME,		// Game entities, their bodies stepped by the Game's BodyScene
+	PHYSICS_BENCHMARK_BACKEND_SOA		// Same scenes in a BodyScene, bodies stored as structure-of-arrays
+};
+
+enum PhysicsBenchmarkSceneType
+{
+	PHYSICS_BENCHMARK_SCATTER,	// Mixed shapes dropped a short distance onto the ground in a grid
+	PHYSICS_BENCHMARK_PILE,		// Columns of stacked shapes resting on each other
+	PHYSICS_BENCHMARK_RAIN,		// Shapes falling from random heights with random spin
+	PHYSICS_BENCHMARK_TOWERS	// Stacks of the 1/1, 1/8 and 1/64 inverse mass boxes in different orders
+};
+
+struct PhysicsBenchmarkScene
+{
+	const char*					name = nullptr;
+	PhysicsBenchmarkSceneType	type = PHYSICS_BENCHMARK_SCATTER;
+	int							bodyCount = 0;
+};
+
+struct PhysicsBenchmarkSettings
+{
+	int			frameCount = 300;
+	int			maxBodyCount = 10000;		// Scenes with more bodies than this are skipped
+	float		deltaSeconds = (1.f / 60.f);
+	std::string	sceneFilter;				// If set, only scenes whose name contains this are run
+
+	PhysicsBenchmarkBackend backend = PHYSICS_BENCHMARK_BACKEND_GAME;
+	BodySimdMode			simdMode = GetBestBodySimdMode();
+	BodyBroadphaseType		broadphaseType = BODY_BROADPHASE_SORT_AND_SWEEP;
+	float					simdTolerance = 1e-3f;					// Max position difference allowed between scalar and SIMD in RunSimdComparison
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+class PhysicsBenchmark
+{
+public:
+	//-----Public Methods-----
+
+	PhysicsBenchmark(const PhysicsBenchmarkSettings& settings);
+
+	// False if a comparison found a mismatch; the ones that only measure always succeed
+	bool Run();
+	bool RunSimdComparison();
+	bool RunBroadphaseComparison();
+	bool RunWarmStartComparison();
+	bool RunContinuousCollisionComparison();
+	bool RunRollbackComparison();
+
+
+private:
+	//-----Private Methods-----
+
+	bool		ShouldRunScene(const PhysicsBenchmarkScene& scene) const;
+	void		RunGameScene(const PhysicsBenchmarkScene& scene);
+	void		RunSoAScene(const PhysicsBenchmarkScene& scene);
+	bool		RunSimdComparisonScene(const PhysicsBenchmarkScene& scene);
+	bool		RunBroadphaseComparisonScene(const PhysicsBenchmarkScene& scene);
+	void		RunWarmStartComparisonScene(const PhysicsBenchmarkScene& scene);
+	void		RunProjectileScene(float deltaSeconds, float speed, bool useContinuousCollision);
+	bool		RunRollbackScene(const PhysicsBenchmarkScene& scene);
+	void		StepRollbackFrame(int frameIndex);
+	BodyScene*	CreateSoAScene(const PhysicsBenchmarkScene& scene, BodySimdMode simdMode);
+	void		BuildScene(const PhysicsBenchmarkScene& scene);
+
+	void		BuildScatter(int bodyCount);
+	void		BuildPile(int bodyCount);
+	void		BuildRain(int bodyCount);
+	void		BuildTowers(int bodyCount);
+
+	// Spawns into whichever backend is being built
+	void		SpawnBox(const Vector3& extents, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO);
+	void		SpawnSphere(float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO);
+	void		SpawnCapsule(float cylinderHeight, float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO);
+
+	uint64_t	HashBodySceneState(const BodyScene& bodyScene) const;
+	uint64_t	HashGameState(const GameSnapshot& snapshot) const;
+	float		GetMaxPositionDifference(const BodyScene& bodyScene, const BodyScene& otherScene) const;
+
+
+private:
+	//-----Private Data-----
+
+	PhysicsBenchmarkSettings	m_settings;
+
+	// Only one of these is set, while a scene is running
+	Game*						m_game = nullptr;
+	BodyScene*					m_bodyScene = nullptr;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,334 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/ResourceBenchmark.h"
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Framework/ResourcePack.h"
+#include "Game/Framework/ResourceStreamer.h"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <unordered_map>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Registers without touching the disk, only the lookups are being measured
+class LookupBenchmarkResource : public StreamedResource
+{
+public:
+	//-----Public Methods-----
+
+	virtual bool Load(const std::string& path) override { return (path.size() > 0); }
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const int s_registerBatchSize = 4096;		// Keeps the load jobs under the JobScheduler's in flight limit
+static const uint32_t s_lookupSeed = 1234;
+static const char s_storedPackPath[] = "resource_pack_benchmark_stored.pack";
+static const char s_compressedPackPath[] = "resource_pack_benchmark_lz4.pack";
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Same shape as the paths the game asks for, and long enough that comparing them isn't free
+static std::string GetBenchmarkResourcePath(int resourceIndex)
+{
+	return "Data/Mesh/Generated/resource_lookup_benchmark_" + std::to_string(resourceIndex) + ".qef";
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Runs lookup(i) for every i in the order, returning the best pass. The returned indices are summed so none
+// of the lookups can be optimized out
+template <typename LookupFunction>
+static double TimeLookups(const std::vector<int>& order, int repeatCount, uint32_t& out_checksum, LookupFunction lookup)
+{
+	double bestSeconds = 1e30;
+
+	for (int repeatIndex = 0; repeatIndex < repeatCount; ++repeatIndex)
+	{
+		uint32_t checksum = 0;
+		const double startTime = Profiler::GetSeconds();
+
+		for (int resourceIndex : order)
+		{
+			checksum += (uint32_t)lookup(resourceIndex);
+		}
+
+		bestSeconds = std::min(bestSeconds, Profiler::GetSeconds() - startTime);
+		out_checksum = checksum;
+	}
+
+	return bestSeconds;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+ResourceBenchmark::ResourceBenchmark(const ResourceBenchmarkSettings& settings)
+	: m_settings(settings)
+{
+	m_settings.resourceCount = std::max(m_settings.resourceCount, 1);
+	m_settings.lookupCount = std::max(m_settings.lookupCount, 1);
+	m_settings.repeatCount = std::max(m_settings.repeatCount, 1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool ResourceBenchmark::Run()
+{
+	std::vector<std::string> paths;
+	std::vector<ResourceId> ids;
+	std::map<std::string, int> indexByPath;
+	std::unordered_map<std::string, int> indexByPathHashed;
+	ResourceRegistry registry;
+
+	for (int resourceIndex = 0; resourceIndex < m_settings.resourceCount; ++resourceIndex)
+	{
+		paths.push_back(GetBenchmarkResourcePath(resourceIndex));
+		ids.push_back(ResourceId(paths.back()));
+		indexByPath[paths.back()] = resourceIndex;
+		indexByPathHashed[paths.back()] = resourceIndex;
+		registry.Add(ids.back(), resourceIndex);
+	}
+
+	ResourceStreamer::Shutdown();
+	ResourceStreamer::Initialize();
+	RegisterResources(paths);
+
+	BenchmarkRandom random(s_lookupSeed);
+	std::vector<int> order(m_settings.lookupCount);
+	uint32_t expectedChecksum = 0;
+
+	for (int& resourceIndex : order)
+	{
+		resourceIndex = random.GetIntInRange(0, m_settings.resourceCount - 1);
+		expectedChecksum += (uint32_t)resourceIndex;
+	}
+
+	printf("Resource lookup benchmark: %d resources, %d random lookups, best of %d\n", m_settings.resourceCount, m_settings.lookupCount, m_settings.repeatCount);
+	printf("Registry at %d of %d slots, %.3f slots read per lookup\n", registry.GetCount(), registry.GetCapacity(), registry.GetAverageProbeCount());
+
+	uint32_t checksum = 0;
+	double seconds = 0.0;
+	bool succeeded = true;
+
+	seconds = TimeLookups(order, m_settings.repeatCount, checksum, [&](int resourceIndex) { return indexByPath.find(paths[resourceIndex])->second; });
+	succeeded = PrintResult("std::map by path", seconds, checksum, expectedChecksum) && succeeded;
+
+	seconds = TimeLookups(order, m_settings.repeatCount, checksum, [&](int resourceIndex) { return indexByPathHashed.find(paths[resourceIndex])->second; });
+	succeeded = PrintResult("std::unordered_map by path", seconds, checksum, expectedChecksum) && succeeded;
+
+	seconds = TimeLookups(order, m_settings.repeatCount, checksum, [&](int resourceIndex) { return registry.Find(ids[resourceIndex]); });
+	succeeded = PrintResult("ResourceRegistry by ResourceId", seconds, checksum, expectedChecksum) && succeeded;
+
+	seconds = TimeLookups(order, m_settings.repeatCount, checksum, [&](int resourceIndex) { return g_resourceStreamer->FindHandle(paths[resourceIndex]).index; });
+	succeeded = PrintResult("streamer by path, hashed per lookup", seconds, checksum, expectedChecksum) && succeeded;
+
+	seconds = TimeLookups(order, m_settings.repeatCount, checksum, [&](int resourceIndex) { return g_resourceStreamer->FindHandle(ids[resourceIndex]).index; });
+	succeeded = PrintResult("streamer by ResourceId", seconds, checksum, expectedChecksum) && succeeded;
+
+	// One call site looking up the same resource every time, the way a render path does each frame
+	const std::string& cachedPath = paths[0];
+	const int cachedIndex = g_resourceStreamer->FindHandle(cachedPath).index;
+	const uint32_t expectedCachedChecksum = (uint32_t)cachedIndex * (uint32_t)m_settings.lookupCount;
+
+	printf("One resource looked up %d times from one call site\n", m_settings.lookupCount);
+
+	seconds = TimeLookups(order, m_settings.repeatCount, checksum, [&](int) { return indexByPath.find(cachedPath)->second; });
+	succeeded = PrintResult("std::map by path", seconds, checksum, expectedCachedChecksum) && succeeded;
+
+	seconds = TimeLookups(order, m_settings.repeatCount, checksum, [&](int) { return g_resourceStreamer->FindHandle(RESOURCE_ID("Data/Mesh/Generated/resource_lookup_benchmark_0.qef")).index; });
+	succeeded = PrintResult("streamer by compile time ResourceId", seconds, checksum, expectedCachedChecksum) && succeeded;
+
+	seconds = TimeLookups(order, m_settings.repeatCount, checksum, [&](int) { return CACHED_RESOURCE_HANDLE(LookupBenchmarkResource, "Data/Mesh/Generated/resource_lookup_benchmark_0.qef").GetHandle().index; });
+	succeeded = PrintResult("CACHED_RESOURCE_HANDLE", seconds, checksum, expectedCachedChecksum) && succeeded;
+
+	ResourceStreamer::Shutdown();
+	ResourceStreamer::Initialize();
+
+	return succeeded;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Cold runs ask the OS to drop the files from its cache first, which works for the loose files and packs
+// written here without needing admin rights; how cold they really get depends on the OS and the drive
+bool ResourceBenchmark::RunPackLoading()
+{
+	std::vector<std::string> loosePaths;
+	if (!ListFilesInDirectory(m_settings.dataDirectory, loosePaths))
+	{
+		printf("Couldn't read the directory %s\n", m_settings.dataDirectory.c_str());
+		return false;
+	}
+
+	ResourcePackSettings packSettings;
+	ResourcePackStats storedStats;
+	ResourcePackStats compressedStats;
+	std::string error;
+
+	packSettings.compress = false;
+	bool packsWritten = WriteResourcePack(m_settings.dataDirectory, s_storedPackPath, packSettings, &storedStats, &error);
+
+	packSettings.compress = true;
+	packsWritten = packsWritten && WriteResourcePack(m_settings.dataDirectory, s_compressedPackPath, packSettings, &compressedStats, &error);
+
+	bool succeeded = packsWritten;
+
+	if (packsWritten)
+	{
+		printf("Pack loading benchmark: %d files, %.1f KB loose, %.1f KB packed, %.1f KB packed with LZ4 (%d of %d compressed), best of %d\n",
+			storedStats.fileCount, (double)storedStats.looseBytes / 1024.0, (double)storedStats.packBytes / 1024.0, (double)compressedStats.packBytes / 1024.0,
+			compressedStats.compressedCount, compressedStats.fileCount, m_settings.repeatCount);
+
+		struct PackLoadConfig
+		{
+			const char* name;
+			const char* packPath;
+		};
+
+		const PackLoadConfig configs[] =
+		{
+			{ "loose files", nullptr },
+			{ "pack", s_storedPackPath },
+			{ "pack, LZ4", s_compressedPackPath }
+		};
+
+		uint32_t expectedChecksum = 0;
+		TimeLoadingAll(loosePaths, nullptr, false, expectedChecksum);
+
+		for (const PackLoadConfig& config : configs)
+		{
+			double bestColdSeconds = 1e30;
+			double bestWarmSeconds = 1e30;
+			bool checksumsMatch = true;
+
+			for (int repeatIndex = 0; repeatIndex < m_settings.repeatCount; ++repeatIndex)
+			{
+				uint32_t checksum = 0;
+				bestColdSeconds = std::min(bestColdSeconds, TimeLoadingAll(loosePaths, config.packPath, true, checksum));
+				checksumsMatch = checksumsMatch && (checksum == expectedChecksum);
+
+				bestWarmSeconds = std::min(bestWarmSeconds, TimeLoadingAll(loosePaths, config.packPath, false, checksum));
+				checksumsMatch = checksumsMatch && (checksum == expectedChecksum);
+			}
+
+			printf("%-12s | cold %9.3f ms | warm %9.3f ms%s\n", config.name, bestColdSeconds * 1000.0, bestWarmSeconds * 1000.0, (checksumsMatch ? "" : " | WRONG RESULTS"));
+			succeeded = checksumsMatch && succeeded;
+		}
+	}
+	else
+	{
+		printf("Couldn't write the packs: %s\n", error.c_str());
+	}
+
+	DeleteFileAtPath(s_storedPackPath);
+	DeleteFileAtPath(s_compressedPackPath);
+
+	return succeeded;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Every file opened and every byte read, the way startup reads the data directory. From a pack that's opening
+// the pack and then each entry through it by path
+double ResourceBenchmark::TimeLoadingAll(const std::vector<std::string>& loosePaths, const char* packPath, bool evictFirst, uint32_t& out_checksum) const
+{
+	if (evictFirst)
+	{
+		for (const std::string& path : loosePaths)
+		{
+			EvictFileFromCache(path.c_str());
+		}
+
+		if (packPath != nullptr)
+		{
+			EvictFileFromCache(packPath);
+		}
+	}
+
+	const double startTime = Profiler::GetSeconds();
+	ResourcePack pack;
+	ResourceFile file;
+	uint32_t checksum = 0;
+
+	const bool isPacked = (packPath != nullptr && pack.Open(packPath));
+	const int fileCount = (isPacked ? pack.GetEntryCount() : (int)loosePaths.size());
+
+	for (int fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+	{
+		const bool opened = (isPacked ? file.OpenFromPack(pack, pack.GetEntryPath(pack.GetEntry(fileIndex))) : file.OpenLoose(loosePaths[fileIndex].c_str()));
+		if (!opened)
+		{
+			continue;
+		}
+
+		const uint8_t* data = file.GetData();
+		for (size_t byteIndex = 0; byteIndex < file.GetSize(); ++byteIndex)
+		{
+			checksum += data[byteIndex];
+		}
+
+		file.Close();
+	}
+
+	out_checksum = checksum;
+	return Profiler::GetSeconds() - startTime;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Entry indices end up matching the path indices, so every lookup method should return the same thing
+void ResourceBenchmark::RegisterResources(const std::vector<std::string>& paths) const
+{
+	const double startTime = Profiler::GetSeconds();
+
+	for (int resourceIndex = 0; resourceIndex < (int)paths.size(); ++resourceIndex)
+	{
+		g_resourceStreamer->RequestLoad<LookupBenchmarkResource>(paths[resourceIndex]);
+
+		if ((resourceIndex + 1) % s_registerBatchSize == 0)
+		{
+			g_resourceStreamer->FinishAllLoads();
+		}
+	}
+
+	g_resourceStreamer->FinishAllLoads();
+
+	printf("Registered %d resources in %.3f ms\n", (int)paths.size(), (Profiler::GetSeconds() - startTime) * 1000.0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns whether the lookups found what they should have
+bool ResourceBenchmark::PrintResult(const char* name, double bestSeconds, uint32_t checksum, uint32_t expectedChecksum) const
+{
+	const double nanosecondsPerLookup = (bestSeconds * 1e9) / (double)m_settings.lookupCount;
+	const bool isCorrect = (checksum == expectedChecksum);
+
+	printf("%-40s | %9.3f ms | %7.2f ns/lookup%s\n", name, bestSeconds * 1000.0, nanosecondsPerLookup, (isCorrect ? "" : " | WRONG RESULTS"));
+	return isCorrect;
+}
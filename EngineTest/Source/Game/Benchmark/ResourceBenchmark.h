@@ -0,0 +1,72 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Measures looking resources up by path string against looking them up by ResourceId and cached handle
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct ResourceBenchmarkSettings
+{
+	int			resourceCount = 10000;
+	int			lookupCount = 1000000;			// Spread randomly over all the resources
+	int			repeatCount = 5;				// Best of this many passes is reported
+	std::string	dataDirectory = "Data";			// What gets packed for the pack loading benchmark
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Run registers resourceCount resources (with loads that do nothing) in a fresh g_resourceStreamer, alongside
+// the string keyed maps a path lookup would use, then times the same random lookups through each.
+// RunPackLoading packs the data directory and times reading all of it loose against reading it from the pack.
+// Both return false if anything came back with the wrong results, or couldn't be set up
+class ResourceBenchmark
+{
+public:
+	//-----Public Methods-----
+
+	ResourceBenchmark(const ResourceBenchmarkSettings& settings);
+
+	bool Run();
+	bool RunPackLoading();
+
+
+private:
+	//-----Private Methods-----
+
+	void RegisterResources(const std::vector<std::string>& paths) const;
+	bool PrintResult(const char* name, double bestSeconds, uint32_t checksum, uint32_t expectedChecksum) const;
+	double TimeLoadingAll(const std::vector<std::string>& loosePaths, const char* packPath, bool evictFirst, uint32_t& out_checksum) const;
+
+
+private:
+	//-----Private Data-----
+
+	ResourceBenchmarkSettings m_settings;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
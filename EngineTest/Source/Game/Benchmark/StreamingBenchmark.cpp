@@ -0,0 +1,179 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/StreamingBenchmark.h"
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include "Game/Benchmark/VoxelBenchmark.h"
+#include "Game/Framework/MappedFile.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Framework/ResourceStreamer.h"
+#include "Game/Framework/StreamedResources.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char s_modelPathPrefix[] = "streaming_benchmark_";
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+StreamingBenchmark::StreamingBenchmark(const StreamingBenchmarkSettings& settings)
+	: m_settings(settings)
+{
+	m_settings.modelCount = std::max(m_settings.modelCount, 1);
+	m_settings.maxFrames = std::max(m_settings.maxFrames, 1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool StreamingBenchmark::Run()
+{
+	std::vector<std::string> paths;
+
+	for (int modelIndex = 0; modelIndex < m_settings.modelCount; ++modelIndex)
+	{
+		const std::string path = s_modelPathPrefix + std::to_string(modelIndex) + ".qef";
+		if (!WriteVoxelTerrainQef(path, m_settings.modelSize, (uint32_t)(modelIndex + 1)))
+		{
+			printf("Couldn't write %s\n", path.c_str());
+			break;
+		}
+
+		paths.push_back(path);
+	}
+
+	printf("Streaming benchmark: %d voxel meshes of %d^3, %d worker threads, %.2f ms frames\n",
+		(int)paths.size(), m_settings.modelSize, g_jobScheduler->GetWorkerCount(), m_settings.frameSeconds * 1000.f);
+
+	bool succeeded = ((int)paths.size() == m_settings.modelCount);
+	if (succeeded)
+	{
+		succeeded = RunBlocking(paths) && succeeded;
+		succeeded = RunStreamed(paths) && succeeded;
+	}
+
+	for (const std::string& path : paths)
+	{
+		DeleteFileAtPath(path.c_str());
+	}
+
+	return succeeded;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Everything loaded in one frame on the main thread, the way CreateOrGetMesh loads
+bool StreamingBenchmark::RunBlocking(const std::vector<std::string>& paths) const
+{
+	const double startTime = Profiler::GetSeconds();
+	int quadCount = 0;
+	int loadedCount = 0;
+
+	for (const std::string& path : paths)
+	{
+		StreamedVoxelMesh mesh;
+		if (mesh.Load(path) && mesh.Finalize())
+		{
+			quadCount += mesh.GetMeshData().GetQuadCount();
+			loadedCount++;
+		}
+	}
+
+	const double hitchSeconds = Profiler::GetSeconds() - startTime;
+	printf("blocking | 1 frame, %9.3f ms on the main thread | %d quads, %d of %d loaded\n", hitchSeconds * 1000.0, quadCount, loadedCount, (int)paths.size());
+
+	return (loadedCount == (int)paths.size());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Everything requested on the first frame, then FinalizeLoads once a frame until it's all in.
+// Main thread time is the request and finalize cost, the rest of each frame is slept away
+bool StreamingBenchmark::RunStreamed(const std::vector<std::string>& paths) const
+{
+	ResourceStreamer::Shutdown();
+	ResourceStreamer::Initialize();
+
+	std::vector<ResourceHandle<StreamedVoxelMesh>> handles;
+	double worstMainSeconds = 0.0;
+	double totalMainSeconds = 0.0;
+	int frameCount = 0;
+	const double startTime = Profiler::GetSeconds();
+
+	for (; frameCount < m_settings.maxFrames; ++frameCount)
+	{
+		const double frameStartTime = Profiler::GetSeconds();
+
+		if (frameCount == 0)
+		{
+			for (const std::string& path : paths)
+			{
+				handles.push_back(g_resourceStreamer->RequestLoad<StreamedVoxelMesh>(path));
+			}
+		}
+
+		g_resourceStreamer->FinalizeLoads();
+
+		const double mainSeconds = Profiler::GetSeconds() - frameStartTime;
+		worstMainSeconds = std::max(worstMainSeconds, mainSeconds);
+		totalMainSeconds += mainSeconds;
+
+		if (g_resourceStreamer->GetPendingCount() == 0)
+		{
+			frameCount++;
+			break;
+		}
+
+		const double sleepSeconds = (double)m_settings.frameSeconds - (Profiler::GetSeconds() - frameStartTime);
+		if (sleepSeconds > 0.0)
+		{
+			std::this_thread::sleep_for(std::chrono::duration<double>(sleepSeconds));
+		}
+	}
+
+	const double totalSeconds = Profiler::GetSeconds() - startTime;
+	int quadCount = 0;
+	int readyCount = 0;
+
+	for (ResourceHandle<StreamedVoxelMesh> handle : handles)
+	{
+		StreamedVoxelMesh* mesh = g_resourceStreamer->Get(handle);
+		if (mesh != nullptr)
+		{
+			quadCount += mesh->GetMeshData().GetQuadCount();
+			readyCount++;
+		}
+	}
+
+	printf("streamed | %d frames, %9.3f ms worst on the main thread, %9.3f ms in total, %9.3f ms until all ready | %d quads, %d of %d ready\n",
+		frameCount, worstMainSeconds * 1000.0, totalMainSeconds * 1000.0, totalSeconds * 1000.0, quadCount, readyCount, (int)handles.size());
+
+	ResourceStreamer::Shutdown();
+	ResourceStreamer::Initialize();
+
+	return (readyCount == (int)handles.size());
+}
@@ -0,0 +1,66 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Measures the frame hitch of loading voxel meshes on the main thread against streaming them in
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct StreamingBenchmarkSettings
+{
+	int		modelCount = 8;						// Generated terrains, all requested on the same frame
+	int		modelSize = 96;
+	float	frameSeconds = (1.f / 60.f);		// Streamed frames are padded out to this, standing in for the rest of the frame
+	int		maxFrames = 1000;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Recreates g_resourceStreamer for each run so nothing is cached from the last one, putting a fresh one back when done
+class StreamingBenchmark
+{
+public:
+	//-----Public Methods-----
+
+	StreamingBenchmark(const StreamingBenchmarkSettings& settings);
+
+	bool Run();		// False if a mesh couldn't be written or didn't load
+
+
+private:
+	//-----Private Methods-----
+
+	bool RunBlocking(const std::vector<std::string>& paths) const;
+	bool RunStreamed(const std::vector<std::string>& paths) const;
+
+
+private:
+	//-----Private Data-----
+
+	StreamingBenchmarkSettings m_settings;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,218 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/TextureBenchmark.h"
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include "Game/Cook/PngDecoder.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/MappedFile.h"
+#include "Game/Framework/Profiler.h"
+#include <algorithm>
+#include <cstdio>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct TextureImportConfig
+{
+	const char*	name;
+	bool		parallel;
+	bool		allowSimd;
+	MipFilter	mipFilter;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// The scalar serial config of each filter comes first, as the reference the others are checked against
+static const TextureImportConfig s_importConfigs[] =
+{
+	{ "serial, scalar box",		false,	false,	MIP_FILTER_BOX },
+	{ "serial, SIMD box",		false,	true,	MIP_FILTER_BOX },
+	{ "parallel, SIMD box",		true,	true,	MIP_FILTER_BOX },
+	{ "serial, scalar kaiser",	false,	false,	MIP_FILTER_KAISER },
+	{ "parallel, SIMD kaiser",	true,	true,	MIP_FILTER_KAISER }
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+TextureBenchmark::TextureBenchmark(const TextureBenchmarkSettings& settings)
+	: m_settings(settings)
+{
+	m_settings.repeatCount = std::max(m_settings.repeatCount, 1);
+
+	if (m_settings.dataDirectory.size() > 0 && m_settings.dataDirectory.back() != '/' && m_settings.dataDirectory.back() != '\\')
+	{
+		m_settings.dataDirectory += '/';
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool TextureBenchmark::Run()
+{
+	const std::string imageDirectory = m_settings.dataDirectory + "Image/";
+
+	std::vector<std::string> skyboxPaths;
+	for (int faceIndex = 0; faceIndex < TEXTURE_IMPORT_MAX_FACES; ++faceIndex)
+	{
+		skyboxPaths.push_back(imageDirectory + "Skybox/" + std::to_string(faceIndex) + ".png");
+	}
+
+	printf("Texture import benchmark: %d worker threads, best of %d\n", (g_jobScheduler != nullptr ? g_jobScheduler->GetWorkerCount() : 0), m_settings.repeatCount);
+
+	bool succeeded = RunImports("Skybox, 6 faces", skyboxPaths);
+	succeeded = RunImports("debug.png", std::vector<std::string>(1, imageDirectory + "debug.png")) && succeeded;
+	succeeded = RunMipChains(skyboxPaths[0]) && succeeded;
+
+	return succeeded;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool TextureBenchmark::RunImports(const char* name, const std::vector<std::string>& facePaths) const
+{
+	TextureImporter importer;
+	TextureImportSettings importSettings;
+	std::string error;
+
+	if (!importer.Import(facePaths, importSettings, &error))
+	{
+		printf("%s: couldn't import, %s\n", name, error.c_str());
+		return false;
+	}
+
+	printf("%s: %dx%d, %d mips\n", name, importer.GetWidth(), importer.GetHeight(), importer.GetMipCount());
+
+	uint64_t expectedHash = 0;
+	bool hashesMatch = true;
+
+	for (const TextureImportConfig& config : s_importConfigs)
+	{
+		importSettings.parallel = config.parallel;
+		importSettings.allowSimd = config.allowSimd;
+		importSettings.mipFilter = config.mipFilter;
+
+		// Fresh for each config, so the first import's allocations are included in the result
+		TextureImporter configImporter;
+		double bestSeconds = 1e30;
+		uint64_t hash = 0;
+
+		for (int repeatIndex = 0; repeatIndex < m_settings.repeatCount; ++repeatIndex)
+		{
+			bestSeconds = std::min(bestSeconds, TimeImport(configImporter, facePaths, importSettings, hash));
+		}
+
+		if (!config.parallel && !config.allowSimd)
+		{
+			expectedHash = hash;
+		}
+
+		hashesMatch = hashesMatch && (hash == expectedHash);
+
+		const LinearArena& arena = configImporter.GetArena();
+		printf("  %-22s | %9.3f ms | arena %7.1f KB in %d block%s%s\n", config.name, bestSeconds * 1000.0, (double)arena.GetCapacity() / 1024.0,
+			arena.GetBlockCount(), (arena.GetBlockCount() == 1 ? "" : "s"), (hash == expectedHash ? "" : " | WRONG RESULTS"));
+	}
+
+	return hashesMatch;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Decoded once, then only the levels below 0 are timed
+bool TextureBenchmark::RunMipChains(const std::string& facePath) const
+{
+	MappedFile file;
+	DecodedImage image;
+
+	if (!file.Open(facePath.c_str()) || !DecodePng(file.GetData(), file.GetSize(), image))
+	{
+		printf("Mip chains: couldn't decode %s\n", facePath.c_str());
+		return false;
+	}
+
+	const int mipCount = GetMipCount(image.width, image.height);
+	std::vector<uint8_t> chain(GetMipChainSize(image.width, image.height, mipCount));
+	std::copy(image.texels.begin(), image.texels.end(), chain.begin());
+
+	printf("Mip chains of one %dx%d face:\n", image.width, image.height);
+	bool hashesMatch = true;
+
+	for (int filterIndex = 0; filterIndex < NUM_MIP_FILTERS; ++filterIndex)
+	{
+		uint64_t expectedHash = 0;
+
+		for (int simdIndex = 0; simdIndex < 2; ++simdIndex)
+		{
+			const bool allowSimd = (simdIndex == 1);
+			double bestSeconds = 1e30;
+
+			for (int repeatIndex = 0; repeatIndex < m_settings.repeatCount; ++repeatIndex)
+			{
+				const double startTime = Profiler::GetSeconds();
+				uint8_t* above = chain.data();
+
+				for (int mipLevel = 1; mipLevel < mipCount; ++mipLevel)
+				{
+					uint8_t* level = above + (size_t)GetMipDimension(image.width, mipLevel - 1) * GetMipDimension(image.height, mipLevel - 1) * 4;
+					GenerateMip(above, GetMipDimension(image.width, mipLevel - 1), GetMipDimension(image.height, mipLevel - 1), level, (MipFilter)filterIndex, allowSimd);
+					above = level;
+				}
+
+				bestSeconds = std::min(bestSeconds, Profiler::GetSeconds() - startTime);
+			}
+
+			const uint64_t hash = HashBytes(chain.data(), chain.size());
+			expectedHash = (allowSimd ? expectedHash : hash);
+			hashesMatch = hashesMatch && (hash == expectedHash);
+
+			printf("  %-6s %-6s | %9.3f ms%s\n", GetMipFilterName((MipFilter)filterIndex), (allowSimd ? "SIMD" : "scalar"), bestSeconds * 1000.0, (hash == expectedHash ? "" : " | WRONG RESULTS"));
+		}
+	}
+
+	return hashesMatch;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+double TextureBenchmark::TimeImport(TextureImporter& importer, const std::vector<std::string>& facePaths, const TextureImportSettings& importSettings, uint64_t& out_hash) const
+{
+	const double startTime = Profiler::GetSeconds();
+	const bool imported = importer.Import(facePaths, importSettings);
+	const double seconds = Profiler::GetSeconds() - startTime;
+
+	out_hash = 0;
+	if (imported)
+	{
+		out_hash = BENCHMARK_HASH_SEED;
+		for (int faceIndex = 0; faceIndex < importer.GetFaceCount(); ++faceIndex)
+		{
+			for (int mipLevel = 0; mipLevel < importer.GetMipCount(); ++mipLevel)
+			{
+				out_hash = HashBytes(importer.GetMipTexels(faceIndex, mipLevel), importer.GetMipSize(mipLevel), out_hash);
+			}
+		}
+	}
+
+	return seconds;
+}
@@ -0,0 +1,68 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Times decoding and mipping the skybox faces and debug.png, serial and scalar against parallel and SIMD
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Cook/TextureImporter.h"
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct TextureBenchmarkSettings
+{
+	int			repeatCount = 5;				// Best of this many imports is reported
+	std::string	dataDirectory = "Data";
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Imports each texture with one importer per configuration, so every repeat after the first reuses its staging
+// arena. Results are hashed and checked against the scalar import with the same filter. Then times the mip
+// chain alone for one skybox face with each filter, to separate it from the decode
+class TextureBenchmark
+{
+public:
+	//-----Public Methods-----
+
+	TextureBenchmark(const TextureBenchmarkSettings& settings);
+
+	bool Run();		// False if an image couldn't be read, or a faster path's results didn't match the scalar one's
+
+
+private:
+	//-----Private Methods-----
+
+	bool		RunImports(const char* name, const std::vector<std::string>& facePaths) const;
+	bool		RunMipChains(const std::string& facePath) const;
+	double		TimeImport(TextureImporter& importer, const std::vector<std::string>& facePaths, const TextureImportSettings& importSettings, uint64_t& out_hash) const;
+
+
+private:
+	//-----Private Data-----
+
+	TextureBenchmarkSettings m_settings;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,340 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Benchmark/VoxelBenchmark.h"
+#include "Game/Benchmark/BenchmarkCommon.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Voxel/VoxelMesher.h"
+#include "Game/Voxel/VoxelModel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct VoxelMeshConfig
+{
+	const char*		name;
+	VoxelMeshMode	mode;
+	bool			useSimd;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char*		s_shippedModelNames[] = { "andrew", "andrew_2", "test" };
+static const char		s_generatedQefPath[] = "voxel_benchmark_terrain.qef";
+static const char		s_scratchCookedPath[] = "voxel_benchmark_scratch.voxl";
+static const int		s_terrainPaletteCount = 8;
+static const uint32_t	s_generatedSeed = 1234;
+
+// Exposed faces has to run first, the others are compared against it
+static const VoxelMeshConfig s_meshConfigs[] =
+{
+	{ "exposed_faces",			VOXEL_MESH_EXPOSED_FACES,	true },
+	{ "all_faces",				VOXEL_MESH_ALL_FACES,		false },
+	{ "greedy (scalar cull)",	VOXEL_MESH_GREEDY,			false },
+	{ "greedy (sse cull)",		VOXEL_MESH_GREEDY,			true }
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Reads every color and face mask byte, which is what a mesher would do, so the mapped pages actually get touched
+static uint32_t TouchVoxelData(const VoxelModel& model)
+{
+	const uint8_t* colors = model.GetColorIndices();
+	const uint8_t* faceMasks = model.GetFaceMasks();
+	uint32_t sum = 0;
+
+	for (int solidIndex = 0; solidIndex < model.GetSolidCount(); ++solidIndex)
+	{
+		sum += colors[solidIndex] + faceMasks[solidIndex];
+	}
+
+	return sum;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static double ToKilobytes(size_t byteCount)
+{
+	return (double)byteCount / 1024.0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Rolling hills filling roughly the bottom half of a cube, colored in bands by height. The same seed gives the
+// same model on every platform
+bool WriteVoxelTerrainQef(const std::string& qefPath, int size, uint32_t seed)
+{
+	std::ofstream file(qefPath.c_str(), std::ios::out | std::ios::trunc);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	BenchmarkRandom random(seed);
+
+	file << "Qubicle Exchange Format\nVersion 0.2\nwww.minddesk.com\n";
+	file << size << " " << size << " " << size << "\n" << s_terrainPaletteCount << "\n";
+
+	for (int paletteIndex = 0; paletteIndex < s_terrainPaletteCount; ++paletteIndex)
+	{
+		file << random.GetFloatInRange(0.f, 1.f) << " " << random.GetFloatInRange(0.f, 1.f) << " " << random.GetFloatInRange(0.f, 1.f) << "\n";
+	}
+
+	std::string line;
+	char lineBuffer[64];
+
+	for (int z = 0; z < size; ++z)
+	{
+		for (int x = 0; x < size; ++x)
+		{
+			const float hills = std::sin((float)x * 0.11f) * std::cos((float)z * 0.07f) + 0.5f * std::sin((float)(x + z) * 0.23f);
+			const int columnHeight = std::min(std::max((int)((float)size * (0.45f + 0.15f * hills)) + random.GetIntInRange(-1, 1), 1), size);
+
+			for (int y = 0; y < columnHeight; ++y)
+			{
+				const int colorIndex = std::min((y * s_terrainPaletteCount) / size + (y == columnHeight - 1 ? 1 : 0), s_terrainPaletteCount - 1);
+				snprintf(lineBuffer, sizeof(lineBuffer), "%d %d %d %d 0\n", x, y, z, colorIndex);
+				line += lineBuffer;
+			}
+
+			file << line;
+			line.clear();
+		}
+	}
+
+	return file.good();
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+VoxelBenchmark::VoxelBenchmark(const VoxelBenchmarkSettings& settings)
+	: m_settings(settings)
+{
+	m_settings.repeatCount = std::max(m_settings.repeatCount, 1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Cooks each model to a scratch file, then times loading it both ways. Load times include reading every voxel
+// once, so the cooked column pays for its page faults. Heap is what the model holds once loaded, peak is the
+// most it held while loading
+bool VoxelBenchmark::Run()
+{
+	printf("Voxel load benchmark: best of %d, times in ms, sizes in KB\n", m_settings.repeatCount);
+
+	std::vector<VoxelBenchmarkModel> models;
+	bool succeeded = GetModels(models);
+
+	for (const VoxelBenchmarkModel& model : models)
+	{
+		succeeded = RunLoadModel(model) && succeeded;
+	}
+
+	DeleteGeneratedModel();
+	return succeeded;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Build times are the best of the repeats, with the mesher's scratch already sized by the first
+bool VoxelBenchmark::RunMeshing()
+{
+	printf("Voxel mesh benchmark: best of %d, times in ms, fewer is against exposed faces\n", m_settings.repeatCount);
+
+	std::vector<VoxelBenchmarkModel> models;
+	bool succeeded = GetModels(models);
+
+	for (const VoxelBenchmarkModel& model : models)
+	{
+		succeeded = RunMeshModel(model) && succeeded;
+	}
+
+	DeleteGeneratedModel();
+	return succeeded;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes the generated model if it could be written, returning false if it couldn't
+bool VoxelBenchmark::GetModels(std::vector<VoxelBenchmarkModel>& out_models) const
+{
+	out_models.clear();
+
+	for (const char* modelName : s_shippedModelNames)
+	{
+		VoxelBenchmarkModel model;
+		model.name = modelName;
+		model.qefPath = m_settings.meshDirectory + modelName + ".qef";
+		out_models.push_back(model);
+	}
+
+	if (m_settings.generatedSize > 0)
+	{
+		if (WriteVoxelTerrainQef(s_generatedQefPath, m_settings.generatedSize, s_generatedSeed))
+		{
+			char name[32];
+			snprintf(name, sizeof(name), "terrain_%d", m_settings.generatedSize);
+
+			VoxelBenchmarkModel model;
+			model.name = name;
+			model.qefPath = s_generatedQefPath;
+			out_models.push_back(model);
+		}
+		else
+		{
+			printf("Couldn't write %s\n", s_generatedQefPath);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void VoxelBenchmark::DeleteGeneratedModel() const
+{
+	DeleteFileAtPath(s_generatedQefPath);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool VoxelBenchmark::RunLoadModel(const VoxelBenchmarkModel& model) const
+{
+	const std::string& name = model.name;
+	const std::string& qefPath = model.qefPath;
+	FileInfo qefInfo;
+	std::string error;
+
+	if (!GetFileInfo(qefPath.c_str(), qefInfo) || !CookVoxelModel(qefPath, s_scratchCookedPath, &error))
+	{
+		printf("%-14s | skipped, %s\n", name.c_str(), (error.size() > 0 ? error.c_str() : "file not found"));
+		return false;
+	}
+
+	double bestQefSeconds = 1e30;
+	double bestCookedSeconds = 1e30;
+	uint32_t qefSum = 0;
+	uint32_t cookedSum = 0;
+	size_t qefHeapSize = 0;
+	size_t qefPeakSize = 0;
+	size_t cookedHeapSize = 0;
+	size_t imageSize = 0;
+	bool imagesMatch = true;
+
+	VoxelModel qefModel;
+	VoxelModel cookedModel;
+
+	for (int repeatIndex = 0; repeatIndex < m_settings.repeatCount; ++repeatIndex)
+	{
+		double startTime = Profiler::GetSeconds();
+		qefModel.LoadQef(qefPath);
+		qefSum = TouchVoxelData(qefModel);
+		bestQefSeconds = std::min(bestQefSeconds, Profiler::GetSeconds() - startTime);
+
+		qefHeapSize = qefModel.GetHeapSize();
+		qefPeakSize = qefModel.GetPeakLoadHeapSize();
+
+		startTime = Profiler::GetSeconds();
+		cookedModel.LoadCooked(s_scratchCookedPath);
+		cookedSum = TouchVoxelData(cookedModel);
+		bestCookedSeconds = std::min(bestCookedSeconds, Profiler::GetSeconds() - startTime);
+
+		cookedHeapSize = cookedModel.GetHeapSize();
+		imageSize = cookedModel.GetImageSize();
+
+		// Source size and time in the header can't differ, both came from the same .qef
+		imagesMatch = imagesMatch && qefModel.IsLoaded() && cookedModel.IsMapped() && qefSum == cookedSum
+			&& qefModel.GetImageSize() == imageSize && memcmp(qefModel.GetPalette(), cookedModel.GetPalette(), imageSize - sizeof(VoxelFileHeader)) == 0;
+
+		qefModel.Clear();
+		cookedModel.Clear();
+	}
+
+	DeleteFileAtPath(s_scratchCookedPath);
+
+	printf("%-14s | qef %9.1f KB: %9.3f ms, heap %9.1f, peak %9.1f | cooked %8.1f KB: %8.3f ms, heap %5.1f | %6.1fx faster | %s\n",
+		name.c_str(), ToKilobytes((size_t)qefInfo.size), bestQefSeconds * 1000.0, ToKilobytes(qefHeapSize), ToKilobytes(qefPeakSize),
+		ToKilobytes(imageSize), bestCookedSeconds * 1000.0, ToKilobytes(cookedHeapSize),
+		(bestCookedSeconds > 0.0 ? bestQefSeconds / bestCookedSeconds : 0.0), (imagesMatch ? "match" : "MISMATCH"));
+
+	return imagesMatch;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool VoxelBenchmark::RunMeshModel(const VoxelBenchmarkModel& model) const
+{
+	VoxelModel voxelModel;
+	std::string error;
+
+	if (!voxelModel.LoadQef(model.qefPath, &error))
+	{
+		printf("%-14s | skipped, %s\n", model.name.c_str(), error.c_str());
+		return false;
+	}
+
+	printf("%-14s | %d x %d x %d, %d voxels\n", model.name.c_str(), voxelModel.GetWidth(), voxelModel.GetHeight(), voxelModel.GetDepth(), voxelModel.GetSolidCount());
+
+	int exposedQuadCount = 0;
+	int exposedFaceCount = 0;
+	bool allCoverageMatches = true;
+
+	for (const VoxelMeshConfig& config : s_meshConfigs)
+	{
+		VoxelMeshSettings settings;
+		settings.mode = config.mode;
+		settings.useSimd = config.useSimd;
+
+		VoxelMesher mesher(settings);
+		VoxelMeshData mesh;
+		double bestSeconds = 1e30;
+
+		for (int repeatIndex = 0; repeatIndex < m_settings.repeatCount; ++repeatIndex)
+		{
+			const double startTime = Profiler::GetSeconds();
+			mesher.Build(voxelModel, mesh);
+			bestSeconds = std::min(bestSeconds, Profiler::GetSeconds() - startTime);
+		}
+
+		if (config.mode == VOXEL_MESH_EXPOSED_FACES)
+		{
+			exposedQuadCount = mesh.GetQuadCount();
+			exposedFaceCount = mesh.faceCount;
+		}
+
+		// Every mode but all faces has to cover exactly the exposed faces, however they're merged
+		const bool coverageMatches = (config.mode == VOXEL_MESH_ALL_FACES || mesh.faceCount == exposedFaceCount);
+		const double fewerQuads = (mesh.GetQuadCount() > 0 ? (double)exposedQuadCount / (double)mesh.GetQuadCount() : 0.0);
+		allCoverageMatches = allCoverageMatches && coverageMatches;
+
+		printf("  %-20s | %9.3f ms | %8d quads | %9d vertices | %6.2fx fewer | %s\n",
+			config.name, bestSeconds * 1000.0, mesh.GetQuadCount(), (int)mesh.vertices.size(), fewerQuads, (coverageMatches ? "match" : "MISMATCH"));
+	}
+
+	return allCoverageMatches;
+}
@@ -0,0 +1,78 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Voxel load times and memory, .qef text against the cooked file, and meshing speed and size per mesh mode
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct VoxelBenchmarkSettings
+{
+	int			generatedSize = 128;				// Edge length of the generated terrain model, <= 0 to skip it
+	int			repeatCount = 5;					// Best of this many loads is reported
+	std::string	meshDirectory = "Data/Mesh/";		// The .qef files shipped with the game
+};
+
+struct VoxelBenchmarkModel
+{
+	std::string name;
+	std::string qefPath;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Runs over the shipped models plus a generated terrain. Everything written is deleted afterwards
+class VoxelBenchmark
+{
+public:
+	//-----Public Methods-----
+
+	VoxelBenchmark(const VoxelBenchmarkSettings& settings);
+
+	// False if a model was skipped or its two results didn't match
+	bool Run();
+	bool RunMeshing();
+
+
+private:
+	//-----Private Methods-----
+
+	bool								GetModels(std::vector<VoxelBenchmarkModel>& out_models) const;
+	void								DeleteGeneratedModel() const;
+	bool								RunLoadModel(const VoxelBenchmarkModel& model) const;
+	bool								RunMeshModel(const VoxelBenchmarkModel& model) const;
+
+
+private:
+	//-----Private Data-----
+
+	VoxelBenchmarkSettings m_settings;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+bool WriteVoxelTerrainQef(const std::string& qefPath, int size, uint32_t seed);
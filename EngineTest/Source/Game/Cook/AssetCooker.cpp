@@ -0,0 +1,1066 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Cook/AssetCooker.h"
+#include "Game/Cook/CookedAssets.h"
+#include "Game/Cook/TextureImporter.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Framework/ResourceId.h"
+#include "Game/Voxel/VoxelModel.h"
+#include "Engine/Job/Job.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+class CookAssetJob : public Job
+{
+public:
+	//-----Public Methods-----
+
+	CookAssetJob(AssetCooker* cooker, int assetIndex) : m_cooker(cooker), m_assetIndex(assetIndex) {}
+
+	virtual void Execute() override { m_cooker->CookAsset(m_assetIndex); }
+	virtual void Finalize() override {}
+
+
+private:
+	//-----Private Data-----
+
+	AssetCooker*	m_cooker = nullptr;
+	int				m_assetIndex = 0;
+
+};
+
+
+// One element, with its attributes in the order written. Just enough XML for the material and shader files
+struct XmlTag
+{
+	std::string											name;
+	std::vector<std::pair<std::string, std::string>>	attributes;
+	bool												isClosing = false;		// </name>
+	bool												isEmpty = false;		// <name/>
+
+	const char* GetAttribute(const char* attributeName) const
+	{
+		for (const std::pair<std::string, std::string>& attribute : attributes)
+		{
+			if (attribute.first == attributeName)
+			{
+				return attribute.second.c_str();
+			}
+		}
+
+		return nullptr;
+	}
+};
+
+
+struct ParsedMaterial
+{
+	std::string											shaderPath;
+	std::vector<std::pair<std::string, std::string>>	textures;				// Slot name and texture path
+};
+
+
+struct ParsedShader
+{
+	std::string		sourcePath;
+	CookedBlendMode	blendMode = COOKED_BLEND_DEFAULT;
+	CookedFillMode	fillMode = COOKED_FILL_DEFAULT;
+	CookedCullMode	cullMode = COOKED_CULL_DEFAULT;
+	CookedDepthMode	depthMode = COOKED_DEPTH_DEFAULT;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Lays out a cooked asset front to back: header, sources, body and whatever sections the body points to, then
+// the strings. Strings are offsets into their own section, so they can be added at any point before Finish.
+// Sections are reserved and then written through GetAt, since reserving can move the buffer
+class CookedAssetBuilder
+{
+public:
+	//-----Public Methods-----
+
+	CookedAssetBuilder(CookedAssetType type, const std::vector<std::string>& sourcePaths, const std::string& rootDirectory);
+
+	uint32_t	AddString(const std::string& text);
+	uint64_t	Reserve(size_t size, size_t alignment = 8);
+	template <typename T>
+	T*			GetAt(uint64_t offset) { return (T*)(m_data.data() + offset); }
+
+	void		SetBodyOffset(uint64_t offset) { GetAt<CookedAssetHeader>(0)->bodyOffset = offset; }
+	const std::vector<uint8_t>& Finish();
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<uint8_t>			m_data;
+	std::string						m_strings;
+	std::map<std::string, uint32_t>	m_stringOffsets;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char	s_manifestHeader[] = "cook_manifest";
+static const char*	s_assetCookTypeNames[NUM_ASSET_COOK_TYPES] = { "material", "shader", "texture", "voxel model" };
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static bool EndsWith(const std::string& text, const char* ending)
+{
+	const size_t endingLength = strlen(ending);
+	return (text.size() >= endingLength && text.compare(text.size() - endingLength, endingLength, ending) == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint64_t HashBytes(const void* data, size_t size, uint64_t hash)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+	for (size_t byteIndex = 0; byteIndex < size; ++byteIndex)
+	{
+		hash = (hash ^ bytes[byteIndex]) * RESOURCE_ID_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool IsXmlSpace(char character)
+{
+	return (character == ' ' || character == '\t' || character == '\r' || character == '\n');
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Reads the next element tag, skipping text, comments and declarations. Returns false at the end, or on a malformed tag
+static bool ReadNextXmlTag(const char*& cursor, const char* end, XmlTag& out_tag)
+{
+	out_tag = XmlTag();
+
+	for (;;)
+	{
+		while (cursor < end && *cursor != '<')
+		{
+			cursor++;
+		}
+
+		if (end - cursor < 2)
+		{
+			return false;
+		}
+
+		if (cursor[1] != '!' && cursor[1] != '?')
+		{
+			break;
+		}
+
+		const char* closer = (end - cursor >= 4 && strncmp(cursor, "<!--", 4) == 0 ? "-->" : ">");
+		const char* closerEnd = std::search(cursor + 2, end, closer, closer + strlen(closer));
+		cursor = (closerEnd < end ? closerEnd + strlen(closer) : end);
+	}
+
+	cursor++;
+	if (*cursor == '/')
+	{
+		out_tag.isClosing = true;
+		cursor++;
+	}
+
+	while (cursor < end && !IsXmlSpace(*cursor) && *cursor != '/' && *cursor != '>')
+	{
+		out_tag.name.push_back(*cursor++);
+	}
+
+	for (;;)
+	{
+		while (cursor < end && IsXmlSpace(*cursor))
+		{
+			cursor++;
+		}
+
+		if (cursor >= end)
+		{
+			return false;
+		}
+
+		if (*cursor == '>')
+		{
+			cursor++;
+			return (out_tag.name.size() > 0);
+		}
+
+		if (*cursor == '/')
+		{
+			out_tag.isEmpty = true;
+			cursor++;
+			continue;
+		}
+
+		std::pair<std::string, std::string> attribute;
+		while (cursor < end && !IsXmlSpace(*cursor) && *cursor != '=' && *cursor != '>' && *cursor != '/')
+		{
+			attribute.first.push_back(*cursor++);
+		}
+
+		while (cursor < end && IsXmlSpace(*cursor))
+		{
+			cursor++;
+		}
+
+		if (attribute.first.size() == 0 || cursor + 1 >= end || *cursor != '=')
+		{
+			return false;
+		}
+
+		cursor++;
+		while (cursor < end && IsXmlSpace(*cursor))
+		{
+			cursor++;
+		}
+
+		const char quote = (cursor < end ? *cursor : 0);
+		if (quote != '"' && quote != '\'')
+		{
+			return false;
+		}
+
+		cursor++;
+		while (cursor < end && *cursor != quote)
+		{
+			attribute.second.push_back(*cursor++);
+		}
+
+		if (cursor >= end)
+		{
+			return false;
+		}
+
+		cursor++;
+		out_tag.attributes.push_back(attribute);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// <material><shader file="..."/><texture><slot name="..."/>...</texture></material>
+static bool ParseMaterial(const MappedFile& file, ParsedMaterial& out_material, std::string& out_error)
+{
+	const char* cursor = (const char*)file.GetData();
+	const char* end = cursor + file.GetSize();
+	bool isInTextures = false;
+	XmlTag tag;
+
+	while (ReadNextXmlTag(cursor, end, tag))
+	{
+		if (tag.name == "texture")
+		{
+			isInTextures = (!tag.isClosing && !tag.isEmpty);
+		}
+		else if (tag.name == "shader" && !tag.isClosing && tag.GetAttribute("file") != nullptr)
+		{
+			out_material.shaderPath = tag.GetAttribute("file");
+		}
+		else if (isInTextures && !tag.isClosing && tag.GetAttribute("name") != nullptr)
+		{
+			out_material.textures.push_back(std::make_pair(tag.name, std::string(tag.GetAttribute("name"))));
+		}
+	}
+
+	if (out_material.shaderPath.size() == 0)
+	{
+		out_error = "no <shader file=\"...\"/>";
+		return false;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// A single <shader source="..." blend="..." fill="..." cull="..." depth="..."/>. Any state named that the
+// cooked enums don't know is an error, rather than quietly becoming the default
+static bool ParseShader(const MappedFile& file, ParsedShader& out_shader, std::string& out_error)
+{
+	const char* cursor = (const char*)file.GetData();
+	const char* end = cursor + file.GetSize();
+	XmlTag tag;
+
+	while (ReadNextXmlTag(cursor, end, tag) && tag.name != "shader")
+	{
+	}
+
+	if (tag.name != "shader" || tag.GetAttribute("source") == nullptr)
+	{
+		out_error = "no <shader source=\"...\"/>";
+		return false;
+	}
+
+	out_shader.sourcePath = tag.GetAttribute("source");
+
+	for (const std::pair<std::string, std::string>& attribute : tag.attributes)
+	{
+		const char* value = attribute.second.c_str();
+		bool isKnown = true;
+
+		if (attribute.first == "blend")
+		{
+			out_shader.blendMode = GetCookedBlendModeFromName(value, NUM_COOKED_BLEND_MODES);
+			isKnown = (out_shader.blendMode != NUM_COOKED_BLEND_MODES);
+		}
+		else if (attribute.first == "fill")
+		{
+			out_shader.fillMode = GetCookedFillModeFromName(value, NUM_COOKED_FILL_MODES);
+			isKnown = (out_shader.fillMode != NUM_COOKED_FILL_MODES);
+		}
+		else if (attribute.first == "cull")
+		{
+			out_shader.cullMode = GetCookedCullModeFromName(value, NUM_COOKED_CULL_MODES);
+			isKnown = (out_shader.cullMode != NUM_COOKED_CULL_MODES);
+		}
+		else if (attribute.first == "depth")
+		{
+			out_shader.depthMode = GetCookedDepthModeFromName(value, NUM_COOKED_DEPTH_MODES);
+			isKnown = (out_shader.depthMode != NUM_COOKED_DEPTH_MODES);
+		}
+
+		if (!isKnown)
+		{
+			out_error = "unknown " + attribute.first + " \"" + attribute.second + "\"";
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool CookMaterial(const std::string& materialPath, const std::string& diskPath, CookedAssetBuilder& builder, std::string& out_error)
+{
+	MappedFile file;
+	ParsedMaterial material;
+
+	if (!file.Open(diskPath.c_str()) || !ParseMaterial(file, material, out_error))
+	{
+		out_error = materialPath + ": " + (out_error.size() > 0 ? out_error : "couldn't open it");
+		return false;
+	}
+
+	const uint64_t bodyOffset = builder.Reserve(sizeof(CookedMaterialBody));
+	const uint64_t texturesOffset = builder.Reserve(material.textures.size() * sizeof(CookedMaterialTexture));
+	builder.SetBodyOffset(bodyOffset);
+
+	CookedMaterialBody* body = builder.GetAt<CookedMaterialBody>(bodyOffset);
+	body->shaderPathOffset = builder.AddString(material.shaderPath);
+	body->textureCount = (uint32_t)material.textures.size();
+	body->texturesOffset = texturesOffset;
+
+	for (size_t textureIndex = 0; textureIndex < material.textures.size(); ++textureIndex)
+	{
+		const std::string& texturePath = material.textures[textureIndex].second;
+		const CookedTextureKind kind = GetTextureKindFromPath(texturePath);
+
+		CookedMaterialTexture* texture = builder.GetAt<CookedMaterialTexture>(texturesOffset + textureIndex * sizeof(CookedMaterialTexture));
+		texture->slotOffset = builder.AddString(material.textures[textureIndex].first);
+		texture->pathOffset = builder.AddString(texturePath);
+		texture->cookedPathOffset = builder.AddString(kind == COOKED_TEXTURE_KIND_BUILT_IN ? std::string() : GetCookedAssetPath(texturePath));
+		texture->kind = (uint32_t)kind;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool CookShader(const std::string& shaderPath, const std::string& rootDirectory, CookedAssetBuilder& builder, std::string& out_error)
+{
+	MappedFile file;
+	ParsedShader shader;
+
+	if (!file.Open((rootDirectory + shaderPath).c_str()) || !ParseShader(file, shader, out_error))
+	{
+		out_error = shaderPath + ": " + (out_error.size() > 0 ? out_error : "couldn't open it");
+		return false;
+	}
+
+	MappedFile sourceFile;
+	if (!sourceFile.Open((rootDirectory + shader.sourcePath).c_str()))
+	{
+		out_error = shaderPath + ": couldn't open " + shader.sourcePath;
+		return false;
+	}
+
+	const uint64_t bodyOffset = builder.Reserve(sizeof(CookedShaderBody));
+	const uint64_t sourceTextOffset = builder.Reserve(sourceFile.GetSize() + 1);
+	builder.SetBodyOffset(bodyOffset);
+
+	CookedShaderBody* body = builder.GetAt<CookedShaderBody>(bodyOffset);
+	body->blendMode = shader.blendMode;
+	body->fillMode = shader.fillMode;
+	body->cullMode = shader.cullMode;
+	body->depthMode = shader.depthMode;
+	body->sourcePathOffset = builder.AddString(shader.sourcePath);
+	body->sourceTextOffset = sourceTextOffset;
+	body->sourceTextSize = sourceFile.GetSize();
+
+	char* sourceText = builder.GetAt<char>(sourceTextOffset);
+	if (sourceFile.GetSize() > 0)
+	{
+		memcpy(sourceText, sourceFile.GetData(), sourceFile.GetSize());
+	}
+
+	sourceText[sourceFile.GetSize()] = 0;
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The importer decodes the faces and builds their mip chains in parallel; they're then copied in face major order
+static bool CookTexture(const std::string& texturePath, const std::vector<std::string>& facePaths, const std::string& rootDirectory, CookedAssetBuilder& builder, std::string& out_error)
+{
+	std::vector<std::string> faceDiskPaths;
+	for (const std::string& facePath : facePaths)
+	{
+		faceDiskPaths.push_back(rootDirectory + facePath);
+	}
+
+	// Local rather than shared, as waiting on the face jobs can run another cook job on this thread
+	TextureImporter importer;
+	std::string importError;
+
+	if (!importer.Import(faceDiskPaths, TextureImportSettings(), &importError))
+	{
+		out_error = (importError.size() > 0 ? importError : texturePath + ": couldn't import it");
+		return false;
+	}
+
+	const int width = importer.GetWidth();
+	const int height = importer.GetHeight();
+	const int faceCount = importer.GetFaceCount();
+	const int mipCount = importer.GetMipCount();
+
+	const uint64_t bodyOffset = builder.Reserve(sizeof(CookedTextureBody));
+	const uint64_t mipsOffset = builder.Reserve((size_t)faceCount * mipCount * sizeof(CookedTextureMip));
+	builder.SetBodyOffset(bodyOffset);
+
+	for (int faceIndex = 0; faceIndex < faceCount; ++faceIndex)
+	{
+		for (int mipLevel = 0; mipLevel < mipCount; ++mipLevel)
+		{
+			CookedTextureMip mip;
+			mip.width = (uint32_t)GetMipDimension(width, mipLevel);
+			mip.height = (uint32_t)GetMipDimension(height, mipLevel);
+			mip.size = (uint64_t)importer.GetMipSize(mipLevel);
+			mip.offset = builder.Reserve((size_t)mip.size, 16);
+
+			memcpy(builder.GetAt<uint8_t>(mip.offset), importer.GetMipTexels(faceIndex, mipLevel), (size_t)mip.size);
+			*builder.GetAt<CookedTextureMip>(mipsOffset + (faceIndex * mipCount + mipLevel) * sizeof(CookedTextureMip)) = mip;
+		}
+	}
+
+	CookedTextureBody* body = builder.GetAt<CookedTextureBody>(bodyOffset);
+	body->width = (uint32_t)width;
+	body->height = (uint32_t)height;
+	body->faceCount = (uint32_t)faceCount;
+	body->mipCount = (uint32_t)mipCount;
+	body->mipsOffset = mipsOffset;
+
+	return true;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Offset 0 of the strings is always the empty string, for fields with nothing to name
+CookedAssetBuilder::CookedAssetBuilder(CookedAssetType type, const std::vector<std::string>& sourcePaths, const std::string& rootDirectory)
+{
+	AddString(std::string());
+	Reserve(sizeof(CookedAssetHeader));
+
+	CookedAssetHeader* header = GetAt<CookedAssetHeader>(0);
+	header->magic = COOKED_ASSET_MAGIC;
+	header->version = COOKED_ASSET_VERSION;
+	header->type = (uint32_t)type;
+	header->sourceCount = (uint32_t)sourcePaths.size();
+
+	const uint64_t sourcesOffset = Reserve(sourcePaths.size() * sizeof(CookedAssetSource));
+	GetAt<CookedAssetHeader>(0)->sourcesOffset = sourcesOffset;
+
+	for (size_t sourceIndex = 0; sourceIndex < sourcePaths.size(); ++sourceIndex)
+	{
+		FileInfo info;
+		GetFileInfo((rootDirectory + sourcePaths[sourceIndex]).c_str(), info);
+
+		CookedAssetSource* source = GetAt<CookedAssetSource>(sourcesOffset + sourceIndex * sizeof(CookedAssetSource));
+		source->size = info.size;
+		source->modifiedTime = info.modifiedTime;
+		source->pathOffset = AddString(sourcePaths[sourceIndex]);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+uint32_t CookedAssetBuilder::AddString(const std::string& text)
+{
+	const std::map<std::string, uint32_t>::const_iterator existing = m_stringOffsets.find(text);
+	if (existing != m_stringOffsets.end())
+	{
+		return existing->second;
+	}
+
+	const uint32_t offset = (uint32_t)m_strings.size();
+	m_strings.append(text.c_str(), text.size() + 1);
+	m_stringOffsets[text] = offset;
+
+	return offset;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Zero filled, so padding and anything left unset comes out the same on every cook
+uint64_t CookedAssetBuilder::Reserve(size_t size, size_t alignment /*= 8*/)
+{
+	const size_t offset = (m_data.size() + alignment - 1) & ~(alignment - 1);
+	m_data.resize(offset + size, 0);
+
+	return offset;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+const std::vector<uint8_t>& CookedAssetBuilder::Finish()
+{
+	const uint64_t stringsOffset = Reserve(m_strings.size());
+	memcpy(GetAt<char>(stringsOffset), m_strings.data(), m_strings.size());
+
+	CookedAssetHeader* header = GetAt<CookedAssetHeader>(0);
+	header->stringsOffset = stringsOffset;
+	header->stringsSize = m_strings.size();
+	header->fileSize = m_data.size();
+
+	return m_data;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+AssetCooker::AssetCooker(const AssetCookSettings& settings)
+	: m_settings(settings)
+{
+	std::string dataDirectory = settings.dataDirectory;
+	while (dataDirectory.size() > 1 && (dataDirectory.back() == '/' || dataDirectory.back() == '\\'))
+	{
+		dataDirectory.pop_back();
+	}
+
+	const size_t nameStart = dataDirectory.find_last_of("/\\");
+	m_rootDirectory = (nameStart != std::string::npos ? dataDirectory.substr(0, nameStart + 1) : std::string());
+	m_settings.dataDirectory = dataDirectory;
+	m_manifestPath = (settings.manifestPath.size() > 0 ? settings.manifestPath : m_rootDirectory + ASSET_COOK_MANIFEST_NAME);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool AssetCooker::Cook(AssetCookStats* out_stats /*= nullptr*/)
+{
+	const double startSeconds = Profiler::GetSeconds();
+
+	m_assets.clear();
+	m_assetIndexBySource.clear();
+	m_currentFiles.clear();
+	m_hashedFileCount = 0;
+	ReadManifest();
+
+	std::vector<std::string> paths;
+	if (!ListFilesInDirectory(m_settings.dataDirectory, paths))
+	{
+		printf("Couldn't list %s\n", m_settings.dataDirectory.c_str());
+		return false;
+	}
+
+	// Materials first, so anything only reached through one is listed under it
+	for (const std::string& path : paths)
+	{
+		if (EndsWith(path, ".material"))
+		{
+			AddAsset(ASSET_COOK_TYPE_MATERIAL, path.substr(m_rootDirectory.size()));
+		}
+	}
+
+	for (const std::string& path : paths)
+	{
+		if (EndsWith(path, ".shader"))
+		{
+			AddAsset(ASSET_COOK_TYPE_SHADER, path.substr(m_rootDirectory.size()));
+		}
+		else if (EndsWith(path, ".qef"))
+		{
+			AddAsset(ASSET_COOK_TYPE_VOXEL_MODEL, path.substr(m_rootDirectory.size()));
+		}
+	}
+
+	// Finding an asset's inputs can add more assets to the end of the list
+	std::vector<int> assetsToCook;
+	AssetCookStats stats;
+
+	for (int assetIndex = 0; assetIndex < (int)m_assets.size(); ++assetIndex)
+	{
+		if (!FindInputs(assetIndex))
+		{
+			continue;
+		}
+
+		CookAssetEntry& asset = m_assets[assetIndex];
+		asset.key = GetAssetKey(asset);
+
+		if (!m_settings.force && IsUpToDate(asset))
+		{
+			asset.succeeded = true;
+			stats.upToDateCount++;
+
+			if (RestampSources(asset))
+			{
+				stats.restampedCount++;
+			}
+
+			if (m_settings.verbose)
+			{
+				printf("Up to date: %s\n", asset.outputPath.c_str());
+			}
+		}
+		else
+		{
+			assetsToCook.push_back(assetIndex);
+		}
+	}
+
+	if (g_jobScheduler != nullptr && g_jobScheduler->GetWorkerCount() > 0)
+	{
+		std::vector<CookAssetJob> jobs;
+		jobs.reserve(assetsToCook.size());
+
+		for (int assetIndex : assetsToCook)
+		{
+			jobs.emplace_back(this, assetIndex);
+		}
+
+		for (CookAssetJob& job : jobs)
+		{
+			g_jobScheduler->Submit(&job);
+		}
+
+		g_jobScheduler->WaitForAll();
+	}
+	else
+	{
+		for (int assetIndex : assetsToCook)
+		{
+			CookAsset(assetIndex);
+		}
+	}
+
+	for (int assetIndex : assetsToCook)
+	{
+		const CookAssetEntry& asset = m_assets[assetIndex];
+		if (asset.succeeded)
+		{
+			printf("Cooked %s %s -> %s\n", s_assetCookTypeNames[asset.type], asset.sourcePath.c_str(), asset.outputPath.c_str());
+			stats.cookedCount++;
+		}
+	}
+
+	for (const CookAssetEntry& asset : m_assets)
+	{
+		if (!asset.succeeded)
+		{
+			printf("Couldn't cook %s: %s\n", asset.sourcePath.c_str(), asset.error.c_str());
+			stats.failedCount++;
+		}
+	}
+
+	if (!WriteManifest())
+	{
+		printf("Couldn't write %s, so the next cook will rehash everything\n", m_manifestPath.c_str());
+	}
+
+	stats.assetCount = (int)m_assets.size();
+	stats.hashedFileCount = m_hashedFileCount;
+	stats.seconds = Profiler::GetSeconds() - startSeconds;
+
+	if (out_stats != nullptr)
+	{
+		*out_stats = stats;
+	}
+
+	return (stats.failedCount == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Writes the output for one asset whose inputs are already known. Runs on any thread, touching only its own entry
+void AssetCooker::CookAsset(int assetIndex)
+{
+	CookAssetEntry& asset = m_assets[assetIndex];
+	const std::string outputDiskPath = GetDiskPath(asset.outputPath);
+
+	if (asset.type == ASSET_COOK_TYPE_VOXEL_MODEL)
+	{
+		asset.succeeded = CookVoxelModel(GetDiskPath(asset.sourcePath), outputDiskPath, &asset.error);
+		return;
+	}
+
+	static const CookedAssetType s_cookedTypes[] = { COOKED_ASSET_TYPE_MATERIAL, COOKED_ASSET_TYPE_SHADER, COOKED_ASSET_TYPE_TEXTURE };
+	CookedAssetBuilder builder(s_cookedTypes[asset.type], asset.inputPaths, m_rootDirectory);
+
+	bool cooked = false;
+	switch (asset.type)
+	{
+	case ASSET_COOK_TYPE_MATERIAL:	cooked = CookMaterial(asset.sourcePath, GetDiskPath(asset.sourcePath), builder, asset.error); break;
+	case ASSET_COOK_TYPE_SHADER:	cooked = CookShader(asset.sourcePath, m_rootDirectory, builder, asset.error); break;
+	case ASSET_COOK_TYPE_TEXTURE:	cooked = CookTexture(asset.sourcePath, asset.inputPaths, m_rootDirectory, builder, asset.error); break;
+	default:
+		break;
+	}
+
+	if (cooked)
+	{
+		const std::vector<uint8_t>& data = builder.Finish();
+		cooked = WriteBinaryFile(outputDiskPath.c_str(), data.data(), data.size());
+
+		if (!cooked)
+		{
+			asset.error = "couldn't write " + asset.outputPath;
+		}
+	}
+
+	asset.succeeded = cooked;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns the asset's index, adding it if it's new
+int AssetCooker::AddAsset(AssetCookType type, const std::string& sourcePath)
+{
+	const std::map<std::string, int>::const_iterator existing = m_assetIndexBySource.find(sourcePath);
+	if (existing != m_assetIndexBySource.end())
+	{
+		return existing->second;
+	}
+
+	CookAssetEntry asset;
+	asset.type = type;
+	asset.sourcePath = sourcePath;
+	asset.outputPath = (type == ASSET_COOK_TYPE_VOXEL_MODEL ? GetCookedVoxelPath(sourcePath) : GetCookedAssetPath(sourcePath));
+
+	m_assets.push_back(asset);
+	m_assetIndexBySource[sourcePath] = (int)m_assets.size() - 1;
+
+	return (int)m_assets.size() - 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Materials and shaders are parsed here to follow their references; the cook jobs parse them again, which
+// costs far less than the texture decodes they run alongside
+bool AssetCooker::FindInputs(int assetIndex)
+{
+	const AssetCookType type = m_assets[assetIndex].type;
+	const std::string sourcePath = m_assets[assetIndex].sourcePath;
+	std::vector<std::string> inputPaths;
+	std::string error;
+
+	if (type == ASSET_COOK_TYPE_MATERIAL)
+	{
+		MappedFile file;
+		ParsedMaterial material;
+
+		if (file.Open(GetDiskPath(sourcePath).c_str()) && ParseMaterial(file, material, error))
+		{
+			inputPaths.push_back(sourcePath);
+			AddAsset(ASSET_COOK_TYPE_SHADER, material.shaderPath);
+
+			for (const std::pair<std::string, std::string>& texture : material.textures)
+			{
+				if (GetTextureKindFromPath(texture.second) != COOKED_TEXTURE_KIND_BUILT_IN)
+				{
+					AddAsset(ASSET_COOK_TYPE_TEXTURE, texture.second);
+				}
+			}
+		}
+	}
+	else if (type == ASSET_COOK_TYPE_SHADER)
+	{
+		MappedFile file;
+		ParsedShader shader;
+
+		if (file.Open(GetDiskPath(sourcePath).c_str()) && ParseShader(file, shader, error))
+		{
+			inputPaths.push_back(sourcePath);
+			inputPaths.push_back(shader.sourcePath);
+		}
+	}
+	else if (type == ASSET_COOK_TYPE_TEXTURE && GetTextureKindFromPath(sourcePath) == COOKED_TEXTURE_KIND_CUBE)
+	{
+		for (int faceIndex = 0; faceIndex < COOKED_CUBE_FACE_COUNT; ++faceIndex)
+		{
+			inputPaths.push_back(sourcePath + std::to_string(faceIndex) + ".png");
+		}
+	}
+	else
+	{
+		inputPaths.push_back(sourcePath);
+	}
+
+	// Every input has to be there to cook at all
+	for (const std::string& inputPath : inputPaths)
+	{
+		FileInfo info;
+		if (!GetFileInfo(GetDiskPath(inputPath).c_str(), info))
+		{
+			error = "couldn't find " + inputPath;
+			inputPaths.clear();
+			break;
+		}
+	}
+
+	CookAssetEntry& asset = m_assets[assetIndex];
+	if (inputPaths.size() == 0)
+	{
+		asset.error = (error.size() > 0 ? error : "couldn't open it");
+		return false;
+	}
+
+	asset.inputPaths = inputPaths;
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool AssetCooker::IsUpToDate(const CookAssetEntry& asset) const
+{
+	const std::map<std::string, uint64_t>::const_iterator previousKey = m_previousKeys.find(asset.outputPath);
+
+	FileInfo outputInfo;
+	return (previousKey != m_previousKeys.end() && previousKey->second == asset.key && GetFileInfo(GetDiskPath(asset.outputPath).c_str(), outputInfo));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The game checks cooked files against their sources by size and modified time, so a source that was touched
+// (a fresh checkout, say) without changing would make it ignore a perfectly good cooked file. This rewrites
+// just those fields in place instead of cooking again. Returns whether anything was rewritten
+bool AssetCooker::RestampSources(const CookAssetEntry& asset) const
+{
+	const std::string outputDiskPath = GetDiskPath(asset.outputPath);
+	std::vector<std::pair<uint64_t, uint64_t>> patches;		// Offset in the file, and the value to write there
+
+	{
+		MappedFile file;
+		if (!file.Open(outputDiskPath.c_str()))
+		{
+			return false;
+		}
+
+		const uint8_t* data = file.GetData();
+
+		if (asset.type == ASSET_COOK_TYPE_VOXEL_MODEL)
+		{
+			FileInfo info;
+			if (file.GetSize() >= sizeof(VoxelFileHeader) && GetFileInfo(GetDiskPath(asset.sourcePath).c_str(), info))
+			{
+				const VoxelFileHeader* header = (const VoxelFileHeader*)data;
+				if (header->sourceSize != info.size || header->sourceModifiedTime != info.modifiedTime)
+				{
+					patches.push_back(std::make_pair((uint64_t)offsetof(VoxelFileHeader, sourceSize), info.size));
+					patches.push_back(std::make_pair((uint64_t)offsetof(VoxelFileHeader, sourceModifiedTime), info.modifiedTime));
+				}
+			}
+		}
+		else if (file.GetSize() >= sizeof(CookedAssetHeader))
+		{
+			const CookedAssetHeader* header = (const CookedAssetHeader*)data;
+			if (header->sourcesOffset + (uint64_t)header->sourceCount * sizeof(CookedAssetSource) > file.GetSize() || header->sourceCount != asset.inputPaths.size())
+			{
+				return false;
+			}
+
+			const CookedAssetSource* sources = (const CookedAssetSource*)(data + header->sourcesOffset);
+			for (uint32_t sourceIndex = 0; sourceIndex < header->sourceCount; ++sourceIndex)
+			{
+				FileInfo info;
+				if (GetFileInfo(GetDiskPath(asset.inputPaths[sourceIndex]).c_str(), info) && (sources[sourceIndex].size != info.size || sources[sourceIndex].modifiedTime != info.modifiedTime))
+				{
+					const uint64_t sourceOffset = header->sourcesOffset + sourceIndex * sizeof(CookedAssetSource);
+					patches.push_back(std::make_pair(sourceOffset + offsetof(CookedAssetSource, size), info.size));
+					patches.push_back(std::make_pair(sourceOffset + offsetof(CookedAssetSource, modifiedTime), info.modifiedTime));
+				}
+			}
+		}
+	}
+
+	if (patches.size() == 0)
+	{
+		return false;
+	}
+
+	std::fstream file(outputDiskPath.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+	for (const std::pair<uint64_t, uint64_t>& patch : patches)
+	{
+		file.seekp((std::streamoff)patch.first);
+		file.write((const char*)&patch.second, sizeof(patch.second));
+	}
+
+	return file.good();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Trusts the manifest's hash while the file's size and modified time match what it recorded
+uint64_t AssetCooker::GetContentHash(const std::string& path)
+{
+	const std::map<std::string, ManifestFile>::const_iterator current = m_currentFiles.find(path);
+	if (current != m_currentFiles.end())
+	{
+		return current->second.contentHash;
+	}
+
+	ManifestFile file;
+	GetFileInfo(GetDiskPath(path).c_str(), file.info);
+
+	const std::map<std::string, ManifestFile>::const_iterator previous = m_previousFiles.find(path);
+	if (previous != m_previousFiles.end() && previous->second.info.size == file.info.size && previous->second.info.modifiedTime == file.info.modifiedTime)
+	{
+		file.contentHash = previous->second.contentHash;
+	}
+	else
+	{
+		MappedFile contents;
+		contents.Open(GetDiskPath(path).c_str());
+		file.contentHash = HashBytes(contents.GetData(), contents.GetSize(), RESOURCE_ID_HASH_SEED);
+		m_hashedFileCount++;
+	}
+
+	m_currentFiles[path] = file;
+	return file.contentHash;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+uint64_t AssetCooker::GetAssetKey(const CookAssetEntry& asset)
+{
+	const uint32_t formatVersion = (asset.type == ASSET_COOK_TYPE_VOXEL_MODEL ? VOXEL_FILE_VERSION : COOKED_ASSET_VERSION);
+	const uint32_t versions[3] = { ASSET_COOK_VERSION, formatVersion, (uint32_t)asset.type };
+
+	uint64_t key = HashBytes(versions, sizeof(versions), RESOURCE_ID_HASH_SEED);
+	for (const std::string& inputPath : asset.inputPaths)
+	{
+		const uint64_t contentHash = GetContentHash(inputPath);
+		key = HashBytes(inputPath.c_str(), inputPath.size() + 1, key);
+		key = HashBytes(&contentHash, sizeof(contentHash), key);
+	}
+
+	return key;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Text, one record per line, path last so it can hold spaces:
+//   cook_manifest <version>
+//   file <content hash> <size> <modified time> <path>
+//   output <key> <path>
+// A manifest from another cooker version is ignored, which cooks everything
+void AssetCooker::ReadManifest()
+{
+	m_previousFiles.clear();
+	m_previousKeys.clear();
+
+	std::ifstream file(m_manifestPath.c_str());
+	std::string line;
+
+	unsigned int version = 0;
+	if (!std::getline(file, line) || sscanf(line.c_str(), "cook_manifest %u", &version) != 1 || version != ASSET_COOK_VERSION)
+	{
+		return;
+	}
+
+	while (std::getline(file, line))
+	{
+		unsigned long long hash = 0;
+		unsigned long long size = 0;
+		unsigned long long modifiedTime = 0;
+		int pathStart = 0;
+
+		if (sscanf(line.c_str(), "file %llx %llu %llu %n", &hash, &size, &modifiedTime, &pathStart) == 3 && pathStart > 0)
+		{
+			ManifestFile& manifestFile = m_previousFiles[line.substr(pathStart)];
+			manifestFile.contentHash = hash;
+			manifestFile.info.size = size;
+			manifestFile.info.modifiedTime = modifiedTime;
+		}
+		else if (sscanf(line.c_str(), "output %llx %n", &hash, &pathStart) == 1 && pathStart > 0)
+		{
+			m_previousKeys[line.substr(pathStart)] = hash;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Only outputs that exist as their key says are recorded, so a failed cook is retried next time
+bool AssetCooker::WriteManifest() const
+{
+	std::ofstream file(m_manifestPath.c_str(), std::ios::out | std::ios::trunc);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	char line[64];
+	snprintf(line, sizeof(line), "%s %u\n", s_manifestHeader, ASSET_COOK_VERSION);
+	file << line;
+
+	for (const std::pair<const std::string, ManifestFile>& entry : m_currentFiles)
+	{
+		snprintf(line, sizeof(line), "file %016llx %llu %llu ", (unsigned long long)entry.second.contentHash, (unsigned long long)entry.second.info.size, (unsigned long long)entry.second.info.modifiedTime);
+		file << line << entry.first << "\n";
+	}
+
+	for (const CookAssetEntry& asset : m_assets)
+	{
+		if (asset.succeeded)
+		{
+			snprintf(line, sizeof(line), "output %016llx ", (unsigned long long)asset.key);
+			file << line << asset.outputPath << "\n";
+		}
+	}
+
+	return file.good();
+}
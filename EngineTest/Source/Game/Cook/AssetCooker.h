@@ -0,0 +1,137 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Offline cooking of the Data directory, rebuilding only what changed
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/MappedFile.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+enum AssetCookType
+{
+	ASSET_COOK_TYPE_MATERIAL,
+	ASSET_COOK_TYPE_SHADER,
+	ASSET_COOK_TYPE_TEXTURE,
+	ASSET_COOK_TYPE_VOXEL_MODEL,
+	NUM_ASSET_COOK_TYPES
+};
+
+struct AssetCookSettings
+{
+	std::string	dataDirectory = "Data";
+	std::string	manifestPath;							// Empty for the default, inside the data directory's parent
+	bool		force = false;							// Cook everything, changed or not
+	bool		verbose = false;						// Print every asset, not just the ones cooked
+};
+
+struct AssetCookStats
+{
+	int		assetCount = 0;
+	int		cookedCount = 0;
+	int		upToDateCount = 0;
+	int		restampedCount = 0;							// Up to date, but a source was touched, so its size and time were rewritten
+	int		failedCount = 0;
+	int		hashedFileCount = 0;						// Sources whose contents had to be read, rather than trusting the manifest
+	double	seconds = 0.0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+const uint32_t	ASSET_COOK_VERSION = 1;						// Bump to recook everything when the cooker's output changes
+const char		ASSET_COOK_MANIFEST_NAME[] = "cook_manifest.txt";
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Walks from the materials (and any shaders and voxel models not reached through one) to everything they
+// refer to, and gives each output a key hashed from the cooker and format versions and the contents of every
+// source it's built from. An output is only cooked when its key differs from the one recorded in the manifest
+// or the file is gone, so renaming, touching or checking out files changes nothing.
+// Contents are only hashed for sources whose size or modified time changed since the manifest was written.
+// The cooks themselves are independent, so they run as jobs on the JobScheduler if there is one.
+// Paths are kept as the game sees them ("Data/..."), relative to the data directory's parent
+class AssetCooker
+{
+public:
+	//-----Public Methods-----
+
+	AssetCooker(const AssetCookSettings& settings);
+
+	// Returns false if anything failed to cook; everything else is still cooked and recorded
+	bool			Cook(AssetCookStats* out_stats = nullptr);
+
+	// Called from the cook jobs
+	void			CookAsset(int assetIndex);
+
+
+private:
+	//-----Private Methods-----
+
+	struct CookAssetEntry;
+
+	int				AddAsset(AssetCookType type, const std::string& sourcePath);
+	bool			FindInputs(int assetIndex);
+	bool			IsUpToDate(const CookAssetEntry& asset) const;
+	bool			RestampSources(const CookAssetEntry& asset) const;
+	uint64_t		GetContentHash(const std::string& path);
+	uint64_t		GetAssetKey(const CookAssetEntry& asset);
+	std::string		GetDiskPath(const std::string& path) const { return m_rootDirectory + path; }
+
+	void			ReadManifest();
+	bool			WriteManifest() const;
+
+
+private:
+	//-----Private Data-----
+
+	struct ManifestFile
+	{
+		uint64_t	contentHash = 0;
+		FileInfo	info;
+	};
+
+	struct CookAssetEntry
+	{
+		AssetCookType				type;
+		std::string					sourcePath;
+		std::string					outputPath;
+		std::vector<std::string>	inputPaths;			// Everything whose contents go into the output
+		uint64_t					key = 0;
+		bool						succeeded = false;
+		std::string					error;
+	};
+
+	AssetCookSettings					m_settings;
+	std::string							m_rootDirectory;		// Prepended to every path to find it on disk
+	std::string							m_manifestPath;
+	std::vector<CookAssetEntry>			m_assets;
+	std::map<std::string, int>			m_assetIndexBySource;
+	std::map<std::string, ManifestFile>	m_previousFiles;		// As the manifest recorded them
+	std::map<std::string, ManifestFile>	m_currentFiles;			// Every source seen this run
+	std::map<std::string, uint64_t>		m_previousKeys;			// Output path to the key it was cooked with
+	int									m_hashedFileCount = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
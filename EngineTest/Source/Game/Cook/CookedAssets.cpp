@@ -0,0 +1,282 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Cook/CookedAssets.h"
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char	s_dataPathPrefix[] = "Data/";
+
+// Indexed by the enums, with DEFAULT's slot never matching a name
+static const char*	s_blendModeNames[NUM_COOKED_BLEND_MODES] = { "", "opaque", "alpha", "additive" };
+static const char*	s_fillModeNames[NUM_COOKED_FILL_MODES] = { "", "solid", "wireframe" };
+static const char*	s_cullModeNames[NUM_COOKED_CULL_MODES] = { "", "back", "front", "none" };
+static const char*	s_depthModeNames[NUM_COOKED_DEPTH_MODES] = { "", "never", "less", "equal", "less_than_or_equal", "greater", "not_equal", "greater_than_or_equal", "always" };
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static void SetError(std::string* out_error, const std::string& error)
+{
+	if (out_error != nullptr)
+	{
+		*out_error = error;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static int GetIndexFromName(const char* name, const char* const* names, int nameCount, int defaultIndex)
+{
+	for (int nameIndex = 1; nameIndex < nameCount; ++nameIndex)
+	{
+		if (strcmp(name, names[nameIndex]) == 0)
+		{
+			return nameIndex;
+		}
+	}
+
+	return defaultIndex;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+std::string GetCookedAssetPath(const std::string& sourcePath)
+{
+	if (sourcePath.size() > 1 && (sourcePath.back() == '/' || sourcePath.back() == '\\'))
+	{
+		return sourcePath.substr(0, sourcePath.size() - 1) + COOKED_ASSET_EXTENSION;
+	}
+
+	return sourcePath + COOKED_ASSET_EXTENSION;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Textures are named by path under Data/, with a trailing slash for a cube map's directory, or by a built in name
+CookedTextureKind GetTextureKindFromPath(const std::string& texturePath)
+{
+	if (texturePath.compare(0, sizeof(s_dataPathPrefix) - 1, s_dataPathPrefix) != 0)
+	{
+		return COOKED_TEXTURE_KIND_BUILT_IN;
+	}
+
+	return (texturePath.back() == '/' ? COOKED_TEXTURE_KIND_CUBE : COOKED_TEXTURE_KIND_2D);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+CookedBlendMode GetCookedBlendModeFromName(const char* name, CookedBlendMode defaultMode)
+{
+	return (CookedBlendMode)GetIndexFromName(name, s_blendModeNames, NUM_COOKED_BLEND_MODES, defaultMode);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+CookedFillMode GetCookedFillModeFromName(const char* name, CookedFillMode defaultMode)
+{
+	return (CookedFillMode)GetIndexFromName(name, s_fillModeNames, NUM_COOKED_FILL_MODES, defaultMode);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+CookedCullMode GetCookedCullModeFromName(const char* name, CookedCullMode defaultMode)
+{
+	return (CookedCullMode)GetIndexFromName(name, s_cullModeNames, NUM_COOKED_CULL_MODES, defaultMode);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+CookedDepthMode GetCookedDepthModeFromName(const char* name, CookedDepthMode defaultMode)
+{
+	return (CookedDepthMode)GetIndexFromName(name, s_depthModeNames, NUM_COOKED_DEPTH_MODES, defaultMode);
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+bool CookedAsset::Load(const std::string& sourcePath, std::string* out_error /*= nullptr*/)
+{
+	const std::string cookedPath = GetCookedAssetPath(sourcePath);
+	if (!Open(cookedPath, out_error))
+	{
+		return false;
+	}
+
+	if (IsStale())
+	{
+		Close();
+		SetError(out_error, cookedPath + " is older than what it was cooked from");
+		return false;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Everything the accessors read is range checked here, so they don't have to be
+bool CookedAsset::Open(const std::string& cookedPath, std::string* out_error /*= nullptr*/)
+{
+	Close();
+
+	if (!m_file.Open(cookedPath.c_str()))
+	{
+		SetError(out_error, "Couldn't open " + cookedPath);
+		return false;
+	}
+
+	const CookedAssetHeader* header = (const CookedAssetHeader*)m_file.GetData();
+	const bool isHeaderValid = (m_file.GetSize() >= sizeof(CookedAssetHeader) && header->magic == COOKED_ASSET_MAGIC && header->version == COOKED_ASSET_VERSION
+		&& header->type == (uint32_t)m_type && header->fileSize == m_file.GetSize());
+
+	if (!isHeaderValid || !IsRangeValid(header->sourcesOffset, (uint64_t)header->sourceCount * sizeof(CookedAssetSource)) || !IsRangeValid(header->stringsOffset, header->stringsSize)
+		|| header->stringsSize == 0 || m_file.GetData()[header->stringsOffset + header->stringsSize - 1] != 0)
+	{
+		m_file.Close();
+		SetError(out_error, cookedPath + " isn't a cooked asset of the right type and version, or is damaged");
+		return false;
+	}
+
+	m_header = header;
+
+	bool areSourcesValid = true;
+	for (uint32_t sourceIndex = 0; sourceIndex < header->sourceCount; ++sourceIndex)
+	{
+		areSourcesValid = areSourcesValid && IsStringValid(GetSources()[sourceIndex].pathOffset);
+	}
+
+	if (!areSourcesValid || !IsBodyValid())
+	{
+		Close();
+		SetError(out_error, cookedPath + " is damaged");
+		return false;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void CookedAsset::Close()
+{
+	m_header = nullptr;
+	m_file.Close();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool CookedAsset::IsStale() const
+{
+	for (uint32_t sourceIndex = 0; sourceIndex < m_header->sourceCount; ++sourceIndex)
+	{
+		const CookedAssetSource& source = GetSources()[sourceIndex];
+
+		FileInfo info;
+		if (GetResourceFileInfo(GetString(source.pathOffset), info) && (info.size != source.size || info.modifiedTime != source.modifiedTime))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool CookedShader::IsBodyValid() const
+{
+	if (!IsBodyInRange(sizeof(CookedShaderBody)))
+	{
+		return false;
+	}
+
+	const CookedShaderBody* body = GetBody<CookedShaderBody>();
+
+	return (body->blendMode < NUM_COOKED_BLEND_MODES && body->fillMode < NUM_COOKED_FILL_MODES && body->cullMode < NUM_COOKED_CULL_MODES && body->depthMode < NUM_COOKED_DEPTH_MODES
+		&& IsStringValid(body->sourcePathOffset) && body->sourceTextSize < UINT64_MAX && IsRangeValid(body->sourceTextOffset, body->sourceTextSize + 1)
+		&& GetSection<char>(body->sourceTextOffset)[body->sourceTextSize] == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool CookedMaterial::IsBodyValid() const
+{
+	if (!IsBodyInRange(sizeof(CookedMaterialBody)))
+	{
+		return false;
+	}
+
+	const CookedMaterialBody* body = GetBody<CookedMaterialBody>();
+	if (!IsStringValid(body->shaderPathOffset) || !IsRangeValid(body->texturesOffset, (uint64_t)body->textureCount * sizeof(CookedMaterialTexture)))
+	{
+		return false;
+	}
+
+	for (int textureIndex = 0; textureIndex < (int)body->textureCount; ++textureIndex)
+	{
+		const CookedMaterialTexture& texture = GetTexture(textureIndex);
+		if (!IsStringValid(texture.slotOffset) || !IsStringValid(texture.pathOffset) || !IsStringValid(texture.cookedPathOffset) || texture.kind > COOKED_TEXTURE_KIND_BUILT_IN)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Each level has to hold exactly its texels, at the size the level's dimensions give
+bool CookedTexture::IsBodyValid() const
+{
+	if (!IsBodyInRange(sizeof(CookedTextureBody)))
+	{
+		return false;
+	}
+
+	const CookedTextureBody* body = GetBody<CookedTextureBody>();
+	if (body->width == 0 || body->height == 0 || (body->faceCount != 1 && body->faceCount != COOKED_CUBE_FACE_COUNT) || body->mipCount == 0 || body->mipCount > 32
+		|| !IsRangeValid(body->mipsOffset, (uint64_t)body->faceCount * body->mipCount * sizeof(CookedTextureMip)))
+	{
+		return false;
+	}
+
+	for (int faceIndex = 0; faceIndex < (int)body->faceCount; ++faceIndex)
+	{
+		for (int mipLevel = 0; mipLevel < (int)body->mipCount; ++mipLevel)
+		{
+			const CookedTextureMip& mip = GetMip(faceIndex, mipLevel);
+			const uint32_t expectedWidth = (body->width >> mipLevel > 0 ? body->width >> mipLevel : 1);
+			const uint32_t expectedHeight = (body->height >> mipLevel > 0 ? body->height >> mipLevel : 1);
+
+			if (mip.width != expectedWidth || mip.height != expectedHeight || mip.size != (uint64_t)expectedWidth * expectedHeight * 4 || !IsRangeValid(mip.offset, mip.size))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,275 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Binary formats the asset cooker writes, and the readers the game uses in place of parsing the sources
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/ResourcePack.h"
+#include <cstdint>
+#include <string>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+enum CookedAssetType
+{
+	COOKED_ASSET_TYPE_MATERIAL,
+	COOKED_ASSET_TYPE_SHADER,
+	COOKED_ASSET_TYPE_TEXTURE,
+	NUM_COOKED_ASSET_TYPES
+};
+
+// The render states a .shader can set. DEFAULT means the file left it out, so the engine's default applies
+enum CookedBlendMode		{ COOKED_BLEND_DEFAULT, COOKED_BLEND_OPAQUE, COOKED_BLEND_ALPHA, COOKED_BLEND_ADDITIVE, NUM_COOKED_BLEND_MODES };
+enum CookedFillMode			{ COOKED_FILL_DEFAULT, COOKED_FILL_SOLID, COOKED_FILL_WIREFRAME, NUM_COOKED_FILL_MODES };
+enum CookedCullMode			{ COOKED_CULL_DEFAULT, COOKED_CULL_BACK, COOKED_CULL_FRONT, COOKED_CULL_NONE, NUM_COOKED_CULL_MODES };
+enum CookedDepthMode
+{
+	COOKED_DEPTH_DEFAULT,
+	COOKED_DEPTH_NEVER,
+	COOKED_DEPTH_LESS,
+	COOKED_DEPTH_EQUAL,
+	COOKED_DEPTH_LESS_THAN_OR_EQUAL,
+	COOKED_DEPTH_GREATER,
+	COOKED_DEPTH_NOT_EQUAL,
+	COOKED_DEPTH_GREATER_THAN_OR_EQUAL,
+	COOKED_DEPTH_ALWAYS,
+	NUM_COOKED_DEPTH_MODES
+};
+
+enum CookedTextureKind
+{
+	COOKED_TEXTURE_KIND_2D,
+	COOKED_TEXTURE_KIND_CUBE,			// A directory holding 0.png to 5.png
+	COOKED_TEXTURE_KIND_BUILT_IN		// A name the engine makes itself, like "white", with nothing to cook
+};
+
+// Start of every cooked asset. Offsets are from the start of the file, and every section is 8 byte aligned
+// (texel data 16). Little endian, and read in place, so the structs are the file format
+struct CookedAssetHeader
+{
+	uint32_t	magic;
+	uint32_t	version;
+	uint32_t	type;
+	uint32_t	sourceCount;
+	uint64_t	sourcesOffset;			// CookedAssetSource per file it was cooked from
+	uint64_t	stringsOffset;			// Null terminated, referred to by offset into this section
+	uint64_t	stringsSize;
+	uint64_t	bodyOffset;				// The type's own struct, e.g. CookedShaderBody
+	uint64_t	fileSize;
+};
+
+// Sources are checked the way cooked voxel files check their .qef: by size and modified time, not contents
+struct CookedAssetSource
+{
+	uint64_t	size;
+	uint64_t	modifiedTime;
+	uint32_t	pathOffset;
+	uint32_t	padding;
+};
+
+struct CookedShaderBody
+{
+	uint32_t	blendMode;
+	uint32_t	fillMode;
+	uint32_t	cullMode;
+	uint32_t	depthMode;
+	uint32_t	sourcePathOffset;		// The .shadersource, whose text is embedded
+	uint32_t	padding;
+	uint64_t	sourceTextOffset;		// Null terminated, from the start of the file
+	uint64_t	sourceTextSize;			// Not counting the terminator
+};
+
+struct CookedMaterialTexture
+{
+	uint32_t	slotOffset;				// The element name, e.g. "albedo" or "albedo_cube"
+	uint32_t	pathOffset;				// As the material wrote it
+	uint32_t	cookedPathOffset;		// Empty for built in textures
+	uint32_t	kind;
+};
+
+struct CookedMaterialBody
+{
+	uint32_t	shaderPathOffset;
+	uint32_t	textureCount;
+	uint64_t	texturesOffset;			// CookedMaterialTexture each
+};
+
+// RGBA8, top row first. Cube maps are faceCount 6, in the engine's 0 to 5 face order
+struct CookedTextureMip
+{
+	uint64_t	offset;
+	uint64_t	size;
+	uint32_t	width;
+	uint32_t	height;
+};
+
+struct CookedTextureBody
+{
+	uint32_t	width;
+	uint32_t	height;
+	uint32_t	faceCount;
+	uint32_t	mipCount;
+	uint64_t	mipsOffset;				// CookedTextureMip per face per level, face major
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+const uint32_t	COOKED_ASSET_MAGIC = 0x4B4F4F43;	// "COOK"
+const uint32_t	COOKED_ASSET_VERSION = 1;
+const char		COOKED_ASSET_EXTENSION[] = ".cooked";
+const int		COOKED_CUBE_FACE_COUNT = 6;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// A cooked file mapped and checked once on open, then read in place. Load takes the source path and opens the
+// cooked file next to it, refusing it if any source it was cooked from has changed since. A cooked file whose
+// sources are all missing is used as is, so builds can ship without them
+class CookedAsset
+{
+public:
+	//-----Public Methods-----
+
+	CookedAsset(CookedAssetType type) : m_type(type) {}
+	CookedAsset(const CookedAsset& copy) = delete;
+	virtual ~CookedAsset() {}
+
+	bool				Load(const std::string& sourcePath, std::string* out_error = nullptr);
+	bool				Open(const std::string& cookedPath, std::string* out_error = nullptr);
+	void				Close();
+
+	bool				IsOpen() const { return m_header != nullptr; }
+	bool				IsStale() const;
+	size_t				GetFileSize() const { return m_file.GetSize(); }
+
+	int					GetSourceCount() const { return (int)m_header->sourceCount; }
+	const char*			GetSourcePath(int sourceIndex) const { return GetString(GetSources()[sourceIndex].pathOffset); }
+
+
+protected:
+	//-----Protected Methods-----
+
+	// Checks the body once the header and strings are known good
+	virtual bool		IsBodyValid() const = 0;
+	bool				IsRangeValid(uint64_t offset, uint64_t size) const { return (offset <= m_file.GetSize() && size <= m_file.GetSize() - offset); }
+	bool				IsBodyInRange(size_t bodySize) const { return ((m_header->bodyOffset & 7) == 0 && IsRangeValid(m_header->bodyOffset, bodySize)); }
+	bool				IsStringValid(uint32_t offset) const { return (offset < m_header->stringsSize); }
+	const char*			GetString(uint32_t offset) const { return GetSection<char>(m_header->stringsOffset) + offset; }
+
+	template <typename T>
+	const T*			GetSection(uint64_t offset) const { return (const T*)(m_file.GetData() + offset); }
+	template <typename T>
+	const T*			GetBody() const { return GetSection<T>(m_header->bodyOffset); }
+	const CookedAssetSource* GetSources() const { return GetSection<CookedAssetSource>(m_header->sourcesOffset); }
+
+
+private:
+	//-----Private Data-----
+
+	CookedAssetType				m_type;
+	ResourceFile				m_file;
+	const CookedAssetHeader*	m_header = nullptr;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+class CookedShader : public CookedAsset
+{
+public:
+	//-----Public Methods-----
+
+	CookedShader() : CookedAsset(COOKED_ASSET_TYPE_SHADER) {}
+
+	CookedBlendMode		GetBlendMode() const { return (CookedBlendMode)GetBody<CookedShaderBody>()->blendMode; }
+	CookedFillMode		GetFillMode() const { return (CookedFillMode)GetBody<CookedShaderBody>()->fillMode; }
+	CookedCullMode		GetCullMode() const { return (CookedCullMode)GetBody<CookedShaderBody>()->cullMode; }
+	CookedDepthMode		GetDepthMode() const { return (CookedDepthMode)GetBody<CookedShaderBody>()->depthMode; }
+	const char*			GetSourcePath() const { return GetString(GetBody<CookedShaderBody>()->sourcePathOffset); }
+	const char*			GetSourceText() const { return GetSection<char>(GetBody<CookedShaderBody>()->sourceTextOffset); }
+	size_t				GetSourceTextSize() const { return (size_t)GetBody<CookedShaderBody>()->sourceTextSize; }
+
+
+protected:
+	//-----Protected Methods-----
+
+	virtual bool		IsBodyValid() const override;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+class CookedMaterial : public CookedAsset
+{
+public:
+	//-----Public Methods-----
+
+	CookedMaterial() : CookedAsset(COOKED_ASSET_TYPE_MATERIAL) {}
+
+	const char*			GetShaderPath() const { return GetString(GetBody<CookedMaterialBody>()->shaderPathOffset); }
+	int					GetTextureCount() const { return (int)GetBody<CookedMaterialBody>()->textureCount; }
+	const char*			GetTextureSlot(int textureIndex) const { return GetString(GetTexture(textureIndex).slotOffset); }
+	const char*			GetTexturePath(int textureIndex) const { return GetString(GetTexture(textureIndex).pathOffset); }
+	const char*			GetTextureCookedPath(int textureIndex) const { return GetString(GetTexture(textureIndex).cookedPathOffset); }
+	CookedTextureKind	GetTextureKind(int textureIndex) const { return (CookedTextureKind)GetTexture(textureIndex).kind; }
+
+
+protected:
+	//-----Protected Methods-----
+
+	virtual bool		IsBodyValid() const override;
+	const CookedMaterialTexture& GetTexture(int textureIndex) const { return GetSection<CookedMaterialTexture>(GetBody<CookedMaterialBody>()->texturesOffset)[textureIndex]; }
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+class CookedTexture : public CookedAsset
+{
+public:
+	//-----Public Methods-----
+
+	CookedTexture() : CookedAsset(COOKED_ASSET_TYPE_TEXTURE) {}
+
+	int					GetWidth() const { return (int)GetBody<CookedTextureBody>()->width; }
+	int					GetHeight() const { return (int)GetBody<CookedTextureBody>()->height; }
+	int					GetFaceCount() const { return (int)GetBody<CookedTextureBody>()->faceCount; }
+	int					GetMipCount() const { return (int)GetBody<CookedTextureBody>()->mipCount; }
+	const CookedTextureMip& GetMip(int faceIndex, int mipLevel) const { return GetSection<CookedTextureMip>(GetBody<CookedTextureBody>()->mipsOffset)[faceIndex * GetMipCount() + mipLevel]; }
+	const uint8_t*		GetMipTexels(int faceIndex, int mipLevel) const { return GetSection<uint8_t>(GetMip(faceIndex, mipLevel).offset); }
+
+
+protected:
+	//-----Protected Methods-----
+
+	virtual bool		IsBodyValid() const override;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Next to the source, e.g. Data/Image/debug.png.cooked. A cube map's directory becomes Data/Image/Skybox.cooked
+std::string			GetCookedAssetPath(const std::string& sourcePath);
+CookedTextureKind	GetTextureKindFromPath(const std::string& texturePath);
+
+// Names as .shader files write them; anything else gives back the default passed in
+CookedBlendMode		GetCookedBlendModeFromName(const char* name, CookedBlendMode defaultMode);
+CookedFillMode		GetCookedFillModeFromName(const char* name, CookedFillMode defaultMode);
+CookedCullMode		GetCookedCullModeFromName(const char* name, CookedCullMode defaultMode);
+CookedDepthMode		GetCookedDepthModeFromName(const char* name, CookedDepthMode defaultMode);
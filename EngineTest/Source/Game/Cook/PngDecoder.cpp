@@ -0,0 +1,750 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Cook/PngDecoder.h"
+#include <cstdlib>
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+enum PngColorType
+{
+	PNG_COLOR_TYPE_GRAY = 0,
+	PNG_COLOR_TYPE_RGB = 2,
+	PNG_COLOR_TYPE_PALETTE = 3,
+	PNG_COLOR_TYPE_GRAY_ALPHA = 4,
+	PNG_COLOR_TYPE_RGBA = 6
+};
+
+//-------------------------------------------------------------------------------------------------
+// Reads the deflate stream least significant bit first, keeping up to 64 bits buffered.
+// Past the end it feeds in zeros, which only count as an overrun once they're consumed, so the decoder
+// checks once per code rather than per bit
+struct InflateBitReader
+{
+	const uint8_t*	cursor = nullptr;
+	const uint8_t*	end = nullptr;
+	uint64_t		bits = 0;
+	int				bitCount = 0;
+	int				paddingBitCount = 0;		// Zeros at the top of bits that aren't in the stream
+	bool			isOverrun = false;
+
+	void Refill()
+	{
+		while (bitCount <= 56)
+		{
+			if (cursor < end)
+			{
+				bits |= (uint64_t)(*cursor++) << bitCount;
+			}
+			else
+			{
+				paddingBitCount += 8;
+			}
+
+			bitCount += 8;
+		}
+	}
+
+	uint32_t Peek(int count) { if (bitCount < count) { Refill(); } return (uint32_t)(bits & ((1ULL << count) - 1)); }
+	void Consume(int count) { bits >>= count; bitCount -= count; isOverrun = isOverrun || (bitCount < paddingBitCount); }
+	uint32_t Read(int count) { const uint32_t value = Peek(count); Consume(count); return value; }
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Canonical Huffman code. Codes up to FAST_BITS long resolve with one table read; longer ones walk the counts
+struct InflateHuffman
+{
+	static const int FAST_BITS = 10;
+	static const int MAX_BITS = 15;
+
+	uint16_t	fastTable[1 << FAST_BITS];		// (symbol << 4) | length, 0 if the code is longer than FAST_BITS
+	uint16_t	counts[MAX_BITS + 1];
+	uint16_t	symbols[288];
+
+	bool Build(const uint8_t* lengths, int symbolCount);
+	int Decode(InflateBitReader& reader) const;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const uint8_t	s_pngSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+static const int		s_maxImageDimension = 16384;
+
+static const uint16_t	s_lengthBases[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t	s_lengthExtraBits[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t	s_distanceBases[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t	s_distanceExtraBits[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const uint8_t	s_codeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static void SetError(std::string* out_error, const std::string& error)
+{
+	if (out_error != nullptr)
+	{
+		*out_error = error;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint32_t ReadBigEndian32(const uint8_t* data)
+{
+	return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint32_t ReverseBits(uint32_t code, int length)
+{
+	uint32_t reversed = 0;
+	for (int bitIndex = 0; bitIndex < length; ++bitIndex)
+	{
+		reversed = (reversed << 1) | ((code >> bitIndex) & 1);
+	}
+
+	return reversed;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Incomplete codes are allowed, since deflate uses them for single symbol distance codes
+bool InflateHuffman::Build(const uint8_t* lengths, int symbolCount)
+{
+	memset(counts, 0, sizeof(counts));
+	memset(fastTable, 0, sizeof(fastTable));
+
+	for (int symbol = 0; symbol < symbolCount; ++symbol)
+	{
+		counts[lengths[symbol]]++;
+	}
+
+	counts[0] = 0;
+
+	int left = 1;
+	for (int length = 1; length <= MAX_BITS; ++length)
+	{
+		left = (left << 1) - counts[length];
+		if (left < 0)
+		{
+			return false;
+		}
+	}
+
+	uint16_t offsets[MAX_BITS + 2];
+	offsets[1] = 0;
+	for (int length = 1; length <= MAX_BITS; ++length)
+	{
+		offsets[length + 1] = (uint16_t)(offsets[length] + counts[length]);
+	}
+
+	uint32_t nextCode[MAX_BITS + 1];
+	uint32_t code = 0;
+	for (int length = 1; length <= MAX_BITS; ++length)
+	{
+		code = (code + counts[length - 1]) << 1;
+		nextCode[length] = code;
+	}
+
+	for (int symbol = 0; symbol < symbolCount; ++symbol)
+	{
+		const int length = lengths[symbol];
+		if (length == 0)
+		{
+			continue;
+		}
+
+		symbols[offsets[length]++] = (uint16_t)symbol;
+
+		if (length <= FAST_BITS)
+		{
+			// Every table slot whose low bits are this code, whatever bits follow it
+			const uint32_t reversed = ReverseBits(nextCode[length], length);
+			for (uint32_t slot = reversed; slot < (1u << FAST_BITS); slot += (1u << length))
+			{
+				fastTable[slot] = (uint16_t)((symbol << 4) | length);
+			}
+		}
+
+		nextCode[length]++;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns -1 for a code that isn't in the table
+int InflateHuffman::Decode(InflateBitReader& reader) const
+{
+	const uint32_t peeked = reader.Peek(MAX_BITS);
+	const uint16_t fastEntry = fastTable[peeked & ((1u << FAST_BITS) - 1)];
+
+	if (fastEntry != 0)
+	{
+		reader.Consume(fastEntry & 15);
+		return (fastEntry >> 4);
+	}
+
+	int code = 0;
+	int first = 0;
+	int index = 0;
+
+	for (int length = 1; length <= MAX_BITS; ++length)
+	{
+		code |= (int)((peeked >> (length - 1)) & 1);
+		const int count = counts[length];
+
+		if (code - first < count)
+		{
+			reader.Consume(length);
+			return symbols[index + (code - first)];
+		}
+
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+
+	return -1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool InflateCodes(InflateBitReader& reader, const InflateHuffman& lengthCodes, const InflateHuffman& distanceCodes, uint8_t* destination, size_t& written, size_t destinationSize)
+{
+	for (;;)
+	{
+		const int symbol = lengthCodes.Decode(reader);
+		if (symbol < 0 || reader.isOverrun)
+		{
+			return false;
+		}
+
+		if (symbol < 256)
+		{
+			if (written >= destinationSize)
+			{
+				return false;
+			}
+
+			destination[written++] = (uint8_t)symbol;
+			continue;
+		}
+
+		if (symbol == 256)
+		{
+			return true;
+		}
+
+		const int lengthIndex = symbol - 257;
+		if (lengthIndex >= 29)
+		{
+			return false;
+		}
+
+		const size_t length = s_lengthBases[lengthIndex] + reader.Read(s_lengthExtraBits[lengthIndex]);
+
+		const int distanceIndex = distanceCodes.Decode(reader);
+		if (distanceIndex < 0 || distanceIndex >= 30)
+		{
+			return false;
+		}
+
+		const size_t distance = s_distanceBases[distanceIndex] + reader.Read(s_distanceExtraBits[distanceIndex]);
+
+		if (distance > written || length > destinationSize - written)
+		{
+			return false;
+		}
+
+		// Byte by byte, since a match can overlap the bytes it's writing
+		const uint8_t* match = destination + written - distance;
+		for (size_t byteIndex = 0; byteIndex < length; ++byteIndex)
+		{
+			destination[written + byteIndex] = match[byteIndex];
+		}
+
+		written += length;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool ReadDynamicCodes(InflateBitReader& reader, InflateHuffman& out_lengthCodes, InflateHuffman& out_distanceCodes)
+{
+	const int lengthCodeCount = (int)reader.Read(5) + 257;
+	const int distanceCodeCount = (int)reader.Read(5) + 1;
+	const int codeLengthCodeCount = (int)reader.Read(4) + 4;
+
+	if (lengthCodeCount > 286 || distanceCodeCount > 30)
+	{
+		return false;
+	}
+
+	uint8_t codeLengthLengths[19] = {};
+	for (int index = 0; index < codeLengthCodeCount; ++index)
+	{
+		codeLengthLengths[s_codeLengthOrder[index]] = (uint8_t)reader.Read(3);
+	}
+
+	InflateHuffman codeLengthCodes;
+	if (!codeLengthCodes.Build(codeLengthLengths, 19))
+	{
+		return false;
+	}
+
+	uint8_t lengths[286 + 30] = {};
+	const int totalCount = lengthCodeCount + distanceCodeCount;
+
+	for (int index = 0; index < totalCount;)
+	{
+		const int symbol = codeLengthCodes.Decode(reader);
+		if (symbol < 0 || reader.isOverrun)
+		{
+			return false;
+		}
+
+		if (symbol < 16)
+		{
+			lengths[index++] = (uint8_t)symbol;
+			continue;
+		}
+
+		uint8_t repeatedLength = 0;
+		int repeatCount = 0;
+
+		if (symbol == 16)
+		{
+			if (index == 0)
+			{
+				return false;
+			}
+
+			repeatedLength = lengths[index - 1];
+			repeatCount = 3 + (int)reader.Read(2);
+		}
+		else if (symbol == 17)
+		{
+			repeatCount = 3 + (int)reader.Read(3);
+		}
+		else
+		{
+			repeatCount = 11 + (int)reader.Read(7);
+		}
+
+		if (index + repeatCount > totalCount)
+		{
+			return false;
+		}
+
+		memset(lengths + index, repeatedLength, (size_t)repeatCount);
+		index += repeatCount;
+	}
+
+	// The end of block code has to be there
+	return (lengths[256] != 0 && out_lengthCodes.Build(lengths, lengthCodeCount) && out_distanceCodes.Build(lengths + lengthCodeCount, distanceCodeCount));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint32_t GetAdler32(const uint8_t* data, size_t size)
+{
+	uint32_t a = 1;
+	uint32_t b = 0;
+
+	while (size > 0)
+	{
+		// 5552 bytes is the most that can be summed before the 32 bit sums could overflow
+		const size_t blockSize = (size < 5552 ? size : 5552);
+		for (size_t byteIndex = 0; byteIndex < blockSize; ++byteIndex)
+		{
+			a += data[byteIndex];
+			b += a;
+		}
+
+		a %= 65521;
+		b %= 65521;
+		data += blockSize;
+		size -= blockSize;
+	}
+
+	return (b << 16) | a;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool InflateZlib(const uint8_t* data, size_t size, uint8_t* out_destination, size_t expectedSize)
+{
+	// Deflate with no preset dictionary, and the header check bits right
+	if (size < 6 || (data[0] & 0x0F) != 8 || (data[1] & 0x20) != 0 || ((data[0] << 8) | data[1]) % 31 != 0)
+	{
+		return false;
+	}
+
+	InflateBitReader reader;
+	reader.cursor = data + 2;
+	reader.end = data + size - 4;
+
+	InflateHuffman* lengthCodes = new InflateHuffman();
+	InflateHuffman* distanceCodes = new InflateHuffman();
+	size_t written = 0;
+	bool isLastBlock = false;
+	bool succeeded = true;
+
+	while (succeeded && !isLastBlock)
+	{
+		isLastBlock = (reader.Read(1) != 0);
+		const uint32_t blockType = reader.Read(2);
+
+		if (blockType == 0)
+		{
+			// Stored: skip to the byte boundary, then a length and its complement
+			reader.Consume(reader.bitCount & 7);
+			const uint32_t length = reader.Read(16);
+			const uint32_t lengthComplement = reader.Read(16);
+
+			succeeded = (length == (~lengthComplement & 0xFFFF) && length <= expectedSize - written);
+			for (uint32_t byteIndex = 0; succeeded && byteIndex < length; ++byteIndex)
+			{
+				out_destination[written++] = (uint8_t)reader.Read(8);
+			}
+		}
+		else if (blockType == 1)
+		{
+			uint8_t lengths[288 + 30];
+			memset(lengths, 8, 144);
+			memset(lengths + 144, 9, 112);
+			memset(lengths + 256, 7, 24);
+			memset(lengths + 280, 8, 8);
+			memset(lengths + 288, 5, 30);
+
+			succeeded = lengthCodes->Build(lengths, 288) && distanceCodes->Build(lengths + 288, 30) && InflateCodes(reader, *lengthCodes, *distanceCodes, out_destination, written, expectedSize);
+		}
+		else if (blockType == 2)
+		{
+			succeeded = ReadDynamicCodes(reader, *lengthCodes, *distanceCodes) && InflateCodes(reader, *lengthCodes, *distanceCodes, out_destination, written, expectedSize);
+		}
+		else
+		{
+			succeeded = false;
+		}
+
+		succeeded = succeeded && !reader.isOverrun;
+	}
+
+	delete lengthCodes;
+	delete distanceCodes;
+
+	return (succeeded && written == expectedSize && ReadBigEndian32(data + size - 4) == GetAdler32(out_destination, expectedSize));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint8_t GetPaethPredictor(int left, int up, int upLeft)
+{
+	const int estimate = left + up - upLeft;
+	const int leftDistance = abs(estimate - left);
+	const int upDistance = abs(estimate - up);
+	const int upLeftDistance = abs(estimate - upLeft);
+
+	if (leftDistance <= upDistance && leftDistance <= upLeftDistance)
+	{
+		return (uint8_t)left;
+	}
+
+	return (uint8_t)(upDistance <= upLeftDistance ? up : upLeft);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Undoes the per row filters in place. Each row starts with its filter type byte. The first row has nothing
+// above it, which the filters treat as zeros, so it's filtered against a row of them.
+// One loop per filter type, so the inner loops don't branch per byte
+static bool UnfilterRows(uint8_t* rows, int height, size_t rowSize, int bytesPerPixel)
+{
+	const std::vector<uint8_t> zeroRow(rowSize, 0);
+	const size_t pixelSize = (size_t)bytesPerPixel;
+
+	for (int rowIndex = 0; rowIndex < height; ++rowIndex)
+	{
+		uint8_t* row = rows + (size_t)rowIndex * (rowSize + 1);
+		uint8_t* pixels = row + 1;
+		const uint8_t* above = (rowIndex > 0 ? row - rowSize : zeroRow.data());
+
+		switch (row[0])
+		{
+		case 0:
+			break;
+		case 1:
+			for (size_t byteIndex = pixelSize; byteIndex < rowSize; ++byteIndex)
+			{
+				pixels[byteIndex] = (uint8_t)(pixels[byteIndex] + pixels[byteIndex - pixelSize]);
+			}
+			break;
+		case 2:
+			for (size_t byteIndex = 0; byteIndex < rowSize; ++byteIndex)
+			{
+				pixels[byteIndex] = (uint8_t)(pixels[byteIndex] + above[byteIndex]);
+			}
+			break;
+		case 3:
+			for (size_t byteIndex = 0; byteIndex < rowSize && byteIndex < pixelSize; ++byteIndex)
+			{
+				pixels[byteIndex] = (uint8_t)(pixels[byteIndex] + (above[byteIndex] >> 1));
+			}
+
+			for (size_t byteIndex = pixelSize; byteIndex < rowSize; ++byteIndex)
+			{
+				pixels[byteIndex] = (uint8_t)(pixels[byteIndex] + ((pixels[byteIndex - pixelSize] + above[byteIndex]) >> 1));
+			}
+			break;
+		case 4:
+			for (size_t byteIndex = 0; byteIndex < rowSize && byteIndex < pixelSize; ++byteIndex)
+			{
+				pixels[byteIndex] = (uint8_t)(pixels[byteIndex] + above[byteIndex]);
+			}
+
+			for (size_t byteIndex = pixelSize; byteIndex < rowSize; ++byteIndex)
+			{
+				pixels[byteIndex] = (uint8_t)(pixels[byteIndex] + GetPaethPredictor(pixels[byteIndex - pixelSize], above[byteIndex], above[byteIndex - pixelSize]));
+			}
+			break;
+		default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static int GetChannelCount(int colorType)
+{
+	static const int s_channelCounts[7] = { 1, 0, 3, 1, 2, 0, 4 };
+	return s_channelCounts[colorType];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Walks the chunks, calling visitor(type, chunkData, chunkSize) for each up to IEND
+template <typename Visitor>
+static bool VisitPngChunks(const uint8_t* data, size_t size, Visitor visitor, std::string* out_error)
+{
+	if (size < 8 || memcmp(data, s_pngSignature, 8) != 0)
+	{
+		SetError(out_error, "Not a PNG file");
+		return false;
+	}
+
+	for (size_t offset = 8; offset + 12 <= size;)
+	{
+		const uint32_t chunkSize = ReadBigEndian32(data + offset);
+		const uint8_t* chunkType = data + offset + 4;
+
+		if (chunkSize > size - offset - 12)
+		{
+			SetError(out_error, "A chunk runs past the end of the file");
+			return false;
+		}
+
+		if (memcmp(chunkType, "IEND", 4) == 0)
+		{
+			break;
+		}
+
+		if (!visitor(chunkType, data + offset + 8, chunkSize))
+		{
+			return false;
+		}
+
+		offset += (size_t)chunkSize + 12;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+size_t PngInfo::GetScratchSize() const
+{
+	return compressedSize + ((size_t)width * GetChannelCount(colorType) + 1) * height;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool ReadPngInfo(const uint8_t* data, size_t size, PngInfo& out_info, std::string* out_error /*= nullptr*/)
+{
+	out_info = PngInfo();
+	bool hasHeader = false;
+	bool hasPalette = false;
+
+	const bool walked = VisitPngChunks(data, size, [&](const uint8_t* chunkType, const uint8_t* chunkData, uint32_t chunkSize)
+	{
+		if (memcmp(chunkType, "IHDR", 4) == 0 && chunkSize >= 13)
+		{
+			out_info.width = (int)ReadBigEndian32(chunkData);
+			out_info.height = (int)ReadBigEndian32(chunkData + 4);
+			out_info.colorType = chunkData[9];
+
+			const uint8_t bitDepth = chunkData[8];
+			const uint8_t interlaceMethod = chunkData[12];
+			const int colorType = out_info.colorType;
+
+			if (bitDepth != 8 || interlaceMethod != 0 || (colorType != PNG_COLOR_TYPE_GRAY && colorType != PNG_COLOR_TYPE_RGB && colorType != PNG_COLOR_TYPE_PALETTE && colorType != PNG_COLOR_TYPE_GRAY_ALPHA && colorType != PNG_COLOR_TYPE_RGBA))
+			{
+				SetError(out_error, "Only 8 bit, non interlaced images are supported");
+				return false;
+			}
+
+			if (out_info.width <= 0 || out_info.height <= 0 || out_info.width > s_maxImageDimension || out_info.height > s_maxImageDimension)
+			{
+				SetError(out_error, "Bad image size");
+				return false;
+			}
+
+			hasHeader = true;
+		}
+		else if (memcmp(chunkType, "PLTE", 4) == 0)
+		{
+			hasPalette = (chunkSize >= 3);
+		}
+		else if (memcmp(chunkType, "IDAT", 4) == 0)
+		{
+			out_info.compressedSize += chunkSize;
+		}
+
+		return true;
+	}, out_error);
+
+	if (!walked)
+	{
+		return false;
+	}
+
+	if (!hasHeader || out_info.compressedSize == 0 || (out_info.colorType == PNG_COLOR_TYPE_PALETTE && !hasPalette))
+	{
+		SetError(out_error, "Missing the header, palette or image data");
+		return false;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Chunk CRCs aren't checked; the zlib stream's own checksum catches damage to the image data
+bool DecodePngInto(const uint8_t* data, size_t size, const PngInfo& info, uint8_t* scratch, uint8_t* out_texels, std::string* out_error /*= nullptr*/)
+{
+	uint8_t palette[256 * 4];
+	memset(palette, 255, sizeof(palette));
+
+	uint8_t* compressedData = scratch;
+	size_t compressedSize = 0;
+
+	VisitPngChunks(data, size, [&](const uint8_t* chunkType, const uint8_t* chunkData, uint32_t chunkSize)
+	{
+		if (memcmp(chunkType, "PLTE", 4) == 0)
+		{
+			const uint32_t paletteCount = (chunkSize / 3 < 256 ? chunkSize / 3 : 256);
+			for (uint32_t colorIndex = 0; colorIndex < paletteCount; ++colorIndex)
+			{
+				memcpy(palette + colorIndex * 4, chunkData + colorIndex * 3, 3);
+			}
+		}
+		else if (memcmp(chunkType, "tRNS", 4) == 0 && info.colorType == PNG_COLOR_TYPE_PALETTE)
+		{
+			for (uint32_t colorIndex = 0; colorIndex < chunkSize && colorIndex < 256; ++colorIndex)
+			{
+				palette[colorIndex * 4 + 3] = chunkData[colorIndex];
+			}
+		}
+		else if (memcmp(chunkType, "IDAT", 4) == 0 && chunkSize <= info.compressedSize - compressedSize)
+		{
+			memcpy(compressedData + compressedSize, chunkData, chunkSize);
+			compressedSize += chunkSize;
+		}
+
+		return true;
+	}, nullptr);
+
+	const int width = info.width;
+	const int height = info.height;
+	const int channelCount = GetChannelCount(info.colorType);
+	const size_t rowSize = (size_t)width * channelCount;
+	uint8_t* rows = scratch + info.compressedSize;
+
+	if (compressedSize != info.compressedSize || !InflateZlib(compressedData, compressedSize, rows, (rowSize + 1) * height))
+	{
+		SetError(out_error, "Corrupt image data");
+		return false;
+	}
+
+	if (!UnfilterRows(rows, height, rowSize, channelCount))
+	{
+		SetError(out_error, "Unknown row filter");
+		return false;
+	}
+
+	for (int rowIndex = 0; rowIndex < height; ++rowIndex)
+	{
+		const uint8_t* source = rows + (size_t)rowIndex * (rowSize + 1) + 1;
+		uint8_t* destination = out_texels + (size_t)rowIndex * width * 4;
+
+		for (int x = 0; x < width; ++x, destination += 4)
+		{
+			switch (info.colorType)
+			{
+			case PNG_COLOR_TYPE_GRAY:		destination[0] = destination[1] = destination[2] = source[x]; destination[3] = 255; break;
+			case PNG_COLOR_TYPE_GRAY_ALPHA:	destination[0] = destination[1] = destination[2] = source[x * 2]; destination[3] = source[x * 2 + 1]; break;
+			case PNG_COLOR_TYPE_RGB:		memcpy(destination, source + x * 3, 3); destination[3] = 255; break;
+			case PNG_COLOR_TYPE_PALETTE:	memcpy(destination, palette + source[x] * 4, 4); break;
+			default:						memcpy(destination, source + x * 4, 4); break;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool DecodePng(const uint8_t* data, size_t size, DecodedImage& out_image, std::string* out_error /*= nullptr*/)
+{
+	PngInfo info;
+	if (!ReadPngInfo(data, size, info, out_error))
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> scratch(info.GetScratchSize());
+	out_image.texels.resize(info.GetTexelsSize());
+
+	if (!DecodePngInto(data, size, info, scratch.data(), out_image.texels.data(), out_error))
+	{
+		return false;
+	}
+
+	out_image.width = info.width;
+	out_image.height = info.height;
+	return true;
+}
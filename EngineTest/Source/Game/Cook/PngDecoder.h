@@ -0,0 +1,66 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Decodes PNG files to RGBA8 for the asset cooker
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// What's needed to decode into memory the caller owns
+struct PngInfo
+{
+	int		width = 0;
+	int		height = 0;
+	int		colorType = 0;
+	size_t	compressedSize = 0;					// Every IDAT chunk together
+
+	size_t	GetTexelsSize() const { return (size_t)width * height * 4; }
+	size_t	GetScratchSize() const;				// The compressed data and the filtered rows, while decoding
+};
+
+// Rows top to bottom, 4 bytes per texel
+struct DecodedImage
+{
+	int						width = 0;
+	int						height = 0;
+	std::vector<uint8_t>	texels;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// 8 bit gray, gray alpha, RGB, RGBA and paletted images, not interlaced, which covers everything under Data.
+// Anything else fails with an error rather than decoding wrong. Safe on corrupt data
+bool DecodePng(const uint8_t* data, size_t size, DecodedImage& out_image, std::string* out_error = nullptr);
+
+// The same in two steps, so the caller can put the scratch space and texels somewhere it reuses.
+// The data must be unchanged between them
+bool ReadPngInfo(const uint8_t* data, size_t size, PngInfo& out_info, std::string* out_error = nullptr);
+bool DecodePngInto(const uint8_t* data, size_t size, const PngInfo& info, uint8_t* scratch, uint8_t* out_texels, std::string* out_error = nullptr);
+
+// zlib stream to exactly expectedSize bytes
+bool InflateZlib(const uint8_t* data, size_t size, uint8_t* out_destination, size_t expectedSize);
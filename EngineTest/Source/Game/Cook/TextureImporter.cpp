@@ -0,0 +1,175 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Cook/TextureImporter.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Engine/Job/Job.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+class ImportFaceJob : public Job
+{
+public:
+	//-----Public Methods-----
+
+	ImportFaceJob(TextureImporter* importer, int faceIndex) : m_importer(importer), m_faceIndex(faceIndex) {}
+
+	virtual void Execute() override { m_importer->ImportFace(m_faceIndex); }
+	virtual void Finalize() override {}
+
+
+private:
+	//-----Private Data-----
+
+	TextureImporter*	m_importer = nullptr;
+	int					m_faceIndex = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static void SetError(std::string* out_error, const std::string& error)
+{
+	if (out_error != nullptr)
+	{
+		*out_error = error;
+	}
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+bool TextureImporter::Import(const std::vector<std::string>& facePaths, const TextureImportSettings& settings, std::string* out_error /*= nullptr*/)
+{
+	m_arena.Reset();
+	m_settings = settings;
+	m_faceCount = 0;
+
+	if (facePaths.size() != 1 && facePaths.size() != TEXTURE_IMPORT_MAX_FACES)
+	{
+		SetError(out_error, "a texture has to have 1 or 6 faces");
+		return false;
+	}
+
+	const int faceCount = (int)facePaths.size();
+	for (int faceIndex = 0; faceIndex < faceCount; ++faceIndex)
+	{
+		FaceImport& face = m_faces[faceIndex];
+		face.file.Close();
+		face.succeeded = false;
+		face.error.clear();
+
+		std::string error;
+		if (!face.file.Open(facePaths[faceIndex].c_str()) || !ReadPngInfo(face.file.GetData(), face.file.GetSize(), face.info, &error))
+		{
+			SetError(out_error, facePaths[faceIndex] + ": " + (error.size() > 0 ? error : "couldn't open it"));
+			return false;
+		}
+
+		const PngInfo& firstInfo = m_faces[0].info;
+		if (face.info.width != firstInfo.width || face.info.height != firstInfo.height || (faceCount > 1 && face.info.width != face.info.height))
+		{
+			SetError(out_error, facePaths[faceIndex] + ": cube map faces have to be square and all the same size");
+			return false;
+		}
+	}
+
+	m_faceCount = faceCount;
+	m_width = m_faces[0].info.width;
+	m_height = m_faces[0].info.height;
+	m_mipCount = (settings.generateMips ? ::GetMipCount(m_width, m_height) : 1);
+
+	// Everything comes out of the arena here, on this thread, so the jobs only touch their own face
+	for (int faceIndex = 0; faceIndex < m_faceCount; ++faceIndex)
+	{
+		FaceImport& face = m_faces[faceIndex];
+		face.scratch = m_arena.Allocate(face.info.GetScratchSize());
+
+		for (int mipLevel = 0; mipLevel < m_mipCount; ++mipLevel)
+		{
+			face.mipTexels[mipLevel] = m_arena.Allocate(GetMipSize(mipLevel));
+		}
+	}
+
+	if (settings.parallel && m_faceCount > 1 && g_jobScheduler != nullptr && g_jobScheduler->GetWorkerCount() > 0)
+	{
+		std::vector<ImportFaceJob> jobs;
+		std::vector<JobHandle> handles;
+		jobs.reserve(m_faceCount);
+		handles.reserve(m_faceCount);
+
+		// Children of the job importing, if any (e.g. a cook job), so waiting on that covers these too
+		const JobHandle parent = JobScheduler::GetCurrentJob();
+		for (int faceIndex = 0; faceIndex < m_faceCount; ++faceIndex)
+		{
+			jobs.emplace_back(this, faceIndex);
+			handles.push_back(g_jobScheduler->Submit(&jobs.back(), parent));
+		}
+
+		for (const JobHandle& handle : handles)
+		{
+			g_jobScheduler->Wait(handle);
+		}
+	}
+	else
+	{
+		for (int faceIndex = 0; faceIndex < m_faceCount; ++faceIndex)
+		{
+			ImportFace(faceIndex);
+		}
+	}
+
+	for (int faceIndex = 0; faceIndex < m_faceCount; ++faceIndex)
+	{
+		FaceImport& face = m_faces[faceIndex];
+		face.file.Close();
+
+		if (!face.succeeded)
+		{
+			SetError(out_error, facePaths[faceIndex] + ": " + face.error);
+			m_faceCount = 0;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void TextureImporter::ImportFace(int faceIndex)
+{
+	FaceImport& face = m_faces[faceIndex];
+	face.succeeded = DecodePngInto(face.file.GetData(), face.file.GetSize(), face.info, face.scratch, face.mipTexels[0], &face.error);
+
+	if (face.succeeded)
+	{
+		for (int mipLevel = 1; mipLevel < m_mipCount; ++mipLevel)
+		{
+			GenerateMip(face.mipTexels[mipLevel - 1], GetMipDimension(m_width, mipLevel - 1), GetMipDimension(m_height, mipLevel - 1), face.mipTexels[mipLevel], m_settings.mipFilter, m_settings.allowSimd);
+		}
+	}
+}
@@ -0,0 +1,98 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Decodes a texture's faces and builds their mip chains in parallel, into memory reused between imports
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Cook/PngDecoder.h"
+#include "Game/Cook/TextureMips.h"
+#include "Game/Framework/LinearArena.h"
+#include "Game/Framework/MappedFile.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct TextureImportSettings
+{
+	MipFilter	mipFilter = MIP_FILTER_BOX;
+	bool		allowSimd = true;
+	bool		parallel = true;						// One job per face on the JobScheduler, if there is one with workers
+	bool		generateMips = true;					// Otherwise only level 0
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+const int TEXTURE_IMPORT_MAX_FACES = 6;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Imports a 2D texture (one path) or a cube map (six, all square and the same size). Every face's headers are
+// read first so all the scratch space and texels can come out of the arena before any job starts; then each
+// face is decoded and mipped by its own job. Inflating is sequential within an image, so a face is the unit of
+// parallelism. Results stay valid until the next Import
+class TextureImporter
+{
+public:
+	//-----Public Methods-----
+
+	TextureImporter() {}
+	TextureImporter(const TextureImporter& copy) = delete;
+
+	bool					Import(const std::vector<std::string>& facePaths, const TextureImportSettings& settings, std::string* out_error = nullptr);
+
+	// Called from the face jobs
+	void					ImportFace(int faceIndex);
+
+	int						GetWidth() const { return m_width; }
+	int						GetHeight() const { return m_height; }
+	int						GetFaceCount() const { return m_faceCount; }
+	int						GetMipCount() const { return m_mipCount; }
+	const uint8_t*			GetMipTexels(int faceIndex, int mipLevel) const { return m_faces[faceIndex].mipTexels[mipLevel]; }
+	size_t					GetMipSize(int mipLevel) const { return (size_t)GetMipDimension(m_width, mipLevel) * GetMipDimension(m_height, mipLevel) * 4; }
+	const LinearArena&		GetArena() const { return m_arena; }
+
+
+private:
+	//-----Private Data-----
+
+	struct FaceImport
+	{
+		MappedFile		file;
+		PngInfo			info;
+		uint8_t*		scratch = nullptr;
+		uint8_t*		mipTexels[32] = {};
+		bool			succeeded = false;
+		std::string		error;
+	};
+
+	LinearArena				m_arena;
+	TextureImportSettings	m_settings;
+	FaceImport				m_faces[TEXTURE_IMPORT_MAX_FACES];
+	int						m_faceCount = 0;
+	int						m_width = 0;
+	int						m_height = 0;
+	int						m_mipCount = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,381 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Cook/TextureMips.h"
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#ifdef TEXTURE_MIPS_SSE_AVAILABLE
+#include <emmintrin.h>
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Weights for the source texels 2x - 2 to 2x + 3 around output texel x, the same for every x since the
+// scale is always exactly one half. Built once, on first use
+struct KaiserWeights
+{
+	static const int TAP_COUNT = 6;
+
+	float weights[TAP_COUNT];
+
+	KaiserWeights();
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char*	s_mipFilterNames[NUM_MIP_FILTERS] = { "box", "kaiser" };
+static const float	s_kaiserAlpha = 4.f;
+static const float	s_kaiserRadius = 3.f;		// In source texels
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Modified Bessel function of the first kind, order 0, by its power series
+static double GetBesselI0(double x)
+{
+	double sum = 1.0;
+	double term = 1.0;
+
+	for (int termIndex = 1; termIndex < 32; ++termIndex)
+	{
+		term *= (x * x) / (4.0 * termIndex * termIndex);
+		sum += term;
+	}
+
+	return sum;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static double GetSinc(double x)
+{
+	const double pi = 3.14159265358979323846;
+	return (x == 0.0 ? 1.0 : sin(pi * x) / (pi * x));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Output texel centers sit between two source texels, so the taps are 0.5, 1.5 and 2.5 texels either side.
+// The sinc is stretched by two for the half rate, and the weights are normalized so flat color stays flat
+KaiserWeights::KaiserWeights()
+{
+	double total = 0.0;
+	double unnormalized[TAP_COUNT];
+
+	for (int tapIndex = 0; tapIndex < TAP_COUNT; ++tapIndex)
+	{
+		const double distance = (double)tapIndex - 2.5;
+		const double t = distance / s_kaiserRadius;
+		const double window = GetBesselI0(s_kaiserAlpha * sqrt(1.0 - t * t)) / GetBesselI0(s_kaiserAlpha);
+
+		unnormalized[tapIndex] = GetSinc(distance * 0.5) * window;
+		total += unnormalized[tapIndex];
+	}
+
+	for (int tapIndex = 0; tapIndex < TAP_COUNT; ++tapIndex)
+	{
+		weights[tapIndex] = (float)(unnormalized[tapIndex] / total);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static const KaiserWeights& GetKaiserWeights()
+{
+	static const KaiserWeights s_weights;
+	return s_weights;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static int ClampIndex(int index, int count)
+{
+	return (index < 0 ? 0 : (index >= count ? count - 1 : index));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint8_t RoundToByte(float value)
+{
+	const long rounded = lrintf(value);
+	return (uint8_t)(rounded < 0 ? 0 : (rounded > 255 ? 255 : rounded));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Rounds the average to nearest, so repeated halving doesn't darken the image
+static void GenerateBoxTexel(const uint8_t* topRow, const uint8_t* bottomRow, int x, int sourceWidth, uint8_t* out_texel)
+{
+	const int leftX = (x * 2 < sourceWidth ? x * 2 : sourceWidth - 1);
+	const int rightX = (leftX + 1 < sourceWidth ? leftX + 1 : leftX);
+
+	for (int channel = 0; channel < 4; ++channel)
+	{
+		const int sum = topRow[leftX * 4 + channel] + topRow[rightX * 4 + channel] + bottomRow[leftX * 4 + channel] + bottomRow[rightX * 4 + channel];
+		out_texel[channel] = (uint8_t)((sum + 2) >> 2);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Four output texels from eight source texels on each of two rows per iteration, summed in 16 bit lanes
+static void GenerateBoxMip(const uint8_t* source, int sourceWidth, int sourceHeight, uint8_t* out_destination, bool useSse)
+{
+	const int width = GetMipDimension(sourceWidth, 1);
+	const int height = GetMipDimension(sourceHeight, 1);
+	const size_t sourceRowSize = (size_t)sourceWidth * 4;
+
+	for (int y = 0; y < height; ++y)
+	{
+		const int topY = (y * 2 < sourceHeight ? y * 2 : sourceHeight - 1);
+		const int bottomY = (topY + 1 < sourceHeight ? topY + 1 : topY);
+		const uint8_t* topRow = source + (size_t)topY * sourceRowSize;
+		const uint8_t* bottomRow = source + (size_t)bottomY * sourceRowSize;
+		uint8_t* destination = out_destination + (size_t)y * width * 4;
+		int x = 0;
+
+#ifdef TEXTURE_MIPS_SSE_AVAILABLE
+		if (useSse && sourceWidth > 1)
+		{
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i rounding = _mm_set1_epi16(2);
+
+			for (; x + 4 <= width; x += 4)
+			{
+				__m128i halves[2];
+
+				for (int halfIndex = 0; halfIndex < 2; ++halfIndex)
+				{
+					const size_t byteOffset = (size_t)(x * 2 + halfIndex * 4) * 4;
+					const __m128i top = _mm_loadu_si128((const __m128i*)(topRow + byteOffset));
+					const __m128i bottom = _mm_loadu_si128((const __m128i*)(bottomRow + byteOffset));
+
+					// Columns summed: texels 0 and 1 in one register, 2 and 3 in the other
+					const __m128i columns01 = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+					const __m128i columns23 = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+
+					// Then each pair of columns
+					halves[halfIndex] = _mm_add_epi16(_mm_unpacklo_epi64(columns01, columns23), _mm_unpackhi_epi64(columns01, columns23));
+				}
+
+				const __m128i low = _mm_srli_epi16(_mm_add_epi16(halves[0], rounding), 2);
+				const __m128i high = _mm_srli_epi16(_mm_add_epi16(halves[1], rounding), 2);
+				_mm_storeu_si128((__m128i*)(destination + x * 4), _mm_packus_epi16(low, high));
+			}
+		}
+#else
+		(void)useSse;
+#endif
+
+		for (; x < width; ++x)
+		{
+			GenerateBoxTexel(topRow, bottomRow, x, sourceWidth, destination + x * 4);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Separable: each row is filtered across into floats at the output width, then those columns down into bytes.
+// The SSE path holds one texel's four channels per register and does the same multiplies and adds in the same order
+static void GenerateKaiserMip(const uint8_t* source, int sourceWidth, int sourceHeight, uint8_t* out_destination, bool useSse)
+{
+	const int width = GetMipDimension(sourceWidth, 1);
+	const int height = GetMipDimension(sourceHeight, 1);
+	const float* weights = GetKaiserWeights().weights;
+	const int tapCount = KaiserWeights::TAP_COUNT;
+
+	std::vector<float> filteredRows((size_t)width * sourceHeight * 4);
+
+#ifdef TEXTURE_MIPS_SSE_AVAILABLE
+	if (useSse)
+	{
+		const __m128i zero = _mm_setzero_si128();
+
+		for (int sourceY = 0; sourceY < sourceHeight; ++sourceY)
+		{
+			const uint8_t* sourceRow = source + (size_t)sourceY * sourceWidth * 4;
+			float* filteredRow = filteredRows.data() + (size_t)sourceY * width * 4;
+
+			for (int x = 0; x < width; ++x)
+			{
+				__m128 sum = _mm_setzero_ps();
+				for (int tapIndex = 0; tapIndex < tapCount; ++tapIndex)
+				{
+					int texelBits;
+					memcpy(&texelBits, sourceRow + ClampIndex(x * 2 - 2 + tapIndex, sourceWidth) * 4, 4);
+
+					const __m128i texel = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(texelBits), zero), zero);
+					sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(texel), _mm_set1_ps(weights[tapIndex])));
+				}
+
+				_mm_storeu_ps(filteredRow + x * 4, sum);
+			}
+		}
+
+		for (int y = 0; y < height; ++y)
+		{
+			const float* rows[KaiserWeights::TAP_COUNT];
+			for (int tapIndex = 0; tapIndex < tapCount; ++tapIndex)
+			{
+				rows[tapIndex] = filteredRows.data() + (size_t)ClampIndex(y * 2 - 2 + tapIndex, sourceHeight) * width * 4;
+			}
+
+			uint8_t* destination = out_destination + (size_t)y * width * 4;
+			for (int x = 0; x < width; ++x)
+			{
+				__m128 sum = _mm_setzero_ps();
+				for (int tapIndex = 0; tapIndex < tapCount; ++tapIndex)
+				{
+					sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(rows[tapIndex] + x * 4), _mm_set1_ps(weights[tapIndex])));
+				}
+
+				// Rounds to nearest, then saturates down to bytes
+				const __m128i rounded = _mm_cvtps_epi32(sum);
+				const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(rounded, rounded), zero);
+				const int texelBits = _mm_cvtsi128_si32(packed);
+				memcpy(destination + x * 4, &texelBits, 4);
+			}
+		}
+
+		return;
+	}
+#else
+	(void)useSse;
+#endif
+
+	for (int sourceY = 0; sourceY < sourceHeight; ++sourceY)
+	{
+		const uint8_t* sourceRow = source + (size_t)sourceY * sourceWidth * 4;
+		float* filteredRow = filteredRows.data() + (size_t)sourceY * width * 4;
+
+		for (int x = 0; x < width; ++x)
+		{
+			float sum[4] = { 0.f, 0.f, 0.f, 0.f };
+			for (int tapIndex = 0; tapIndex < tapCount; ++tapIndex)
+			{
+				const uint8_t* texel = sourceRow + ClampIndex(x * 2 - 2 + tapIndex, sourceWidth) * 4;
+				for (int channel = 0; channel < 4; ++channel)
+				{
+					sum[channel] += (float)texel[channel] * weights[tapIndex];
+				}
+			}
+
+			memcpy(filteredRow + x * 4, sum, sizeof(sum));
+		}
+	}
+
+	for (int y = 0; y < height; ++y)
+	{
+		uint8_t* destination = out_destination + (size_t)y * width * 4;
+
+		for (int x = 0; x < width; ++x)
+		{
+			float sum[4] = { 0.f, 0.f, 0.f, 0.f };
+			for (int tapIndex = 0; tapIndex < tapCount; ++tapIndex)
+			{
+				const float* filteredTexel = filteredRows.data() + ((size_t)ClampIndex(y * 2 - 2 + tapIndex, sourceHeight) * width + x) * 4;
+				for (int channel = 0; channel < 4; ++channel)
+				{
+					sum[channel] += filteredTexel[channel] * weights[tapIndex];
+				}
+			}
+
+			for (int channel = 0; channel < 4; ++channel)
+			{
+				destination[x * 4 + channel] = RoundToByte(sum[channel]);
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+int GetMipCount(int width, int height)
+{
+	int largest = (width > height ? width : height);
+	int mipCount = 1;
+
+	while (largest > 1)
+	{
+		largest >>= 1;
+		mipCount++;
+	}
+
+	return mipCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+int GetMipDimension(int baseDimension, int mipLevel)
+{
+	const int dimension = (baseDimension >> mipLevel);
+	return (dimension > 0 ? dimension : 1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+size_t GetMipChainSize(int width, int height, int mipCount)
+{
+	size_t size = 0;
+	for (int mipLevel = 0; mipLevel < mipCount; ++mipLevel)
+	{
+		size += (size_t)GetMipDimension(width, mipLevel) * GetMipDimension(height, mipLevel) * 4;
+	}
+
+	return size;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void GenerateMip(const uint8_t* source, int sourceWidth, int sourceHeight, uint8_t* out_destination, MipFilter filter /*= MIP_FILTER_BOX*/, bool allowSimd /*= true*/)
+{
+	if (filter == MIP_FILTER_KAISER)
+	{
+		GenerateKaiserMip(source, sourceWidth, sourceHeight, out_destination, allowSimd);
+	}
+	else
+	{
+		GenerateBoxMip(source, sourceWidth, sourceHeight, out_destination, allowSimd);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+const char* GetMipFilterName(MipFilter filter)
+{
+	return (filter >= 0 && filter < NUM_MIP_FILTERS ? s_mipFilterNames[filter] : "unknown");
+}
+
+
+//-------------------------------------------------------------------------------------------------
+MipFilter GetMipFilterFromName(const char* name, MipFilter defaultFilter)
+{
+	for (int filterIndex = 0; filterIndex < NUM_MIP_FILTERS; ++filterIndex)
+	{
+		if (strcmp(name, s_mipFilterNames[filterIndex]) == 0)
+		{
+			return (MipFilter)filterIndex;
+		}
+	}
+
+	return defaultFilter;
+}
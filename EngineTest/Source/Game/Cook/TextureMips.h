@@ -0,0 +1,56 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Box filtered mip chains for RGBA8 textures
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define TEXTURE_MIPS_SSE_AVAILABLE
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+enum MipFilter
+{
+	MIP_FILTER_BOX,			// Average of each 2x2 block; cheapest, and softens a little with every level
+	MIP_FILTER_KAISER,		// Kaiser windowed sinc over 6x6 texels; keeps detail that box filtering blurs away
+	NUM_MIP_FILTERS
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Down to and including 1x1, the way D3D sizes a full chain
+int			GetMipCount(int width, int height);
+int			GetMipDimension(int baseDimension, int mipLevel);
+size_t		GetMipChainSize(int width, int height, int mipCount);	// Bytes for every level at 4 bytes per texel
+
+// Writes the next level down (half size, rounded down, at least 1) of a tightly packed RGBA8 image.
+// Samples past the edge clamp to it. With allowSimd the SSE path is used where the platform has it; the box
+// filter gives exactly the same bytes either way, the Kaiser filter can differ by one from float rounding
+void		GenerateMip(const uint8_t* source, int sourceWidth, int sourceHeight, uint8_t* out_destination, MipFilter filter = MIP_FILTER_BOX, bool allowSimd = true);
+
+const char*	GetMipFilterName(MipFilter filter);
+MipFilter	GetMipFilterFromName(const char* name, MipFilter defaultFilter);
@@ -8,12 +8,17 @@
 /// INCLUDES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 #include "Game/Entity/Player.h"
-#include "Engine/Core/DevConsole.h"
+#include "Game/Framework/GameInput.h"
+#include "Game/Framework/PerfCounters.h"
+#include "Game/Physics/BodyEngineConversions.h"
+#include "Game/Physics/BodyScene.h"
 #include "Engine/Core/EngineCommon.h"
 #include "Engine/IO/InputSystem.h"
 #include "Engine/Math/MathUtils.h"
-#include "Engine/Physics/Rigidbody/Rigidbody.h"
+#ifndef HEADLESS_ONLY
+#include "Engine/Core/DevConsole.h"
 #include "Engine/Render/Camera.h"
+#endif
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// DEFINES
@@ -26,7 +31,7 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// GLOBALS AND STATICS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
-Vector3 Player::s_cameraOffset = Vector3(0.f, 1.5f, 0.f);
+Vector3 Player::s_cameraOffset = Vector3(0.f, 0.5f, 0.f); // From the capsule's center, which the transform sits on
 float Player::s_maxMoveSpeed = 5.0f;
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -38,22 +43,20 @@ float Player::s_maxMoveSpeed = 5.0f;
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 
 //-------------------------------------------------------------------------------------------------
-Player::Player(Camera* camera)
+// Headless-only builds have no camera to give it, and only ever turn the Player itself
+Player::Player(Camera* camera, BodyScene* bodyScene, BodyHandle body)
 	: m_camera(camera)
+	, m_bodyScene(bodyScene)
+	, m_body(body)
 {
+#ifndef HEADLESS_ONLY
 	m_camera->transform.SetParentTransform(&transform);
 	m_camera->SetPosition(s_cameraOffset);
 	m_camera->SetRotationEulerAnglesDegrees(Vector3::ZERO);
+#endif
 
-	collider = new CapsuleCollider(this, Capsule3D(Vector3(0.f, 0.5f, 0.f), Vector3(0.f, 1.5f, 0.f), 0.5f));
-
-	rigidBody = new RigidBody(&transform);
-	rigidBody->SetInverseMass(1.f);
-	rigidBody->SetInertiaTensor_Capsule(1.0f, 1.0f);
-	rigidBody->SetAffectedByGravity(true);
-	rigidBody->SetRotationLocked(true);
-	rigidBody->SetMaxLateralSpeed(s_maxMoveSpeed);
-	rigidBody->SetCanSleep(false);
+	// Only drawn; the body does the colliding
+	collider = new CapsuleCollider(this, Capsule3D(Vector3(0.f, -0.5f, 0.f), Vector3(0.f, 0.5f, 0.f), 0.5f));
 }
 
 
@@ -71,40 +74,47 @@ void Player::ProcessInput(float deltaSeconds)
 
 	// Translate
 	Vector3 moveDir = Vector3::ZERO;
-	if (g_inputSystem->IsKeyPressed('W')) { moveDir.z += 1.f; }		// Forward
-	if (g_inputSystem->IsKeyPressed('S')) { moveDir.z -= 1.f; }		// Left
-	if (g_inputSystem->IsKeyPressed('A')) { moveDir.x -= 1.f; }		// Back
-	if (g_inputSystem->IsKeyPressed('D')) { moveDir.x += 1.f; }		// Right
+	if (g_gameInput->IsKeyPressed('W')) { moveDir.z += 1.f; }		// Forward
+	if (g_gameInput->IsKeyPressed('S')) { moveDir.z -= 1.f; }		// Left
+	if (g_gameInput->IsKeyPressed('A')) { moveDir.x -= 1.f; }		// Back
+	if (g_gameInput->IsKeyPressed('D')) { moveDir.x += 1.f; }		// Right
 	moveDir.SafeNormalize(moveDir);
 
-	rigidBody->SetAcceleration(transform.TransformDirection(moveDir * 50.f));
+	BodyStore& store = m_bodyScene->GetStore();
+	const int bodyIndex = GetBodyIndex();
 
-	if (g_inputSystem->WasKeyJustPressed(InputSystem::KEYBOARD_SHIFT))
-	{
-		rigidBody->SetMaxLateralSpeed(2.f * s_maxMoveSpeed);
-	}
-	else if (g_inputSystem->WasKeyJustReleased(InputSystem::KEYBOARD_SHIFT))
+	if (bodyIndex >= 0)
 	{
-		rigidBody->SetMaxLateralSpeed(s_maxMoveSpeed);
+		store.SetFloat3(bodyIndex, BODY_ACCELERATION_X, ToFloat3(transform.TransformDirection(moveDir * 50.f)));
+
+		if (g_gameInput->WasKeyJustPressed(InputSystem::KEYBOARD_SHIFT))
+		{
+			store.GetField(BODY_MAX_LATERAL_SPEED)[bodyIndex] = 2.f * s_maxMoveSpeed;
+		}
+		else if (g_gameInput->WasKeyJustReleased(InputSystem::KEYBOARD_SHIFT))
+		{
+			store.GetField(BODY_MAX_LATERAL_SPEED)[bodyIndex] = s_maxMoveSpeed;
+		}
 	}
 
 	// Rotate
-	Mouse& mouse = InputSystem::GetMouse();
-	IntVector2 mouseDelta = mouse.GetMouseDelta();
+	IntVector2 mouseDelta = g_gameInput->GetMouseDelta();
 	Vector2 rot = Vector2((float)mouseDelta.y, (float)mouseDelta.x); // Flip X and Y
 
 	const float degreesPerSecond = 30.f;
 	Vector3 deltaDegrees = Vector3(rot.x, rot.y, 0.f) * degreesPerSecond * deltaSeconds;
 	transform.SetRotation(transform.GetWorldRotation().GetAsEulerAnglesDegrees() + Vector3(0.f, deltaDegrees.y, 0.f));
 
+#ifndef HEADLESS_ONLY
 	Vector3 cameraDegrees = m_camera->GetRotationAsEulerAnglesDegrees() + Vector3(deltaDegrees.x, 0.f, 0.f);
 	cameraDegrees.x = Clamp(cameraDegrees.x, -70.f, 70.f);
 
 	m_camera->SetRotationEulerAnglesDegrees(cameraDegrees);
+#endif
 
-	if (g_inputSystem->WasKeyJustPressed(InputSystem::KEYBOARD_SPACEBAR))
+	if (bodyIndex >= 0 && g_gameInput->WasKeyJustPressed(InputSystem::KEYBOARD_SPACEBAR))
 	{
-		rigidBody->AddWorldVelocity(Vector3(0.f, 5.f, 0.f));
+		store.SetFloat3(bodyIndex, BODY_VELOCITY_X, store.GetFloat3(bodyIndex, BODY_VELOCITY_X) + Float3(0.f, 5.f, 0.f));
 		//rigidBody->AddLocalForce(Vector3::Y_AXIS * 1000.f);
 	}
 }
@@ -120,7 +130,40 @@ void Player::Update(float deltaSeconds)
 //-------------------------------------------------------------------------------------------------
 void Player::Render() const
 {
-	Vector3 lateralVelocity = rigidBody->GetVelocityWs();
+	const int bodyIndex = GetBodyIndex();
+	if (bodyIndex < 0)
+	{
+		return;
+	}
+
+	Float3 lateralVelocity = m_bodyScene->GetStore().GetFloat3(bodyIndex, BODY_VELOCITY_X);
 	lateralVelocity.y = 0.f;
-	ConsolePrintf("Speed: %.2f", lateralVelocity.GetLength());
+	g_perfCounters->SetValue(PERF_COUNTER_PLAYER_SPEED, Length(lateralVelocity));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// A capsule as tall as the player, standing upright with its center at the given position
+BodyDefinition Player::GetBodyDefinition(const Vector3& position)
+{
+	BodyDefinition definition;
+	definition.shapeType = BODY_SHAPE_CAPSULE;
+	definition.radius = 0.5f;
+	definition.halfHeight = 0.5f;
+	definition.inverseMass = 1.f;
+	definition.position = ToFloat3(position);
+	definition.maxLateralSpeed = s_maxMoveSpeed;
+	definition.affectedByGravity = true;
+	definition.rotationLocked = true;	// Input turns the player, physics never does
+	definition.canSleep = false;
+
+	return definition;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// -1 if the body has been removed
+int Player::GetBodyIndex() const
+{
+	return m_bodyScene->GetStore().GetIndex(m_body);
 }
@@ -8,6 +8,7 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// INCLUDES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyStore.h"
 #include "Engine/Core/Entity.h"
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -17,6 +18,7 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodyScene;
 class Camera;
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -33,18 +35,28 @@ class Player : public Entity
 public:
 	//-----Public Methods-----
 
-	Player(Camera* camera);
+	Player(Camera* camera, BodyScene* bodyScene, BodyHandle body);
 	~Player();
 
 	void			ProcessInput(float deltaSeconds);
 	virtual void	Update(float deltaSeconds) override;
 	virtual void	Render() const override;
 
+	static BodyDefinition GetBodyDefinition(const Vector3& position);
+
+
+private:
+	//-----Private Methods-----
+
+	int GetBodyIndex() const;
+
 
 private:
 	//-----Private Data-----
 
-	Camera* m_camera = nullptr;
+	Camera*		m_camera = nullptr;
+	BodyScene*	m_bodyScene = nullptr;
+	BodyHandle	m_body;			// Owned by the Game, which adds it before the Player is made and removes it on despawn
 
 	static Vector3 s_cameraOffset;
 	static float	s_maxMoveSpeed;
@@ -0,0 +1,126 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#ifdef ALLOCATION_COUNTER_ENABLED
+// Constant initialized, so allocations made by other static initializers are counted too
+static std::atomic<uint64_t> s_allocationCount(0);
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#ifdef ALLOCATION_COUNTER_ENABLED
+//-------------------------------------------------------------------------------------------------
+static void* AllocateCounted(size_t size)
+{
+	s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+	return malloc(size > 0 ? size : 1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+uint64_t GetAllocationCount()
+{
+	return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Replacing the global operators (all of the C++14 ones) is the only way to see allocations made inside the
+// engine and the standard library as well as our own
+void* operator new(size_t size)
+{
+	void* memory = AllocateCounted(size);
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return AllocateCounted(size);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return AllocateCounted(size);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void operator delete[](void* memory) noexcept
+{
+	free(memory);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void operator delete(void* memory, size_t) noexcept
+{
+	free(memory);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void operator delete[](void* memory, size_t) noexcept
+{
+	free(memory);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+	free(memory);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+	free(memory);
+}
+#endif
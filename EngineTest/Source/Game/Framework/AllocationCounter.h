@@ -0,0 +1,44 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Counts every heap allocation made through the global operator new
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstdint>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Replaces the global operator new/delete so every allocation is counted, which every allocation then pays for.
+// Defined by the Debug and Headless configurations and the CMake target; without it the count is always 0
+//#define ALLOCATION_COUNTER_ENABLED
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef ALLOCATION_COUNTER_ENABLED
+// Total since startup, across all threads; take the difference between two reads for a frame's worth
+uint64_t	GetAllocationCount();
+inline bool	IsAllocationCounterEnabled() { return true; }
+#else
+inline uint64_t	GetAllocationCount() { return 0; }
+inline bool		IsAllocationCounterEnabled() { return false; }
+#endif
@@ -7,23 +7,22 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// INCLUDES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
-#define WIN32_LEAN_AND_MEAN	
-#include <windows.h>
+#include "Game/Framework/AllocationCounter.h"
 #include "Game/Framework/App.h"
+#include "Game/Framework/FrameArena.h"
 #include "Game/Framework/Game.h"
-#include "Game/Framework/GameCommands.h"
 #include "Game/Framework/GameCommon.h"
+#include "Game/Framework/GameInput.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/PerfCounters.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Framework/ResourcePack.h"
+#include "Game/Framework/ResourceStreamer.h"
+#include "Game/Render/DebugDraw.h"
+#include "Game/Render/DebugDrawBackend.h"
 #include "Engine/Event/EventSystem.h"
-#include "Engine/Core/ConsoleCommand.h"
-#include "Engine/Core/DevConsole.h"
 #include "Engine/Core/EngineCommon.h"
-#include "Engine/Core/Window.h"
-#include "Engine/IO/InputSystem.h"
 #include "Engine/Job/JobSystem.h"
-#include "Engine/Render/DX11Common.h"
-#include "Engine/Render/RenderContext.h"
-#include "Engine/Render/Debug/DebugRenderSystem.h"
-#include "Engine/Resource/ResourceSystem.h"
 #include "Engine/Time/Clock.h"
 #include "Engine/Utility/StringID.h"
 
@@ -44,53 +43,6 @@ App* g_app = nullptr;
 /// C FUNCTIONS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 
-//-------------------------------------------------------------------------------------------------
-bool AppMessageHandler(unsigned int msg, size_t wParam, size_t lParam)
-{
-	UNUSED(wParam);
-	UNUSED(lParam);
-
-	switch (msg)
-	{
-	case WM_CLOSE: // App close requested via "X" button, "Close Window" on task bar, or "Close" from system menu, or Alt-F4
-	{
-		g_app->Quit();
-		return true;
-	}
-	case WM_KEYDOWN:
-	{
-		unsigned char asKey = (unsigned char)wParam;
-		if (asKey == VK_ESCAPE)
-		{
-			g_app->Quit();
-			return true;
-		}
-		break;
-	}
-	}
-
-	return false;
-}
-
-
-//-------------------------------------------------------------------------------------------------
-void RunMessagePump()
-{
-	MSG queuedMessage;
-	for (;;)
-	{
-		const BOOL wasMessagePresent = PeekMessage(&queuedMessage, NULL, 0, 0, PM_REMOVE);
-		if (!wasMessagePresent)
-		{
-			break;
-		}
-
-		TranslateMessage(&queuedMessage);
-		DispatchMessage(&queuedMessage); // This tells Windows to call the "WindowsMessageHandlingProcedure" above
-	}
-}
-
-
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// CLASS IMPLEMENTATIONS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -108,24 +60,31 @@ App::~App()
 
 
 //-------------------------------------------------------------------------------------------------
-void App::Initialize()
+// Brings up only the systems the simulation needs; no window, renderer, input or console
+void App::InitializeHeadless(const HeadlessSettings& settings)
 {
 	g_app = new App();
+	g_app->m_isHeadless = true;
+	g_app->m_headlessSettings = settings;
 
 	StringIdSystem::Initialize();
 	EventSystem::Initialize();
-	Window::Initialize((21.f / 9.f), "Hello");
-	g_window->RegisterMessageHandler(AppMessageHandler);
 	Clock::ResetMaster();
-	RenderContext::Initialize();
-	InputSystem::Initialize();
+	GameInput::Initialize();
 	JobSystem::Initialize();
-	ResourceSystem::Initialize();
-	DevConsole::Initialize();
-	DebugRenderSystem::Initialize();
+	Profiler::Initialize();
+	Profiler::SetThreadName("Main");
+	PerfCounters::Initialize();
+	FrameArena::Initialize();
+	DebugDraw::Initialize();
+	g_app->m_debugDrawBackend = new NullDebugDrawBackend();
+	JobScheduler::Initialize(settings.workerThreadCount);
+	ResourcePack::Initialize();
+	ResourceStreamer::Initialize();
 
 	g_app->m_game = new Game();
-	g_app->RegisterGameCommands();
+	g_app->m_game->SetFixedDeltaSeconds(settings.fixedDeltaSeconds);
+	g_app->m_startRealSeconds = Profiler::GetSeconds();
 }
 
 
@@ -134,14 +93,24 @@ void App::Shutdown()
 {
 	SAFE_DELETE(g_app->m_game);
 
-	DebugRenderSystem::Shutdown();
-	ResourceSystem::Shutdown();
-	DevConsole::Shutdown();
+#ifndef HEADLESS_ONLY
+	if (!g_app->m_isHeadless)
+	{
+		ShutdownWindowed();
+		return;
+	}
+#endif
+
+	ResourceStreamer::Shutdown();
+	ResourcePack::Shutdown();
+	JobScheduler::Shutdown();
+	SAFE_DELETE(g_app->m_debugDrawBackend);
+	DebugDraw::Shutdown();
+	FrameArena::Shutdown();
+	PerfCounters::Shutdown();
+	Profiler::Shutdown();
 	JobSystem::Shutdown();
-	InputSystem::Shutdown();
-	RenderContext::Shutdown();
-	g_window->UnregisterMessageHandler(AppMessageHandler);
-	Window::Shutdown();
+	GameInput::Shutdown();
 	EventSystem::Shutdown();
 	StringIdSystem::Shutdown();
 
@@ -152,67 +121,114 @@ void App::Shutdown()
 //-------------------------------------------------------------------------------------------------
 void App::RunFrame()
 {
-	Clock::BeginMasterFrame();
-	RunMessagePump();
+	const double frameStartSeconds = Profiler::GetSeconds();
+	g_frameArena->BeginFrame();
+	g_profiler->BeginFrame();
+
+#ifdef HEADLESS_ONLY
+	RunHeadlessFrame();
+#else
+	if (m_isHeadless)
+	{
+		RunHeadlessFrame();
+	}
+	else
+	{
+		RunWindowedFrame();
+	}
+#endif
 
-	// Begin Frames...
-	g_inputSystem->BeginFrame();
-	g_renderContext->BeginFrame();
-	g_devConsole->BeginFrame();
-	g_eventSystem->BeginFrame();
+	g_profiler->EndFrame();
+
+	PublishFrameCounters(Profiler::GetSeconds() - frameStartSeconds);
+}
 
-	// Game Frame
-	ProcessInput();
-	Update();
-	Render();
 
-	// End Frames...
-	g_devConsole->EndFrame();
-	g_renderContext->EndFrame();
-	g_inputSystem->EndFrame();
+//-------------------------------------------------------------------------------------------------
+// Everything the frame loop itself knows; the game and physics set their own counters as they go
+void App::PublishFrameCounters(double frameSeconds)
+{
+	const uint64_t allocationCount = GetAllocationCount();
+
+	g_perfCounters->SetValue(PERF_COUNTER_FRAME_TIME, frameSeconds);
+#ifdef ALLOCATION_COUNTER_ENABLED
+	g_perfCounters->SetValue(PERF_COUNTER_ALLOCATION_COUNT, (double)(allocationCount - m_lastAllocationCount));
+#endif
+	g_perfCounters->SetValue(PERF_COUNTER_JOB_QUEUE_DEPTH, (double)g_jobScheduler->TakePeakQueuedJobCount());
+	g_perfCounters->SetValue(PERF_COUNTER_FRAME_ARENA_BYTES, (double)g_frameArena->GetUsedSize());
+	g_perfCounters->EndFrame();
+
+	m_lastAllocationCount = allocationCount;
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void App::Quit()
+double App::GetElapsedRealSeconds() const
 {
-	m_isQuitting = true;
+	return Profiler::GetSeconds() - m_startRealSeconds;
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void App::ProcessInput()
+void App::Quit()
 {
-	if (g_devConsole->IsActive())
-	{
-		g_devConsole->ProcessInput();
-	}
-	else
-	{
-		m_game->ProcessInput();
-	}
+	m_isQuitting = true;
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void App::Update()
+void App::FinalizeLoads()
 {
-	m_game->Update();
-	g_devConsole->Update();
+	PROFILE_SCOPE("Finalize Loads");
+	g_resourceStreamer->FinalizeLoads();
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void App::Render()
+// Everything debug drawn this frame, from any thread, as a few batched draws. Headless, nothing draws them, but
+// flushing keeps the streams from growing forever, and the counters show what would be drawn
+void App::FlushDebugDraw()
 {
-	m_game->Render();
-	g_debugRenderSystem->Render();
-	g_devConsole->Render();
+	const DebugDrawStats stats = g_debugDraw->Flush(*m_debugDrawBackend);
+
+	g_perfCounters->SetValue(PERF_COUNTER_DEBUG_DRAW_COUNT, (double)stats.drawCount);
+	g_perfCounters->SetValue(PERF_COUNTER_DEBUG_DRAW_VERTICES, (double)stats.vertexCount);
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void App::RegisterGameCommands()
+// Steps the game with a fixed timestep, ignoring vsync and render cost, until a frame or time limit is hit
+void App::RunHeadlessFrame()
 {
-	ConsoleCommand::Register(SID("exit"), "Shuts down the program", "exit (NO_PARAMS)", Command_Exit, false);
+	PROFILE_SCOPE("Frame");
+
+	Clock::BeginMasterFrame();
+	g_eventSystem->BeginFrame();
+
+	// Only replays have input to give the game
+	if (g_gameInput->IsReplaying())
+	{
+		PROFILE_SCOPE("Process Input");
+		g_gameInput->BeginFrame(0.f, false);
+
+		if (g_gameInput->IsGameFocused())
+		{
+			m_game->ProcessInput();
+		}
+	}
+
+	m_game->Update();
+	FinalizeLoads();
+	FlushDebugDraw();
+	m_frameCount++;
+
+	// A replay ends the run on its last frame, so every frame run (and written to the stats) is a recorded one
+	const bool frameLimitHit = (m_headlessSettings.maxFrames > 0 && m_frameCount >= m_headlessSettings.maxFrames);
+	const bool timeLimitHit = (m_headlessSettings.maxRealSeconds > 0.f && GetElapsedRealSeconds() >= (double)m_headlessSettings.maxRealSeconds);
+	const bool replayFinished = (g_gameInput->IsReplaying() && g_gameInput->GetReplayFrameIndex() >= g_gameInput->GetReplayFrameCount());
+
+	if (frameLimitHit || timeLimitHit || replayFinished)
+	{
+		Quit();
+	}
 }
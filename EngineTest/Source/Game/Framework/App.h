@@ -8,16 +8,32 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// INCLUDES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstdint>
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// DEFINES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 
+// Defined by the headless-only builds (the Headless configurations and the CMake target), which leave out
+// App_Windowed.cpp, Main_Win.cpp, GameCommands.cpp and DebugRenderSystemBackend.cpp, and compile out what the
+// shared files only do windowed, so nothing windowed, DX11, input or console needs to link
+//#define HEADLESS_ONLY
+
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+class DebugDrawBackend;
 class Game;
 
+// Settings for running the simulation without a window, renderer or input
+struct HeadlessSettings
+{
+	float	fixedDeltaSeconds = (1.f / 60.f);
+	int		maxFrames = 3600;		// <= 0 for no frame limit
+	float	maxRealSeconds = 0.f;	// <= 0 for no time budget
+	int		workerThreadCount = -1;	// For the JobScheduler; < 0 for one per core, 0 to run jobs inline
+};
+
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// GLOBALS AND STATICS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -36,30 +52,49 @@ public:
 	~App();
 
 	static void Initialize();
+	static void InitializeHeadless(const HeadlessSettings& settings);
 	static void Shutdown();
 
 	void RunFrame();
 	void Quit();
 
-	bool IsQuitting() const { return m_isQuitting; }
+	bool	IsQuitting() const { return m_isQuitting; }
+	bool	IsHeadless() const { return m_isHeadless; }
+	int		GetFrameCount() const { return m_frameCount; }
+	double	GetElapsedRealSeconds() const;
 
 
 private:
 	//-----Private Methods-----
 
-	// "One Frame"
+	// "One Frame", the windowed ones live in App_Windowed.cpp
 	void ProcessInput();
 	void Update();
+	void FinalizeLoads();
 	void Render();
+	void FlushDebugDraw();
+	void DrawStatsOverlay() const;
+
+	static void ShutdownWindowed();
 
+	void RunWindowedFrame();
+	void RunHeadlessFrame();
 	void RegisterGameCommands();
+	void PublishFrameCounters(double frameSeconds);
 
 
 private:
 	//-----Private Data-----
 
-	bool m_isQuitting = false;
-	Game* m_game = nullptr;
+	bool				m_isQuitting = false;
+	bool				m_isHeadless = false;
+	Game*				m_game = nullptr;
+
+	HeadlessSettings	m_headlessSettings;
+	int					m_frameCount = 0;
+	double				m_startRealSeconds = 0.0;
+	uint64_t			m_lastAllocationCount = 0;
+	DebugDrawBackend*	m_debugDrawBackend = nullptr;	// The DebugRenderSystem windowed; headless, one that only counts what would be drawn
 
 };
 
@@ -0,0 +1,306 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN	
+#include <windows.h>
+#endif
+#include "Game/Framework/App.h"
+#include "Game/Framework/FrameArena.h"
+#include "Game/Framework/Game.h"
+#include "Game/Framework/GameCommands.h"
+#include "Game/Framework/GameCommon.h"
+#include "Game/Framework/GameInput.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/PerfCounters.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Framework/ResourcePack.h"
+#include "Game/Framework/ResourceStreamer.h"
+#include "Game/Render/DebugDraw.h"
+#include "Game/Render/DebugRenderSystemBackend.h"
+#include "Engine/Event/EventSystem.h"
+#include "Engine/Core/ConsoleCommand.h"
+#include "Engine/Core/DevConsole.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Core/Window.h"
+#include "Engine/IO/InputSystem.h"
+#include "Engine/Job/JobSystem.h"
+#include "Engine/Math/Vector2.h"
+#include "Engine/Render/DX11Common.h"
+#include "Engine/Render/RenderContext.h"
+#include "Engine/Render/Debug/DebugRenderSystem.h"
+#include "Engine/Resource/ResourceSystem.h"
+#include "Engine/Time/Clock.h"
+#include "Engine/Utility/StringID.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const float s_statsOverlayLineHeight = 16.f;
+static const float s_statsOverlayMargin = 8.f;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef _WIN32
+//-------------------------------------------------------------------------------------------------
+bool AppMessageHandler(unsigned int msg, size_t wParam, size_t lParam)
+{
+	UNUSED(wParam);
+	UNUSED(lParam);
+
+	switch (msg)
+	{
+	case WM_CLOSE: // App close requested via "X" button, "Close Window" on task bar, or "Close" from system menu, or Alt-F4
+	{
+		g_app->Quit();
+		return true;
+	}
+	case WM_KEYDOWN:
+	{
+		unsigned char asKey = (unsigned char)wParam;
+		if (asKey == VK_ESCAPE)
+		{
+			g_app->Quit();
+			return true;
+		}
+		break;
+	}
+	}
+
+	return false;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void RunMessagePump()
+{
+	MSG queuedMessage;
+	for (;;)
+	{
+		const BOOL wasMessagePresent = PeekMessage(&queuedMessage, NULL, 0, 0, PM_REMOVE);
+		if (!wasMessagePresent)
+		{
+			break;
+		}
+
+		TranslateMessage(&queuedMessage);
+		DispatchMessage(&queuedMessage); // This tells Windows to call the "WindowsMessageHandlingProcedure" above
+	}
+}
+#endif
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void App::Initialize()
+{
+	g_app = new App();
+
+	StringIdSystem::Initialize();
+	EventSystem::Initialize();
+	Window::Initialize((21.f / 9.f), "Hello");
+#ifdef _WIN32
+	g_window->RegisterMessageHandler(AppMessageHandler);
+#endif
+	Clock::ResetMaster();
+	RenderContext::Initialize();
+	InputSystem::Initialize();
+	GameInput::Initialize();
+	JobSystem::Initialize();
+	Profiler::Initialize();
+	Profiler::SetThreadName("Main");
+	PerfCounters::Initialize();
+	FrameArena::Initialize();
+	DebugDraw::Initialize();
+	g_app->m_debugDrawBackend = new DebugRenderSystemBackend();
+	JobScheduler::Initialize();
+	ResourcePack::Initialize();
+	ResourceSystem::Initialize();
+	ResourceStreamer::Initialize();
+	DevConsole::Initialize();
+	DebugRenderSystem::Initialize();
+
+	g_app->m_game = new Game();
+	g_app->RegisterGameCommands();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The windowed half of App::Shutdown, once the game is gone
+void App::ShutdownWindowed()
+{
+	DebugRenderSystem::Shutdown();
+	ResourceStreamer::Shutdown();
+	ResourceSystem::Shutdown();
+	ResourcePack::Shutdown();
+	DevConsole::Shutdown();
+	JobScheduler::Shutdown();
+	SAFE_DELETE(g_app->m_debugDrawBackend);
+	DebugDraw::Shutdown();
+	FrameArena::Shutdown();
+	PerfCounters::Shutdown();
+	Profiler::Shutdown();
+	JobSystem::Shutdown();
+	GameInput::Shutdown();
+	InputSystem::Shutdown();
+	RenderContext::Shutdown();
+#ifdef _WIN32
+	g_window->UnregisterMessageHandler(AppMessageHandler);
+#endif
+	Window::Shutdown();
+	EventSystem::Shutdown();
+	StringIdSystem::Shutdown();
+
+	SAFE_DELETE(g_app);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void App::RunWindowedFrame()
+{
+	PROFILE_SCOPE("Frame");
+
+	Clock::BeginMasterFrame();
+#ifdef _WIN32
+	RunMessagePump();
+#endif
+
+	// Begin Frames...
+	{
+		PROFILE_SCOPE("Begin Frame");
+		g_inputSystem->BeginFrame();
+		g_renderContext->BeginFrame();
+		g_devConsole->BeginFrame();
+		g_eventSystem->BeginFrame();
+	}
+
+	// Game Frame
+	ProcessInput();
+	Update();
+	FinalizeLoads();
+	Render();
+
+	// End Frames...
+	{
+		PROFILE_SCOPE("End Frame");
+		g_devConsole->EndFrame();
+		g_renderContext->EndFrame();
+		g_inputSystem->EndFrame();
+	}
+
+	m_frameCount++;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void App::ProcessInput()
+{
+	PROFILE_SCOPE("Process Input");
+
+	// Replays say for themselves whether the game had input, so the console can be used while one plays
+	const bool isConsoleActive = g_devConsole->IsActive();
+	g_gameInput->BeginFrame(m_game->GetFrameDeltaSeconds(), !isConsoleActive);
+
+	if (isConsoleActive)
+	{
+		g_devConsole->ProcessInput();
+	}
+
+	if (g_gameInput->IsGameFocused())
+	{
+		m_game->ProcessInput();
+	}
+
+	if (g_gameInput->HasReplayFinished())
+	{
+		ConsoleLogf("Input replay finished");
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void App::Update()
+{
+	{
+		PROFILE_SCOPE("Update");
+		m_game->Update();
+	}
+
+	{
+		PROFILE_SCOPE("DevConsole Update");
+		g_devConsole->Update();
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void App::Render()
+{
+	{
+		PROFILE_SCOPE("Render");
+		m_game->Render();
+	}
+
+	{
+		PROFILE_SCOPE("Debug Render");
+		FlushDebugDraw();
+		DrawStatsOverlay();
+		g_debugRenderSystem->Render();
+	}
+
+	{
+		PROFILE_SCOPE("DevConsole Render");
+		g_devConsole->Render();
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Screen text down from the top left, lasting the one frame, so it's redrawn with this frame's values
+void App::DrawStatsOverlay() const
+{
+	if (!g_perfCounters->IsOverlayVisible())
+	{
+		return;
+	}
+
+	std::vector<std::string> lines;
+	g_perfCounters->GetSummaryLines(lines);
+
+	const float clientHeight = (float)g_window->GetClientPixelHeight();
+	for (int lineIndex = 0; lineIndex < (int)lines.size(); ++lineIndex)
+	{
+		const Vector2 position = Vector2(s_statsOverlayMargin, clientHeight - s_statsOverlayMargin - (float)(lineIndex + 1) * s_statsOverlayLineHeight);
+		DebugDrawText2D(lines[lineIndex], position, s_statsOverlayLineHeight, Rgba::WHITE, 0.f);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void App::RegisterGameCommands()
+{
+	ConsoleCommand::Register(SID("exit"), "Shuts down the program", "exit (NO_PARAMS)", Command_Exit, false);
+	ConsoleCommand::Register(SID("profile_capture"), "Profiles the next frames and writes them as a Chrome trace (chrome://tracing or Perfetto)", "profile_capture [FRAME_COUNT] [PATH]", Command_ProfileCapture, false);
+	ConsoleCommand::Register(SID("input_record"), "Records the game's input until run again (or exit), for input_replay or the headless -replay", "input_record [PATH]", Command_InputRecord, false);
+	ConsoleCommand::Register(SID("input_replay"), "Plays back recorded input in place of the keyboard and mouse, frame times included", "input_replay [PATH]", Command_InputReplay, false);
+	ConsoleCommand::Register(SID("stats"), "Prints the frame counters, or toggles them on screen with \"overlay\"", "stats [overlay]", Command_Stats, false);
+}
@@ -0,0 +1,142 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameArena.h"
+#include "Engine/Core/EngineCommon.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+FrameArena* g_frameArena = nullptr;
+
+static uint32_t					s_nextGeneration = 1;
+static thread_local void*		s_threadArenas = nullptr;			// FrameArena::ThreadArenas, which is private
+static thread_local uint32_t	s_threadArenasGeneration = 0;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void FrameArena::Initialize()
+{
+	ASSERT_OR_DIE(g_frameArena == nullptr, "FrameArena initialized twice!");
+	g_frameArena = new FrameArena();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void FrameArena::Shutdown()
+{
+	SAFE_DELETE(g_frameArena);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+FrameArena::FrameArena()
+	: m_generation(s_nextGeneration++)
+	, m_bufferIndex(0)
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The buffer coming back around was last used two frames ago, so nothing can still be reading it
+void FrameArena::BeginFrame()
+{
+	const int bufferIndex = (m_bufferIndex.load(std::memory_order_relaxed) + 1) % FRAME_ARENA_BUFFER_COUNT;
+
+	std::lock_guard<std::mutex> lock(m_threadArenasMutex);
+	for (std::unique_ptr<ThreadArenas>& threadArenas : m_threadArenas)
+	{
+		threadArenas->buffers[bufferIndex].Reset();
+	}
+
+	m_bufferIndex.store(bufferIndex, std::memory_order_relaxed);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Alignment must be a power of two
+uint8_t* FrameArena::Allocate(size_t size, size_t alignment /*= 16*/)
+{
+	return GetThreadArena().Allocate(size, alignment);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+size_t FrameArena::GetUsedSize() const
+{
+	const int bufferIndex = m_bufferIndex.load(std::memory_order_relaxed);
+	std::lock_guard<std::mutex> lock(m_threadArenasMutex);
+
+	size_t usedSize = 0;
+	for (const std::unique_ptr<ThreadArenas>& threadArenas : m_threadArenas)
+	{
+		usedSize += threadArenas->buffers[bufferIndex].GetUsedSize();
+	}
+
+	return usedSize;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+size_t FrameArena::GetCapacity() const
+{
+	std::lock_guard<std::mutex> lock(m_threadArenasMutex);
+
+	size_t capacity = 0;
+	for (const std::unique_ptr<ThreadArenas>& threadArenas : m_threadArenas)
+	{
+		for (int bufferIndex = 0; bufferIndex < FRAME_ARENA_BUFFER_COUNT; ++bufferIndex)
+		{
+			capacity += threadArenas->buffers[bufferIndex].GetCapacity();
+		}
+	}
+
+	return capacity;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+int FrameArena::GetThreadCount() const
+{
+	std::lock_guard<std::mutex> lock(m_threadArenasMutex);
+	return (int)m_threadArenas.size();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Cached per thread, so the lock is only taken the first time a thread allocates from this FrameArena
+LinearArena& FrameArena::GetThreadArena()
+{
+	if (s_threadArenas == nullptr || s_threadArenasGeneration != m_generation)
+	{
+		std::lock_guard<std::mutex> lock(m_threadArenasMutex);
+
+		m_threadArenas.emplace_back(new ThreadArenas());
+		s_threadArenas = m_threadArenas.back().get();
+		s_threadArenasGeneration = m_generation;
+	}
+
+	ThreadArenas* threadArenas = (ThreadArenas*)s_threadArenas;
+	return threadArenas->buffers[m_bufferIndex.load(std::memory_order_relaxed)];
+}
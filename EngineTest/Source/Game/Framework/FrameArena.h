@@ -0,0 +1,127 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Per thread arenas for data that only lives for a frame, reset by the App between frames
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/LinearArena.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+template <typename T> class FrameAllocator;
+
+// Containers whose memory is gone at the end of the next frame; never keep one across frames
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+typedef std::basic_string<char, std::char_traits<char>, FrameAllocator<char>> FrameString;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class FrameArena;
+extern FrameArena* g_frameArena;
+
+const int		FRAME_ARENA_BUFFER_COUNT = 2;
+const size_t	FRAME_ARENA_MIN_BLOCK_SIZE = 256 * 1024;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Every thread that allocates gets its own arena per buffer, so allocating never locks. The buffers are
+// swapped at the start of each frame and the one coming back around is reset, so anything allocated stays
+// valid through the end of the next frame (e.g. built during Update, drawn next frame).
+// Resetting touches every thread's arena, so only work that starts and finishes within the frame (the
+// JobScheduler's) may allocate here; the engine JobSystem's loads can span frames and must not.
+// Arenas keep their memory across resets, so once they've grown to fit a frame nothing here hits the heap
+class FrameArena
+{
+public:
+	//-----Public Methods-----
+
+	static void		Initialize();
+	static void		Shutdown();
+
+	// Main thread only, with no jobs running
+	void			BeginFrame();
+
+	uint8_t*		Allocate(size_t size, size_t alignment = 16);
+	template <typename T>
+	T*				AllocateArray(size_t count) { return (T*)Allocate(count * sizeof(T), alignof(T)); }
+
+	size_t			GetUsedSize() const;				// This frame's buffer, across every thread
+	size_t			GetCapacity() const;				// Both buffers, across every thread
+	int				GetThreadCount() const;
+
+
+private:
+	//-----Private Methods-----
+
+	FrameArena();
+	~FrameArena() {}
+	FrameArena(const FrameArena& copy) = delete;
+
+	LinearArena&	GetThreadArena();
+
+
+private:
+	//-----Private Data-----
+
+	struct ThreadArenas
+	{
+		ThreadArenas() : buffers{ { FRAME_ARENA_MIN_BLOCK_SIZE }, { FRAME_ARENA_MIN_BLOCK_SIZE } } {}
+
+		LinearArena buffers[FRAME_ARENA_BUFFER_COUNT];
+	};
+
+	mutable std::mutex							m_threadArenasMutex;	// Only taken when a thread allocates for the first time, and for stats
+	std::vector<std::unique_ptr<ThreadArenas>>	m_threadArenas;
+	uint32_t									m_generation = 0;		// Tells threads their cached arenas belong to an earlier FrameArena
+	std::atomic<int>							m_bufferIndex;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// For standard containers; deallocating does nothing, the memory goes when the frame's buffer is reset
+template <typename T>
+class FrameAllocator
+{
+public:
+	//-----Public Methods-----
+
+	typedef T value_type;
+
+	FrameAllocator() {}
+	template <typename U>
+	FrameAllocator(const FrameAllocator<U>&) {}
+
+	T*		allocate(size_t count) { return g_frameArena->AllocateArray<T>(count); }
+	void	deallocate(T*, size_t) {}
+
+	template <typename U>
+	bool	operator==(const FrameAllocator<U>&) const { return true; }
+	template <typename U>
+	bool	operator!=(const FrameAllocator<U>&) const { return false; }
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -8,11 +8,19 @@
 /// INCLUDES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 #include "Game/Entity/Player.h"
+#include "Game/Framework/App.h"
 #include "Game/Framework/Game.h"
-#include "Engine/Core/DevConsole.h"
+#include "Game/Framework/GameCommon.h"
+#include "Game/Framework/GameInput.h"
+#include "Game/Framework/GameJobs.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/PerfCounters.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Framework/StreamedResources.h"
+#include "Game/Physics/BodyEngineConversions.h"
+#include "Game/Physics/BodyScene.h"
+#include "Game/Render/DebugDraw.h"
 #include "Engine/Core/EngineCommon.h"
-#include "Engine/Core/Window.h"
-#include "Engine/IO/InputSystem.h"
 #include "Engine/Physics/Particle/Particle.h"
 #include "Engine/Physics/Particle/ParticleAnchoredBungee.h"
 #include "Engine/Physics/Particle/ParticleAnchoredSpring.h"
@@ -20,17 +28,20 @@
 #include "Engine/Physics/Particle/ParticleBuoyancy.h"
 #include "Engine/Physics/Particle/ParticleSpring.h"
 #include "Engine/Physics/Particle/ParticleWorld.h"
-#include "Engine/Physics/RigidBody/RigidBody.h"
-#include "Engine/Physics/RigidBody/PhysicsScene.h"
 #include "Engine/Physics/RigidBody/RigidBodyAnchoredSpring.h"
 #include "Engine/Math/MathUtils.h"
+#include "Engine/Time/Clock.h"
+#include "Engine/Physics/Particle/ParticleRod.h"
+#include "Engine/Physics/Particle/ParticleCable.h"
+#include <cmath>
+#ifndef HEADLESS_ONLY
+#include "Engine/Core/Window.h"
+#include "Engine/IO/InputSystem.h"
 #include "Engine/Render/Camera.h"
 #include "Engine/Render/Debug/DebugRenderSystem.h"
 #include "Engine/Render/RenderContext.h"
 #include "Engine/Resource/ResourceSystem.h"
-#include "Engine/Time/Clock.h"
-#include "Engine/Physics/Particle/ParticleRod.h"
-#include "Engine/Physics/Particle/ParticleCable.h"
+#endif
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// DEFINES
@@ -43,6 +54,8 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// GLOBALS AND STATICS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const float s_groundDrawHalfSize = 50.f;
+static const float s_contactDrawSize = 0.25f;
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// C FUNCTIONS
@@ -56,9 +69,11 @@
 
 //-------------------------------------------------------------------------------------------------
 Game::Game()
+	: m_entities(OBJECT_POOL_DEFAULT_CHUNK_SIZE, sizeof(Player))
 {
 	SetupFramework();
 	SetupRendering();
+	SetupPhysics();
 	SpawnEntities();
 }
 
@@ -66,23 +81,20 @@ Game::Game()
 //-------------------------------------------------------------------------------------------------
 Game::~Game()
 {
-	g_debugRenderSystem->SetCamera(nullptr);
-
-	for (Entity* entity : m_entities)
+#ifndef HEADLESS_ONLY
+	if (!g_app->IsHeadless())
 	{
-		if (entity->collider != nullptr)
-		{	
-			m_collisionScene->RemoveEntity(entity);
-			SAFE_DELETE(entity->collider);
-		}
+		g_debugRenderSystem->SetCamera(nullptr);
 	}
+#endif
 
-	SafeDeleteVector(m_entities);
+	DestroyEntities();
 
-	SAFE_DELETE(m_collisionScene);
-	SAFE_DELETE(m_physicsScene);
+	SAFE_DELETE(m_bodyScene);
+#ifndef HEADLESS_ONLY
 	SAFE_DELETE(m_uiCamera);
 	SAFE_DELETE(m_gameCamera);
+#endif
 	SAFE_DELETE(m_gameClock);
 }
 
@@ -90,7 +102,19 @@ Game::~Game()
 //-------------------------------------------------------------------------------------------------
 void Game::ProcessInput()
 {
-	m_player->ProcessInput(m_gameClock->GetDeltaSeconds());
+	m_player->ProcessInput(g_gameInput->GetDeltaSeconds());
+
+	// P pauses physics, N steps it once while paused
+	if (g_gameInput->WasKeyJustPressed('P'))
+	{
+		m_pausePhysics = !m_pausePhysics;
+	}
+
+	if (m_pausePhysics && g_gameInput->WasKeyJustPressed('N'))
+	{
+		m_queuedPhysicsSteps++;
+	}
+
 	//float mass = 1.f;
 	//float iMass = (1.f / mass);
 
@@ -118,155 +142,753 @@ void Game::ProcessInput()
 
 
 //-------------------------------------------------------------------------------------------------
+// Physics only ever moves in fixed steps, however long the frame was; whatever's left over carries into the
+// next frame, and rendering is placed that far between the last two steps
 void Game::Update()
 {	
-	const float deltaSeconds = m_gameClock->GetDeltaSeconds();
-	
-	for (Entity* entity : m_entities)
+	PROFILE_SCOPE("Game Update");
+
+	// Replays use the recorded frame times, so the accumulator takes the same steps it did live
+	const float deltaSeconds = (g_gameInput->IsReplaying() ? g_gameInput->GetDeltaSeconds() : GetFrameDeltaSeconds());
+	m_gameSeconds += (double)deltaSeconds;
+
+	const int stepCount = GetPhysicsStepCount(deltaSeconds);
+
+	for (int stepIndex = 0; stepIndex < stepCount; ++stepIndex)
+	{
+		// Only the last step's start matters for interpolating
+		if (stepIndex == stepCount - 1)
+		{
+			StorePhysicsPoses(true);
+		}
+
+		StepPhysics();
+	}
+
+	if (stepCount > 0)
 	{
-		entity->Update(deltaSeconds);
+		StorePhysicsPoses(false);
 	}
 
-	m_physicsScene->BeginFrame();
-	m_physicsScene->DoPhysicsStep(deltaSeconds);
+	m_renderInterpolation = (m_pausePhysics ? 1.f : m_physicsAccumulator / m_physicsStepSeconds);
+
+	g_perfCounters->SetValue(PERF_COUNTER_BODY_COUNT, (double)m_bodyScene->GetStore().GetCount());
 }
 
 
+#ifndef HEADLESS_ONLY
 //-------------------------------------------------------------------------------------------------
 void Game::Render()
 {
+	PROFILE_SCOPE("Game Render");
+
+	// Before the camera, as the player's transform parents it
+	ApplyRenderPoses();
+
 	g_renderContext->BeginCamera(m_gameCamera);
 	g_renderContext->ClearScreen(Rgba::BLACK);
 	g_renderContext->ClearDepth();
 
-	for (Entity* entity : m_entities)
+	// Colliders and contacts go through DebugDraw, which the App flushes with the rest of the debug rendering
+	DrawColliders();
+	DrawContacts();
+
+	if (m_player != nullptr)
 	{
-		entity->Render();
+		m_player->Render();
 	}
 
-	Material* skyboxMaterial = g_resourceSystem->CreateOrGetMaterial("Data/Material/skybox.material");
-	Mesh* skyboxMesh = g_resourceSystem->CreateOrGetMesh("unit_cube");
+	// No skybox until it's streamed in, the clear color stands in for it
+	StreamedMaterial* skyboxMaterial = g_resourceStreamer->Get(m_skyboxMaterial);
+	if (skyboxMaterial != nullptr)
+	{
+		g_renderContext->DrawMeshWithMaterial(*m_skyboxMesh, skyboxMaterial->GetMaterial());
+	}
 
-	g_renderContext->DrawMeshWithMaterial(*skyboxMesh, skyboxMaterial);
-	
 	g_renderContext->EndCamera();
+
+	RestoreSimulatedPoses();
+}
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Headless runs step physics at their own rate, one step a frame, rather than the game's
+void Game::SetFixedDeltaSeconds(float deltaSeconds)
+{
+	m_fixedDeltaSeconds = deltaSeconds;
+
+	if (deltaSeconds > 0.f)
+	{
+		m_physicsStepSeconds = deltaSeconds;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Call between frames, after Update; restoring then picks up as if that Update had just finished
+void Game::SaveSnapshot(GameSnapshot& out_snapshot) const
+{
+	out_snapshot.gameSeconds = m_gameSeconds;
+	out_snapshot.physicsAccumulator = m_physicsAccumulator;
+	out_snapshot.pausePhysics = m_pausePhysics;
+	out_snapshot.queuedPhysicsSteps = m_queuedPhysicsSteps;
+
+	m_entities.GetLayout(out_snapshot.entityLayout);
+	out_snapshot.entities.resize(m_entities.GetCount());
+
+	for (int entityIndex = 0; entityIndex < m_entities.GetCount(); ++entityIndex)
+	{
+		const EntityHandle handle = m_entities.GetHandleAt(entityIndex);
+		const Entity* entity = m_entities.GetAt(entityIndex);
+		GameSnapshotEntity& snapshotEntity = out_snapshot.entities[entityIndex];
+
+		snapshotEntity.handle = handle;
+		snapshotEntity.components = m_entityComponents[handle.slot];
+		snapshotEntity.position = entity->transform.position;
+		snapshotEntity.rotation = entity->transform.rotation;
+		snapshotEntity.isPlayer = (entity == m_player);
+	}
+
+	m_bodyScene->SaveSnapshot(out_snapshot.bodies);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The bodies go back first, then the entities: any live now that weren't then (or that have the same handle
+// but different pieces) are despawned, and any despawned since are respawned into their old slots, so every
+// EntityHandle and BodyHandle from before the snapshot resolves the same way after it. The collider pools
+// aren't part of the snapshot, as colliders are only drawn; respawned entities get new ones.
+// Returns false, changing nothing, if the bodies don't restore
+bool Game::RestoreSnapshot(const GameSnapshot& snapshot)
+{
+	if (!m_bodyScene->RestoreSnapshot(snapshot.bodies))
+	{
+		return false;
+	}
+
+	const int snapshotSlotCount = (int)snapshot.entityLayout.generations.size();
+	m_snapshotEntityIndices.assign((snapshotSlotCount > m_entities.GetSlotCount() ? snapshotSlotCount : m_entities.GetSlotCount()), -1);
+
+	for (int snapshotIndex = 0; snapshotIndex < (int)snapshot.entities.size(); ++snapshotIndex)
+	{
+		m_snapshotEntityIndices[snapshot.entities[snapshotIndex].handle.slot] = snapshotIndex;
+	}
+
+	// From the back, so the ones not yet checked don't move
+	for (int entityIndex = m_entities.GetCount() - 1; entityIndex >= 0; --entityIndex)
+	{
+		const EntityHandle handle = m_entities.GetHandleAt(entityIndex);
+		const EntityComponents& components = m_entityComponents[handle.slot];
+		const int snapshotIndex = m_snapshotEntityIndices[handle.slot];
+
+		const bool isInSnapshot = (snapshotIndex >= 0 && snapshot.entities[snapshotIndex].handle == handle
+			&& snapshot.entities[snapshotIndex].components.body == components.body && snapshot.entities[snapshotIndex].components.colliderType == components.colliderType);
+
+		if (!isInSnapshot)
+		{
+			// Its body belongs to the scene from before the restore, so it's left out of the despawn
+			m_entityComponents[handle.slot].body = BodyHandle();
+			DespawnEntity(handle);
+		}
+	}
+
+	for (const GameSnapshotEntity& snapshotEntity : snapshot.entities)
+	{
+		if (!m_entities.IsValid(snapshotEntity.handle))
+		{
+			RespawnEntity(snapshotEntity);
+		}
+	}
+
+	const bool layoutRestored = m_entities.SetLayout(snapshot.entityLayout);
+	ASSERT_OR_DIE(layoutRestored, "Entities didn't match the snapshot after respawning!");
+
+	m_player = nullptr;
+	for (const GameSnapshotEntity& snapshotEntity : snapshot.entities)
+	{
+		Entity* entity = m_entities.Get(snapshotEntity.handle);
+		entity->transform.position = snapshotEntity.position;
+		entity->transform.rotation = snapshotEntity.rotation;
+
+		if (snapshotEntity.isPlayer)
+		{
+			m_player = (Player*)entity;
+		}
+	}
+
+	m_gameSeconds = snapshot.gameSeconds;
+	m_physicsAccumulator = snapshot.physicsAccumulator;
+	m_pausePhysics = snapshot.pausePhysics;
+	m_queuedPhysicsSteps = snapshot.queuedPhysicsSteps;
+
+	// There's no step before this one to interpolate from, so everything is drawn where it was left
+	StorePhysicsPoses(true);
+	m_renderInterpolation = (m_pausePhysics ? 1.f : m_physicsAccumulator / m_physicsStepSeconds);
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+float Game::GetFrameDeltaSeconds() const
+{
+	if (m_fixedDeltaSeconds > 0.f)
+	{
+		return m_fixedDeltaSeconds;
+	}
+
+	return m_gameClock->GetDeltaSeconds();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// How many fixed steps to take this frame. Paused, that's however many were queued, and time doesn't build up
+int Game::GetPhysicsStepCount(float deltaSeconds)
+{
+	if (m_pausePhysics)
+	{
+		const int queuedStepCount = m_queuedPhysicsSteps;
+		m_queuedPhysicsSteps = 0;
+
+		return queuedStepCount;
+	}
+
+	m_physicsAccumulator += deltaSeconds;
+
+	int stepCount = 0;
+	while (m_physicsAccumulator >= m_physicsStepSeconds && stepCount < m_maxPhysicsStepsPerFrame)
+	{
+		m_physicsAccumulator -= m_physicsStepSeconds;
+		stepCount++;
+	}
+
+	// Over the cap, so drop the whole steps that are left but keep the fraction, so interpolation doesn't jump
+	if (m_physicsAccumulator >= m_physicsStepSeconds)
+	{
+		m_physicsAccumulator = fmodf(m_physicsAccumulator, m_physicsStepSeconds);
+	}
+
+	return stepCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Entities -> physics -> entities, the first two as a job graph; waiting runs the jobs here too, so this works with no workers
+void Game::StepPhysics()
+{
+	PROFILE_SCOPE("Physics Step");
+	const uint64_t startTicks = Profiler::GetTicks();
+
+	UpdateEntitiesJob updateEntitiesJob(m_entities.GetObjects(), m_physicsStepSeconds, m_entitiesPerUpdateJob);
+	PhysicsStepJob physicsStepJob(m_bodyScene, m_physicsStepSeconds);
+	JobHandle physicsStepHandle;
+
+	// Unsplit, the update runs right here rather than being submitted, so a worker can't steal it and call
+	// Update off the main thread
+	if (m_entitiesPerUpdateJob <= 0)
+	{
+		updateEntitiesJob.Execute();
+		physicsStepHandle = g_jobScheduler->Submit(&physicsStepJob);
+	}
+	else
+	{
+		const JobHandle updateEntitiesHandle = g_jobScheduler->Submit(&updateEntitiesJob);
+		physicsStepHandle = g_jobScheduler->SubmitContinuation(&physicsStepJob, updateEntitiesHandle);
+	}
+
+	g_jobScheduler->Wait(physicsStepHandle);
+	CopyBodyPosesToEntities();
+
+	// The step may have run on a worker, so its stats are published from here rather than by the BodyScene
+	const BodySceneStats& stepStats = m_bodyScene->GetLastStepStats();
+	g_perfCounters->SetValue(PERF_COUNTER_CONTACT_COUNT, (double)stepStats.contactCount);
+	g_perfCounters->SetValue(PERF_COUNTER_ISLAND_COUNT, (double)stepStats.islandCount);
+	g_perfCounters->SetValue(PERF_COUNTER_BROADPHASE_PAIR_COUNT, (double)stepStats.pairCount);
+	g_perfCounters->AddValue(PERF_COUNTER_PHYSICS_STEP_TIME, (double)(Profiler::GetTicks() - startTicks) * 1e-9);
+	g_perfCounters->AddValue(PERF_COUNTER_PHYSICS_STEP_COUNT, 1.0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bodies own the simulated pose, entities just mirror it for rendering and gameplay. Bodies with locked
+// rotation (the player) keep the entity's rotation, since input turns those and physics never does
+void Game::CopyBodyPosesToEntities()
+{
+	const BodyStore& store = m_bodyScene->GetStore();
+
+	for (int entityIndex = 0; entityIndex < m_entities.GetCount(); ++entityIndex)
+	{
+		const EntityHandle handle = m_entities.GetHandleAt(entityIndex);
+		const int bodyIndex = store.GetIndex(m_entityComponents[handle.slot].body);
+		if (bodyIndex < 0)
+		{
+			continue;
+		}
+
+		Entity* entity = m_entities.GetAt(entityIndex);
+		entity->transform.position = ToVector3(store.GetFloat3(bodyIndex, BODY_POSITION_X));
+
+		if (!store.HasFlag(bodyIndex, BODY_FLAG_ROTATION_LOCKED))
+		{
+			entity->transform.rotation = ToQuaternion(store.GetRotation(bodyIndex));
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Entities spawned since the last store (or into a slot since reused) start out with both poses where they are
+void Game::StorePhysicsPoses(bool isPrevious)
+{
+	m_renderPoses.resize(m_entities.GetSlotCount());
+
+	for (int entityIndex = 0; entityIndex < m_entities.GetCount(); ++entityIndex)
+	{
+		const EntityHandle handle = m_entities.GetHandleAt(entityIndex);
+		const Transform& transform = m_entities.GetAt(entityIndex)->transform;
+		PhysicsRenderPose& pose = m_renderPoses[handle.slot];
+
+		if (isPrevious || pose.generation != handle.generation)
+		{
+			pose.previousPosition = transform.position;
+			pose.previousRotation = transform.rotation;
+			pose.generation = handle.generation;
+		}
+
+		pose.currentPosition = transform.position;
+		pose.currentRotation = transform.rotation;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Anything moved outside of physics since the last step (spawned, teleported) is drawn where it is.
+// The player's rotation is skipped, as input turns it every frame and physics never does
+void Game::ApplyRenderPoses()
+{
+	for (int entityIndex = 0; entityIndex < m_entities.GetCount(); ++entityIndex)
+	{
+		const EntityHandle handle = m_entities.GetHandleAt(entityIndex);
+		if (handle.slot >= (uint32_t)m_renderPoses.size())
+		{
+			continue;
+		}
+
+		Entity* entity = m_entities.GetAt(entityIndex);
+		PhysicsRenderPose& pose = m_renderPoses[handle.slot];
+		const Vector3& position = entity->transform.position;
+
+		pose.isApplied = (m_bodyScene->GetStore().IsValid(m_entityComponents[handle.slot].body) && pose.generation == handle.generation
+			&& position.x == pose.currentPosition.x && position.y == pose.currentPosition.y && position.z == pose.currentPosition.z);
+		if (!pose.isApplied)
+		{
+			continue;
+		}
+
+		pose.simulatedPosition = entity->transform.position;
+		pose.simulatedRotation = entity->transform.rotation;
+
+		entity->transform.position = pose.previousPosition + (pose.currentPosition - pose.previousPosition) * m_renderInterpolation;
+
+		if (entity != m_player)
+		{
+			entity->transform.rotation = Quaternion::Slerp(pose.previousRotation, pose.currentRotation, m_renderInterpolation);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Game::RestoreSimulatedPoses()
+{
+	for (int entityIndex = 0; entityIndex < m_entities.GetCount(); ++entityIndex)
+	{
+		const EntityHandle handle = m_entities.GetHandleAt(entityIndex);
+		if (handle.slot >= (uint32_t)m_renderPoses.size())
+		{
+			continue;
+		}
+
+		PhysicsRenderPose& pose = m_renderPoses[handle.slot];
+		if (pose.isApplied)
+		{
+			Entity* entity = m_entities.GetAt(entityIndex);
+			entity->transform.position = pose.simulatedPosition;
+			entity->transform.rotation = pose.simulatedRotation;
+			pose.isApplied = false;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Drawn at the entities' render poses, so this runs between ApplyRenderPoses and RestoreSimulatedPoses. Static bodies
+// are white, sleeping ones blue and the rest green
+void Game::DrawColliders() const
+{
+	const BodyStore& store = m_bodyScene->GetStore();
+
+	for (int entityIndex = 0; entityIndex < m_entities.GetCount(); ++entityIndex)
+	{
+		const EntityHandle handle = m_entities.GetHandleAt(entityIndex);
+		const EntityComponents& components = m_entityComponents[handle.slot];
+		const Entity* entity = m_entities.GetAt(entityIndex);
+		const Float3 position = ToFloat3(entity->transform.position);
+
+		// The ground is the y = 0 plane SpawnGround adds, so a flat box around the origin stands in for it
+		if (components.colliderType == GAME_COLLIDER_HALF_SPACE)
+		{
+			g_debugDraw->DrawWireBox(position, Float3(s_groundDrawHalfSize, 0.f, s_groundDrawHalfSize), FloatQuat(), DEBUG_DRAW_WHITE);
+			continue;
+		}
+
+		const int bodyIndex = store.GetIndex(components.body);
+		if (bodyIndex < 0)
+		{
+			continue;
+		}
+
+		uint32_t color = DEBUG_DRAW_GREEN;
+		if (store.GetField(BODY_INVERSE_MASS)[bodyIndex] == 0.f)
+		{
+			color = DEBUG_DRAW_WHITE;
+		}
+		else if (store.HasFlag(bodyIndex, BODY_FLAG_ASLEEP))
+		{
+			color = DEBUG_DRAW_BLUE;
+		}
+
+		const FloatQuat rotation = ToFloatQuat(entity->transform.rotation);
+
+		// By the body's shape, as the player makes its own collider
+		switch (store.GetShapeTypes()[bodyIndex])
+		{
+		case BODY_SHAPE_BOX:
+			g_debugDraw->DrawWireBox(position, store.GetFloat3(bodyIndex, BODY_SHAPE_HALF_EXTENT_X), rotation, color);
+			break;
+		case BODY_SHAPE_SPHERE:
+			g_debugDraw->DrawWireSphere(position, store.GetField(BODY_SHAPE_RADIUS)[bodyIndex], color);
+			break;
+		case BODY_SHAPE_CAPSULE:
+		{
+			// A sphere at each end of the segment, joined along the sides
+			const float radius = store.GetField(BODY_SHAPE_RADIUS)[bodyIndex];
+			const Float3 up = Rotate(rotation, Float3(0.f, store.GetField(BODY_SHAPE_HALF_HEIGHT)[bodyIndex], 0.f));
+			const Float3 top = position + up;
+			const Float3 bottom = position - up;
+
+			g_debugDraw->DrawWireSphere(top, radius, color);
+			g_debugDraw->DrawWireSphere(bottom, radius, color);
+
+			const Float3 sides[4] = { Float3(radius, 0.f, 0.f), Float3(-radius, 0.f, 0.f), Float3(0.f, 0.f, radius), Float3(0.f, 0.f, -radius) };
+			for (const Float3& side : sides)
+			{
+				const Float3 offset = Rotate(rotation, side);
+				g_debugDraw->DrawLine(top + offset, bottom + offset, color);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Where the last step found them, so they can sit slightly off the interpolated colliders
+void Game::DrawContacts() const
+{
+	for (const BodyContact& contact : m_bodyScene->GetContacts())
+	{
+		g_debugDraw->DrawContact(contact.position, contact.normal, s_contactDrawSize, DEBUG_DRAW_RED);
+	}
 }
 
 
 //-------------------------------------------------------------------------------------------------
 void Game::SetupFramework()
 {
+	m_gameClock = new Clock(nullptr);
+
+#ifndef HEADLESS_ONLY
+	if (g_app->IsHeadless())
+	{
+		return;
+	}
+
 	Mouse& mouse = InputSystem::GetMouse();
 	mouse.ShowMouseCursor(false);
 	mouse.LockCursorToClient(true);
 	mouse.SetCursorMode(CURSORMODE_RELATIVE);
-
-	m_gameClock = new Clock(nullptr);
+#endif
 }
 
 
 //-------------------------------------------------------------------------------------------------
+// Headless-only builds leave out the renderer entirely, so they have no cameras and the Player goes without
 void Game::SetupRendering()
 {
+#ifndef HEADLESS_ONLY
 	// Cameras
 	m_gameCamera = new Camera();
 	m_gameCamera->SetProjectionPerspective(90.f, 0.1f, 100.f);
 	m_gameCamera->LookAt(Vector3(0.f, 0.f, -10.f), Vector3(0.f, 0.f, 0.f));
+
+	// Headless runs still need the game camera, since the Player's transform parents it
+	if (g_app->IsHeadless())
+	{
+		return;
+	}
+
 	m_gameCamera->SetDepthTarget(g_renderContext->GetDefaultDepthStencilTarget(), false);
 	g_debugRenderSystem->SetCamera(m_gameCamera);
 
 	m_uiCamera = new Camera();
 	m_uiCamera->SetProjectionOrthographic((float)g_window->GetClientPixelHeight(), g_window->GetClientAspect());
+
+	// Looked up once here rather than by name every frame
+	m_skyboxMaterial = g_resourceStreamer->RequestLoad<StreamedMaterial>("Data/Material/skybox.material");
+	m_skyboxMesh = g_resourceSystem->CreateOrGetMesh("unit_cube");
+#endif
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void Game::SpawnEntities()
+void Game::SetupPhysics()
 {
-	m_collisionScene = new CollisionScene<BoundingVolumeSphere>();
-	m_physicsScene = new PhysicsScene(m_collisionScene);
+	m_bodyScene = new BodyScene();
+}
 
-	Entity* ground = new Entity();
-	ground->collider = new HalfSpaceCollider(ground, Plane3(Vector3::Y_AXIS, Vector3::ZERO));;
 
-	m_collisionScene->AddEntity(ground);
-	m_entities.push_back(ground);
+//-------------------------------------------------------------------------------------------------
+void Game::SpawnEntities()
+{
+	SpawnGround();
 
 	SpawnBox(Vector3(1.f),	(1.f / 1.f),	Vector3(-10.f, 1.f, 0.f));
 	SpawnBox(Vector3(2.f), (1.f / 8.f),		Vector3(0.f, 2.f, 0.f));
 	SpawnBox(Vector3(4.f), (1.f / 64.f),	Vector3(10.f, 4.f, 0.f));
 
-	m_player = new Player(m_gameCamera);
-	m_collisionScene->AddEntity(m_player);
-	m_physicsScene->AddRigidbody(m_player->rigidBody);
-	m_entities.push_back(m_player);
+	// Standing on the ground, the transform sits on the body's center
+	const Vector3 playerPosition(0.f, 1.f, 0.f);
+	const BodyHandle playerBody = m_bodyScene->AddBody(Player::GetBodyDefinition(playerPosition));
+
+	const EntityHandle playerHandle = m_entities.Create<Player>(m_gameCamera, m_bodyScene, playerBody);
+	ResetEntityComponents(playerHandle);
+	m_entityComponents[playerHandle.slot].body = playerBody;
+
+	m_player = (Player*)m_entities.Get(playerHandle);
+	m_player->transform.position = playerPosition;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// From the back, so nothing is moved around in the pool while it empties
+void Game::DestroyEntities()
+{
+	while (m_entities.GetCount() > 0)
+	{
+		DespawnEntity(m_entities.GetHandleAt(m_entities.GetCount() - 1));
+	}
+
+	m_renderPoses.clear();
+	m_player = nullptr;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Clears out all entities and starts over with an empty BodyScene, which also drops the ground plane
+void Game::ResetScene()
+{
+	DestroyEntities();
+
+	SAFE_DELETE(m_bodyScene);
+	SetupPhysics();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Called right after an entity is created; the spawn helpers fill in whatever pooled pieces they give it
+void Game::ResetEntityComponents(EntityHandle handle)
+{
+	if ((int)m_entityComponents.size() < m_entities.GetSlotCount())
+	{
+		m_entityComponents.resize(m_entities.GetSlotCount());
+	}
+
+	m_entityComponents[handle.slot] = EntityComponents();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Removes the entity's body and hands it and its pieces back to their pools. A collider it made itself
+// (the Player's) is deleted here
+void Game::DespawnEntity(EntityHandle handle)
+{
+	Entity* entity = m_entities.Get(handle);
+	if (entity == nullptr)
+	{
+		return;
+	}
+
+	const EntityComponents& components = m_entityComponents[handle.slot];
+
+	if (entity->collider != nullptr)
+	{
+		switch (components.colliderType)
+		{
+		case GAME_COLLIDER_HALF_SPACE:	m_halfSpaceColliders.Destroy(components.collider);	break;
+		case GAME_COLLIDER_BOX:			m_boxColliders.Destroy(components.collider);		break;
+		case GAME_COLLIDER_SPHERE:		m_sphereColliders.Destroy(components.collider);		break;
+		case GAME_COLLIDER_CAPSULE:		m_capsuleColliders.Destroy(components.collider);	break;
+		default:						SAFE_DELETE(entity->collider);						break;
+		}
+
+		entity->collider = nullptr;
+	}
+
+	m_bodyScene->RemoveBody(components.body);
+
+	if (entity == m_player)
+	{
+		m_player = nullptr;
+	}
+
+	m_entities.Destroy(handle);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// For RestoreSnapshot, once the bodies are back: the entity goes into its old slot, with a collider shaped
+// like its body, or like the ground if it's the ground. The Player makes its own
+void Game::RespawnEntity(const GameSnapshotEntity& snapshotEntity)
+{
+	const EntityHandle handle = (snapshotEntity.isPlayer ? m_entities.CreateAt<Player>(snapshotEntity.handle, m_gameCamera, m_bodyScene, snapshotEntity.components.body)
+		: m_entities.CreateAt(snapshotEntity.handle));
+	ResetEntityComponents(handle);
+
+	Entity* entity = m_entities.Get(handle);
+	EntityComponents& components = m_entityComponents[handle.slot];
+	components.body = snapshotEntity.components.body;
+	components.colliderType = snapshotEntity.components.colliderType;
+
+	const BodyStore& store = m_bodyScene->GetStore();
+	const int bodyIndex = store.GetIndex(components.body);
+	if (bodyIndex < 0 && components.colliderType != GAME_COLLIDER_HALF_SPACE)
+	{
+		return;
+	}
+
+	switch (components.colliderType)
+	{
+	case GAME_COLLIDER_HALF_SPACE:
+		components.collider = m_halfSpaceColliders.Create(entity, Plane3(Vector3::Y_AXIS, Vector3::ZERO));
+		entity->collider = m_halfSpaceColliders.Get(components.collider);
+		break;
+	case GAME_COLLIDER_BOX:
+		components.collider = m_boxColliders.Create(entity, OBB3(Vector3::ZERO, ToVector3(store.GetFloat3(bodyIndex, BODY_SHAPE_HALF_EXTENT_X)), Quaternion::IDENTITY));
+		entity->collider = m_boxColliders.Get(components.collider);
+		break;
+	case GAME_COLLIDER_SPHERE:
+		components.collider = m_sphereColliders.Create(entity, Sphere3D(Vector3::ZERO, store.GetField(BODY_SHAPE_RADIUS)[bodyIndex]));
+		entity->collider = m_sphereColliders.Get(components.collider);
+		break;
+	case GAME_COLLIDER_CAPSULE:
+	{
+		const float halfHeight = store.GetField(BODY_SHAPE_HALF_HEIGHT)[bodyIndex];
+		components.collider = m_capsuleColliders.Create(entity, Capsule3D(Vector3(0.f, -halfHeight, 0.f), Vector3(0.f, halfHeight, 0.f), store.GetField(BODY_SHAPE_RADIUS)[bodyIndex]));
+		entity->collider = m_capsuleColliders.Get(components.collider);
+		break;
+	}
+	default:
+		break;
+	}
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void Game::SpawnCapsule(float cylinderHeight, float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/, bool hasGravity /*= true*/)
+// BodyScene planes can't be removed, so despawning the ground leaves its plane in place until ResetScene
+EntityHandle Game::SpawnGround()
 {
-	Entity* entity = new Entity();
+	const EntityHandle handle = m_entities.Create();
+	ResetEntityComponents(handle);
+
+	Entity* ground = m_entities.Get(handle);
+	EntityComponents& components = m_entityComponents[handle.slot];
+
+	components.collider = m_halfSpaceColliders.Create(ground, Plane3(Vector3::Y_AXIS, Vector3::ZERO));
+	components.colliderType = GAME_COLLIDER_HALF_SPACE;
+	ground->collider = m_halfSpaceColliders.Get(components.collider);
+
+	m_bodyScene->AddPlane(Float3(0.f, 1.f, 0.f), 0.f);
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+EntityHandle Game::SpawnCapsule(float cylinderHeight, float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/, bool hasGravity /*= true*/)
+{
+	const EntityHandle handle = m_entities.Create();
+	ResetEntityComponents(handle);
+
+	Entity* entity = m_entities.Get(handle);
+	EntityComponents& components = m_entityComponents[handle.slot];
 	entity->transform.position = position;
 	entity->transform.rotation = Quaternion::CreateFromEulerAnglesDegrees(rotationDegrees);
 
-	RigidBody* body = new RigidBody(&entity->transform);
-	body->SetInverseMass(inverseMass);
-	body->SetInertiaTensor_Capsule(cylinderHeight, radius);
-	body->SetVelocityWs(velocity);
-	body->SetAngularVelocityDegreesWs(angularVelocityDegrees);
-	body->SetAffectedByGravity(hasGravity);
+	components.body = m_bodyScene->AddCapsule(cylinderHeight, radius, inverseMass, ToFloat3(position), ToFloat3(rotationDegrees), ToFloat3(velocity), ToFloat3(angularVelocityDegrees), hasGravity);
+
+	components.collider = m_capsuleColliders.Create(entity, Capsule3D(Vector3(0.f, -cylinderHeight, 0.f), Vector3(0.f, cylinderHeight, 0.f), radius));
+	components.colliderType = GAME_COLLIDER_CAPSULE;
 
-	entity->rigidBody = body;
-	entity->collider = new CapsuleCollider(entity, Capsule3D(Vector3(0.f, -cylinderHeight, 0.f), Vector3(0.f, cylinderHeight, 0.f), radius));
+	entity->collider = m_capsuleColliders.Get(components.collider);
 
-	m_collisionScene->AddEntity(entity);
-	m_physicsScene->AddRigidbody(body);
-	m_entities.push_back(entity);
+	return handle;
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void Game::SpawnBox(const Vector3& extents, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/, bool hasGravity /*= true*/)
+EntityHandle Game::SpawnBox(const Vector3& extents, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/, bool hasGravity /*= true*/)
 {
-	Entity* entity = new Entity();
+	const EntityHandle handle = m_entities.Create();
+	ResetEntityComponents(handle);
+
+	Entity* entity = m_entities.Get(handle);
+	EntityComponents& components = m_entityComponents[handle.slot];
 	entity->transform.position = position;
 	entity->transform.rotation = Quaternion::CreateFromEulerAnglesDegrees(rotationDegrees);
 
-	RigidBody* body = new RigidBody(&entity->transform);
-	body->SetInverseMass(inverseMass);
-	body->SetInertiaTensor_Box(extents);
-	body->SetVelocityWs(velocity);
-	body->SetAngularVelocityDegreesWs(angularVelocityDegrees);
-	body->SetAffectedByGravity(hasGravity);
+	components.body = m_bodyScene->AddBox(ToFloat3(extents), inverseMass, ToFloat3(position), ToFloat3(rotationDegrees), ToFloat3(velocity), ToFloat3(angularVelocityDegrees), hasGravity);
+
+	components.collider = m_boxColliders.Create(entity, OBB3(Vector3::ZERO, extents, Quaternion::IDENTITY));
+	components.colliderType = GAME_COLLIDER_BOX;
 
-	entity->rigidBody = body;
-	entity->collider = new BoxCollider(entity, OBB3(Vector3::ZERO, extents, Quaternion::IDENTITY));
+	entity->collider = m_boxColliders.Get(components.collider);
 
-	m_collisionScene->AddEntity(entity);
-	m_physicsScene->AddRigidbody(body);
-	m_entities.push_back(entity);
+	return handle;
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void Game::SpawnSphere(float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/, bool hasGravity /*= true*/)
+EntityHandle Game::SpawnSphere(float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees /*= Vector3::ZERO*/, const Vector3& velocity /*= Vector3::ZERO*/, const Vector3& angularVelocityDegrees /*= Vector3::ZERO*/, bool hasGravity /*= true*/)
 {
-	Entity* entity = new Entity();
+	const EntityHandle handle = m_entities.Create();
+	ResetEntityComponents(handle);
+
+	Entity* entity = m_entities.Get(handle);
+	EntityComponents& components = m_entityComponents[handle.slot];
 	entity->transform.position = position;
 	entity->transform.rotation = Quaternion::CreateFromEulerAnglesDegrees(rotationDegrees);
 
-	RigidBody* body = new RigidBody(&entity->transform);
-	body->SetInverseMass(inverseMass);
-	body->SetInertiaTensor_Sphere(radius);
-	body->SetVelocityWs(velocity);
-	body->SetAngularVelocityDegreesWs(angularVelocityDegrees);
-	body->SetAffectedByGravity(hasGravity);
+	components.body = m_bodyScene->AddSphere(radius, inverseMass, ToFloat3(position), ToFloat3(rotationDegrees), ToFloat3(velocity), ToFloat3(angularVelocityDegrees), hasGravity);
+
+	components.collider = m_sphereColliders.Create(entity, Sphere3D(Vector3::ZERO, radius));
+	components.colliderType = GAME_COLLIDER_SPHERE;
 
-	entity->rigidBody = body;
-	entity->collider = new SphereCollider(entity, Sphere3D(Vector3::ZERO, radius));
+	entity->collider = m_sphereColliders.Get(components.collider);
 
-	m_collisionScene->AddEntity(entity);
-	m_physicsScene->AddRigidbody(body);
-	m_entities.push_back(entity);
+	return handle;
 }
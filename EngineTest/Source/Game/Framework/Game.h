@@ -8,9 +8,11 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// INCLUDES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/ObjectPool.h"
+#include "Game/Framework/ResourceStreamer.h"
+#include "Game/Physics/BodySnapshot.h"
+#include "Game/Physics/BodyStore.h"
 #include "Engine/Math/Transform.h"
-#include "Engine/Collision/BoundingVolumeHierarchy/BoundingVolume.h"
-#include "Engine/Collision/CollisionScene.h"
 #include <vector>
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -20,14 +22,79 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodyScene;
+class BoxCollider;
 class Camera;
+class CapsuleCollider;
 class Clock;
 class Entity;
+class HalfSpaceCollider;
+class Mesh;
 class Particle;
 class ParticleWorld;
-class PhysicsScene;
 class Player;
-class RigidBody;
+class SphereCollider;
+class StreamedMaterial;
+
+typedef PoolHandle EntityHandle;
+
+enum GameColliderType
+{
+	GAME_COLLIDER_NONE,				// None, or one the entity made itself (the Player does)
+	GAME_COLLIDER_HALF_SPACE,
+	GAME_COLLIDER_BOX,
+	GAME_COLLIDER_SPHERE,
+	GAME_COLLIDER_CAPSULE
+};
+
+// The body and pooled pieces an entity was spawned with, so despawning can hand each back to where it came from.
+// The collider is only what the entity draws; the body in the BodyScene is what collides
+struct EntityComponents
+{
+	BodyHandle			body;
+	PoolHandle			collider;
+	GameColliderType	colliderType = GAME_COLLIDER_NONE;
+};
+
+// Where an entity's body was before and after the last physics step, so rendering can sit between them
+struct PhysicsRenderPose
+{
+	Vector3		previousPosition;
+	Quaternion	previousRotation;
+	Vector3		currentPosition;
+	Quaternion	currentRotation;
+
+	// What the entity had before rendering moved it, put back once the frame is drawn
+	Vector3		simulatedPosition;
+	Quaternion	simulatedRotation;
+	bool		isApplied = false;
+
+	uint32_t	generation = 0;		// Of the entity handle it was stored for, so a reused slot starts over
+};
+
+// One live entity in a GameSnapshot; its collider is rebuilt from its body if it has to be respawned
+struct GameSnapshotEntity
+{
+	EntityHandle		handle;
+	EntityComponents	components;
+	Vector3				position;
+	Quaternion			rotation;
+	bool				isPlayer = false;
+};
+
+// Everything Game::RestoreSnapshot needs to carry on from the frame Game::SaveSnapshot was called after.
+// Reuse one per frame; once its buffers have grown, saving into it again doesn't allocate
+struct GameSnapshot
+{
+	double							gameSeconds = 0.0;
+	float							physicsAccumulator = 0.f;
+	bool							pausePhysics = false;
+	int								queuedPhysicsSteps = 0;
+
+	ObjectPoolLayout				entityLayout;
+	std::vector<GameSnapshotEntity>	entities;			// In the order the pool keeps them
+	BodySnapshot					bodies;
+};
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// GLOBALS AND STATICS
@@ -48,6 +115,8 @@ private:
 	//-----Private Methods-----
 
 	friend class App;
+	friend class PhysicsBenchmark;
+	friend class EntityPoolBenchmark;
 
 	Game();
 	~Game();
@@ -57,18 +126,41 @@ private:
 	void Update();
 	void Render();
 
+	void SetFixedDeltaSeconds(float deltaSeconds);
+
+	void SaveSnapshot(GameSnapshot& out_snapshot) const;
+	bool RestoreSnapshot(const GameSnapshot& snapshot);
+
 
 private:
 	//-----Private Methods-----
 
+	float GetFrameDeltaSeconds() const;
+	int  GetPhysicsStepCount(float deltaSeconds);
+	void StepPhysics();
+	void CopyBodyPosesToEntities();
+	void StorePhysicsPoses(bool isPrevious);
+	void ApplyRenderPoses();
+	void RestoreSimulatedPoses();
+	void DrawColliders() const;
+	void DrawContacts() const;
+
 	void SetupFramework();
 	void SetupRendering();
+	void SetupPhysics();
 	void SpawnEntities();
+	void DestroyEntities();
+	void ResetScene();
+
+	void ResetEntityComponents(EntityHandle handle);
+	void DespawnEntity(EntityHandle handle);
+	void RespawnEntity(const GameSnapshotEntity& snapshotEntity);
 
 	// Physics helpers
-	void SpawnCapsule(float cylinderHeight, float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO, bool hasGravity = true);
-	void SpawnBox(const Vector3& extents, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO, bool hasGravity = true);
-	void SpawnSphere(float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO, bool hasGravity = true);
+	EntityHandle SpawnGround();
+	EntityHandle SpawnCapsule(float cylinderHeight, float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO, bool hasGravity = true);
+	EntityHandle SpawnBox(const Vector3& extents, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO, bool hasGravity = true);
+	EntityHandle SpawnSphere(float radius, float inverseMass, const Vector3& position, const Vector3& rotationDegrees = Vector3::ZERO, const Vector3& velocity = Vector3::ZERO, const Vector3& angularVelocityDegrees = Vector3::ZERO, bool hasGravity = true);
 
 
 private:
@@ -77,18 +169,34 @@ private:
 	// Rendering
 	Camera*										m_gameCamera = nullptr;
 	Camera*										m_uiCamera = nullptr;
+	ResourceHandle<StreamedMaterial>			m_skyboxMaterial;
+	Mesh*										m_skyboxMesh = nullptr;
 
 	// Framework
 	Clock*										m_gameClock = nullptr;
+	double										m_gameSeconds = 0.0; // Frame time Update has consumed; the game's clock as far as snapshots go, since m_gameClock only measures real time
 	Player*										m_player = nullptr;
+	float										m_fixedDeltaSeconds = 0.f; // > 0 overrides the clock, used by headless runs
+	int											m_entitiesPerUpdateJob = 0; // <= 0 updates every entity on the main thread. > 0 runs Update on workers, so it's only safe once no entity's Update touches input or the render/debug systems, which Player::Update (through the engine's Entity::Update) isn't known not to
 
 	// Physics/collision
-	bool										m_pausePhysics = true;
-	PhysicsScene*								m_physicsScene = nullptr;
-	CollisionScene<BoundingVolumeSphere>*		m_collisionScene = nullptr;
-
-	// Entities
-	std::vector<Entity*>						m_entities;
+	bool										m_pausePhysics = false; // Stops the accumulator; steps queued while paused still run, one per press
+	int											m_queuedPhysicsSteps = 0;
+	float										m_physicsStepSeconds = (1.f / 60.f);
+	int											m_maxPhysicsStepsPerFrame = 4; // Time beyond this is dropped, so one slow frame can't make the next ones slower
+	float										m_physicsAccumulator = 0.f;
+	float										m_renderInterpolation = 1.f; // 0 renders the previous step's poses, 1 the current step's
+	std::vector<PhysicsRenderPose>				m_renderPoses; // By entity slot, as of the last step
+	BodyScene*									m_bodyScene = nullptr;
+
+	// Entities, and what they're built from; pooled, so spawning and despawning at runtime doesn't go to the heap
+	ObjectPool<Entity>							m_entities; // Slots fit a Player too
+	std::vector<EntityComponents>				m_entityComponents; // By entity slot
+	std::vector<int>							m_snapshotEntityIndices; // By entity slot, scratch for RestoreSnapshot
+	ObjectPool<HalfSpaceCollider>				m_halfSpaceColliders;
+	ObjectPool<BoxCollider>						m_boxColliders;
+	ObjectPool<SphereCollider>					m_sphereColliders;
+	ObjectPool<CapsuleCollider>					m_capsuleColliders;
 
 };
 
@@ -10,6 +10,9 @@
 #include "Game/Framework/App.h"
 #include "Game/Framework/GameCommands.h"
 #include "Game/Framework/GameCommon.h"
+#include "Game/Framework/GameInput.h"
+#include "Game/Framework/PerfCounters.h"
+#include "Game/Framework/Profiler.h"
 #include "Engine/Core/DevConsole.h"
 #include "Engine/Core/EngineCommon.h"
 
@@ -40,3 +43,76 @@ void Command_Exit(CommandArgs& args)
 	g_app->Quit();
 	ConsoleLogf("Exiting...");
 }
+
+
+//-------------------------------------------------------------------------------------------------
+// Starts a recording, or stops and saves the one going
+void Command_InputRecord(CommandArgs& args)
+{
+	if (g_gameInput->IsRecording())
+	{
+		int frameCount = 0;
+		if (g_gameInput->StopRecording(&frameCount))
+		{
+			ConsoleLogf("Recorded %d frames of input to %s", frameCount, g_gameInput->GetPath().c_str());
+		}
+		else
+		{
+			ConsoleErrorf("Couldn't write %d frames of input to %s", frameCount, g_gameInput->GetPath().c_str());
+		}
+
+		return;
+	}
+
+	// A missing path reads as empty, which picks the default
+	g_gameInput->StartRecording(args.GetNextString());
+	ConsoleLogf("Recording input to %s, run input_record again to stop", g_gameInput->GetPath().c_str());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Command_InputReplay(CommandArgs& args)
+{
+	std::string error;
+	if (!g_gameInput->StartReplay(args.GetNextString(), &error))
+	{
+		ConsoleErrorf("Couldn't replay input: %s", error.c_str());
+		return;
+	}
+
+	ConsoleLogf("Replaying %d frames of input from %s", g_gameInput->GetReplayFrameCount(), g_gameInput->GetPath().c_str());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Command_ProfileCapture(CommandArgs& args)
+{
+	// Both optional; a missing count reads as 0 and a missing path as empty, which pick the defaults
+	const int frameCount = args.GetNextInt();
+	const std::string path = args.GetNextString();
+
+	g_profiler->RequestCapture(frameCount, path);
+	ConsoleLogf("Profiling the next %d frames...", (frameCount > 0 ? frameCount : PROFILER_DEFAULT_CAPTURE_FRAMES));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Command_Stats(CommandArgs& args)
+{
+	const std::string mode = args.GetNextString();
+
+	if (mode == "overlay")
+	{
+		g_perfCounters->SetOverlayVisible(!g_perfCounters->IsOverlayVisible());
+		ConsoleLogf("Stats overlay %s", (g_perfCounters->IsOverlayVisible() ? "on" : "off"));
+		return;
+	}
+
+	std::vector<std::string> lines;
+	g_perfCounters->GetSummaryLines(lines);
+
+	for (const std::string& line : lines)
+	{
+		ConsoleLogf("%s", line.c_str());
+	}
+}
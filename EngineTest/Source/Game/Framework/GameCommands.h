@@ -32,3 +32,7 @@
 
 //-------------------------------------------------------------------------------------------------
 void Command_Exit(CommandArgs& args);
+void Command_InputRecord(CommandArgs& args);
+void Command_InputReplay(CommandArgs& args);
+void Command_ProfileCapture(CommandArgs& args);
+void Command_Stats(CommandArgs& args);
@@ -0,0 +1,425 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/GameInput.h"
+#include "Game/Framework/Lz4Compression.h"
+#include "Game/Framework/MappedFile.h"
+#include "Engine/Core/EngineCommon.h"
+#include <cstdio>
+#include <cstring>
+#ifndef HEADLESS_ONLY
+#include "Engine/Core/DevConsole.h"
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct GameInputRecordingHeader
+{
+	uint32_t	magic = 0;
+	uint32_t	version = 0;
+	uint32_t	frameCount = 0;
+	uint32_t	compressedSize = 0;
+	uint16_t	initialHeldKeys = 0;
+	uint16_t	unused = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+GameInput* g_gameInput = nullptr;
+
+// Every key the game reads, in held key bit order; changing this changes what recordings mean, so bump the version
+static const unsigned char s_trackedKeys[] = { 'W', 'A', 'S', 'D', InputSystem::KEYBOARD_SHIFT, InputSystem::KEYBOARD_SPACEBAR, 'P', 'N' };
+static const int s_trackedKeyCount = (int)(sizeof(s_trackedKeys) / sizeof(s_trackedKeys[0]));
+
+static const uint32_t s_recordingMagic = 0x504E4947; // "GINP"
+static const uint32_t s_recordingVersion = 1;
+static const size_t s_maxLz4Ratio = 255;	// LZ4 can't expand past this, so anything claiming more is corrupt
+
+static_assert(sizeof(GameInputFrame) == 12, "GameInputFrame is written as is, so it mustn't pick up padding");
+static_assert(s_trackedKeyCount <= 16, "Held keys only has 16 bits");
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADLESS_ONLY
+//-------------------------------------------------------------------------------------------------
+static int16_t ClampToInt16(int value)
+{
+	return (int16_t)(value < INT16_MIN ? INT16_MIN : (value > INT16_MAX ? INT16_MAX : value));
+}
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Byte 0 of every frame, then byte 1 of every frame, and so on. Frame times and held keys barely change but sit
+// between the mouse deltas, which change every frame; split out, each of their bytes is one long run for LZ4
+static void SplitIntoBytePlanes(const uint8_t* frames, size_t frameCount, uint8_t* out_planes)
+{
+	for (size_t byteIndex = 0; byteIndex < sizeof(GameInputFrame); ++byteIndex)
+	{
+		for (size_t frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+		{
+			out_planes[byteIndex * frameCount + frameIndex] = frames[frameIndex * sizeof(GameInputFrame) + byteIndex];
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static void MergeBytePlanes(const uint8_t* planes, size_t frameCount, uint8_t* out_frames)
+{
+	for (size_t byteIndex = 0; byteIndex < sizeof(GameInputFrame); ++byteIndex)
+	{
+		for (size_t frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+		{
+			out_frames[frameIndex * sizeof(GameInputFrame) + byteIndex] = planes[byteIndex * frameCount + frameIndex];
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static void SetError(std::string* out_error, const std::string& message)
+{
+	if (out_error != nullptr)
+	{
+		*out_error = message;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Headless runs have no console, so the result goes to stdout
+static void PrintRecordingResult(bool succeeded, const std::string& message)
+{
+#ifndef HEADLESS_ONLY
+	if (g_devConsole != nullptr)
+	{
+		if (succeeded)
+		{
+			ConsoleLogf("%s", message.c_str());
+		}
+		else
+		{
+			ConsoleErrorf("%s", message.c_str());
+		}
+
+		return;
+	}
+#else
+	UNUSED(succeeded);
+#endif
+
+	printf("%s\n", message.c_str());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool WriteGameInputRecording(const std::string& path, const GameInputRecording& recording)
+{
+	const size_t framesSize = recording.frames.size() * sizeof(GameInputFrame);
+	std::vector<uint8_t> planes(framesSize);
+	SplitIntoBytePlanes((const uint8_t*)recording.frames.data(), recording.frames.size(), planes.data());
+
+	std::vector<uint8_t> file(sizeof(GameInputRecordingHeader) + GetLz4MaxCompressedSize(framesSize));
+	const size_t compressedSize = CompressLz4(planes.data(), framesSize, file.data() + sizeof(GameInputRecordingHeader), file.size() - sizeof(GameInputRecordingHeader));
+	if (compressedSize == 0 && framesSize > 0)
+	{
+		return false;
+	}
+
+	GameInputRecordingHeader header;
+	header.magic = s_recordingMagic;
+	header.version = s_recordingVersion;
+	header.frameCount = (uint32_t)recording.frames.size();
+	header.compressedSize = (uint32_t)compressedSize;
+	header.initialHeldKeys = recording.initialHeldKeys;
+
+	memcpy(file.data(), &header, sizeof(header));
+	file.resize(sizeof(header) + compressedSize);
+
+	return WriteBinaryFile(path.c_str(), file.data(), file.size());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool ReadGameInputRecording(const std::string& path, GameInputRecording& out_recording, std::string* out_error /*= nullptr*/)
+{
+	out_recording = GameInputRecording();
+
+	MappedFile file;
+	if (!file.Open(path.c_str()))
+	{
+		SetError(out_error, "Couldn't open " + path);
+		return false;
+	}
+
+	GameInputRecordingHeader header;
+	if (file.GetSize() < sizeof(header))
+	{
+		SetError(out_error, path + " is too small to be an input recording");
+		return false;
+	}
+
+	memcpy(&header, file.GetData(), sizeof(header));
+	if (header.magic != s_recordingMagic || header.version != s_recordingVersion)
+	{
+		SetError(out_error, path + " isn't an input recording, or is from a different version");
+		return false;
+	}
+
+	const size_t framesSize = (size_t)header.frameCount * sizeof(GameInputFrame);
+	if (header.compressedSize != file.GetSize() - sizeof(header) || framesSize > (size_t)header.compressedSize * s_maxLz4Ratio)
+	{
+		SetError(out_error, path + " is truncated or corrupt");
+		return false;
+	}
+
+	std::vector<uint8_t> planes(framesSize);
+	if (framesSize > 0 && DecompressLz4(file.GetData() + sizeof(header), header.compressedSize, planes.data(), framesSize) != framesSize)
+	{
+		SetError(out_error, path + " is corrupt");
+		return false;
+	}
+
+	out_recording.frames.resize(header.frameCount);
+	MergeBytePlanes(planes.data(), header.frameCount, (uint8_t*)out_recording.frames.data());
+
+	out_recording.initialHeldKeys = header.initialHeldKeys;
+	return true;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void GameInput::Initialize()
+{
+	ASSERT_OR_DIE(g_gameInput == nullptr, "GameInput initialized twice!");
+	g_gameInput = new GameInput();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// A recording still going is saved, so quitting is a fine way to end one
+void GameInput::Shutdown()
+{
+	if (g_gameInput != nullptr && g_gameInput->IsRecording())
+	{
+		int frameCount = 0;
+		const bool succeeded = g_gameInput->StopRecording(&frameCount);
+
+		char message[512];
+		snprintf(message, sizeof(message), (succeeded ? "Recorded %d frames of input to %s" : "Couldn't write %d frames of input to %s"), frameCount, g_gameInput->GetPath().c_str());
+		PrintRecordingResult(succeeded, message);
+	}
+
+	SAFE_DELETE(g_gameInput);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+GameInput::GameInput()
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+GameInput::~GameInput()
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void GameInput::BeginFrame(float liveDeltaSeconds, bool isGameFocused)
+{
+	m_previousHeldKeys = m_frame.heldKeys;
+	m_hasReplayFinished = false;
+
+	if (m_mode == GAME_INPUT_MODE_REPLAYING)
+	{
+		if (m_replayFrameIndex < (int)m_replay.frames.size())
+		{
+			m_frame = m_replay.frames[m_replayFrameIndex++];
+			return;
+		}
+
+		StopReplay();
+		m_hasReplayFinished = true;
+	}
+
+	SampleInputSystem(liveDeltaSeconds, isGameFocused);
+
+	if (m_mode == GAME_INPUT_MODE_RECORDING)
+	{
+		m_recording.frames.push_back(m_frame);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool GameInput::IsKeyPressed(unsigned char key) const
+{
+	return (m_frame.heldKeys & GetKeyBit(key)) != 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool GameInput::WasKeyJustPressed(unsigned char key) const
+{
+	const uint16_t keyBit = GetKeyBit(key);
+	return (m_frame.heldKeys & keyBit) != 0 && (m_previousHeldKeys & keyBit) == 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool GameInput::WasKeyJustReleased(unsigned char key) const
+{
+	const uint16_t keyBit = GetKeyBit(key);
+	return (m_frame.heldKeys & keyBit) == 0 && (m_previousHeldKeys & keyBit) != 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+IntVector2 GameInput::GetMouseDelta() const
+{
+	IntVector2 mouseDelta;
+	mouseDelta.x = m_frame.mouseDeltaX;
+	mouseDelta.y = m_frame.mouseDeltaY;
+
+	return mouseDelta;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Starts with the next frame; a replay in progress is stopped, recording what's played live from here on
+void GameInput::StartRecording(const std::string& path)
+{
+	StopReplay();
+
+	m_mode = GAME_INPUT_MODE_RECORDING;
+	m_path = (path.size() > 0 ? path : GAME_INPUT_DEFAULT_RECORDING_PATH);
+	m_recording.initialHeldKeys = m_frame.heldKeys;
+	m_recording.frames.clear();
+	m_recording.frames.reserve(5 * 60 * 60);	// 5 minutes at 60 Hz, so the common case doesn't regrow mid session
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool GameInput::StopRecording(int* out_frameCount /*= nullptr*/)
+{
+	if (out_frameCount != nullptr)
+	{
+		*out_frameCount = (int)m_recording.frames.size();
+	}
+
+	if (m_mode != GAME_INPUT_MODE_RECORDING)
+	{
+		return false;
+	}
+
+	m_mode = GAME_INPUT_MODE_LIVE;
+	const bool succeeded = WriteGameInputRecording(m_path, m_recording);
+	m_recording.frames.clear();
+
+	return succeeded;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Starts with the next frame; a recording in progress is saved first
+bool GameInput::StartReplay(const std::string& path, std::string* out_error /*= nullptr*/)
+{
+	if (IsRecording())
+	{
+		StopRecording();
+	}
+
+	StopReplay();
+
+	m_path = (path.size() > 0 ? path : GAME_INPUT_DEFAULT_RECORDING_PATH);
+	if (!ReadGameInputRecording(m_path, m_replay, out_error))
+	{
+		return false;
+	}
+
+	m_mode = GAME_INPUT_MODE_REPLAYING;
+	m_replayFrameIndex = 0;
+	m_frame.heldKeys = m_replay.initialHeldKeys;
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void GameInput::StopReplay()
+{
+	if (m_mode == GAME_INPUT_MODE_REPLAYING)
+	{
+		m_mode = GAME_INPUT_MODE_LIVE;
+	}
+
+	m_replay.frames.clear();
+	m_replayFrameIndex = 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Headless runs have no InputSystem, so live input there is nothing held and no mouse movement
+void GameInput::SampleInputSystem(float deltaSeconds, bool isGameFocused)
+{
+	m_frame = GameInputFrame();
+	m_frame.deltaSeconds = deltaSeconds;
+	m_frame.flags = (isGameFocused ? GAME_INPUT_FRAME_GAME_FOCUSED : 0);
+
+#ifndef HEADLESS_ONLY
+	if (g_inputSystem == nullptr)
+	{
+		return;
+	}
+
+	for (int keyIndex = 0; keyIndex < s_trackedKeyCount; ++keyIndex)
+	{
+		if (g_inputSystem->IsKeyPressed(s_trackedKeys[keyIndex]))
+		{
+			m_frame.heldKeys |= (uint16_t)(1 << keyIndex);
+		}
+	}
+
+	const IntVector2 mouseDelta = InputSystem::GetMouse().GetMouseDelta();
+	m_frame.mouseDeltaX = ClampToInt16(mouseDelta.x);
+	m_frame.mouseDeltaY = ClampToInt16(mouseDelta.y);
+#endif
+}
+
+
+//-------------------------------------------------------------------------------------------------
+uint16_t GameInput::GetKeyBit(unsigned char key) const
+{
+	for (int keyIndex = 0; keyIndex < s_trackedKeyCount; ++keyIndex)
+	{
+		if (s_trackedKeys[keyIndex] == key)
+		{
+			return (uint16_t)(1 << keyIndex);
+		}
+	}
+
+	ERROR_RECOVERABLE("Key isn't tracked by GameInput, add it to s_trackedKeys!");
+	return 0;
+}
@@ -0,0 +1,137 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: The input the game reads each frame, taken live from the InputSystem or replayed from a recording
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Engine/IO/InputSystem.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+enum GameInputMode
+{
+	GAME_INPUT_MODE_LIVE,
+	GAME_INPUT_MODE_RECORDING,		// Live, and keeping every frame to save
+	GAME_INPUT_MODE_REPLAYING
+};
+
+enum GameInputFrameFlags : uint8_t
+{
+	GAME_INPUT_FRAME_GAME_FOCUSED = (1 << 0)		// The game processed input this frame, rather than the console
+};
+
+// Everything the game reads in one frame. Written to recordings as is, so it's kept free of padding
+struct GameInputFrame
+{
+	float		deltaSeconds = 0.f;
+	int16_t		mouseDeltaX = 0;
+	int16_t		mouseDeltaY = 0;
+	uint16_t	heldKeys = 0;		// A bit per tracked key; just pressed/released come from comparing with the last frame
+	uint8_t		flags = 0;
+	uint8_t		unused = 0;
+};
+
+struct GameInputRecording
+{
+	uint16_t					initialHeldKeys = 0;	// Held going into the first frame, so its just pressed/released match
+	std::vector<GameInputFrame>	frames;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class GameInput;
+extern GameInput* g_gameInput;
+
+const char GAME_INPUT_DEFAULT_RECORDING_PATH[] = "input_recording.bin";
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// The game reads its keys and mouse through here instead of the InputSystem, so a session can be recorded and
+// played back exactly, windowed or headless, to compare perf captures across engine changes.
+// Only the keys the game uses are tracked; asking about any other is an error. Replays also hand back the
+// recorded frame times, so the fixed step accumulator takes the same physics steps it did live.
+// Main thread only
+class GameInput
+{
+public:
+	//-----Public Methods-----
+
+	static void		Initialize();
+	static void		Shutdown();
+
+	// Live and recording sample the InputSystem (if there is one) and keep the given frame time; replaying
+	// ignores both and steps to the next recorded frame, going back to live once they run out
+	void			BeginFrame(float liveDeltaSeconds, bool isGameFocused);
+
+	bool			IsKeyPressed(unsigned char key) const;
+	bool			WasKeyJustPressed(unsigned char key) const;
+	bool			WasKeyJustReleased(unsigned char key) const;
+	IntVector2		GetMouseDelta() const;
+	float			GetDeltaSeconds() const { return m_frame.deltaSeconds; }
+	bool			IsGameFocused() const { return (m_frame.flags & GAME_INPUT_FRAME_GAME_FOCUSED) != 0; }
+
+	void			StartRecording(const std::string& path);
+	bool			StopRecording(int* out_frameCount = nullptr);		// Writes the file
+	bool			StartReplay(const std::string& path, std::string* out_error = nullptr);
+	void			StopReplay();
+
+	GameInputMode	GetMode() const { return m_mode; }
+	bool			IsRecording() const { return m_mode == GAME_INPUT_MODE_RECORDING; }
+	bool			IsReplaying() const { return m_mode == GAME_INPUT_MODE_REPLAYING; }
+	bool			HasReplayFinished() const { return m_hasReplayFinished; }		// Set on the frame after the last one
+	int				GetReplayFrameIndex() const { return m_replayFrameIndex; }
+	int				GetReplayFrameCount() const { return (int)m_replay.frames.size(); }
+	const std::string& GetPath() const { return m_path; }
+
+
+private:
+	//-----Private Methods-----
+
+	GameInput();
+	~GameInput();
+	GameInput(const GameInput& copy) = delete;
+
+	void			SampleInputSystem(float deltaSeconds, bool isGameFocused);
+	uint16_t		GetKeyBit(unsigned char key) const;
+
+
+private:
+	//-----Private Data-----
+
+	GameInputMode				m_mode = GAME_INPUT_MODE_LIVE;
+	GameInputFrame				m_frame;
+	uint16_t					m_previousHeldKeys = 0;
+
+	std::string					m_path;
+	GameInputRecording			m_recording;
+	GameInputRecording			m_replay;
+	int							m_replayFrameIndex = 0;
+	bool						m_hasReplayFinished = false;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Recordings are a small header and the frames, split into byte planes and LZ4 compressed. A 5 minute session at
+// 60 Hz is 216 KB of frames, and comes out under 100 KB even with the mouse moving every frame
+bool WriteGameInputRecording(const std::string& path, const GameInputRecording& recording);
+bool ReadGameInputRecording(const std::string& path, GameInputRecording& out_recording, std::string* out_error = nullptr);
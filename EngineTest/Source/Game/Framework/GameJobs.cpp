@@ -8,7 +8,9 @@
 /// INCLUDES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 #include "Game/Framework/GameJobs.h"
-#include "Engine/Job/JobSystem.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Physics/BodyScene.h"
+#include "Engine/Core/Entity.h"
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// DEFINES
@@ -31,18 +33,46 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 
 //-------------------------------------------------------------------------------------------------
-void CountJob::Execute()
+void EntityUpdateJob::Execute()
 {
-	for (int i = 0; i < 100000000; i++)
+	for (int entityIndex = 0; entityIndex < m_entityCount; ++entityIndex)
 	{
-		int j = 0;
-		j = i;
+		m_entities[entityIndex]->Update(m_deltaSeconds);
 	}
 }
 
 
 //-------------------------------------------------------------------------------------------------
-void CountJob::Finalize()
+// The child jobs are all created before any are submitted, so the vector never moves under them
+void UpdateEntitiesJob::Execute()
 {
-	// Nothing!
+	const int entityCount = (int)m_entities.size();
+
+	if (m_entitiesPerJob <= 0 || entityCount <= m_entitiesPerJob)
+	{
+		EntityUpdateJob(m_entities.data(), entityCount, m_deltaSeconds).Execute();
+		return;
+	}
+
+	m_childJobs.clear();
+	m_childJobs.reserve((entityCount + m_entitiesPerJob - 1) / m_entitiesPerJob);
+	for (int firstEntity = 0; firstEntity < entityCount; firstEntity += m_entitiesPerJob)
+	{
+		const int chunkCount = (entityCount - firstEntity < m_entitiesPerJob ? entityCount - firstEntity : m_entitiesPerJob);
+		m_childJobs.emplace_back(m_entities.data() + firstEntity, chunkCount, m_deltaSeconds);
+	}
+
+	const JobHandle thisJob = JobScheduler::GetCurrentJob();
+	for (EntityUpdateJob& childJob : m_childJobs)
+	{
+		g_jobScheduler->Submit(&childJob, thisJob);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The scene's island solves run as children of this job
+void PhysicsStepJob::Execute()
+{
+	m_scene->DoPhysicsStep(m_deltaSeconds);
 }
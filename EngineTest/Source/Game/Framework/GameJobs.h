@@ -8,7 +8,9 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// INCLUDES
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/FrameArena.h"
 #include "Engine/Job/Job.h"
+#include <vector>
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// DEFINES
@@ -17,6 +19,8 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodyScene;
+class Entity;
 
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 /// GLOBALS AND STATICS
@@ -27,13 +31,73 @@
 ///--------------------------------------------------------------------------------------------------------------------------------------------------
 
 //-------------------------------------------------------------------------------------------------
-class CountJob : public Job
+// Updates a run of entities
+class EntityUpdateJob : public Job
 {
 public:
 	//-----Public Methods-----
 
+	EntityUpdateJob(Entity* const* entities, int entityCount, float deltaSeconds)
+		: m_entities(entities), m_entityCount(entityCount), m_deltaSeconds(deltaSeconds) {}
+
+	virtual void Execute() override;
+	virtual void Finalize() override {}
+
+
+private:
+	//-----Private Data-----
+
+	Entity* const*	m_entities = nullptr;
+	int				m_entityCount = 0;
+	float			m_deltaSeconds = 0.f;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Updates every entity, split into child jobs of entitiesPerJob each, so anything that depends on this
+// job waits for all of them. entitiesPerJob <= 0 updates them all here
+class UpdateEntitiesJob : public Job
+{
+public:
+	//-----Public Methods-----
+
+	UpdateEntitiesJob(const std::vector<Entity*>& entities, float deltaSeconds, int entitiesPerJob)
+		: m_entities(entities), m_deltaSeconds(deltaSeconds), m_entitiesPerJob(entitiesPerJob) {}
+
+	virtual void Execute() override;
+	virtual void Finalize() override {}
+
+
+private:
+	//-----Private Data-----
+
+	const std::vector<Entity*>&		m_entities;
+	float							m_deltaSeconds = 0.f;
+	int								m_entitiesPerJob = 0;
+	FrameVector<EntityUpdateJob>	m_childJobs;			// Only needed for the step
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+class PhysicsStepJob : public Job
+{
+public:
+	//-----Public Methods-----
+
+	PhysicsStepJob(BodyScene* scene, float deltaSeconds)
+		: m_scene(scene), m_deltaSeconds(deltaSeconds) {}
+
 	virtual void Execute() override;
-	virtual void Finalize() override;
+	virtual void Finalize() override {}
+
+
+private:
+	//-----Private Data-----
+
+	BodyScene*		m_scene = nullptr;
+	float			m_deltaSeconds = 0.f;
 
 };
 
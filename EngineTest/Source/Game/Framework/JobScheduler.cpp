@@ -0,0 +1,483 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/Profiler.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Job/Job.h"
+#include <string>
+#include <typeinfo>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#define MAX_JOB_CONTINUATIONS 16
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Bookkeeping for one submitted job; lives in the scheduler's record array and is reused once the job is done
+struct JobRecord
+{
+	Job*					job = nullptr;
+	JobRecord*				parent = nullptr;
+	std::atomic<uint32_t>	sequence{ 0 };
+	std::atomic<int>		unfinishedCount{ 0 };			// Itself plus unfinished children
+	std::atomic<int>		pendingDependencyCount{ 0 };	// Queued once this hits zero
+	std::atomic<bool>		isDone{ true };
+
+	std::mutex				continuationMutex;
+	JobRecord*				continuations[MAX_JOB_CONTINUATIONS];
+	int						continuationCount = 0;
+	bool					isClosed = false;				// Set once finished, no more continuations can be added
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+JobScheduler* g_jobScheduler = nullptr;
+
+static thread_local int			s_queueIndex = 0;	// Threads outside the scheduler share queue 0
+static thread_local JobHandle	s_currentJob;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Negative worker count uses one worker per core, leaving one for the calling thread
+// Zero workers runs every job on the threads that wait, which is handy for checking determinism
+void JobScheduler::Initialize(int workerCount /*= -1*/)
+{
+	ASSERT_OR_DIE(g_jobScheduler == nullptr, "JobScheduler initialized twice!");
+	g_jobScheduler = new JobScheduler(workerCount < 0 ? GetDefaultWorkerCount() : workerCount);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void JobScheduler::Shutdown()
+{
+	SAFE_DELETE(g_jobScheduler);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+JobHandle JobScheduler::Submit(Job* job, JobHandle parent /*= JobHandle()*/)
+{
+	const JobHandle handle = CreateJob(job, parent);
+	PushJob(handle.record);
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+JobHandle JobScheduler::SubmitContinuation(Job* job, JobHandle dependency, JobHandle parent /*= JobHandle()*/)
+{
+	return SubmitContinuation(job, &dependency, 1, parent);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Dependencies that are already complete (or invalid) are skipped, so this can end up queued right away
+JobHandle JobScheduler::SubmitContinuation(Job* job, const JobHandle* dependencies, int dependencyCount, JobHandle parent /*= JobHandle()*/)
+{
+	const JobHandle handle = CreateJob(job, parent);
+	JobRecord* record = handle.record;
+
+	// Holds the job back until every dependency has been added
+	record->pendingDependencyCount = 1;
+
+	for (int dependencyIndex = 0; dependencyIndex < dependencyCount; ++dependencyIndex)
+	{
+		AddContinuation(dependencies[dependencyIndex], record);
+	}
+
+	if (--record->pendingDependencyCount == 0)
+	{
+		PushJob(record);
+	}
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Runs other jobs until the handle's job (and its children) are done
+void JobScheduler::Wait(JobHandle handle)
+{
+	while (!IsComplete(handle))
+	{
+		if (!TryRunJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void JobScheduler::WaitForAll()
+{
+	while (m_unfinishedJobCount > 0)
+	{
+		if (!TryRunJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool JobScheduler::IsComplete(JobHandle handle) const
+{
+	if (!handle.IsValid())
+	{
+		return true;
+	}
+
+	return (handle.record->sequence != handle.sequence || handle.record->isDone);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+int JobScheduler::GetDefaultWorkerCount()
+{
+	const int coreCount = (int)std::thread::hardware_concurrency();
+	return (coreCount > 1 ? coreCount - 1 : 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The job the calling thread is running, for submitting children of it
+JobHandle JobScheduler::GetCurrentJob()
+{
+	return s_currentJob;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+JobScheduler::JobScheduler(int workerCount)
+	: m_workerCount(workerCount)
+	, m_nextSequence(0)
+	, m_queuedJobCount(0)
+	, m_peakQueuedJobCount(0)
+	, m_unfinishedJobCount(0)
+	, m_sleepingWorkerCount(0)
+{
+	m_queues.reset(new JobQueue[workerCount + 1]);
+	for (int queueIndex = 0; queueIndex < workerCount + 1; ++queueIndex)
+	{
+		m_queues[queueIndex].jobs.reset(new JobRecord*[MAX_JOBS_IN_FLIGHT]);
+	}
+
+	m_records.reset(new JobRecord[MAX_JOBS_IN_FLIGHT]);
+	m_freeRecords.reset(new JobRecord*[MAX_JOBS_IN_FLIGHT]);
+
+	// Pushed in reverse so the first jobs get the first records
+	for (int recordIndex = MAX_JOBS_IN_FLIGHT - 1; recordIndex >= 0; --recordIndex)
+	{
+		m_freeRecords[m_freeRecordCount++] = &m_records[recordIndex];
+	}
+
+	for (int workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+	{
+		m_workers.push_back(std::thread(&JobScheduler::WorkerThreadMain, this, workerIndex + 1));
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+JobScheduler::~JobScheduler()
+{
+	WaitForAll();
+
+	{
+		std::lock_guard<std::mutex> lock(m_sleepMutex);
+		m_isStopping = true;
+	}
+
+	m_jobQueued.notify_all();
+
+	for (std::thread& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// If every record is taken, this helps run queued jobs until one completes and hands its record back
+JobHandle JobScheduler::CreateJob(Job* job, JobHandle parent)
+{
+	JobRecord* record = TryTakeFreeRecord();
+	while (record == nullptr)
+	{
+		if (!TryRunJob())
+		{
+			std::this_thread::yield();
+		}
+
+		record = TryTakeFreeRecord();
+	}
+
+	// Sequences are never reused (short of wrapping), so old handles to this record read as complete
+	const uint32_t sequence = ++m_nextSequence;
+
+	{
+		std::lock_guard<std::mutex> lock(record->continuationMutex);
+		record->sequence = sequence;
+		record->continuationCount = 0;
+		record->isClosed = false;
+	}
+
+	record->job = job;
+	record->parent = nullptr;
+	record->unfinishedCount = 1;
+	record->pendingDependencyCount = 0;
+	record->isDone = false;
+
+	if (parent.IsValid())
+	{
+		ASSERT_OR_DIE(!IsComplete(parent), "Adding a child to a job that already completed");
+		record->parent = parent.record;
+		parent.record->unfinishedCount++;
+	}
+
+	m_unfinishedJobCount++;
+
+	JobHandle handle;
+	handle.record = record;
+	handle.sequence = sequence;
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+JobRecord* JobScheduler::TryTakeFreeRecord()
+{
+	std::lock_guard<std::mutex> lock(m_freeRecordMutex);
+
+	if (m_freeRecordCount == 0)
+	{
+		return nullptr;
+	}
+
+	return m_freeRecords[--m_freeRecordCount];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void JobScheduler::ReleaseRecord(JobRecord* record)
+{
+	std::lock_guard<std::mutex> lock(m_freeRecordMutex);
+	m_freeRecords[m_freeRecordCount++] = record;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns false if the dependency already finished, in which case there is nothing to wait on
+bool JobScheduler::AddContinuation(JobHandle dependency, JobRecord* continuation)
+{
+	if (!dependency.IsValid())
+	{
+		return false;
+	}
+
+	JobRecord* record = dependency.record;
+	std::lock_guard<std::mutex> lock(record->continuationMutex);
+
+	if (record->sequence != dependency.sequence || record->isClosed)
+	{
+		return false;
+	}
+
+	ASSERT_OR_DIE(record->continuationCount < MAX_JOB_CONTINUATIONS, "Too many continuations on one job");
+	continuation->pendingDependencyCount++;
+	record->continuations[record->continuationCount++] = continuation;
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Onto the back of the calling thread's queue, waking a worker if any are asleep
+void JobScheduler::PushJob(JobRecord* record)
+{
+	JobQueue& queue = m_queues[s_queueIndex];
+
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs[(queue.first + queue.count) % MAX_JOBS_IN_FLIGHT] = record;
+		queue.count++;
+	}
+
+	// Racing pushes can each miss the other's peak; close enough for a stat
+	const int queuedJobCount = ++m_queuedJobCount;
+	if (queuedJobCount > m_peakQueuedJobCount.load(std::memory_order_relaxed))
+	{
+		m_peakQueuedJobCount.store(queuedJobCount, std::memory_order_relaxed);
+	}
+
+	// Workers count themselves as sleeping before checking the queued count, so one of the two sides always sees the other
+	if (m_sleepingWorkerCount > 0)
+	{
+		std::lock_guard<std::mutex> lock(m_sleepMutex);
+		m_jobQueued.notify_one();
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Newest job from our own queue first, otherwise steal the oldest job of the next queue that has one
+bool JobScheduler::TryRunJob()
+{
+	const int queueCount = m_workerCount + 1;
+	JobRecord* record = nullptr;
+
+	for (int offset = 0; offset < queueCount && record == nullptr; ++offset)
+	{
+		record = TryPopJob((s_queueIndex + offset) % queueCount);
+	}
+
+	if (record == nullptr)
+	{
+		return false;
+	}
+
+	m_queuedJobCount--;
+	ExecuteJob(record);
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+JobRecord* JobScheduler::TryPopJob(int queueIndex)
+{
+	JobQueue& queue = m_queues[queueIndex];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+
+	if (queue.count == 0)
+	{
+		return nullptr;
+	}
+
+	JobRecord* record = nullptr;
+	if (queueIndex == s_queueIndex)
+	{
+		record = queue.jobs[(queue.first + queue.count - 1) % MAX_JOBS_IN_FLIGHT];
+	}
+	else
+	{
+		record = queue.jobs[queue.first];
+		queue.first = (queue.first + 1) % MAX_JOBS_IN_FLIGHT;
+	}
+
+	queue.count--;
+	return record;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void JobScheduler::ExecuteJob(JobRecord* record)
+{
+	const JobHandle previousJob = s_currentJob;
+	s_currentJob.record = record;
+	s_currentJob.sequence = record->sequence;
+
+	{
+		PROFILE_SCOPE(typeid(*record->job).name());
+		record->job->Execute();
+	}
+
+	s_currentJob = previousJob;
+	FinishJob(record);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Called once for the job itself and once per child; the last call completes the job, then queues any
+// continuations that were only waiting on it and passes the completion up to the parent
+void JobScheduler::FinishJob(JobRecord* record)
+{
+	if (--record->unfinishedCount > 0)
+	{
+		return;
+	}
+
+	record->job->Finalize();
+
+	JobRecord* continuations[MAX_JOB_CONTINUATIONS];
+	int continuationCount = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(record->continuationMutex);
+		record->isClosed = true;
+		continuationCount = record->continuationCount;
+
+		for (int continuationIndex = 0; continuationIndex < continuationCount; ++continuationIndex)
+		{
+			continuations[continuationIndex] = record->continuations[continuationIndex];
+		}
+	}
+
+	// The record can be reused as soon as it's released, so grab what we need first
+	JobRecord* parent = record->parent;
+	record->isDone = true;
+	ReleaseRecord(record);
+
+	for (int continuationIndex = 0; continuationIndex < continuationCount; ++continuationIndex)
+	{
+		if (--continuations[continuationIndex]->pendingDependencyCount == 0)
+		{
+			PushJob(continuations[continuationIndex]);
+		}
+	}
+
+	if (parent != nullptr)
+	{
+		FinishJob(parent);
+	}
+
+	m_unfinishedJobCount--;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void JobScheduler::WorkerThreadMain(int queueIndex)
+{
+	s_queueIndex = queueIndex;
+	Profiler::SetThreadName("Job Worker " + std::to_string(queueIndex));
+
+	while (true)
+	{
+		if (TryRunJob())
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_sleepMutex);
+		m_sleepingWorkerCount++;
+		m_jobQueued.wait(lock, [this]() { return m_isStopping || m_queuedJobCount > 0; });
+		m_sleepingWorkerCount--;
+
+		if (m_isStopping)
+		{
+			return;
+		}
+	}
+}
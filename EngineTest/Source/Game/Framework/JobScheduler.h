@@ -0,0 +1,136 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Work-stealing job scheduler with parent/continuation dependencies, for work waited on within the frame
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class Job;
+class JobScheduler;
+struct JobRecord;
+
+// Refers to one submitted job; stays safe to wait on after the job's record is reused (it just reads as complete)
+struct JobHandle
+{
+	JobRecord*	record = nullptr;
+	uint32_t	sequence = 0;
+
+	bool IsValid() const { return record != nullptr; }
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+extern JobScheduler* g_jobScheduler;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// For work that has to be done before the frame moves on (e.g. physics islands), as opposed to the
+// engine JobSystem's fire-and-finalize-later jobs.
+// Each worker (and the threads outside the scheduler, together) has its own deque: it pushes and pops at the back,
+// and idle workers steal from the front of the others. A job isn't complete until its children are, and
+// continuations only start once every job they depend on is complete. Waiting runs other jobs instead of blocking.
+// Jobs are owned by the submitter and must outlive their completion; Finalize is called on whichever thread
+// completes the job, right before its continuations are scheduled
+class JobScheduler
+{
+public:
+	//-----Public Methods-----
+
+	static void Initialize(int workerCount = -1);
+	static void Shutdown();
+
+	// Parent, if given, must not have completed yet, so children are usually submitted from inside the parent's Execute
+	JobHandle	Submit(Job* job, JobHandle parent = JobHandle());
+	JobHandle	SubmitContinuation(Job* job, JobHandle dependency, JobHandle parent = JobHandle());
+	JobHandle	SubmitContinuation(Job* job, const JobHandle* dependencies, int dependencyCount, JobHandle parent = JobHandle());
+
+	void		Wait(JobHandle handle);
+	void		WaitForAll();
+	bool		IsComplete(JobHandle handle) const;
+
+	int			GetWorkerCount() const { return m_workerCount; }
+	int			TakePeakQueuedJobCount() { return m_peakQueuedJobCount.exchange(0, std::memory_order_relaxed); } // Most jobs queued at once since the last call
+	static int	GetDefaultWorkerCount();
+	static JobHandle GetCurrentJob();
+
+
+private:
+	//-----Private Methods-----
+
+	JobScheduler(int workerCount);
+	~JobScheduler();
+
+	JobHandle	CreateJob(Job* job, JobHandle parent);
+	JobRecord*	TryTakeFreeRecord();
+	void		ReleaseRecord(JobRecord* record);
+	bool		AddContinuation(JobHandle dependency, JobRecord* continuation);
+	void		PushJob(JobRecord* record);
+	bool		TryRunJob();
+	JobRecord*	TryPopJob(int queueIndex);
+	void		ExecuteJob(JobRecord* record);
+	void		FinishJob(JobRecord* record);
+
+	void		WorkerThreadMain(int queueIndex);
+
+
+private:
+	//-----Private Data-----
+
+	// Ring as big as the record array, so it can never fill; a deque allocates and frees blocks as it's pushed and popped
+	struct JobQueue
+	{
+		std::mutex						mutex;
+		std::unique_ptr<JobRecord*[]>	jobs;
+		uint32_t						first = 0;
+		uint32_t						count = 0;
+	};
+
+	int								m_workerCount = 0;
+	std::vector<std::thread>		m_workers;
+	std::unique_ptr<JobQueue[]>		m_queues;			// 0 is shared by every thread outside the scheduler, then one per worker
+	std::unique_ptr<JobRecord[]>	m_records;
+
+	// Records are handed back as their jobs complete, in whatever order that is, so one long job can't hold up the rest
+	std::mutex						m_freeRecordMutex;
+	std::unique_ptr<JobRecord*[]>	m_freeRecords;		// Used as a stack
+	int								m_freeRecordCount = 0;
+
+	std::atomic<uint32_t>			m_nextSequence;
+	std::atomic<int>				m_queuedJobCount;
+	std::atomic<int>				m_peakQueuedJobCount;
+	std::atomic<int>				m_unfinishedJobCount;
+	std::atomic<int>				m_sleepingWorkerCount;
+
+	std::mutex						m_sleepMutex;
+	std::condition_variable			m_jobQueued;
+	bool							m_isStopping = false;
+
+	static const int				MAX_JOBS_IN_FLIGHT = 8192;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,92 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/LinearArena.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Alignment must be a power of two. Blocks are new[]'d, so they're aligned to at least 16 themselves
+uint8_t* LinearArena::Allocate(size_t size, size_t alignment /*= 16*/)
+{
+	if (m_blocks.size() > 0)
+	{
+		Block& block = m_blocks.back();
+		const size_t start = (block.usedSize + alignment - 1) & ~(alignment - 1);
+
+		if (start <= block.size && size <= block.size - start)
+		{
+			m_usedSize += (start + size) - block.usedSize;
+			block.usedSize = start + size;
+			return block.memory.get() + start;
+		}
+	}
+
+	Block block;
+	block.size = (size + alignment > m_minBlockSize ? size + alignment : m_minBlockSize);
+	block.memory.reset(new uint8_t[block.size]);
+	m_blocks.push_back(std::move(block));
+
+	return Allocate(size, alignment);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void LinearArena::Reset()
+{
+	m_peakUsedSize = (m_usedSize > m_peakUsedSize ? m_usedSize : m_peakUsedSize);
+
+	if (m_blocks.size() > 1)
+	{
+		m_blocks.clear();
+
+		Block block;
+		block.size = m_peakUsedSize;
+		block.memory.reset(new uint8_t[block.size]);
+		m_blocks.push_back(std::move(block));
+	}
+
+	for (Block& block : m_blocks)
+	{
+		block.usedSize = 0;
+	}
+
+	m_usedSize = 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+size_t LinearArena::GetCapacity() const
+{
+	size_t capacity = 0;
+	for (const Block& block : m_blocks)
+	{
+		capacity += block.size;
+	}
+
+	return capacity;
+}
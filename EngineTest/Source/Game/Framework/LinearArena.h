@@ -0,0 +1,72 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Bump allocator over a few large blocks, for memory that's all thrown away at once
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+const size_t LINEAR_ARENA_DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Hands out aligned memory that never moves until Reset. Reset keeps the memory, and if the last use spilled
+// into more than one block they're replaced with a single one big enough for all of it, so an arena settles
+// on one allocation after its first few uses. Only used from one thread at a time
+class LinearArena
+{
+public:
+	//-----Public Methods-----
+
+	LinearArena(size_t minBlockSize = LINEAR_ARENA_DEFAULT_BLOCK_SIZE) : m_minBlockSize(minBlockSize) {}
+	LinearArena(const LinearArena& copy) = delete;
+
+	uint8_t*	Allocate(size_t size, size_t alignment = 16);
+	void		Reset();
+
+	size_t		GetCapacity() const;
+	size_t		GetUsedSize() const { return m_usedSize; }
+	int			GetBlockCount() const { return (int)m_blocks.size(); }
+
+
+private:
+	//-----Private Data-----
+
+	struct Block
+	{
+		std::unique_ptr<uint8_t[]>	memory;
+		size_t						size = 0;
+		size_t						usedSize = 0;
+	};
+
+	std::vector<Block>	m_blocks;
+	size_t				m_minBlockSize = LINEAR_ARENA_DEFAULT_BLOCK_SIZE;
+	size_t				m_usedSize = 0;						// Across every block, including alignment padding
+	size_t				m_peakUsedSize = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,282 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/Lz4Compression.h"
+#include <cstring>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const size_t	s_minMatchLength = 4;
+static const size_t	s_lastLiteralCount = 5;		// The block has to end in at least this many literals
+static const size_t	s_matchSearchLimit = 12;	// and no match can start this close to the end
+static const size_t	s_maxOffset = 65535;
+static const int	s_hashBits = 16;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static uint32_t ReadUInt32(const uint8_t* data)
+{
+	uint32_t value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint32_t GetSequenceHash(uint32_t sequence)
+{
+	return (sequence * 2654435761U) >> (32 - s_hashBits);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Lengths past the token's 4 bits carry on in bytes of 255, ending with a byte under 255
+static bool WriteLengthBytes(size_t length, uint8_t*& cursor, const uint8_t* end)
+{
+	for (; length >= 255; length -= 255)
+	{
+		if (cursor >= end)
+		{
+			return false;
+		}
+
+		*cursor++ = 255;
+	}
+
+	if (cursor >= end)
+	{
+		return false;
+	}
+
+	*cursor++ = (uint8_t)length;
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool ReadLengthBytes(size_t& length, const uint8_t*& cursor, const uint8_t* end)
+{
+	uint8_t lengthByte;
+
+	do
+	{
+		if (cursor >= end)
+		{
+			return false;
+		}
+
+		lengthByte = *cursor++;
+		length += lengthByte;
+	} while (lengthByte == 255);
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// One sequence: the literals since the last match, then the match. A match length of 0 writes the
+// literals only, which is how a block ends
+static bool WriteSequence(const uint8_t* literals, size_t literalCount, size_t matchOffset, size_t matchLength, uint8_t*& cursor, const uint8_t* end)
+{
+	if (cursor >= end)
+	{
+		return false;
+	}
+
+	uint8_t* token = cursor++;
+	*token = (uint8_t)((literalCount >= 15 ? 15 : literalCount) << 4);
+
+	if (literalCount >= 15 && !WriteLengthBytes(literalCount - 15, cursor, end))
+	{
+		return false;
+	}
+
+	if ((size_t)(end - cursor) < literalCount)
+	{
+		return false;
+	}
+
+	if (literalCount > 0)
+	{
+		memcpy(cursor, literals, literalCount);
+		cursor += literalCount;
+	}
+
+	if (matchLength == 0)
+	{
+		return true;
+	}
+
+	if (end - cursor < 2)
+	{
+		return false;
+	}
+
+	*cursor++ = (uint8_t)(matchOffset & 0xFF);
+	*cursor++ = (uint8_t)(matchOffset >> 8);
+
+	const size_t extraLength = matchLength - s_minMatchLength;
+	*token |= (uint8_t)(extraLength >= 15 ? 15 : extraLength);
+
+	return (extraLength < 15 || WriteLengthBytes(extraLength - 15, cursor, end));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+size_t GetLz4MaxCompressedSize(size_t size)
+{
+	return size + (size / 255) + 16;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Every byte of a block can add at most 255 to a match length, and a match needs a token and an offset
+// besides, so nothing decodes to more than 255 times its compressed size
+uint64_t GetLz4MaxDecompressedSize(uint64_t compressedSize)
+{
+	return compressedSize * 255;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Each position is hashed on its next 4 bytes, and the table remembers the last position with that hash;
+// if those bytes match it's extended forward as far as it goes
+size_t CompressLz4(const uint8_t* source, size_t sourceSize, uint8_t* out_destination, size_t destinationCapacity)
+{
+	uint8_t* cursor = out_destination;
+	const uint8_t* end = out_destination + destinationCapacity;
+	size_t anchor = 0;
+
+	if (sourceSize > s_matchSearchLimit)
+	{
+		std::vector<int64_t> lastPositionByHash((size_t)1 << s_hashBits, -1);
+		const size_t searchEnd = sourceSize - s_matchSearchLimit;
+		const size_t matchEnd = sourceSize - s_lastLiteralCount;
+
+		for (size_t position = 0; position < searchEnd;)
+		{
+			const uint32_t sequence = ReadUInt32(source + position);
+			int64_t& lastPosition = lastPositionByHash[GetSequenceHash(sequence)];
+			const int64_t candidate = lastPosition;
+			lastPosition = (int64_t)position;
+
+			if (candidate < 0 || position - (size_t)candidate > s_maxOffset || ReadUInt32(source + candidate) != sequence)
+			{
+				position++;
+				continue;
+			}
+
+			size_t matchLength = s_minMatchLength;
+			while (position + matchLength < matchEnd && source[(size_t)candidate + matchLength] == source[position + matchLength])
+			{
+				matchLength++;
+			}
+
+			if (!WriteSequence(source + anchor, position - anchor, position - (size_t)candidate, matchLength, cursor, end))
+			{
+				return 0;
+			}
+
+			position += matchLength;
+			anchor = position;
+		}
+	}
+
+	if (!WriteSequence(source + anchor, sourceSize - anchor, 0, 0, cursor, end))
+	{
+		return 0;
+	}
+
+	return (size_t)(cursor - out_destination);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Every length and offset is checked against both buffers, so a corrupt block fails rather than reading
+// or writing out of bounds. Succeeds only if the block decodes to exactly destinationSize bytes
+size_t DecompressLz4(const uint8_t* source, size_t sourceSize, uint8_t* out_destination, size_t destinationSize)
+{
+	const uint8_t* cursor = source;
+	const uint8_t* end = source + sourceSize;
+	size_t written = 0;
+
+	while (cursor < end)
+	{
+		const uint8_t token = *cursor++;
+
+		size_t literalCount = (token >> 4);
+		if (literalCount == 15 && !ReadLengthBytes(literalCount, cursor, end))
+		{
+			return 0;
+		}
+
+		if ((size_t)(end - cursor) < literalCount || destinationSize - written < literalCount)
+		{
+			return 0;
+		}
+
+		if (literalCount > 0)
+		{
+			memcpy(out_destination + written, cursor, literalCount);
+			cursor += literalCount;
+			written += literalCount;
+		}
+
+		// The last sequence has no match
+		if (cursor == end)
+		{
+			break;
+		}
+
+		if (end - cursor < 2)
+		{
+			return 0;
+		}
+
+		const size_t matchOffset = (size_t)cursor[0] | ((size_t)cursor[1] << 8);
+		cursor += 2;
+
+		size_t matchLength = (token & 15);
+		if (matchLength == 15 && !ReadLengthBytes(matchLength, cursor, end))
+		{
+			return 0;
+		}
+
+		matchLength += s_minMatchLength;
+
+		if (matchOffset == 0 || matchOffset > written || destinationSize - written < matchLength)
+		{
+			return 0;
+		}
+
+		// Byte by byte, since a match can overlap the bytes it's writing
+		const uint8_t* match = out_destination + written - matchOffset;
+		for (size_t byteIndex = 0; byteIndex < matchLength; ++byteIndex)
+		{
+			out_destination[written + byteIndex] = match[byteIndex];
+		}
+
+		written += matchLength;
+	}
+
+	return (written == destinationSize ? written : 0);
+}
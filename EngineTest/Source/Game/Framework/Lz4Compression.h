@@ -0,0 +1,40 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: LZ4 block format compression, for resource pack entries
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Raw blocks, no frame header or checksums, so the sizes have to be stored alongside them.
+// The compressor is a single pass greedy matcher: quick enough for the packer, and the output
+// decodes with any LZ4 block decoder. Both return 0 on failure, including the output not fitting
+size_t GetLz4MaxCompressedSize(size_t size);
+uint64_t GetLz4MaxDecompressedSize(uint64_t compressedSize);
+size_t CompressLz4(const uint8_t* source, size_t sourceSize, uint8_t* out_destination, size_t destinationCapacity);
+size_t DecompressLz4(const uint8_t* source, size_t sourceSize, uint8_t* out_destination, size_t destinationSize);
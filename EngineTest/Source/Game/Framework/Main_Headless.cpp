@@ -0,0 +1,487 @@
+#include "Game/Benchmark/DebugDrawBenchmark.h"
+#include "Game/Benchmark/EntityPoolBenchmark.h"
+#include "Game/Benchmark/JobBenchmark.h"
+#include "Game/Benchmark/PhysicsBenchmark.h"
+#include "Game/Benchmark/ResourceBenchmark.h"
+#include "Game/Benchmark/StreamingBenchmark.h"
+#include "Game/Benchmark/TextureBenchmark.h"
+#include "Game/Benchmark/VoxelBenchmark.h"
+#include "Game/Cook/AssetCooker.h"
+#include "Game/Framework/App.h"
+#include "Game/Framework/GameCommon.h"
+#include "Game/Framework/GameInput.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/PerfCounters.h"
+#include "Game/Framework/Profiler.h"
+#include "Game/Framework/ResourcePack.h"
+#include "Game/Voxel/VoxelModel.h"
+#include "Engine/Core/EngineCommon.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------
+struct HeadlessCommandLine
+{
+	HeadlessSettings			settings;
+	std::string					benchmarkName;
+	PhysicsBenchmarkSettings	physicsBenchmark;
+	EntityPoolBenchmarkSettings	entityPoolBenchmark;
+	JobBenchmarkSettings		jobBenchmark;
+	VoxelBenchmarkSettings		voxelBenchmark;
+	StreamingBenchmarkSettings	streamingBenchmark;
+	ResourceBenchmarkSettings	resourceBenchmark;
+	TextureBenchmarkSettings	textureBenchmark;
+	DebugDrawBenchmarkSettings	debugDrawBenchmark;
+	std::vector<std::string>	qefPathsToCook;
+	std::string					directoryToCook;
+	AssetCookSettings			cookSettings;
+	std::string					directoryToPack;
+	std::string					packPath = RESOURCE_PACK_DEFAULT_PATH;
+	ResourcePackSettings		packSettings;
+	int							profileFrameCount = 0;
+	std::string					profilePath = PROFILER_DEFAULT_CAPTURE_PATH;
+	std::string					statsCsvPath;
+	std::string					replayPath;
+	bool						hasFrameLimit = false;
+};
+
+
+//-----------------------------------------------------------------------------------------------
+// Reads "-name=value" style arguments, returns nullptr if the argument isn't the one asked for
+static const char* GetArgValue(const char* arg, const char* name)
+{
+	const size_t nameLength = strlen(name);
+	if (strncmp(arg, name, nameLength) == 0 && arg[nameLength] == '=')
+	{
+		return arg + nameLength + 1;
+	}
+
+	return nullptr;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+static void ParseCommandLine(int argc, char* argv[], HeadlessCommandLine& out_commandLine)
+{
+	for (int argIndex = 1; argIndex < argc; ++argIndex)
+	{
+		const char* arg = argv[argIndex];
+		const char* value = nullptr;
+
+		if ((value = GetArgValue(arg, "-frames")) != nullptr)
+		{
+			out_commandLine.settings.maxFrames = atoi(value);
+			out_commandLine.hasFrameLimit = true;
+		}
+		else if ((value = GetArgValue(arg, "-seconds")) != nullptr)
+		{
+			out_commandLine.settings.maxRealSeconds = (float)atof(value);
+		}
+		else if ((value = GetArgValue(arg, "-hz")) != nullptr)
+		{
+			const float hz = (float)atof(value);
+			if (hz > 0.f)
+			{
+				out_commandLine.settings.fixedDeltaSeconds = (1.f / hz);
+				out_commandLine.physicsBenchmark.deltaSeconds = (1.f / hz);
+				out_commandLine.entityPoolBenchmark.deltaSeconds = (1.f / hz);
+			}
+		}
+		else if ((value = GetArgValue(arg, "-threads")) != nullptr)
+		{
+			out_commandLine.settings.workerThreadCount = atoi(value);
+		}
+		else if ((value = GetArgValue(arg, "-benchmark")) != nullptr)
+		{
+			out_commandLine.benchmarkName = value;
+		}
+		else if ((value = GetArgValue(arg, "-benchmark_frames")) != nullptr)
+		{
+			out_commandLine.physicsBenchmark.frameCount = atoi(value);
+			out_commandLine.entityPoolBenchmark.frameCount = atoi(value);
+			out_commandLine.debugDrawBenchmark.frameCount = atoi(value);
+		}
+		else if ((value = GetArgValue(arg, "-max_bodies")) != nullptr)
+		{
+			out_commandLine.physicsBenchmark.maxBodyCount = atoi(value);
+			out_commandLine.entityPoolBenchmark.maxBodyCount = atoi(value);
+			out_commandLine.debugDrawBenchmark.colliderCount = atoi(value);
+		}
+		else if ((value = GetArgValue(arg, "-scene")) != nullptr)
+		{
+			out_commandLine.physicsBenchmark.sceneFilter = value;
+		}
+		else if ((value = GetArgValue(arg, "-broadphase")) != nullptr)
+		{
+			const BodyBroadphaseType type = GetBodyBroadphaseTypeFromName(value, NUM_BODY_BROADPHASE_TYPES);
+			if (type == NUM_BODY_BROADPHASE_TYPES)
+			{
+				printf("Unknown broadphase \"%s\", expected sort_and_sweep, aabb_tree, sweep_and_prune, spatial_hash or sphere_bounds\n", value);
+			}
+			else
+			{
+				out_commandLine.physicsBenchmark.broadphaseType = type;
+			}
+		}
+		else if ((value = GetArgValue(arg, "-max_threads")) != nullptr)
+		{
+			out_commandLine.jobBenchmark.maxThreadCount = atoi(value);
+		}
+		else if ((value = GetArgValue(arg, "-voxel_size")) != nullptr)
+		{
+			out_commandLine.voxelBenchmark.generatedSize = atoi(value);
+		}
+		else if ((value = GetArgValue(arg, "-stream_models")) != nullptr)
+		{
+			out_commandLine.streamingBenchmark.modelCount = atoi(value);
+		}
+		else if ((value = GetArgValue(arg, "-resource_count")) != nullptr)
+		{
+			out_commandLine.resourceBenchmark.resourceCount = atoi(value);
+		}
+		else if ((value = GetArgValue(arg, "-data_directory")) != nullptr)
+		{
+			out_commandLine.resourceBenchmark.dataDirectory = value;
+			out_commandLine.textureBenchmark.dataDirectory = value;
+		}
+		else if ((value = GetArgValue(arg, "-cook_voxels")) != nullptr)
+		{
+			out_commandLine.qefPathsToCook.push_back(value);
+		}
+		else if ((value = GetArgValue(arg, "-cook")) != nullptr)
+		{
+			out_commandLine.directoryToCook = value;
+		}
+		else if ((value = GetArgValue(arg, "-cook_manifest")) != nullptr)
+		{
+			out_commandLine.cookSettings.manifestPath = value;
+		}
+		else if ((value = GetArgValue(arg, "-cook_force")) != nullptr)
+		{
+			out_commandLine.cookSettings.force = (atoi(value) != 0);
+		}
+		else if ((value = GetArgValue(arg, "-cook_verbose")) != nullptr)
+		{
+			out_commandLine.cookSettings.verbose = (atoi(value) != 0);
+		}
+		else if ((value = GetArgValue(arg, "-pack")) != nullptr)
+		{
+			out_commandLine.directoryToPack = value;
+		}
+		else if ((value = GetArgValue(arg, "-pack_output")) != nullptr)
+		{
+			out_commandLine.packPath = value;
+		}
+		else if ((value = GetArgValue(arg, "-pack_compress")) != nullptr)
+		{
+			out_commandLine.packSettings.compress = (atoi(value) != 0);
+		}
+		else if ((value = GetArgValue(arg, "-profile_frames")) != nullptr)
+		{
+			out_commandLine.profileFrameCount = atoi(value);
+		}
+		else if ((value = GetArgValue(arg, "-profile_output")) != nullptr)
+		{
+			out_commandLine.profilePath = value;
+		}
+		else if ((value = GetArgValue(arg, "-stats_csv")) != nullptr)
+		{
+			out_commandLine.statsCsvPath = value;
+		}
+		else if ((value = GetArgValue(arg, "-replay")) != nullptr)
+		{
+			out_commandLine.replayPath = value;
+		}
+		else if ((value = GetArgValue(arg, "-backend")) != nullptr)
+		{
+			if (strcmp(value, "soa") == 0)
+			{
+				out_commandLine.physicsBenchmark.backend = PHYSICS_BENCHMARK_BACKEND_SOA;
+			}
+			else if (strcmp(value, "game") == 0)
+			{
+				out_commandLine.physicsBenchmark.backend = PHYSICS_BENCHMARK_BACKEND_GAME;
+			}
+			else
+			{
+				printf("Unknown backend \"%s\", expected game or soa\n", value);
+			}
+		}
+		else if ((value = GetArgValue(arg, "-simd")) != nullptr)
+		{
+			const BodySimdMode mode = GetBodySimdModeFromName(value, NUM_BODY_SIMD_MODES);
+			if (mode == NUM_BODY_SIMD_MODES || !IsBodySimdModeSupported(mode))
+			{
+				printf("SIMD mode \"%s\" isn't available, expected scalar or sse\n", value);
+			}
+			else
+			{
+				out_commandLine.physicsBenchmark.simdMode = mode;
+			}
+		}
+		else
+		{
+			printf("Unknown argument \"%s\", expected -frames=N, -seconds=S, -hz=H, -threads=N, -profile_frames=N [-profile_output=PATH], -stats_csv=PATH, -replay=PATH, -cook_voxels=PATH.qef, -cook=DIR [-cook_manifest=PATH -cook_force=0|1 -cook_verbose=0|1], -pack=DIR [-pack_output=PATH -pack_compress=0|1] or -benchmark=physics|physics_simd|broadphase|warm_start|ccd|rollback|jobs|voxel_load|voxel_mesh|streaming|resource_lookup|pack_load|texture_import|entity_pool|debug_draw [-benchmark_frames=N -max_bodies=N -scene=NAME -backend=game|soa -simd=scalar|sse -broadphase=NAME -max_threads=N -voxel_size=N -stream_models=N -resource_count=N -data_directory=DIR]\n", arg);
+		}
+	}
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Writes the cooked file next to each .qef, where VoxelModel::Load looks for it. Returns the number that failed
+static int CookVoxelModels(const std::vector<std::string>& qefPaths)
+{
+	int failedCount = 0;
+
+	for (const std::string& qefPath : qefPaths)
+	{
+		const std::string cookedPath = GetCookedVoxelPath(qefPath);
+		std::string error;
+
+		if (CookVoxelModel(qefPath, cookedPath, &error))
+		{
+			printf("Cooked %s -> %s\n", qefPath.c_str(), cookedPath.c_str());
+		}
+		else
+		{
+			printf("Couldn't cook %s: %s\n", qefPath.c_str(), error.c_str());
+			failedCount++;
+		}
+	}
+
+	return failedCount;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Cooks everything under the directory that changed since the last cook, in parallel on the JobScheduler
+static bool CookDirectory(const std::string& directory, const AssetCookSettings& cookSettings, int workerThreadCount)
+{
+	AssetCookSettings settings = cookSettings;
+	settings.dataDirectory = directory;
+
+	JobScheduler::Initialize(workerThreadCount);
+
+	AssetCooker cooker(settings);
+	AssetCookStats stats;
+	const bool succeeded = cooker.Cook(&stats);
+
+	JobScheduler::Shutdown();
+
+	printf("Cooked %s in %.3fs: %d assets, %d cooked, %d up to date (%d restamped), %d failed, %d sources hashed\n", directory.c_str(), stats.seconds,
+		stats.assetCount, stats.cookedCount, stats.upToDateCount, stats.restampedCount, stats.failedCount, stats.hashedFileCount);
+
+	return succeeded;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Packs the directory into one file the game reads in place of the loose files. Returns whether it worked
+static bool PackDirectory(const std::string& directory, const std::string& packPath, const ResourcePackSettings& settings)
+{
+	ResourcePackStats stats;
+	std::string error;
+
+	if (!WriteResourcePack(directory, packPath, settings, &stats, &error))
+	{
+		printf("Couldn't pack %s: %s\n", directory.c_str(), error.c_str());
+		return false;
+	}
+
+	printf("Packed %s -> %s: %d files (%d compressed), %.1f KB -> %.1f KB\n", directory.c_str(), packPath.c_str(),
+		stats.fileCount, stats.compressedCount, (double)stats.looseBytes / 1024.0, (double)stats.packBytes / 1024.0);
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------------------
+// Headless entry point - steps Game::Update with a fixed timestep, with no window, renderer or input
+int main(int argc, char* argv[])
+{
+	HeadlessCommandLine commandLine;
+	ParseCommandLine(argc, argv, commandLine);
+
+	// Cooking and packing are offline steps, so they don't need the game running. Cooking goes first so the
+	// cooked files can be packed in the same run
+	if (commandLine.qefPathsToCook.size() > 0 || commandLine.directoryToCook.size() > 0 || commandLine.directoryToPack.size() > 0)
+	{
+		const bool cookedVoxels = (CookVoxelModels(commandLine.qefPathsToCook) == 0);
+		const bool cookedDirectory = (commandLine.directoryToCook.size() == 0 || CookDirectory(commandLine.directoryToCook, commandLine.cookSettings, commandLine.settings.workerThreadCount));
+		const bool cooked = (cookedVoxels && cookedDirectory);
+		const bool packed = (commandLine.directoryToPack.size() == 0 || PackDirectory(commandLine.directoryToPack, commandLine.packPath, commandLine.packSettings));
+
+		return (cooked && packed ? 0 : 1);
+	}
+
+	// Replays end the run themselves, so the default frame limit would only cut them short
+	if (commandLine.replayPath.size() > 0 && !commandLine.hasFrameLimit)
+	{
+		commandLine.settings.maxFrames = 0;
+	}
+
+	const HeadlessSettings& settings = commandLine.settings;
+	App::InitializeHeadless(settings);
+
+	if (commandLine.benchmarkName.size() > 0)
+	{
+		// Failed checks and unknown names exit nonzero, so automated runs can tell
+		bool succeeded = true;
+
+		if (commandLine.benchmarkName == "physics")
+		{
+			PhysicsBenchmark benchmark(commandLine.physicsBenchmark);
+			succeeded = benchmark.Run();
+		}
+		else if (commandLine.benchmarkName == "physics_simd")
+		{
+			PhysicsBenchmark benchmark(commandLine.physicsBenchmark);
+			succeeded = benchmark.RunSimdComparison();
+		}
+		else if (commandLine.benchmarkName == "broadphase")
+		{
+			PhysicsBenchmark benchmark(commandLine.physicsBenchmark);
+			succeeded = benchmark.RunBroadphaseComparison();
+		}
+		else if (commandLine.benchmarkName == "warm_start")
+		{
+			PhysicsBenchmark benchmark(commandLine.physicsBenchmark);
+			succeeded = benchmark.RunWarmStartComparison();
+		}
+		else if (commandLine.benchmarkName == "ccd")
+		{
+			PhysicsBenchmark benchmark(commandLine.physicsBenchmark);
+			succeeded = benchmark.RunContinuousCollisionComparison();
+		}
+		else if (commandLine.benchmarkName == "rollback")
+		{
+			PhysicsBenchmark benchmark(commandLine.physicsBenchmark);
+			succeeded = benchmark.RunRollbackComparison();
+		}
+		else if (commandLine.benchmarkName == "jobs")
+		{
+			JobBenchmark benchmark(commandLine.jobBenchmark);
+			succeeded = benchmark.Run();
+		}
+		else if (commandLine.benchmarkName == "voxel_load")
+		{
+			VoxelBenchmark benchmark(commandLine.voxelBenchmark);
+			succeeded = benchmark.Run();
+		}
+		else if (commandLine.benchmarkName == "voxel_mesh")
+		{
+			VoxelBenchmark benchmark(commandLine.voxelBenchmark);
+			succeeded = benchmark.RunMeshing();
+		}
+		else if (commandLine.benchmarkName == "streaming")
+		{
+			StreamingBenchmark benchmark(commandLine.streamingBenchmark);
+			succeeded = benchmark.Run();
+		}
+		else if (commandLine.benchmarkName == "resource_lookup")
+		{
+			ResourceBenchmark benchmark(commandLine.resourceBenchmark);
+			succeeded = benchmark.Run();
+		}
+		else if (commandLine.benchmarkName == "pack_load")
+		{
+			ResourceBenchmark benchmark(commandLine.resourceBenchmark);
+			succeeded = benchmark.RunPackLoading();
+		}
+		else if (commandLine.benchmarkName == "texture_import")
+		{
+			TextureBenchmark benchmark(commandLine.textureBenchmark);
+			succeeded = benchmark.Run();
+		}
+		else if (commandLine.benchmarkName == "entity_pool")
+		{
+			EntityPoolBenchmark benchmark(commandLine.entityPoolBenchmark);
+			succeeded = benchmark.Run();
+		}
+		else if (commandLine.benchmarkName == "debug_draw")
+		{
+			DebugDrawBenchmark benchmark(commandLine.debugDrawBenchmark);
+			succeeded = benchmark.Run();
+		}
+		else
+		{
+			printf("Unknown benchmark \"%s\"\n", commandLine.benchmarkName.c_str());
+			succeeded = false;
+		}
+
+		App::Shutdown();
+		return (succeeded ? 0 : 1);
+	}
+
+	// From the first frame; written when it's done, or at shutdown if the run is shorter
+	if (commandLine.profileFrameCount > 0)
+	{
+		g_profiler->RequestCapture(commandLine.profileFrameCount, commandLine.profilePath);
+	}
+
+	// A row of counters per frame, for automated runs to graph or check against a budget
+	if (commandLine.statsCsvPath.size() > 0 && !g_perfCounters->OpenCsv(commandLine.statsCsvPath))
+	{
+		printf("Couldn't open %s to write the stats to\n", commandLine.statsCsvPath.c_str());
+		App::Shutdown();
+		return 1;
+	}
+
+	// Played back in place of input, with the recorded frame times; pair with -stats_csv to compare frame times between runs
+	std::string replayError;
+	if (commandLine.replayPath.size() > 0 && !g_gameInput->StartReplay(commandLine.replayPath, &replayError))
+	{
+		printf("Couldn't replay input: %s\n", replayError.c_str());
+		App::Shutdown();
+		return 1;
+	}
+
+	if (commandLine.replayPath.size() > 0 && g_gameInput->GetReplayFrameCount() == 0)
+	{
+		printf("%s has no frames to replay\n", commandLine.replayPath.c_str());
+		App::Shutdown();
+		return 1;
+	}
+
+	while (!g_app->IsQuitting())
+	{
+		g_app->RunFrame();
+	}
+
+	const int frameCount = g_app->GetFrameCount();
+	const double realSeconds = g_app->GetElapsedRealSeconds();
+	const double simSeconds = (double)frameCount * (double)settings.fixedDeltaSeconds;
+
+	if (commandLine.replayPath.size() > 0)
+	{
+		printf("Replayed %d frames of input from %s in %.3fs\n", frameCount, commandLine.replayPath.c_str(), realSeconds);
+	}
+	else
+	{
+		printf("Simulated %d frames (%.2fs of game time) in %.3fs\n", frameCount, simSeconds, realSeconds);
+	}
+
+	if (frameCount > 0 && realSeconds > 0.0)
+	{
+		printf("%.1f frames/s, %.4f ms/frame\n", (double)frameCount / realSeconds, (1000.0 * realSeconds) / (double)frameCount);
+	}
+
+	if (commandLine.statsCsvPath.size() > 0)
+	{
+		std::vector<std::string> lines;
+		g_perfCounters->GetSummaryLines(lines);
+
+		for (const std::string& line : lines)
+		{
+			printf("%s\n", line.c_str());
+		}
+
+		printf("Wrote a row per frame to %s\n", commandLine.statsCsvPath.c_str());
+	}
+
+	App::Shutdown();
+	return 0;
+}
@@ -0,0 +1,311 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/MappedFile.h"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+bool GetFileInfo(const char* path, FileInfo& out_info)
+{
+#ifdef _WIN32
+	struct _stat64 fileStat;
+	if (_stat64(path, &fileStat) != 0)
+	{
+		return false;
+	}
+#else
+	struct stat fileStat;
+	if (stat(path, &fileStat) != 0)
+	{
+		return false;
+	}
+#endif
+
+	out_info.size = (uint64_t)fileStat.st_size;
+	out_info.modifiedTime = (uint64_t)fileStat.st_mtime;
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Replaces the file if it's there
+bool WriteBinaryFile(const char* path, const void* data, size_t size)
+{
+	std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	file.write((const char*)data, (std::streamsize)size);
+	return file.good();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool DeleteFileAtPath(const char* path)
+{
+	return (remove(path) == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Every file under the directory, recursively, as the directory plus the relative path with forward
+// slashes. Sorted, so anything built from the list comes out the same on every machine
+bool ListFilesInDirectory(const std::string& directory, std::vector<std::string>& out_paths)
+{
+	const size_t firstNewPath = out_paths.size();
+	std::vector<std::string> directoriesToVisit;
+	directoriesToVisit.push_back(directory);
+
+	while (directoriesToVisit.size() > 0)
+	{
+		const std::string currentDirectory = directoriesToVisit.back();
+		directoriesToVisit.pop_back();
+
+#ifdef _WIN32
+		WIN32_FIND_DATAA findData;
+		HANDLE findHandle = FindFirstFileA((currentDirectory + "/*").c_str(), &findData);
+		if (findHandle == INVALID_HANDLE_VALUE)
+		{
+			if (currentDirectory == directory)
+			{
+				return false;
+			}
+
+			continue;
+		}
+
+		do
+		{
+			const std::string name = findData.cFileName;
+			if (name == "." || name == "..")
+			{
+				continue;
+			}
+
+			const bool isDirectory = ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0);
+			(isDirectory ? directoriesToVisit : out_paths).push_back(currentDirectory + "/" + name);
+		} while (FindNextFileA(findHandle, &findData));
+
+		FindClose(findHandle);
+#else
+		DIR* directoryHandle = opendir(currentDirectory.c_str());
+		if (directoryHandle == nullptr)
+		{
+			if (currentDirectory == directory)
+			{
+				return false;
+			}
+
+			continue;
+		}
+
+		for (dirent* entry = readdir(directoryHandle); entry != nullptr; entry = readdir(directoryHandle))
+		{
+			const std::string name = entry->d_name;
+			if (name == "." || name == "..")
+			{
+				continue;
+			}
+
+			const std::string path = currentDirectory + "/" + name;
+			struct stat pathStat;
+			if (stat(path.c_str(), &pathStat) == 0)
+			{
+				(S_ISDIR(pathStat.st_mode) ? directoriesToVisit : out_paths).push_back(path);
+			}
+		}
+
+		closedir(directoryHandle);
+#endif
+	}
+
+	std::sort(out_paths.begin() + firstNewPath, out_paths.end());
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Best effort, for measuring cold loads: asks the OS to drop its cached copy of the file so the next read
+// comes from the disk. Windows purges a file's cache when it's opened unbuffered
+void EvictFileFromCache(const char* path)
+{
+#ifdef _WIN32
+	HANDLE fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+	if (fileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(fileHandle);
+	}
+#elif defined(POSIX_FADV_DONTNEED)
+	const int fileDescriptor = open(path, O_RDONLY);
+	if (fileDescriptor >= 0)
+	{
+		posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_DONTNEED);
+		close(fileDescriptor);
+	}
+#else
+	(void)path;
+#endif
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool MappedFile::Open(const char* path)
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(fileHandle, &fileSize))
+	{
+		CloseHandle(fileHandle);
+		return false;
+	}
+
+	m_fileHandle = fileHandle;
+	m_size = (size_t)fileSize.QuadPart;
+
+	// Zero length files can't be mapped
+	if (m_size > 0)
+	{
+		HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		const void* view = (mappingHandle != nullptr ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr);
+
+		if (view == nullptr)
+		{
+			if (mappingHandle != nullptr)
+			{
+				CloseHandle(mappingHandle);
+			}
+
+			CloseHandle(fileHandle);
+			m_fileHandle = nullptr;
+			m_size = 0;
+			return false;
+		}
+
+		m_mappingHandle = mappingHandle;
+		m_data = (const uint8_t*)view;
+	}
+#else
+	const int fileDescriptor = open(path, O_RDONLY);
+	if (fileDescriptor < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+	if (fstat(fileDescriptor, &fileStat) != 0)
+	{
+		close(fileDescriptor);
+		return false;
+	}
+
+	m_size = (size_t)fileStat.st_size;
+
+	// The mapping keeps its own reference to the file, so the descriptor isn't needed past here
+	if (m_size > 0)
+	{
+		void* view = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		if (view == MAP_FAILED)
+		{
+			close(fileDescriptor);
+			m_size = 0;
+			return false;
+		}
+
+		m_data = (const uint8_t*)view;
+	}
+
+	close(fileDescriptor);
+#endif
+
+	m_isOpen = true;
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void MappedFile::Close()
+{
+#ifdef _WIN32
+	if (m_data != nullptr)
+	{
+		UnmapViewOfFile(m_data);
+	}
+
+	if (m_mappingHandle != nullptr)
+	{
+		CloseHandle((HANDLE)m_mappingHandle);
+		m_mappingHandle = nullptr;
+	}
+
+	if (m_fileHandle != nullptr)
+	{
+		CloseHandle((HANDLE)m_fileHandle);
+		m_fileHandle = nullptr;
+	}
+#else
+	if (m_data != nullptr)
+	{
+		munmap((void*)m_data, m_size);
+	}
+#endif
+
+	m_isOpen = false;
+	m_data = nullptr;
+	m_size = 0;
+}
@@ -0,0 +1,81 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Read only memory mapped files, plus the few other file operations the cooked data needs
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct FileInfo
+{
+	uint64_t size = 0;
+	uint64_t modifiedTime = 0;		// Seconds since the epoch, only good for comparing against itself
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Maps a whole file read only; pages are only read in as they're touched, and nothing is copied to the heap.
+// Empty files open fine, with no data
+class MappedFile
+{
+public:
+	//-----Public Methods-----
+
+	MappedFile() {}
+	~MappedFile();
+	MappedFile(const MappedFile& copy) = delete;
+	MappedFile& operator=(const MappedFile& copy) = delete;
+
+	bool			Open(const char* path);
+	void			Close();
+
+	bool			IsOpen() const { return m_isOpen; }
+	const uint8_t*	GetData() const { return m_data; }
+	size_t			GetSize() const { return m_size; }
+
+
+private:
+	//-----Private Data-----
+
+	bool			m_isOpen = false;
+	const uint8_t*	m_data = nullptr;
+	size_t			m_size = 0;
+
+#ifdef _WIN32
+	void*			m_fileHandle = nullptr;
+	void*			m_mappingHandle = nullptr;
+#endif
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+bool GetFileInfo(const char* path, FileInfo& out_info);
+bool WriteBinaryFile(const char* path, const void* data, size_t size);
+bool DeleteFileAtPath(const char* path);
+bool ListFilesInDirectory(const std::string& directory, std::vector<std::string>& out_paths);
+void EvictFileFromCache(const char* path);
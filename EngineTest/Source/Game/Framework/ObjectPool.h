@@ -0,0 +1,399 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Typed pools of objects that never move, addressed by generational handles
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Engine/Core/EngineCommon.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <cstdlib>
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Same idea as BodyHandle: stays valid across other objects being destroyed, and the generation catches use
+// after destruction, or after the slot was reused. Generations start at 1, so a default handle is never valid
+struct PoolHandle
+{
+	static const uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+	bool operator==(const PoolHandle& other) const { return slot == other.slot && generation == other.generation; }
+	bool operator!=(const PoolHandle& other) const { return !(*this == other); }
+
+	uint32_t slot = INVALID_SLOT;
+	uint32_t generation = 0;
+};
+
+// The slot bookkeeping of an ObjectPool without the objects, so the pool can be put back the way it was
+// once the same objects are live in it again (see Game::RestoreSnapshot)
+struct ObjectPoolLayout
+{
+	std::vector<uint32_t>	generations;	// By slot
+	std::vector<uint32_t>	freeSlots;		// Bottom of the stack first
+	std::vector<uint32_t>	objectSlots;	// Of the live objects, in order
+};
+
+// Chunks come from the aligned allocators, since new[] only promises 8 bytes on 32 bit MSVC builds
+struct ObjectPoolChunkDeleter
+{
+	static uint8_t* Allocate(size_t size)
+	{
+#ifdef _WIN32
+		void* memory = _aligned_malloc(size, 16);
+#else
+		void* memory = nullptr;
+		if (posix_memalign(&memory, 16, size) != 0)
+		{
+			memory = nullptr;
+		}
+#endif
+		ASSERT_OR_DIE(memory != nullptr, "Couldn't allocate an ObjectPool chunk");
+		return (uint8_t*)memory;
+	}
+
+	void operator()(uint8_t* memory) const
+	{
+#ifdef _WIN32
+		_aligned_free(memory);
+#else
+		free(memory);
+#endif
+	}
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+const int OBJECT_POOL_DEFAULT_CHUNK_SIZE = 256;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Objects are built in place in chunks of slots and stay at the same address until destroyed, since raw pointers
+// are held onto (entities to their colliders, colliders to their owning entity, the Game to its Player). Bodies
+// live in the BodyScene and are only held by BodyHandle, so they don't rely on this.
+// Creating pops a free slot and destroying pushes it back, both O(1); the heap is only touched when
+// every chunk is full. The live objects are also kept densely packed in a pointer array for iterating; destroying
+// swaps the last one into the hole, so that order changes, but handles and addresses don't.
+// Slots can be made bigger than T so a derived type can be created in them (e.g. the Player among Entities)
+template <typename T>
+class ObjectPool
+{
+public:
+	//-----Public Methods-----
+
+	ObjectPool(int objectsPerChunk = OBJECT_POOL_DEFAULT_CHUNK_SIZE, size_t objectSize = sizeof(T));
+	~ObjectPool() { Clear(); }
+	ObjectPool(const ObjectPool& copy) = delete;
+
+	template <typename U = T, typename... ARGS>
+	PoolHandle			Create(ARGS&&... args);
+	template <typename U = T, typename... ARGS>
+	PoolHandle			CreateAt(PoolHandle handle, ARGS&&... args);	// Into that free slot, with that generation
+	void				Destroy(PoolHandle handle);
+	void				Clear();
+	void				Reserve(int objectCount);
+
+	void				GetLayout(ObjectPoolLayout& out_layout) const;
+	bool				SetLayout(const ObjectPoolLayout& layout);
+
+	bool				IsValid(PoolHandle handle) const { return GetIndex(handle) >= 0; }
+	T*					Get(PoolHandle handle) const;
+	int					GetIndex(PoolHandle handle) const;				// Into the live objects, -1 if the handle is stale
+
+	int					GetCount() const { return (int)m_objects.size(); }
+	int					GetSlotCount() const { return (int)m_slots.size(); }
+	T*					GetAt(int index) const { return m_objects[index]; }
+	PoolHandle			GetHandleAt(int index) const;
+	const std::vector<T*>& GetObjects() const { return m_objects; }
+
+	// Iterates the live objects, so range for works
+	T* const*			begin() const { return m_objects.data(); }
+	T* const*			end() const { return m_objects.data() + m_objects.size(); }
+
+
+private:
+	//-----Private Methods-----
+
+	void				AddChunk();
+
+
+private:
+	//-----Private Data-----
+
+	struct Slot
+	{
+		uint32_t	generation = 1;
+		int			index = -1;								// Into m_objects, -1 if free
+	};
+
+	typedef std::unique_ptr<uint8_t, ObjectPoolChunkDeleter> Chunk;
+
+	int										m_objectsPerChunk = OBJECT_POOL_DEFAULT_CHUNK_SIZE;
+	size_t									m_slotStride = 0;
+	std::vector<Chunk>						m_chunks;
+	std::vector<Slot>						m_slots;
+	std::vector<uint32_t>					m_freeSlots;		// Used as a stack, so the most recently freed (and cached) slot goes first
+
+	std::vector<T*>							m_objects;
+	std::vector<uint32_t>					m_objectSlots;		// Parallel to m_objects
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Slots are rounded up to 16 bytes, which is also what each chunk is aligned to
+template <typename T>
+ObjectPool<T>::ObjectPool(int objectsPerChunk /*= OBJECT_POOL_DEFAULT_CHUNK_SIZE*/, size_t objectSize /*= sizeof(T)*/)
+	: m_objectsPerChunk(objectsPerChunk > 0 ? objectsPerChunk : OBJECT_POOL_DEFAULT_CHUNK_SIZE)
+	, m_slotStride(((objectSize > sizeof(T) ? objectSize : sizeof(T)) + 15) & ~(size_t)15)
+{
+	static_assert(alignof(T) <= 16, "ObjectPool only aligns objects to 16 bytes");
+}
+
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+template <typename U, typename... ARGS>
+PoolHandle ObjectPool<T>::Create(ARGS&&... args)
+{
+	static_assert(alignof(U) <= 16, "ObjectPool only aligns objects to 16 bytes");
+	ASSERT_OR_DIE(sizeof(U) <= m_slotStride, "Type is too big for this pool's slots!");
+
+	if (m_freeSlots.size() == 0)
+	{
+		AddChunk();
+	}
+
+	const uint32_t slotIndex = m_freeSlots.back();
+	m_freeSlots.pop_back();
+
+	uint8_t* memory = m_chunks[slotIndex / m_objectsPerChunk].get() + (slotIndex % m_objectsPerChunk) * m_slotStride;
+	T* object = new (memory) U(std::forward<ARGS>(args)...);
+
+	Slot& slot = m_slots[slotIndex];
+	slot.index = (int)m_objects.size();
+	m_objects.push_back(object);
+	m_objectSlots.push_back(slotIndex);
+
+	PoolHandle handle;
+	handle.slot = slotIndex;
+	handle.generation = slot.generation;
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// For rebuilding an object that was live when a layout was taken. The slot is moved to the top of the free
+// stack so Create takes it; SetLayout puts the stack back in order afterwards
+template <typename T>
+template <typename U, typename... ARGS>
+PoolHandle ObjectPool<T>::CreateAt(PoolHandle handle, ARGS&&... args)
+{
+	Reserve((int)handle.slot + 1);
+	ASSERT_OR_DIE(m_slots[handle.slot].index < 0, "Slot is already in use!");
+
+	const std::vector<uint32_t>::iterator freeSlot = std::find(m_freeSlots.begin(), m_freeSlots.end(), handle.slot);
+	std::swap(*freeSlot, m_freeSlots.back());
+	m_slots[handle.slot].generation = handle.generation;
+
+	return Create<U>(std::forward<ARGS>(args)...);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Stale handles are ignored
+template <typename T>
+void ObjectPool<T>::Destroy(PoolHandle handle)
+{
+	const int index = GetIndex(handle);
+	if (index < 0)
+	{
+		return;
+	}
+
+	m_objects[index]->~T();
+
+	const int lastIndex = GetCount() - 1;
+	m_objects[index] = m_objects[lastIndex];
+	m_objectSlots[index] = m_objectSlots[lastIndex];
+	m_slots[m_objectSlots[index]].index = index;
+	m_objects.pop_back();
+	m_objectSlots.pop_back();
+
+	Slot& slot = m_slots[handle.slot];
+	slot.index = -1;
+	slot.generation++;
+	m_freeSlots.push_back(handle.slot);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Destroys every live object but keeps the chunks
+template <typename T>
+void ObjectPool<T>::Clear()
+{
+	while (GetCount() > 0)
+	{
+		Destroy(GetHandleAt(GetCount() - 1));
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+void ObjectPool<T>::Reserve(int objectCount)
+{
+	while (GetSlotCount() < objectCount)
+	{
+		AddChunk();
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Copies into the layout's vectors, so reusing one doesn't allocate once they've grown
+template <typename T>
+void ObjectPool<T>::GetLayout(ObjectPoolLayout& out_layout) const
+{
+	out_layout.generations.resize(m_slots.size());
+	for (size_t slotIndex = 0; slotIndex < m_slots.size(); ++slotIndex)
+	{
+		out_layout.generations[slotIndex] = m_slots[slotIndex].generation;
+	}
+
+	out_layout.freeSlots.assign(m_freeSlots.begin(), m_freeSlots.end());
+	out_layout.objectSlots.assign(m_objectSlots.begin(), m_objectSlots.end());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The live objects have to be the ones the layout was taken with, in the same slots; they're put back in its
+// order, and the free slots get their generations and stack order back. Slots from chunks added since go under
+// the stack in the order AddChunk would have pushed them, so they're handed out the same as they would have been.
+// Returns false, changing nothing, if the live objects don't match
+template <typename T>
+bool ObjectPool<T>::SetLayout(const ObjectPoolLayout& layout)
+{
+	if (layout.objectSlots.size() != m_objects.size() || layout.generations.size() > m_slots.size())
+	{
+		return false;
+	}
+
+	for (uint32_t slotIndex : layout.objectSlots)
+	{
+		if (slotIndex >= (uint32_t)layout.generations.size() || m_slots[slotIndex].index < 0 || m_slots[slotIndex].generation != layout.generations[slotIndex])
+		{
+			return false;
+		}
+	}
+
+	for (size_t index = 0; index < layout.objectSlots.size(); ++index)
+	{
+		const uint32_t slotIndex = layout.objectSlots[index];
+		const int currentIndex = m_slots[slotIndex].index;
+
+		std::swap(m_objects[index], m_objects[currentIndex]);
+		std::swap(m_objectSlots[index], m_objectSlots[currentIndex]);
+		m_slots[m_objectSlots[currentIndex]].index = currentIndex;
+		m_slots[slotIndex].index = (int)index;
+	}
+
+	m_freeSlots.clear();
+	for (uint32_t slotIndex = (uint32_t)m_slots.size(); slotIndex > (uint32_t)layout.generations.size(); --slotIndex)
+	{
+		m_slots[slotIndex - 1].generation = 1;
+		m_freeSlots.push_back(slotIndex - 1);
+	}
+
+	m_freeSlots.insert(m_freeSlots.end(), layout.freeSlots.begin(), layout.freeSlots.end());
+	for (uint32_t slotIndex : layout.freeSlots)
+	{
+		m_slots[slotIndex].generation = layout.generations[slotIndex];
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns nullptr if the handle doesn't refer to a live object
+template <typename T>
+T* ObjectPool<T>::Get(PoolHandle handle) const
+{
+	const int index = GetIndex(handle);
+	return (index >= 0 ? m_objects[index] : nullptr);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+int ObjectPool<T>::GetIndex(PoolHandle handle) const
+{
+	if (handle.slot >= (uint32_t)m_slots.size() || m_slots[handle.slot].generation != handle.generation)
+	{
+		return -1;
+	}
+
+	return m_slots[handle.slot].index;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+PoolHandle ObjectPool<T>::GetHandleAt(int index) const
+{
+	PoolHandle handle;
+	handle.slot = m_objectSlots[index];
+	handle.generation = m_slots[handle.slot].generation;
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Everything that grows does so here, so a pool that's been big enough once never allocates again
+template <typename T>
+void ObjectPool<T>::AddChunk()
+{
+	const uint32_t firstSlot = (uint32_t)m_slots.size();
+	const size_t slotCount = m_slots.size() + m_objectsPerChunk;
+
+	m_chunks.emplace_back(ObjectPoolChunkDeleter::Allocate(m_objectsPerChunk * m_slotStride));
+	m_slots.resize(slotCount);
+	m_objects.reserve(slotCount);
+	m_objectSlots.reserve(slotCount);
+	m_freeSlots.reserve(slotCount);
+
+	// Pushed in reverse so the chunk is handed out front to back
+	for (uint32_t slotIndex = (uint32_t)slotCount; slotIndex > firstSlot; --slotIndex)
+	{
+		m_freeSlots.push_back(slotIndex - 1);
+	}
+}
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,256 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/PerfCounters.h"
+#include "Engine/Core/EngineCommon.h"
+#include <algorithm>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+PerfCounters* g_perfCounters = nullptr;
+
+// Indexed by PerfCounterId; also the CSV column names
+static const char* s_counterNames[NUM_PERF_COUNTERS] =
+{
+	"frame_time", "physics_step_time", "physics_steps", "bodies", "contacts", "islands", "broadphase_pairs", "allocations", "job_queue_depth", "frame_arena_bytes", "debug_draws", "debug_draw_vertices", "player_speed"
+};
+
+static const PerfCounterUnit s_counterUnits[NUM_PERF_COUNTERS] =
+{
+	PERF_COUNTER_UNIT_SECONDS, PERF_COUNTER_UNIT_SECONDS, PERF_COUNTER_UNIT_COUNT, PERF_COUNTER_UNIT_COUNT, PERF_COUNTER_UNIT_COUNT, PERF_COUNTER_UNIT_COUNT,
+	PERF_COUNTER_UNIT_COUNT, PERF_COUNTER_UNIT_COUNT, PERF_COUNTER_UNIT_COUNT, PERF_COUNTER_UNIT_COUNT, PERF_COUNTER_UNIT_COUNT, PERF_COUNTER_UNIT_COUNT,
+	PERF_COUNTER_UNIT_SPEED
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Nearest rank, over an already sorted list
+static double GetSortedPercentile(const double* sortedValues, int valueCount, float percentile)
+{
+	const size_t rank = (size_t)((percentile / 100.f) * (float)(valueCount - 1) + 0.5f);
+	return sortedValues[rank];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Times are kept in seconds but read better in milliseconds
+static double GetDisplayValue(PerfCounterId counterId, double value)
+{
+	return (PerfCounters::GetCounterUnit(counterId) == PERF_COUNTER_UNIT_SECONDS ? value * 1000.0 : value);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static const char* GetDisplayUnitName(PerfCounterUnit unit)
+{
+	switch (unit)
+	{
+	case PERF_COUNTER_UNIT_SECONDS:	return "ms";
+	case PERF_COUNTER_UNIT_SPEED:	return "m/s";
+	default:						return "";
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static const char* GetCsvUnitSuffix(PerfCounterUnit unit)
+{
+	switch (unit)
+	{
+	case PERF_COUNTER_UNIT_SECONDS:	return "_ms";
+	case PERF_COUNTER_UNIT_SPEED:	return "_mps";
+	default:						return "";
+	}
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void PerfCounters::Initialize()
+{
+	ASSERT_OR_DIE(g_perfCounters == nullptr, "PerfCounters already initialized!");
+	g_perfCounters = new PerfCounters();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void PerfCounters::Shutdown()
+{
+	SAFE_DELETE(g_perfCounters);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+PerfCounters::PerfCounters()
+{
+	for (int counterIndex = 0; counterIndex < NUM_PERF_COUNTERS; ++counterIndex)
+	{
+		m_frameValues[counterIndex] = 0.0;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+PerfCounters::~PerfCounters()
+{
+	CloseCsv();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void PerfCounters::EndFrame()
+{
+	if (m_csvFile != nullptr)
+	{
+		WriteCsvRow();
+	}
+
+	for (int counterIndex = 0; counterIndex < NUM_PERF_COUNTERS; ++counterIndex)
+	{
+		m_history[counterIndex][m_nextHistoryIndex] = m_frameValues[counterIndex];
+		m_frameValues[counterIndex] = 0.0;
+	}
+
+	m_nextHistoryIndex = (m_nextHistoryIndex + 1) % PERF_COUNTER_HISTORY_FRAMES;
+	m_historyCount = std::min(m_historyCount + 1, PERF_COUNTER_HISTORY_FRAMES);
+	m_frameIndex++;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Over the frames in the history, so the last few seconds
+PerfCounterSummary PerfCounters::GetSummary(PerfCounterId counterId) const
+{
+	PerfCounterSummary summary;
+	if (m_historyCount == 0)
+	{
+		return summary;
+	}
+
+	const int lastIndex = (m_nextHistoryIndex + PERF_COUNTER_HISTORY_FRAMES - 1) % PERF_COUNTER_HISTORY_FRAMES;
+	// On the stack; the history is small, and this runs every frame while the overlay is up
+	double sortedValues[PERF_COUNTER_HISTORY_FRAMES];
+	std::copy(m_history[counterId], m_history[counterId] + m_historyCount, sortedValues);
+	std::sort(sortedValues, sortedValues + m_historyCount);
+
+	double total = 0.0;
+	for (int valueIndex = 0; valueIndex < m_historyCount; ++valueIndex)
+	{
+		total += sortedValues[valueIndex];
+	}
+
+	summary.lastValue = m_history[counterId][lastIndex];
+	summary.average = total / (double)m_historyCount;
+	summary.p50 = GetSortedPercentile(sortedValues, m_historyCount, 50.f);
+	summary.p95 = GetSortedPercentile(sortedValues, m_historyCount, 95.f);
+	summary.p99 = GetSortedPercentile(sortedValues, m_historyCount, 99.f);
+	summary.max = sortedValues[m_historyCount - 1];
+	summary.sampleCount = m_historyCount;
+
+	return summary;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// A header and then one line per counter, laid out as columns for a fixed width font
+void PerfCounters::GetSummaryLines(std::vector<std::string>& out_lines) const
+{
+	char line[256];
+	snprintf(line, sizeof(line), "%-20s %10s %10s %10s %10s %10s %10s   (%d frames)", "counter", "last", "avg", "p50", "p95", "p99", "max", m_historyCount);
+	out_lines.push_back(line);
+
+	for (int counterIndex = 0; counterIndex < NUM_PERF_COUNTERS; ++counterIndex)
+	{
+		const PerfCounterId counterId = (PerfCounterId)counterIndex;
+		const PerfCounterSummary summary = GetSummary(counterId);
+
+		snprintf(line, sizeof(line), "%-20s %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f   %s", GetCounterName(counterId), GetDisplayValue(counterId, summary.lastValue),
+			GetDisplayValue(counterId, summary.average), GetDisplayValue(counterId, summary.p50), GetDisplayValue(counterId, summary.p95), GetDisplayValue(counterId, summary.p99),
+			GetDisplayValue(counterId, summary.max), GetDisplayUnitName(GetCounterUnit(counterId)));
+		out_lines.push_back(line);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool PerfCounters::OpenCsv(const std::string& path)
+{
+	CloseCsv();
+
+	m_csvFile = fopen(path.c_str(), "w");
+	if (m_csvFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(m_csvFile, "frame");
+	for (int counterIndex = 0; counterIndex < NUM_PERF_COUNTERS; ++counterIndex)
+	{
+		const PerfCounterId counterId = (PerfCounterId)counterIndex;
+		fprintf(m_csvFile, ",%s%s", GetCounterName(counterId), GetCsvUnitSuffix(GetCounterUnit(counterId)));
+	}
+
+	fprintf(m_csvFile, "\n");
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void PerfCounters::CloseCsv()
+{
+	if (m_csvFile != nullptr)
+	{
+		fclose(m_csvFile);
+		m_csvFile = nullptr;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+const char* PerfCounters::GetCounterName(PerfCounterId counterId)
+{
+	return s_counterNames[counterId];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+PerfCounterUnit PerfCounters::GetCounterUnit(PerfCounterId counterId)
+{
+	return s_counterUnits[counterId];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void PerfCounters::WriteCsvRow()
+{
+	fprintf(m_csvFile, "%d", m_frameIndex);
+
+	for (int counterIndex = 0; counterIndex < NUM_PERF_COUNTERS; ++counterIndex)
+	{
+		const PerfCounterId counterId = (PerfCounterId)counterIndex;
+		fprintf(m_csvFile, ",%.4f", GetDisplayValue(counterId, m_frameValues[counterIndex]));
+	}
+
+	fprintf(m_csvFile, "\n");
+}
@@ -0,0 +1,126 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Named per frame counters with a history for percentiles, shown by the stats command and overlay, and dumped to CSV
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstdio>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+enum PerfCounterId
+{
+	PERF_COUNTER_FRAME_TIME,
+	PERF_COUNTER_PHYSICS_STEP_TIME,		// All of the frame's steps together
+	PERF_COUNTER_PHYSICS_STEP_COUNT,
+	PERF_COUNTER_BODY_COUNT,
+	PERF_COUNTER_CONTACT_COUNT,			// Contact, island and pair counts are as of the frame's last step
+	PERF_COUNTER_ISLAND_COUNT,
+	PERF_COUNTER_BROADPHASE_PAIR_COUNT,
+	PERF_COUNTER_ALLOCATION_COUNT,
+	PERF_COUNTER_JOB_QUEUE_DEPTH,		// The most jobs queued at once during the frame
+	PERF_COUNTER_FRAME_ARENA_BYTES,
+	PERF_COUNTER_DEBUG_DRAW_COUNT,		// Batched draws of the frame's debug draw flush
+	PERF_COUNTER_DEBUG_DRAW_VERTICES,
+	PERF_COUNTER_PLAYER_SPEED,
+	NUM_PERF_COUNTERS
+};
+
+enum PerfCounterUnit
+{
+	PERF_COUNTER_UNIT_COUNT,
+	PERF_COUNTER_UNIT_SECONDS,			// Recorded in seconds, shown in milliseconds
+	PERF_COUNTER_UNIT_SPEED
+};
+
+struct PerfCounterSummary
+{
+	double	lastValue = 0.0;
+	double	average = 0.0;
+	double	p50 = 0.0;
+	double	p95 = 0.0;
+	double	p99 = 0.0;
+	double	max = 0.0;
+	int		sampleCount = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class PerfCounters;
+extern PerfCounters* g_perfCounters;
+
+const int PERF_COUNTER_HISTORY_FRAMES = 240;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Systems set or add to a counter during the frame, and EndFrame moves each frame value into the history and
+// clears it. Main thread only; anything counted on other threads is gathered up and published from the main thread
+class PerfCounters
+{
+public:
+	//-----Public Methods-----
+
+	static void				Initialize();
+	static void				Shutdown();
+
+	void					SetValue(PerfCounterId counterId, double value) { m_frameValues[counterId] = value; }
+	void					AddValue(PerfCounterId counterId, double value) { m_frameValues[counterId] += value; }
+	void					EndFrame();
+
+	PerfCounterSummary		GetSummary(PerfCounterId counterId) const;
+	void					GetSummaryLines(std::vector<std::string>& out_lines) const;
+
+	bool					IsOverlayVisible() const { return m_isOverlayVisible; }
+	void					SetOverlayVisible(bool isVisible) { m_isOverlayVisible = isVisible; }
+
+	// One row per frame from here on, until closed or shut down
+	bool					OpenCsv(const std::string& path);
+	void					CloseCsv();
+
+	static const char*		GetCounterName(PerfCounterId counterId);
+	static PerfCounterUnit	GetCounterUnit(PerfCounterId counterId);
+
+
+private:
+	//-----Private Methods-----
+
+	PerfCounters();
+	~PerfCounters();
+	PerfCounters(const PerfCounters& copy) = delete;
+
+	void					WriteCsvRow();
+
+
+private:
+	//-----Private Data-----
+
+	double					m_frameValues[NUM_PERF_COUNTERS];
+	double					m_history[NUM_PERF_COUNTERS][PERF_COUNTER_HISTORY_FRAMES];
+	int						m_historyCount = 0;
+	int						m_nextHistoryIndex = 0;
+	int						m_frameIndex = 0;
+
+	bool					m_isOverlayVisible = false;
+	FILE*					m_csvFile = nullptr;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,338 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/Profiler.h"
+#include "Game/Framework/MappedFile.h"
+#include "Engine/Core/EngineCommon.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#ifndef HEADLESS_ONLY
+#include "Engine/Core/DevConsole.h"
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+Profiler* g_profiler = nullptr;
+std::atomic<bool> Profiler::s_isRecording(false);
+
+static uint32_t								s_nextGeneration = 1;
+static thread_local ProfileThreadBuffer*	s_threadBuffer = nullptr;
+static thread_local uint32_t				s_threadBufferGeneration = 0;
+static thread_local std::string				s_threadName;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Headless runs have no console, so the result goes to stdout
+static void PrintCaptureResult(bool succeeded, const std::string& message)
+{
+#ifndef HEADLESS_ONLY
+	if (g_devConsole != nullptr)
+	{
+		if (succeeded)
+		{
+			ConsoleLogf("%s", message.c_str());
+		}
+		else
+		{
+			ConsoleErrorf("%s", message.c_str());
+		}
+
+		return;
+	}
+#else
+	UNUSED(succeeded);
+#endif
+
+	printf("%s\n", message.c_str());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Names are almost always literals, but job type names and thread names can hold anything
+static void AppendJsonString(std::string& out_json, const char* text)
+{
+	out_json += '"';
+
+	for (const char* character = text; *character != 0; ++character)
+	{
+		if (*character == '"' || *character == '\\')
+		{
+			out_json += '\\';
+			out_json += *character;
+		}
+		else if ((unsigned char)*character < 0x20)
+		{
+			char escaped[8];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned int)(unsigned char)*character);
+			out_json += escaped;
+		}
+		else
+		{
+			out_json += *character;
+		}
+	}
+
+	out_json += '"';
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+ProfileThreadBuffer::ProfileThreadBuffer(int threadId, const std::string& threadName)
+	: m_threadId(threadId)
+	, m_threadName(threadName)
+	, m_events(new ProfileEvent[PROFILER_EVENTS_PER_THREAD])
+	, m_writeCount(0)
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void ProfileThreadBuffer::Push(const ProfileEvent& event)
+{
+	const uint64_t writeCount = m_writeCount.load(std::memory_order_relaxed);
+	m_events[writeCount & (PROFILER_EVENTS_PER_THREAD - 1)] = event;
+	m_writeCount.store(writeCount + 1, std::memory_order_release);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The owning thread may still be writing. Anything it could have overwritten while this copied is dropped,
+// judged by the write count afterwards
+bool ProfileThreadBuffer::CopyEvents(uint64_t startTicks, std::vector<ProfileEvent>& out_events) const
+{
+	const uint64_t writeCount = m_writeCount.load(std::memory_order_acquire);
+	const uint64_t firstIndex = (writeCount > (uint64_t)PROFILER_EVENTS_PER_THREAD ? writeCount - PROFILER_EVENTS_PER_THREAD : 0);
+	const size_t firstOutIndex = out_events.size();
+
+	for (uint64_t eventIndex = firstIndex; eventIndex < writeCount; ++eventIndex)
+	{
+		out_events.push_back(m_events[eventIndex & (PROFILER_EVENTS_PER_THREAD - 1)]);
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	const uint64_t writeCountAfter = m_writeCount.load(std::memory_order_relaxed);
+	const uint64_t firstValidIndex = std::max(firstIndex, (writeCountAfter > (uint64_t)PROFILER_EVENTS_PER_THREAD ? writeCountAfter - PROFILER_EVENTS_PER_THREAD : 0));
+	std::vector<ProfileEvent>::iterator firstKept = out_events.begin() + firstOutIndex + (size_t)(std::min(firstValidIndex, writeCount) - firstIndex);
+
+	// Events are in the order they ended, so the ones from before the capture are all at the front
+	const bool isAnyBeforeCapture = (firstKept != out_events.end() && firstKept->endTicks < startTicks);
+	while (firstKept != out_events.end() && firstKept->endTicks < startTicks)
+	{
+		++firstKept;
+	}
+
+	out_events.erase(out_events.begin() + firstOutIndex, firstKept);
+
+	// Unless the ring still reaches back to before the capture, its start was overwritten
+	return (firstValidIndex == 0 || isAnyBeforeCapture);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Profiler::Initialize()
+{
+	ASSERT_OR_DIE(g_profiler == nullptr, "Profiler initialized twice!");
+	g_profiler = new Profiler();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Anything captured so far is still written out, so a run that ends early doesn't lose its capture
+void Profiler::Shutdown()
+{
+	if (g_profiler != nullptr && g_profiler->m_isCapturing)
+	{
+		g_profiler->FinishCapture();
+	}
+
+	SAFE_DELETE(g_profiler);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Takes effect at the next BeginFrame; a request during a capture replaces the pending one, not the running one
+void Profiler::RequestCapture(int frameCount, const std::string& path)
+{
+	m_requestedFrameCount = (frameCount > 0 ? frameCount : PROFILER_DEFAULT_CAPTURE_FRAMES);
+	m_requestedPath = (path.size() > 0 ? path : PROFILER_DEFAULT_CAPTURE_PATH);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Profiler::BeginFrame()
+{
+	if (m_isCapturing || m_requestedFrameCount <= 0)
+	{
+		return;
+	}
+
+	m_isCapturing = true;
+	m_capturedFrameCount = 0;
+	m_captureFrameCount = m_requestedFrameCount;
+	m_capturePath = m_requestedPath;
+	m_captureStartTicks = GetTicks();
+	m_requestedFrameCount = 0;
+
+	s_isRecording.store(true, std::memory_order_relaxed);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Profiler::EndFrame()
+{
+	if (m_isCapturing && ++m_capturedFrameCount >= m_captureFrameCount)
+	{
+		FinishCapture();
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+uint64_t Profiler::GetTicks()
+{
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+double Profiler::GetSeconds()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// For the trace's thread list. Call before the thread records anything; unnamed threads are numbered
+void Profiler::SetThreadName(const std::string& threadName)
+{
+	s_threadName = threadName;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Profiler::Record(const ProfileEvent& event)
+{
+	GetThreadBuffer()->Push(event);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+Profiler::Profiler()
+	: m_generation(s_nextGeneration++)
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+Profiler::~Profiler()
+{
+	s_isRecording.store(false, std::memory_order_relaxed);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Made the first time a thread records while this profiler exists, and kept until shutdown
+ProfileThreadBuffer* Profiler::GetThreadBuffer()
+{
+	if (s_threadBuffer == nullptr || s_threadBufferGeneration != m_generation)
+	{
+		std::lock_guard<std::mutex> lock(m_threadBuffersMutex);
+
+		const int threadId = (int)m_threadBuffers.size() + 1;
+		const std::string threadName = (s_threadName.size() > 0 ? s_threadName : "Thread " + std::to_string(threadId));
+
+		m_threadBuffers.emplace_back(new ProfileThreadBuffer(threadId, threadName));
+		s_threadBuffer = m_threadBuffers.back().get();
+		s_threadBufferGeneration = m_generation;
+	}
+
+	return s_threadBuffer;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void Profiler::FinishCapture()
+{
+	s_isRecording.store(false, std::memory_order_relaxed);
+	m_isCapturing = false;
+
+	int eventCount = 0;
+	bool isComplete = true;
+
+	if (WriteChromeTrace(m_capturePath, eventCount, isComplete))
+	{
+		PrintCaptureResult(true, "Profiler: wrote " + std::to_string(m_capturedFrameCount) + " frames, " + std::to_string(eventCount) + " events to " + m_capturePath
+			+ (isComplete ? "" : " (the start was overwritten, capture fewer frames)"));
+	}
+	else
+	{
+		PrintCaptureResult(false, "Profiler: couldn't write " + m_capturePath);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Chrome's trace event format: one complete ("X") event per scope with microsecond times, plus the thread
+// names as metadata. Times are from the start of the capture. Opens in chrome://tracing and Perfetto
+bool Profiler::WriteChromeTrace(const std::string& path, int& out_eventCount, bool& out_isComplete) const
+{
+	std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool isFirst = true;
+	std::vector<ProfileEvent> events;
+	char numbers[128];
+
+	out_eventCount = 0;
+	out_isComplete = true;
+
+	std::lock_guard<std::mutex> lock(m_threadBuffersMutex);
+	for (const std::unique_ptr<ProfileThreadBuffer>& buffer : m_threadBuffers)
+	{
+		events.clear();
+		out_isComplete = buffer->CopyEvents(m_captureStartTicks, events) && out_isComplete;
+
+		json += (isFirst ? "" : ",\n");
+		json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(buffer->GetThreadId()) + ",\"args\":{\"name\":";
+		AppendJsonString(json, buffer->GetThreadName().c_str());
+		json += "}}";
+		isFirst = false;
+
+		for (const ProfileEvent& event : events)
+		{
+			const uint64_t startTicks = std::max(event.startTicks, m_captureStartTicks);
+
+			json += ",\n{\"name\":";
+			AppendJsonString(json, event.name);
+			snprintf(numbers, sizeof(numbers), ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", buffer->GetThreadId(),
+				(double)(startTicks - m_captureStartTicks) / 1000.0, (double)(event.endTicks - startTicks) / 1000.0);
+			json += numbers;
+		}
+
+		out_eventCount += (int)events.size();
+	}
+
+	json += "\n]}\n";
+	return WriteBinaryFile(path.c_str(), json.data(), json.size());
+}
@@ -0,0 +1,185 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Scoped frame timers recorded per thread, captured for a number of frames and written as a Chrome trace
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Define to compile every PROFILE_SCOPE out; otherwise a scope costs one relaxed load and a branch when not capturing
+//#define PROFILER_DISABLED
+
+#define PROFILE_SCOPE_JOIN_INNER(a, b) a##b
+#define PROFILE_SCOPE_JOIN(a, b) PROFILE_SCOPE_JOIN_INNER(a, b)
+
+#ifndef PROFILER_DISABLED
+// Name must outlive the capture, so a literal or something else static
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_SCOPE_JOIN(profileScope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name)
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+struct ProfileEvent
+{
+	const char*	name = nullptr;
+	uint64_t	startTicks = 0;			// Nanoseconds, on the steady clock
+	uint64_t	endTicks = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class Profiler;
+extern Profiler* g_profiler;
+
+const int	PROFILER_EVENTS_PER_THREAD = 65536;				// Power of two; older events are overwritten
+const int	PROFILER_DEFAULT_CAPTURE_FRAMES = 60;
+const char	PROFILER_DEFAULT_CAPTURE_PATH[] = "profile_capture.json";
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// One per thread that has recorded anything, written only by that thread. The write count is published after
+// each event, so the capture can copy what's there without a lock and throw away anything that was overwritten
+// while it copied
+class ProfileThreadBuffer
+{
+public:
+	//-----Public Methods-----
+
+	ProfileThreadBuffer(int threadId, const std::string& threadName);
+
+	void				Push(const ProfileEvent& event);
+
+	// Appends events that ended at or after startTicks; returns false if some of those were already overwritten
+	bool				CopyEvents(uint64_t startTicks, std::vector<ProfileEvent>& out_events) const;
+
+	int					GetThreadId() const { return m_threadId; }
+	const std::string&	GetThreadName() const { return m_threadName; }
+
+
+private:
+	//-----Private Data-----
+
+	int								m_threadId = 0;
+	std::string						m_threadName;
+	std::unique_ptr<ProfileEvent[]>	m_events;
+	std::atomic<uint64_t>			m_writeCount;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Records nothing until a capture is requested. The capture starts at the next BeginFrame and is written out at
+// the EndFrame that completes it, or at shutdown if the run ends first. Only BeginFrame, EndFrame and
+// RequestCapture are main thread only; scopes can be on any thread
+class Profiler
+{
+public:
+	//-----Public Methods-----
+
+	static void		Initialize();
+	static void		Shutdown();
+
+	void			RequestCapture(int frameCount, const std::string& path);
+	void			BeginFrame();
+	void			EndFrame();
+
+	bool			IsCapturing() const { return m_isCapturing; }
+	static bool		IsRecording() { return s_isRecording.load(std::memory_order_relaxed); }
+	static uint64_t	GetTicks();
+	static double	GetSeconds();	// The same steady clock as GetTicks, for anything else that times itself
+	static void		SetThreadName(const std::string& threadName);
+
+	// Called from ProfileScope
+	void			Record(const ProfileEvent& event);
+
+
+private:
+	//-----Private Methods-----
+
+	Profiler();
+	~Profiler();
+	Profiler(const Profiler& copy) = delete;
+
+	ProfileThreadBuffer*	GetThreadBuffer();
+	void					FinishCapture();
+	bool					WriteChromeTrace(const std::string& path, int& out_eventCount, bool& out_isComplete) const;
+
+
+private:
+	//-----Private Data-----
+
+	static std::atomic<bool>	s_isRecording;
+
+	mutable std::mutex			m_threadBuffersMutex;		// Only taken when a thread records for the first time, and by the capture
+	std::vector<std::unique_ptr<ProfileThreadBuffer>> m_threadBuffers;
+	uint32_t					m_generation = 0;			// Tells threads their cached buffer belongs to an earlier profiler
+
+	int							m_requestedFrameCount = 0;
+	std::string					m_requestedPath;
+	bool						m_isCapturing = false;
+	int							m_capturedFrameCount = 0;
+	int							m_captureFrameCount = 0;
+	std::string					m_capturePath;
+	uint64_t					m_captureStartTicks = 0;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+class ProfileScope
+{
+public:
+	//-----Public Methods-----
+
+	ProfileScope(const char* name)
+	{
+		if (Profiler::IsRecording())
+		{
+			m_event.name = name;
+			m_event.startTicks = Profiler::GetTicks();
+		}
+	}
+
+	~ProfileScope()
+	{
+		if (m_event.name != nullptr && g_profiler != nullptr)
+		{
+			m_event.endTicks = Profiler::GetTicks();
+			g_profiler->Record(m_event);
+		}
+	}
+
+	ProfileScope(const ProfileScope& copy) = delete;
+
+
+private:
+	//-----Private Data-----
+
+	ProfileEvent m_event;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
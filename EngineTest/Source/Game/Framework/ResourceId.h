@@ -0,0 +1,67 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: A resource path hashed down to 64 bits, at compile time for literals
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Forces the hash to happen at compile time, for use with literal paths
+#define RESOURCE_ID(path) (ResourceId(std::integral_constant<uint64_t, ResourceId::HashPath(path)>::value))
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+const uint64_t RESOURCE_ID_HASH_SEED = 14695981039346656037ULL;	// FNV-1a offset basis
+const uint64_t RESOURCE_ID_HASH_PRIME = 1099511628211ULL;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Stands in for the path wherever a resource is looked up. Two paths hashing the same is caught when the
+// second one is registered, so a lookup never has to compare strings
+struct ResourceId
+{
+	constexpr ResourceId() {}
+	constexpr explicit ResourceId(uint64_t hash_) : hash(hash_) {}
+	explicit ResourceId(const std::string& path) : hash(HashPath(path.c_str())) {}
+
+	// FNV-1a over the path as written, so "Data/A" and "Data\A" are different resources. 0 is kept for "no resource"
+	static constexpr uint64_t HashPath(const char* path)
+	{
+		uint64_t pathHash = RESOURCE_ID_HASH_SEED;
+
+		for (const char* cursor = path; *cursor != '\0'; ++cursor)
+		{
+			pathHash = (pathHash ^ (uint64_t)(uint8_t)*cursor) * RESOURCE_ID_HASH_PRIME;
+		}
+
+		return (pathHash != 0 ? pathHash : 1);
+	}
+
+	constexpr bool IsValid() const { return hash != 0; }
+	constexpr bool operator==(const ResourceId& other) const { return hash == other.hash; }
+	constexpr bool operator!=(const ResourceId& other) const { return hash != other.hash; }
+
+	uint64_t hash = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
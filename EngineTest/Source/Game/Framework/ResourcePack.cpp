@@ -0,0 +1,392 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/ResourcePack.h"
+#include "Game/Framework/Lz4Compression.h"
+#include "Engine/Core/EngineCommon.h"
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+ResourcePack* g_resourcePack = nullptr;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static void SetError(std::string* out_error, const std::string& error)
+{
+	if (out_error != nullptr)
+	{
+		*out_error = error;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint64_t AlignUp(uint64_t value, uint64_t alignment)
+{
+	return ((value + alignment - 1) / alignment) * alignment;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Packed paths start from the data directory's own name, so packing "../Build/Data" still gives the "Data/..."
+// paths the game asks for
+static std::string GetPackedPath(const std::string& dataDirectory, const std::string& filePath)
+{
+	std::string directory = dataDirectory;
+	while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\'))
+	{
+		directory.pop_back();
+	}
+
+	const size_t nameStart = directory.find_last_of("/\\");
+	std::string packedPath = (nameStart == std::string::npos ? directory : directory.substr(nameStart + 1)) + filePath.substr(directory.size());
+
+	for (char& character : packedPath)
+	{
+		character = (character == '\\' ? '/' : character);
+	}
+
+	return packedPath;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool GetResourceFileInfo(const char* path, FileInfo& out_info)
+{
+	const ResourcePackEntry* entry = (g_resourcePack != nullptr ? g_resourcePack->FindEntry(path) : nullptr);
+	if (entry != nullptr)
+	{
+		out_info.size = entry->size;
+		out_info.modifiedTime = entry->modifiedTime;
+		return true;
+	}
+
+	return GetFileInfo(path, out_info);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Reads every file in, compressing as it goes, and writes the pack in one go at the end. Fails without writing
+// anything if two paths hash to the same ResourceId
+bool WriteResourcePack(const std::string& dataDirectory, const std::string& packPath, const ResourcePackSettings& settings, ResourcePackStats* out_stats /*= nullptr*/, std::string* out_error /*= nullptr*/)
+{
+	std::vector<std::string> filePaths;
+	if (!ListFilesInDirectory(dataDirectory, filePaths))
+	{
+		SetError(out_error, "Couldn't read the directory " + dataDirectory);
+		return false;
+	}
+
+	std::vector<ResourcePackEntry> entries;
+	std::string paths;
+	std::vector<std::vector<uint8_t>> storedData;
+	ResourceRegistry pathIndexById;
+	ResourcePackStats stats;
+
+	for (const std::string& filePath : filePaths)
+	{
+		// Don't pack an old copy of the pack into the new one
+		if (filePath == packPath)
+		{
+			continue;
+		}
+
+		MappedFile file;
+		FileInfo fileInfo;
+		if (!file.Open(filePath.c_str()) || !GetFileInfo(filePath.c_str(), fileInfo))
+		{
+			SetError(out_error, "Couldn't read " + filePath);
+			return false;
+		}
+
+		const std::string packedPath = GetPackedPath(dataDirectory, filePath);
+		const ResourceId id(packedPath);
+
+		if (!pathIndexById.Add(id, (int)entries.size()))
+		{
+			SetError(out_error, packedPath + " hashes to the same ResourceId as " + std::string(paths.c_str() + entries[pathIndexById.Find(id)].pathOffset));
+			return false;
+		}
+
+		ResourcePackEntry entry;
+		memset(&entry, 0, sizeof(entry));
+		entry.pathHash = id.hash;
+		entry.size = file.GetSize();
+		entry.modifiedTime = fileInfo.modifiedTime;
+		entry.pathOffset = (uint32_t)paths.size();
+		entry.compression = RESOURCE_PACK_COMPRESSION_NONE;
+
+		paths += packedPath;
+		paths.push_back('\0');
+
+		std::vector<uint8_t> data;
+		if (settings.compress && file.GetSize() > 0)
+		{
+			data.resize(GetLz4MaxCompressedSize(file.GetSize()));
+			const size_t compressedSize = CompressLz4(file.GetData(), file.GetSize(), data.data(), data.size());
+
+			if (compressedSize > 0 && compressedSize <= file.GetSize() - file.GetSize() / 8)
+			{
+				data.resize(compressedSize);
+				entry.compression = RESOURCE_PACK_COMPRESSION_LZ4;
+				stats.compressedCount++;
+			}
+		}
+
+		if (entry.compression == RESOURCE_PACK_COMPRESSION_NONE)
+		{
+			data.assign(file.GetData(), file.GetData() + file.GetSize());
+		}
+
+		entry.storedSize = data.size();
+		stats.looseBytes += entry.size;
+
+		entries.push_back(entry);
+		storedData.push_back(std::move(data));
+	}
+
+	ResourcePackHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = RESOURCE_PACK_MAGIC;
+	header.version = RESOURCE_PACK_VERSION;
+	header.entryCount = (uint32_t)entries.size();
+	header.alignment = RESOURCE_PACK_ALIGNMENT;
+	header.entriesOffset = sizeof(ResourcePackHeader);
+	header.pathsOffset = header.entriesOffset + entries.size() * sizeof(ResourcePackEntry);
+	header.pathsSize = paths.size();
+
+	uint64_t offset = header.pathsOffset + header.pathsSize;
+	for (ResourcePackEntry& entry : entries)
+	{
+		offset = AlignUp(offset, RESOURCE_PACK_ALIGNMENT);
+		entry.offset = offset;
+		offset += entry.storedSize;
+	}
+
+	header.fileSize = offset;
+
+	std::vector<uint8_t> image((size_t)header.fileSize, 0);
+	memcpy(image.data(), &header, sizeof(header));
+	memcpy(image.data() + header.entriesOffset, entries.data(), entries.size() * sizeof(ResourcePackEntry));
+	memcpy(image.data() + header.pathsOffset, paths.data(), paths.size());
+
+	for (size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+	{
+		if (storedData[entryIndex].size() > 0)
+		{
+			memcpy(image.data() + entries[entryIndex].offset, storedData[entryIndex].data(), storedData[entryIndex].size());
+		}
+	}
+
+	if (!WriteBinaryFile(packPath.c_str(), image.data(), image.size()))
+	{
+		SetError(out_error, "Couldn't write " + packPath);
+		return false;
+	}
+
+	stats.fileCount = (int)entries.size();
+	stats.packBytes = header.fileSize;
+
+	if (out_stats != nullptr)
+	{
+		*out_stats = stats;
+	}
+
+	return true;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Before anything that reads game data, and shut down after it
+void ResourcePack::Initialize(const char* packPath /*= RESOURCE_PACK_DEFAULT_PATH*/)
+{
+	ASSERT_OR_DIE(g_resourcePack == nullptr, "ResourcePack initialized twice!");
+
+	FileInfo packInfo;
+	if (!GetFileInfo(packPath, packInfo))
+	{
+		return;
+	}
+
+	g_resourcePack = new ResourcePack();
+	if (!g_resourcePack->Open(packPath))
+	{
+		SAFE_DELETE(g_resourcePack);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void ResourcePack::Shutdown()
+{
+	SAFE_DELETE(g_resourcePack);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Checks every section and entry lies inside the file, every compressed entry could really decode to its size,
+// and every path hashes to its entry, so nothing read through the pack afterwards needs to check bounds
+bool ResourcePack::Open(const char* packPath, std::string* out_error /*= nullptr*/)
+{
+	Close();
+
+	if (!m_file.Open(packPath))
+	{
+		SetError(out_error, std::string("Couldn't open ") + packPath);
+		return false;
+	}
+
+	const uint8_t* data = m_file.GetData();
+	const uint64_t size = m_file.GetSize();
+	const ResourcePackHeader* header = (const ResourcePackHeader*)data;
+
+	bool isValid = (size >= sizeof(ResourcePackHeader) && header->magic == RESOURCE_PACK_MAGIC && header->version == RESOURCE_PACK_VERSION && header->fileSize == size
+		&& header->entriesOffset == sizeof(ResourcePackHeader) && header->pathsOffset == header->entriesOffset + (uint64_t)header->entryCount * sizeof(ResourcePackEntry)
+		&& header->pathsOffset + header->pathsSize <= size && (header->pathsSize == 0 || data[header->pathsOffset + header->pathsSize - 1] == '\0'));
+
+	if (isValid)
+	{
+		m_entries = (const ResourcePackEntry*)(data + header->entriesOffset);
+		m_entryCount = header->entryCount;
+		m_paths = (const char*)(data + header->pathsOffset);
+		m_entryIndexById.Reserve((int)m_entryCount);
+
+		for (uint32_t entryIndex = 0; entryIndex < m_entryCount && isValid; ++entryIndex)
+		{
+			const ResourcePackEntry& entry = m_entries[entryIndex];
+
+			isValid = (entry.offset <= size && entry.storedSize <= size - entry.offset && entry.pathOffset < header->pathsSize
+				&& (entry.compression == RESOURCE_PACK_COMPRESSION_NONE ? entry.storedSize == entry.size : (entry.compression == RESOURCE_PACK_COMPRESSION_LZ4 && entry.size <= GetLz4MaxDecompressedSize(entry.storedSize)))
+				&& ResourceId::HashPath(m_paths + entry.pathOffset) == entry.pathHash && m_entryIndexById.Add(ResourceId(entry.pathHash), (int)entryIndex));
+		}
+	}
+
+	if (!isValid)
+	{
+		SetError(out_error, std::string(packPath) + " is corrupt or from a different version");
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void ResourcePack::Close()
+{
+	m_file.Close();
+	m_entries = nullptr;
+	m_entryCount = 0;
+	m_paths = nullptr;
+	m_entryIndexById.Clear();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+const ResourcePackEntry* ResourcePack::FindEntry(ResourceId id) const
+{
+	const int entryIndex = m_entryIndexById.Find(id);
+	return (entryIndex != ResourceRegistry::INVALID_INDEX ? &m_entries[entryIndex] : nullptr);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool ResourceFile::Open(const char* path)
+{
+	if (g_resourcePack != nullptr && OpenFromPack(*g_resourcePack, path))
+	{
+		return true;
+	}
+
+	return OpenLoose(path);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool ResourceFile::OpenFromPack(const ResourcePack& pack, const char* path)
+{
+	Close();
+
+	const ResourcePackEntry* entry = pack.FindEntry(path);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+
+	if (entry->compression == RESOURCE_PACK_COMPRESSION_NONE)
+	{
+		m_data = pack.GetStoredData(*entry);
+	}
+	else
+	{
+		m_decompressedData.resize((size_t)entry->size);
+		if (DecompressLz4(pack.GetStoredData(*entry), (size_t)entry->storedSize, m_decompressedData.data(), m_decompressedData.size()) != m_decompressedData.size())
+		{
+			Close();
+			return false;
+		}
+
+		m_data = m_decompressedData.data();
+	}
+
+	m_size = (size_t)entry->size;
+	m_isFromPack = true;
+	m_isOpen = true;
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool ResourceFile::OpenLoose(const char* path)
+{
+	Close();
+
+	if (!m_looseFile.Open(path))
+	{
+		return false;
+	}
+
+	m_data = m_looseFile.GetData();
+	m_size = m_looseFile.GetSize();
+	m_isOpen = true;
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void ResourceFile::Close()
+{
+	m_looseFile.Close();
+	std::vector<uint8_t>().swap(m_decompressedData);
+
+	m_isOpen = false;
+	m_isFromPack = false;
+	m_data = nullptr;
+	m_size = 0;
+}
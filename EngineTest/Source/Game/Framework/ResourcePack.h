@@ -0,0 +1,164 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: The Data directory packed into one memory mapped file, and the file reader that looks in it first
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/MappedFile.h"
+#include "Game/Framework/ResourceRegistry.h"
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class ResourcePack;
+
+enum ResourcePackCompression
+{
+	RESOURCE_PACK_COMPRESSION_NONE,		// Read in place from the mapping
+	RESOURCE_PACK_COMPRESSION_LZ4		// Decompressed into a buffer on open
+};
+
+// Pack layout: header, entries, null terminated paths, then each entry's data starting on an alignment boundary.
+// Little endian, and read in place, so the structs are the file format
+struct ResourcePackHeader
+{
+	uint32_t	magic;
+	uint32_t	version;
+	uint32_t	entryCount;
+	uint32_t	alignment;
+	uint64_t	entriesOffset;
+	uint64_t	pathsOffset;
+	uint64_t	pathsSize;
+	uint64_t	fileSize;
+};
+
+struct ResourcePackEntry
+{
+	uint64_t	pathHash;				// ResourceId of the path
+	uint64_t	offset;
+	uint64_t	storedSize;				// Size in the pack, which is the compressed size for compressed entries
+	uint64_t	size;
+	uint64_t	modifiedTime;			// Of the loose file it was packed from, as GetFileInfo gives it
+	uint32_t	pathOffset;				// Into the paths section
+	uint32_t	compression;
+};
+
+struct ResourcePackSettings
+{
+	bool	compress = true;			// LZ4 entries that shrink by at least an eighth, the rest are stored
+};
+
+struct ResourcePackStats
+{
+	int			fileCount = 0;
+	int			compressedCount = 0;
+	uint64_t	looseBytes = 0;
+	uint64_t	packBytes = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+extern ResourcePack* g_resourcePack;
+
+const uint32_t	RESOURCE_PACK_MAGIC = 0x4B434150;	// "PACK"
+const uint32_t	RESOURCE_PACK_VERSION = 1;
+const uint32_t	RESOURCE_PACK_ALIGNMENT = 64;		// Keeps in place data aligned for anything read straight out of it, like cooked voxel files
+const char		RESOURCE_PACK_DEFAULT_PATH[] = "Data.pack";
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Entries are found by the ResourceId of their path, with the pack's own paths checked against their hashes
+// once on open. Read only once open, so any thread can look things up in it
+class ResourcePack
+{
+public:
+	//-----Public Methods-----
+
+	// g_resourcePack stays null if there's no pack, and everything is read from loose files
+	static void					Initialize(const char* packPath = RESOURCE_PACK_DEFAULT_PATH);
+	static void					Shutdown();
+
+	ResourcePack() {}
+	ResourcePack(const ResourcePack& copy) = delete;
+
+	bool						Open(const char* packPath, std::string* out_error = nullptr);
+	void						Close();
+
+	const ResourcePackEntry*	FindEntry(ResourceId id) const;
+	const ResourcePackEntry*	FindEntry(const std::string& path) const { return FindEntry(ResourceId(path)); }
+	const char*					GetEntryPath(const ResourcePackEntry& entry) const { return m_paths + entry.pathOffset; }
+	const uint8_t*				GetStoredData(const ResourcePackEntry& entry) const { return m_file.GetData() + entry.offset; }
+
+	int							GetEntryCount() const { return (int)m_entryCount; }
+	const ResourcePackEntry&	GetEntry(int entryIndex) const { return m_entries[entryIndex]; }
+	bool						IsOpen() const { return m_file.IsOpen(); }
+
+
+private:
+	//-----Private Data-----
+
+	MappedFile					m_file;
+	const ResourcePackEntry*	m_entries = nullptr;
+	uint32_t					m_entryCount = 0;
+	const char*					m_paths = nullptr;
+	ResourceRegistry			m_entryIndexById;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Drop in for MappedFile in anything that reads game data. Looks in the pack first and falls back to the
+// loose file, so development builds without a pack (or with files added since it was built) still work.
+// Uncompressed pack entries point straight into the pack's mapping, so they cost no copy and no open
+class ResourceFile
+{
+public:
+	//-----Public Methods-----
+
+	ResourceFile() {}
+	ResourceFile(const ResourceFile& copy) = delete;
+
+	bool			Open(const char* path);
+	bool			OpenFromPack(const ResourcePack& pack, const char* path);
+	bool			OpenLoose(const char* path);
+	void			Close();
+
+	bool			IsOpen() const { return m_isOpen; }
+	bool			IsFromPack() const { return m_isFromPack; }
+	const uint8_t*	GetData() const { return m_data; }
+	size_t			GetSize() const { return m_size; }
+
+
+private:
+	//-----Private Data-----
+
+	bool					m_isOpen = false;
+	bool					m_isFromPack = false;
+	const uint8_t*			m_data = nullptr;
+	size_t					m_size = 0;
+	MappedFile				m_looseFile;
+	std::vector<uint8_t>	m_decompressedData;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Size and modified time from the pack entry if there's one, otherwise from the loose file
+bool GetResourceFileInfo(const char* path, FileInfo& out_info);
+bool WriteResourcePack(const std::string& dataDirectory, const std::string& packPath, const ResourcePackSettings& settings, ResourcePackStats* out_stats = nullptr, std::string* out_error = nullptr);
@@ -0,0 +1,162 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/ResourceRegistry.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const int s_minCapacity = 16;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+ResourceRegistry::ResourceRegistry()
+{
+	Rehash(s_minCapacity);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Sizes the table so count entries fit without rehashing
+void ResourceRegistry::Reserve(int count)
+{
+	int capacity = (int)m_slots.size();
+	while (capacity < 2 * count)
+	{
+		capacity *= 2;
+	}
+
+	if (capacity > (int)m_slots.size())
+	{
+		Rehash(capacity);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void ResourceRegistry::Clear()
+{
+	m_slots.clear();
+	m_count = 0;
+	Rehash(s_minCapacity);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool ResourceRegistry::Add(ResourceId id, int index)
+{
+	if (2 * (m_count + 1) > (int)m_slots.size())
+	{
+		Rehash(2 * (int)m_slots.size());
+	}
+
+	for (uint32_t slotIndex = GetHomeSlot(id.hash);; slotIndex = ((slotIndex + 1) & m_mask))
+	{
+		Slot& slot = m_slots[slotIndex];
+
+		if (slot.hash == id.hash)
+		{
+			return false;
+		}
+
+		if (slot.hash == 0)
+		{
+			slot.hash = id.hash;
+			slot.index = index;
+			m_count++;
+			return true;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The table is never full, so an empty slot always ends the probe
+int ResourceRegistry::Find(ResourceId id) const
+{
+	for (uint32_t slotIndex = GetHomeSlot(id.hash);; slotIndex = ((slotIndex + 1) & m_mask))
+	{
+		const Slot& slot = m_slots[slotIndex];
+
+		if (slot.hash == id.hash)
+		{
+			return slot.index;
+		}
+
+		if (slot.hash == 0)
+		{
+			return INVALID_INDEX;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Slots read to find each entry, 1.0 being every entry in its home slot
+float ResourceRegistry::GetAverageProbeCount() const
+{
+	if (m_count == 0)
+	{
+		return 0.f;
+	}
+
+	uint64_t probeCount = 0;
+
+	for (uint32_t slotIndex = 0; slotIndex < (uint32_t)m_slots.size(); ++slotIndex)
+	{
+		if (m_slots[slotIndex].hash != 0)
+		{
+			probeCount += ((slotIndex - GetHomeSlot(m_slots[slotIndex].hash)) & m_mask) + 1;
+		}
+	}
+
+	return (float)probeCount / (float)m_count;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Capacity has to be a power of two. The home slot comes from the top bits of a Fibonacci hash, so paths
+// differing only in their last few characters still spread across the table
+void ResourceRegistry::Rehash(int capacity)
+{
+	std::vector<Slot> oldSlots;
+	oldSlots.swap(m_slots);
+
+	m_slots.resize(capacity);
+	m_mask = (uint32_t)(capacity - 1);
+	m_shift = 64;
+	for (int bits = capacity; bits > 1; bits >>= 1)
+	{
+		m_shift--;
+	}
+
+	m_count = 0;
+	for (const Slot& slot : oldSlots)
+	{
+		if (slot.hash != 0)
+		{
+			Add(ResourceId(slot.hash), slot.index);
+		}
+	}
+}
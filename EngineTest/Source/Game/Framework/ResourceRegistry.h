@@ -0,0 +1,79 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Open addressed table from ResourceId to a resource index
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/ResourceId.h"
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Linear probing over one flat array of 16 byte slots, kept at most half full so nearly every lookup
+// is answered by the first slot it reads. Entries are never removed, matching resources living until shutdown
+class ResourceRegistry
+{
+public:
+	//-----Public Methods-----
+
+	ResourceRegistry();
+
+	void	Reserve(int count);
+	void	Clear();
+
+	// Returns false (and changes nothing) if the id is already in
+	bool	Add(ResourceId id, int index);
+	int		Find(ResourceId id) const;
+
+	int		GetCount() const { return m_count; }
+	int		GetCapacity() const { return (int)m_slots.size(); }
+	float	GetAverageProbeCount() const;
+
+	static const int INVALID_INDEX = -1;
+
+
+private:
+	//-----Private Methods-----
+
+	uint32_t	GetHomeSlot(uint64_t hash) const { return (uint32_t)((hash * 0x9E3779B97F4A7C15ULL) >> m_shift); }
+	void		Rehash(int capacity);
+
+
+private:
+	//-----Private Data-----
+
+	struct Slot
+	{
+		uint64_t	hash = 0;				// 0 is an empty slot, ResourceId never hashes to it
+		int			index = INVALID_INDEX;
+	};
+
+	std::vector<Slot>	m_slots;
+	uint32_t			m_mask = 0;
+	int					m_shift = 64;
+	int					m_count = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
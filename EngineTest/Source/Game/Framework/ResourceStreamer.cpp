@@ -0,0 +1,236 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/ResourceStreamer.h"
+#include "Game/Framework/Profiler.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Job/Job.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Runs the resource's Load on whichever thread picks it up, then flags it for the main thread
+class StreamLoadJob : public Job
+{
+public:
+	//-----Public Methods-----
+
+	StreamLoadJob(StreamEntry* entry) : m_entry(entry) {}
+
+	virtual void Execute() override;
+	virtual void Finalize() override {}
+
+
+private:
+	//-----Private Data-----
+
+	StreamEntry* m_entry = nullptr;
+
+};
+
+
+// One requested path. Only the state is touched by both the worker and the main thread
+struct StreamEntry
+{
+	StreamEntry(const std::string& path_, std::unique_ptr<StreamedResource> resource_)
+		: path(path_), resource(std::move(resource_)), loadJob(this) {}
+
+	std::string							path;
+	std::unique_ptr<StreamedResource>	resource;
+	std::atomic<int>					state{ STREAM_STATE_LOADING };
+	StreamLoadJob						loadJob;
+	JobHandle							loadJobHandle;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+ResourceStreamer* g_resourceStreamer = nullptr;
+int ResourceStreamer::s_generation = 0;
+const double ResourceStreamer::DEFAULT_FINALIZE_SECONDS = 0.002;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void StreamLoadJob::Execute()
+{
+	const bool succeeded = m_entry->resource->Load(m_entry->path);
+	m_entry->state.store(succeeded ? STREAM_STATE_LOADED : STREAM_STATE_FAILED, std::memory_order_release);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Needs the JobScheduler, and has to shut down before it
+void ResourceStreamer::Initialize()
+{
+	ASSERT_OR_DIE(g_resourceStreamer == nullptr, "ResourceStreamer initialized twice!");
+	ASSERT_OR_DIE(g_jobScheduler != nullptr, "ResourceStreamer needs the JobScheduler!");
+
+	g_resourceStreamer = new ResourceStreamer();
+	s_generation++;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void ResourceStreamer::Shutdown()
+{
+	SAFE_DELETE(g_resourceStreamer);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+ResourceStreamer::ResourceStreamer()
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Loads still running hold pointers into the entries, so they have to finish first
+ResourceStreamer::~ResourceStreamer()
+{
+	for (StreamEntry* entry : m_pendingEntries)
+	{
+		g_jobScheduler->Wait(entry->loadJobHandle);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The id has to be the path's, it's only passed in so literal paths can hash at compile time.
+// The path is only compared when the id's already taken, which is where a hash collision would show up
+StreamHandle ResourceStreamer::RequestLoad(ResourceId id, const std::string& path, std::unique_ptr<StreamedResource> resource)
+{
+	StreamHandle handle = FindHandle(id);
+	if (handle.IsValid())
+	{
+		ASSERT_OR_DIE(m_entries[handle.index]->path == path, "Two resource paths hash to the same ResourceId!");
+		return handle;
+	}
+
+	handle.index = (int)m_entries.size();
+	m_entries.push_back(std::unique_ptr<StreamEntry>(new StreamEntry(path, std::move(resource))));
+	m_entryIndexById.Add(id, handle.index);
+
+	StreamEntry* entry = m_entries.back().get();
+	m_pendingEntries.push_back(entry);
+	entry->loadJobHandle = g_jobScheduler->Submit(&entry->loadJob);
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+StreamHandle ResourceStreamer::FindHandle(ResourceId id) const
+{
+	StreamHandle handle;
+	handle.index = m_entryIndexById.Find(id);
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Failed loads are dropped from the pending list as they're found, and don't count against the budget.
+// Callers see them through GetState
+int ResourceStreamer::FinalizeLoads(double maxSeconds /*= DEFAULT_FINALIZE_SECONDS*/)
+{
+	if (m_pendingEntries.size() == 0)
+	{
+		return 0;
+	}
+
+	// With nothing else to run the loads, one is run here. The shared queue pops newest first, so waiting on
+	// the newest load runs just that one, where waiting on the oldest would run them all
+	if (g_jobScheduler->GetWorkerCount() == 0)
+	{
+		g_jobScheduler->Wait(m_pendingEntries.back()->loadJobHandle);
+	}
+
+	const double startSeconds = Profiler::GetSeconds();
+	int finalizedCount = 0;
+	size_t keepCount = 0;
+
+	for (size_t pendingIndex = 0; pendingIndex < m_pendingEntries.size(); ++pendingIndex)
+	{
+		StreamEntry* entry = m_pendingEntries[pendingIndex];
+		const int state = entry->state.load(std::memory_order_acquire);
+		const bool outOfTime = (finalizedCount > 0 && Profiler::GetSeconds() - startSeconds >= maxSeconds);
+
+		if (state == STREAM_STATE_FAILED)
+		{
+			continue;
+		}
+
+		if (state == STREAM_STATE_LOADED && !outOfTime)
+		{
+			FinalizeEntry(entry);
+			finalizedCount++;
+			continue;
+		}
+
+		m_pendingEntries[keepCount++] = entry;
+	}
+
+	m_pendingEntries.resize(keepCount);
+	return finalizedCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Blocks until everything requested so far is ready or failed, for loading screens and shutdown
+void ResourceStreamer::FinishAllLoads()
+{
+	for (StreamEntry* entry : m_pendingEntries)
+	{
+		g_jobScheduler->Wait(entry->loadJobHandle);
+	}
+
+	FinalizeLoads(1e30);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+StreamState ResourceStreamer::GetState(StreamHandle handle) const
+{
+	if (handle.index < 0 || handle.index >= (int)m_entries.size())
+	{
+		return STREAM_STATE_INVALID;
+	}
+
+	return (StreamState)m_entries[handle.index]->state.load(std::memory_order_acquire);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+StreamedResource* ResourceStreamer::GetResource(StreamHandle handle) const
+{
+	return m_entries[handle.index]->resource.get();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool ResourceStreamer::FinalizeEntry(StreamEntry* entry)
+{
+	const bool succeeded = entry->resource->Finalize();
+	entry->state.store(succeeded ? STREAM_STATE_READY : STREAM_STATE_FAILED, std::memory_order_release);
+
+	return succeeded;
+}
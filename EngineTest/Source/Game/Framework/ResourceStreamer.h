@@ -0,0 +1,192 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Loads resources on JobScheduler workers and finishes them on the main thread, a few per frame
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/ResourceRegistry.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Requests the literal path the first time the line runs and keeps the handle in a static for that call site,
+// so after that it costs a compare against the streamer's generation. Evaluates to a CachedResourceHandle<Type>&
+#define CACHED_RESOURCE_HANDLE(Type, path) \
+	([]() -> CachedResourceHandle<Type>& { static CachedResourceHandle<Type> s_cachedHandle(RESOURCE_ID(path), path); return s_cachedHandle; }())
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class ResourceStreamer;
+struct StreamEntry;
+
+enum StreamState
+{
+	STREAM_STATE_INVALID,
+	STREAM_STATE_LOADING,			// Queued or running on a worker
+	STREAM_STATE_LOADED,			// Waiting for FinalizeLoads on the main thread
+	STREAM_STATE_READY,
+	STREAM_STATE_FAILED
+};
+
+// Refers to one requested path, stays valid until the streamer shuts down
+struct StreamHandle
+{
+	int index = -1;
+
+	bool IsValid() const { return index >= 0; }
+};
+
+
+// A handle that knows its resource type, so getting the resource needs no cast at the call site
+template <typename T>
+struct ResourceHandle : public StreamHandle
+{
+	ResourceHandle() {}
+	explicit ResourceHandle(StreamHandle handle) : StreamHandle(handle) {}
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+extern ResourceStreamer* g_resourceStreamer;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Something the streamer can load. Load runs on a worker and should do all the file I/O and decoding,
+// without touching the renderer or any other main thread system; Finalize runs on the main thread
+// afterwards for whatever's left, like GPU uploads
+class StreamedResource
+{
+public:
+	//-----Public Methods-----
+
+	virtual ~StreamedResource() {}
+
+	virtual bool Load(const std::string& path) = 0;
+	virtual bool Finalize() { return true; }
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Requests return straight away, and the resource can be used once it reads as ready; until then callers
+// use a placeholder (or skip drawing). Requests, lookups and FinalizeLoads are main thread only.
+// Loads are jobs that nothing waits on, so they're picked up by idle workers between the frame's own jobs.
+// With no workers, FinalizeLoads runs one load itself each call so streaming still makes progress
+class ResourceStreamer
+{
+public:
+	//-----Public Methods-----
+
+	static void Initialize();
+	static void Shutdown();
+
+	// Requesting a path that's already been requested returns the same handle, whatever the type
+	template <typename T>
+	ResourceHandle<T>	RequestLoad(const std::string& path) { return RequestLoad<T>(ResourceId(path), path); }
+	template <typename T>
+	ResourceHandle<T>	RequestLoad(ResourceId id, const std::string& path) { StreamHandle handle = FindHandle(id); return ResourceHandle<T>(handle.IsValid() ? handle : RequestLoad(id, path, std::unique_ptr<StreamedResource>(new T()))); }
+	StreamHandle		RequestLoad(ResourceId id, const std::string& path, std::unique_ptr<StreamedResource> resource);
+
+	// One probe of the registry, no string compares
+	StreamHandle		FindHandle(ResourceId id) const;
+	StreamHandle		FindHandle(const std::string& path) const { return FindHandle(ResourceId(path)); }
+
+	// Finalizes loaded resources in request order until the budget is spent, always at least one. Returns how many
+	int					FinalizeLoads(double maxSeconds = DEFAULT_FINALIZE_SECONDS);
+	void				FinishAllLoads();
+
+	StreamState			GetState(StreamHandle handle) const;
+	bool				IsReady(StreamHandle handle) const { return GetState(handle) == STREAM_STATE_READY; }
+	int					GetPendingCount() const { return (int)m_pendingEntries.size(); }
+
+	// nullptr (or the placeholder) until the resource is ready
+	template <typename T>
+	T*					Get(StreamHandle handle) const { return (IsReady(handle) ? static_cast<T*>(GetResource(handle)) : nullptr); }
+	template <typename T>
+	T*					Get(ResourceHandle<T> handle) const { return Get<T>((StreamHandle)handle); }
+	template <typename T>
+	T*					GetOrPlaceholder(StreamHandle handle, T* placeholder) const { T* resource = Get<T>(handle); return (resource != nullptr ? resource : placeholder); }
+
+	// Changes each time the streamer is recreated, so handles cached past a restart know to request again
+	static int			GetGeneration() { return s_generation; }
+
+	static const double DEFAULT_FINALIZE_SECONDS;
+
+
+private:
+	//-----Private Methods-----
+
+	ResourceStreamer();
+	~ResourceStreamer();
+	ResourceStreamer(const ResourceStreamer& copy) = delete;
+
+	StreamedResource*	GetResource(StreamHandle handle) const;
+	bool				FinalizeEntry(StreamEntry* entry);
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<std::unique_ptr<StreamEntry>>	m_entries;
+	ResourceRegistry							m_entryIndexById;
+	std::vector<StreamEntry*>					m_pendingEntries;		// Loading or loaded, in request order
+
+	static int									s_generation;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// What CACHED_RESOURCE_HANDLE keeps per call site. The id is worked out at compile time, and the handle is
+// only requested again if the streamer it came from has been shut down since
+template <typename T>
+class CachedResourceHandle
+{
+public:
+	//-----Public Methods-----
+
+	CachedResourceHandle(ResourceId id, const char* path) : m_id(id), m_path(path) {}
+
+	ResourceHandle<T>	GetHandle()
+	{
+		if (m_generation != ResourceStreamer::GetGeneration())
+		{
+			m_handle = g_resourceStreamer->RequestLoad<T>(m_id, m_path);
+			m_generation = ResourceStreamer::GetGeneration();
+		}
+
+		return m_handle;
+	}
+
+	T*					Get() { return g_resourceStreamer->Get(GetHandle()); }
+
+
+private:
+	//-----Private Data-----
+
+	ResourceId			m_id;
+	const char*			m_path = nullptr;
+	ResourceHandle<T>	m_handle;
+	int					m_generation = -1;
+
+};
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,201 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/StreamedResources.h"
+#include "Game/Cook/CookedAssets.h"
+#include "Game/Framework/ResourcePack.h"
+#include "Game/Voxel/VoxelModel.h"
+#include <cstring>
+#include <string>
+#include <vector>
+#ifndef HEADLESS_ONLY
+#include "Engine/Resource/ResourceSystem.h"
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char	s_dataPathPrefix[] = "Data/";
+static const int	s_cubeMapFaceCount = 6;		// Cube map textures name a directory holding 0.png to 5.png
+static const size_t	s_prefetchStride = 4096;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static bool EndsWith(const std::string& text, const char* ending)
+{
+	const size_t endingLength = strlen(ending);
+	return (text.size() >= endingLength && text.compare(text.size() - endingLength, endingLength, ending) == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Every quoted attribute value in the text that's a path under Data/
+static void FindReferencedPaths(const char* text, size_t size, std::vector<std::string>& out_paths)
+{
+	const char* end = text + size;
+
+	for (const char* cursor = text; cursor + 1 < end; ++cursor)
+	{
+		if (cursor[0] != '=' || cursor[1] != '"')
+		{
+			continue;
+		}
+
+		const char* valueStart = cursor + 2;
+		const char* valueEnd = valueStart;
+		while (valueEnd < end && *valueEnd != '"')
+		{
+			valueEnd++;
+		}
+
+		const size_t prefixLength = sizeof(s_dataPathPrefix) - 1;
+		if ((size_t)(valueEnd - valueStart) > prefixLength && strncmp(valueStart, s_dataPathPrefix, prefixLength) == 0)
+		{
+			out_paths.push_back(std::string(valueStart, valueEnd));
+		}
+
+		cursor = valueEnd;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Maps the file and touches a byte per page so the OS reads all of it in. Returns the file's size, 0 if it's missing
+static size_t PrefetchFile(const std::string& path, std::vector<std::string>* out_referencedPaths)
+{
+	ResourceFile file;
+	if (!file.Open(path.c_str()))
+	{
+		return 0;
+	}
+
+	const uint8_t* data = file.GetData();
+	volatile uint8_t touched = 0;
+
+	for (size_t offset = 0; offset < file.GetSize(); offset += s_prefetchStride)
+	{
+		touched = (uint8_t)(touched + data[offset]);
+	}
+
+	if (out_referencedPaths != nullptr)
+	{
+		FindReferencedPaths((const char*)data, file.GetSize(), *out_referencedPaths);
+	}
+
+	return file.GetSize();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Everything the material refers to, read from its cooked descriptor and its shader's, with no text scanned.
+// Returns false if either is missing or stale, so the caller scans the sources instead
+static bool FindCookedReferencedPaths(const std::string& materialPath, std::vector<std::string>& out_paths)
+{
+	CookedMaterial material;
+	CookedShader shader;
+
+	if (!material.Load(materialPath) || !shader.Load(material.GetShaderPath()))
+	{
+		return false;
+	}
+
+	out_paths.push_back(material.GetShaderPath());
+	out_paths.push_back(shader.GetSourcePath());
+
+	for (int textureIndex = 0; textureIndex < material.GetTextureCount(); ++textureIndex)
+	{
+		if (material.GetTextureKind(textureIndex) != COOKED_TEXTURE_KIND_BUILT_IN)
+		{
+			out_paths.push_back(material.GetTexturePath(textureIndex));
+		}
+	}
+
+	return true;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// The model is only needed to build the mesh, so it's dropped (and a cooked file unmapped) afterwards
+bool StreamedVoxelMesh::Load(const std::string& path)
+{
+	VoxelModel model;
+	if (!model.Load(path))
+	{
+		return false;
+	}
+
+	VoxelMesher mesher;
+	mesher.Build(model, m_meshData);
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Follows references from the material into the shader files, but no further. Cooked descriptors list them
+// outright; without them the material and shader text is scanned
+bool StreamedMaterial::Load(const std::string& path)
+{
+	m_path = path;
+
+	std::vector<std::string> referencedPaths;
+	const bool isCooked = FindCookedReferencedPaths(path, referencedPaths);
+	m_prefetchedBytes = PrefetchFile(path, (isCooked ? nullptr : &referencedPaths));
+
+	if (m_prefetchedBytes == 0)
+	{
+		return false;
+	}
+
+	for (size_t pathIndex = 0; pathIndex < referencedPaths.size(); ++pathIndex)
+	{
+		// Copied, since reading a shader can add to the list
+		const std::string referencedPath = referencedPaths[pathIndex];
+
+		if (EndsWith(referencedPath, "/"))
+		{
+			for (int faceIndex = 0; faceIndex < s_cubeMapFaceCount; ++faceIndex)
+			{
+				m_prefetchedBytes += PrefetchFile(referencedPath + std::to_string(faceIndex) + ".png", nullptr);
+			}
+		}
+		else
+		{
+			m_prefetchedBytes += PrefetchFile(referencedPath, (!isCooked && EndsWith(referencedPath, ".shader") ? &referencedPaths : nullptr));
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Headless-only builds have no renderer to make materials with, so they always fail
+bool StreamedMaterial::Finalize()
+{
+#ifndef HEADLESS_ONLY
+	m_material = g_resourceSystem->CreateOrGetMaterial(m_path.c_str());
+#endif
+	return (m_material != nullptr);
+}
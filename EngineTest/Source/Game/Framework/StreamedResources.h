@@ -0,0 +1,79 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: The resource types the ResourceStreamer knows how to load
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/ResourceStreamer.h"
+#include "Game/Voxel/VoxelMesher.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class Material;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// A .qef (or the cooked file next to it) parsed and greedy meshed entirely on the worker
+class StreamedVoxelMesh : public StreamedResource
+{
+public:
+	//-----Public Methods-----
+
+	virtual bool			Load(const std::string& path) override;
+
+	const VoxelMeshData&	GetMeshData() const { return m_meshData; }
+
+
+private:
+	//-----Private Data-----
+
+	VoxelMeshData m_meshData;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// The engine's material loading decodes and uploads in one call on the main thread, so the worker reads the
+// material and every file it refers to (shader, shader source, textures) to get the disk reads off the frame,
+// and Finalize makes the engine material from files that are already in the OS cache.
+// What it refers to comes from the cooked descriptors when they're there and current
+class StreamedMaterial : public StreamedResource
+{
+public:
+	//-----Public Methods-----
+
+	virtual bool	Load(const std::string& path) override;
+	virtual bool	Finalize() override;
+
+	Material*		GetMaterial() const { return m_material; }
+	size_t			GetPrefetchedBytes() const { return m_prefetchedBytes; }
+
+
+private:
+	//-----Private Data-----
+
+	std::string		m_path;
+	Material*		m_material = nullptr;
+	size_t			m_prefetchedBytes = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
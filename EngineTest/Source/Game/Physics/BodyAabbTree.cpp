@@ -0,0 +1,367 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyAabbTree.h"
+#include "Game/Physics/BodyStore.h"
+#include <algorithm>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+DynamicAabbTreeBroadphase::DynamicAabbTreeBroadphase(float fatMargin /*= 0.2f*/)
+	: m_fatMargin(fatMargin)
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DynamicAabbTreeBroadphase::FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs)
+{
+	SyncLeaves(store);
+
+	const int bodyCount = store.GetCount();
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if (store.IsAwakeAndDynamic(bodyIndex))
+		{
+			QueryPairs(store, bodyIndex, out_pairs);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Adds leaves for new bodies, reinserts the ones that left their fat bounds and drops the ones that were removed
+void DynamicAabbTreeBroadphase::SyncLeaves(const BodyStore& store)
+{
+	m_stepCount++;
+	m_lastReinsertCount = 0;
+
+	const int bodyCount = store.GetCount();
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const BodyHandle handle = store.GetHandle(bodyIndex);
+		if (handle.slot >= (uint32_t)m_proxies.size())
+		{
+			m_proxies.resize(handle.slot + 1);
+		}
+
+		LeafProxy& proxy = m_proxies[handle.slot];
+		const FloatAabb bounds = store.GetBounds(bodyIndex);
+
+		// Slot was reused by a new body since we last saw it
+		if (proxy.node >= 0 && proxy.generation != handle.generation)
+		{
+			RemoveLeaf(proxy.node);
+			FreeNode(proxy.node);
+			proxy.node = -1;
+		}
+
+		if (proxy.node < 0)
+		{
+			proxy.node = AllocateNode();
+			proxy.generation = handle.generation;
+			m_nodes[proxy.node].bounds = Expand(bounds, m_fatMargin);
+			InsertLeaf(proxy.node);
+		}
+		else if (!Contains(m_nodes[proxy.node].bounds, bounds))
+		{
+			RemoveLeaf(proxy.node);
+			m_nodes[proxy.node].bounds = Expand(bounds, m_fatMargin);
+			InsertLeaf(proxy.node);
+			m_lastReinsertCount++;
+		}
+
+		m_nodes[proxy.node].bodyIndex = bodyIndex;
+		proxy.lastSeenStep = m_stepCount;
+	}
+
+	for (LeafProxy& proxy : m_proxies)
+	{
+		if (proxy.node >= 0 && proxy.lastSeenStep != m_stepCount)
+		{
+			RemoveLeaf(proxy.node);
+			FreeNode(proxy.node);
+			proxy.node = -1;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Pairs between two awake dynamic bodies are only reported from the lower index, everything else from the body querying
+void DynamicAabbTreeBroadphase::QueryPairs(const BodyStore& store, int bodyIndex, std::vector<BodyPair>& out_pairs)
+{
+	if (m_root < 0)
+	{
+		return;
+	}
+
+	const FloatAabb bounds = store.GetBounds(bodyIndex);
+
+	m_queryStack.clear();
+	m_queryStack.push_back(m_root);
+
+	while (m_queryStack.size() > 0)
+	{
+		const int nodeIndex = m_queryStack.back();
+		m_queryStack.pop_back();
+
+		const AabbTreeNode& node = m_nodes[nodeIndex];
+		if (!DoAabbsOverlap(node.bounds, bounds))
+		{
+			continue;
+		}
+
+		if (!node.IsLeaf())
+		{
+			m_queryStack.push_back(node.children[0]);
+			m_queryStack.push_back(node.children[1]);
+			continue;
+		}
+
+		const int otherIndex = node.bodyIndex;
+		if (otherIndex == bodyIndex || (otherIndex < bodyIndex && store.IsAwakeAndDynamic(otherIndex)))
+		{
+			continue;
+		}
+
+		if (DoBodyBoundsOverlap(store, bodyIndex, otherIndex))
+		{
+			BodyPair pair;
+			pair.bodyA = std::min(bodyIndex, otherIndex);
+			pair.bodyB = std::max(bodyIndex, otherIndex);
+			out_pairs.push_back(pair);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+int DynamicAabbTreeBroadphase::AllocateNode()
+{
+	if (m_freeList < 0)
+	{
+		m_nodes.emplace_back();
+		return (int)m_nodes.size() - 1;
+	}
+
+	const int nodeIndex = m_freeList;
+	m_freeList = m_nodes[nodeIndex].parent;
+	m_nodes[nodeIndex] = AabbTreeNode();
+
+	return nodeIndex;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DynamicAabbTreeBroadphase::FreeNode(int nodeIndex)
+{
+	m_nodes[nodeIndex] = AabbTreeNode();
+	m_nodes[nodeIndex].parent = m_freeList;
+	m_nodes[nodeIndex].height = -1;
+	m_freeList = nodeIndex;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Walks down picking whichever child grows the least in surface area, stopping early once making a new
+// parent right here is cheaper than pushing the leaf further down
+void DynamicAabbTreeBroadphase::InsertLeaf(int leafIndex)
+{
+	if (m_root < 0)
+	{
+		m_root = leafIndex;
+		m_nodes[leafIndex].parent = -1;
+		return;
+	}
+
+	const FloatAabb leafBounds = m_nodes[leafIndex].bounds;
+	int siblingIndex = m_root;
+
+	while (!m_nodes[siblingIndex].IsLeaf())
+	{
+		const AabbTreeNode& node = m_nodes[siblingIndex];
+		const float area = GetSurfaceArea(node.bounds);
+		const float combinedArea = GetSurfaceArea(Union(node.bounds, leafBounds));
+
+		// Cost of a new parent for this node and the leaf, vs the minimum cost of pushing the leaf further down
+		const float cost = 2.f * combinedArea;
+		const float inheritanceCost = 2.f * (combinedArea - area);
+
+		float childCosts[2];
+		for (int childIndex = 0; childIndex < 2; ++childIndex)
+		{
+			const AabbTreeNode& child = m_nodes[node.children[childIndex]];
+			const float unionArea = GetSurfaceArea(Union(child.bounds, leafBounds));
+			childCosts[childIndex] = (child.IsLeaf() ? unionArea : unionArea - GetSurfaceArea(child.bounds)) + inheritanceCost;
+		}
+
+		if (cost < childCosts[0] && cost < childCosts[1])
+		{
+			break;
+		}
+
+		siblingIndex = (childCosts[0] < childCosts[1] ? node.children[0] : node.children[1]);
+	}
+
+	const int oldParentIndex = m_nodes[siblingIndex].parent;
+	const int newParentIndex = AllocateNode();
+
+	AabbTreeNode& newParent = m_nodes[newParentIndex];
+	newParent.parent = oldParentIndex;
+	newParent.bounds = Union(leafBounds, m_nodes[siblingIndex].bounds);
+	newParent.height = m_nodes[siblingIndex].height + 1;
+	newParent.children[0] = siblingIndex;
+	newParent.children[1] = leafIndex;
+
+	if (oldParentIndex >= 0)
+	{
+		AabbTreeNode& oldParent = m_nodes[oldParentIndex];
+		oldParent.children[oldParent.children[0] == siblingIndex ? 0 : 1] = newParentIndex;
+	}
+	else
+	{
+		m_root = newParentIndex;
+	}
+
+	m_nodes[siblingIndex].parent = newParentIndex;
+	m_nodes[leafIndex].parent = newParentIndex;
+
+	RefitAncestors(newParentIndex);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The leaf's parent goes away and its sibling takes the parent's place
+void DynamicAabbTreeBroadphase::RemoveLeaf(int leafIndex)
+{
+	if (leafIndex == m_root)
+	{
+		m_root = -1;
+		return;
+	}
+
+	const int parentIndex = m_nodes[leafIndex].parent;
+	const int grandParentIndex = m_nodes[parentIndex].parent;
+	const int siblingIndex = (m_nodes[parentIndex].children[0] == leafIndex ? m_nodes[parentIndex].children[1] : m_nodes[parentIndex].children[0]);
+
+	m_nodes[siblingIndex].parent = grandParentIndex;
+	m_nodes[leafIndex].parent = -1;
+	FreeNode(parentIndex);
+
+	if (grandParentIndex >= 0)
+	{
+		AabbTreeNode& grandParent = m_nodes[grandParentIndex];
+		grandParent.children[grandParent.children[0] == parentIndex ? 0 : 1] = siblingIndex;
+		RefitAncestors(grandParentIndex);
+	}
+	else
+	{
+		m_root = siblingIndex;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Rebalances, then recomputes bounds and height, from the node up to the root
+void DynamicAabbTreeBroadphase::RefitAncestors(int nodeIndex)
+{
+	while (nodeIndex >= 0)
+	{
+		nodeIndex = Balance(nodeIndex);
+
+		AabbTreeNode& node = m_nodes[nodeIndex];
+		const AabbTreeNode& child0 = m_nodes[node.children[0]];
+		const AabbTreeNode& child1 = m_nodes[node.children[1]];
+
+		node.height = 1 + std::max(child0.height, child1.height);
+		node.bounds = Union(child0.bounds, child1.bounds);
+
+		nodeIndex = node.parent;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// If one child of A is more than one level taller than the other, that child (Up) is rotated into A's place.
+// A becomes Up's first child, Up keeps its taller child, and its shorter child moves under A where Up was.
+// Returns whichever node now sits where A was
+int DynamicAabbTreeBroadphase::Balance(int nodeIndexA)
+{
+	if (m_nodes[nodeIndexA].IsLeaf() || m_nodes[nodeIndexA].height < 2)
+	{
+		return nodeIndexA;
+	}
+
+	const int balance = m_nodes[m_nodes[nodeIndexA].children[1]].height - m_nodes[m_nodes[nodeIndexA].children[0]].height;
+	if (balance >= -1 && balance <= 1)
+	{
+		return nodeIndexA;
+	}
+
+	// The taller child moves up, the shorter one stays under A
+	const int upSide = (balance > 1 ? 1 : 0);
+	AabbTreeNode& nodeA = m_nodes[nodeIndexA];
+	const int nodeIndexUp = nodeA.children[upSide];
+	const int nodeIndexStay = nodeA.children[1 - upSide];
+	AabbTreeNode& nodeUp = m_nodes[nodeIndexUp];
+
+	const int nodeIndexF = nodeUp.children[0];
+	const int nodeIndexG = nodeUp.children[1];
+
+	// Up takes A's place
+	nodeUp.children[0] = nodeIndexA;
+	nodeUp.parent = nodeA.parent;
+	nodeA.parent = nodeIndexUp;
+
+	if (nodeUp.parent >= 0)
+	{
+		AabbTreeNode& parent = m_nodes[nodeUp.parent];
+		parent.children[parent.children[0] == nodeIndexA ? 0 : 1] = nodeIndexUp;
+	}
+	else
+	{
+		m_root = nodeIndexUp;
+	}
+
+	// Taller grandchild stays with Up, the other goes under A in Up's old spot
+	const bool isFTaller = (m_nodes[nodeIndexF].height > m_nodes[nodeIndexG].height);
+	const int nodeIndexKeep = (isFTaller ? nodeIndexF : nodeIndexG);
+	const int nodeIndexMove = (isFTaller ? nodeIndexG : nodeIndexF);
+
+	nodeUp.children[1] = nodeIndexKeep;
+	nodeA.children[upSide] = nodeIndexMove;
+	m_nodes[nodeIndexMove].parent = nodeIndexA;
+
+	nodeA.bounds = Union(m_nodes[nodeIndexStay].bounds, m_nodes[nodeIndexMove].bounds);
+	nodeA.height = 1 + std::max(m_nodes[nodeIndexStay].height, m_nodes[nodeIndexMove].height);
+	nodeUp.bounds = Union(nodeA.bounds, m_nodes[nodeIndexKeep].bounds);
+	nodeUp.height = 1 + std::max(nodeA.height, m_nodes[nodeIndexKeep].height);
+
+	return nodeIndexUp;
+}
@@ -0,0 +1,101 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Dynamic AABB tree broadphase, kept across steps and only touched for bodies that leave their fat bounds
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyBroadphase.h"
+#include "Game/Physics/PhysicsMath.h"
+#include <cstdint>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Leaves hold one body; internal nodes always have two children and bound both
+struct AabbTreeNode
+{
+	FloatAabb	bounds;
+	int			parent = -1;		// Next free node, when on the free list
+	int			children[2] = { -1, -1 };
+	int			height = 0;			// 0 for leaves
+	int			bodyIndex = -1;		// Leaves only, refreshed every step
+
+	bool IsLeaf() const { return children[0] == -1; }
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Leaves are fattened by fatMargin, so a body only gets reinserted once it moves out of its fat box.
+// Insertion picks the sibling by surface area cost, and the path back up is rebalanced with rotations.
+// Bodies are tracked by handle slot, so they keep their leaf across removals of other bodies.
+// Only awake dynamic bodies query the tree, so resting and static bodies cost nothing past their leaf
+class DynamicAabbTreeBroadphase : public BodyBroadphase
+{
+public:
+	//-----Public Methods-----
+
+	DynamicAabbTreeBroadphase(float fatMargin = 0.2f);
+
+	virtual const char*	GetName() const override { return "aabb_tree"; }
+	virtual void		FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs) override;
+
+	int					GetHeight() const { return (m_root >= 0 ? m_nodes[m_root].height : 0); }
+	int					GetLastReinsertCount() const { return m_lastReinsertCount; }
+
+
+private:
+	//-----Private Methods-----
+
+	void	SyncLeaves(const BodyStore& store);
+	void	QueryPairs(const BodyStore& store, int bodyIndex, std::vector<BodyPair>& out_pairs);
+
+	int		AllocateNode();
+	void	FreeNode(int nodeIndex);
+	void	InsertLeaf(int leafIndex);
+	void	RemoveLeaf(int leafIndex);
+	void	RefitAncestors(int nodeIndex);
+	int		Balance(int nodeIndex);
+
+
+private:
+	//-----Private Data-----
+
+	// Per handle slot
+	struct LeafProxy
+	{
+		int			node = -1;
+		uint32_t	generation = 0;
+		uint32_t	lastSeenStep = 0;
+	};
+
+	float						m_fatMargin = 0.2f;
+	std::vector<AabbTreeNode>	m_nodes;
+	int							m_root = -1;
+	int							m_freeList = -1;
+	std::vector<LeafProxy>		m_proxies;
+	uint32_t					m_stepCount = 0;
+	int							m_lastReinsertCount = 0;
+	std::vector<int>			m_queryStack;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,215 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyBroadphase.h"
+#include "Game/Physics/BodyAabbTree.h"
+#include "Game/Physics/BodySpatialHash.h"
+#include "Game/Physics/BodyStore.h"
+#include "Game/Physics/BodySweepAndPrune.h"
+#include <algorithm>
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char* s_broadphaseTypeNames[NUM_BODY_BROADPHASE_TYPES] = { "sort_and_sweep", "aabb_tree", "sweep_and_prune", "spatial_hash", "sphere_bounds" };
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+BodyBroadphase* CreateBodyBroadphase(BodyBroadphaseType type)
+{
+	switch (type)
+	{
+	case BODY_BROADPHASE_AABB_TREE:		return new DynamicAabbTreeBroadphase();
+	case BODY_BROADPHASE_SWEEP_AND_PRUNE:	return new SweepAndPruneBroadphase();
+	case BODY_BROADPHASE_SPATIAL_HASH:	return new SpatialHashBroadphase();
+	case BODY_BROADPHASE_SPHERE_BOUNDS:	return new SphereBoundsBroadphase();
+	case BODY_BROADPHASE_SORT_AND_SWEEP:
+	default:
+		return new SortAndSweepBroadphase();
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+const char* GetBodyBroadphaseTypeName(BodyBroadphaseType type)
+{
+	if (type >= 0 && type < NUM_BODY_BROADPHASE_TYPES)
+	{
+		return s_broadphaseTypeNames[type];
+	}
+
+	return "unknown";
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyBroadphaseType GetBodyBroadphaseTypeFromName(const char* name, BodyBroadphaseType defaultType)
+{
+	for (int typeIndex = 0; typeIndex < NUM_BODY_BROADPHASE_TYPES; ++typeIndex)
+	{
+		if (strcmp(name, s_broadphaseTypeNames[typeIndex]) == 0)
+		{
+			return (BodyBroadphaseType)typeIndex;
+		}
+	}
+
+	return defaultType;
+}
+
+
+
+//-------------------------------------------------------------------------------------------------
+bool DoBodyBoundsOverlap(const BodyStore& store, int indexA, int indexB)
+{
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		const float* mins = store.GetField((BodyField)(BODY_BOUNDS_MIN_X + axisIndex));
+		const float* maxs = store.GetField((BodyField)(BODY_BOUNDS_MAX_X + axisIndex));
+
+		if (mins[indexA] > maxs[indexB] || mins[indexB] > maxs[indexA])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Contacts are only needed when one side can move; immovable and sleeping bodies never do on their own
+bool ShouldBodiesCollide(const BodyStore& store, int indexA, int indexB)
+{
+	return (store.IsAwakeAndDynamic(indexA) || store.IsAwakeAndDynamic(indexB));
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void SortAndSweepBroadphase::FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs)
+{
+	const int bodyCount = store.GetCount();
+	const float* minX = store.GetField(BODY_BOUNDS_MIN_X);
+	const float* maxX = store.GetField(BODY_BOUNDS_MAX_X);
+
+	m_sortedIndices.resize(bodyCount);
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		m_sortedIndices[bodyIndex] = bodyIndex;
+	}
+
+	// Tie break on index so the pair order doesn't depend on the sort implementation
+	std::sort(m_sortedIndices.begin(), m_sortedIndices.end(), [minX](int a, int b)
+	{
+		return (minX[a] < minX[b]) || (minX[a] == minX[b] && a < b);
+	});
+
+	for (int sortedIndex = 0; sortedIndex < bodyCount; ++sortedIndex)
+	{
+		const int indexA = m_sortedIndices[sortedIndex];
+
+		for (int otherSortedIndex = sortedIndex + 1; otherSortedIndex < bodyCount; ++otherSortedIndex)
+		{
+			const int indexB = m_sortedIndices[otherSortedIndex];
+
+			// Everything after this starts past our end on x
+			if (minX[indexB] > maxX[indexA])
+			{
+				break;
+			}
+
+			if (ShouldBodiesCollide(store, indexA, indexB) && DoBodyBoundsOverlap(store, indexA, indexB))
+			{
+				BodyPair pair;
+				pair.bodyA = std::min(indexA, indexB);
+				pair.bodyB = std::max(indexA, indexB);
+				out_pairs.push_back(pair);
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Spheres are centered on the body position and sized to fit the shape at any rotation
+void SphereBoundsBroadphase::FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs)
+{
+	const int bodyCount = store.GetCount();
+	const uint8_t* shapeTypes = store.GetShapeTypes();
+	const float* radii = store.GetField(BODY_SHAPE_RADIUS);
+	const float* halfHeights = store.GetField(BODY_SHAPE_HALF_HEIGHT);
+	const float* positionsX = store.GetField(BODY_POSITION_X);
+
+	m_radii.resize(bodyCount);
+	m_sortedIndices.resize(bodyCount);
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		switch (shapeTypes[bodyIndex])
+		{
+		case BODY_SHAPE_BOX:		m_radii[bodyIndex] = Length(store.GetFloat3(bodyIndex, BODY_SHAPE_HALF_EXTENT_X)); break;
+		case BODY_SHAPE_CAPSULE:	m_radii[bodyIndex] = halfHeights[bodyIndex] + radii[bodyIndex]; break;
+		case BODY_SHAPE_SPHERE:
+		default:
+			m_radii[bodyIndex] = radii[bodyIndex];
+			break;
+		}
+
+		m_radii[bodyIndex] += m_margin;
+		m_sortedIndices[bodyIndex] = bodyIndex;
+	}
+
+	const float* sphereRadii = m_radii.data();
+	std::sort(m_sortedIndices.begin(), m_sortedIndices.end(), [positionsX, sphereRadii](int a, int b)
+	{
+		const float minA = positionsX[a] - sphereRadii[a];
+		const float minB = positionsX[b] - sphereRadii[b];
+		return (minA < minB) || (minA == minB && a < b);
+	});
+
+	for (int sortedIndex = 0; sortedIndex < bodyCount; ++sortedIndex)
+	{
+		const int indexA = m_sortedIndices[sortedIndex];
+		const Float3 centerA = store.GetFloat3(indexA, BODY_POSITION_X);
+		const float maxXA = centerA.x + m_radii[indexA];
+
+		for (int otherSortedIndex = sortedIndex + 1; otherSortedIndex < bodyCount; ++otherSortedIndex)
+		{
+			const int indexB = m_sortedIndices[otherSortedIndex];
+			if (positionsX[indexB] - m_radii[indexB] > maxXA)
+			{
+				break;
+			}
+
+			const float radiusSum = m_radii[indexA] + m_radii[indexB];
+			if (ShouldBodiesCollide(store, indexA, indexB) && LengthSquared(store.GetFloat3(indexB, BODY_POSITION_X) - centerA) <= radiusSum * radiusSum)
+			{
+				BodyPair pair;
+				pair.bodyA = std::min(indexA, indexB);
+				pair.bodyB = std::max(indexA, indexB);
+				out_pairs.push_back(pair);
+			}
+		}
+	}
+}
@@ -0,0 +1,108 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Broadphase interface for the BodyScene, plus the simple sort and sweep implementations
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyCollision.h"
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodyStore;
+
+enum BodyBroadphaseType
+{
+	BODY_BROADPHASE_SORT_AND_SWEEP,
+	BODY_BROADPHASE_AABB_TREE,
+	BODY_BROADPHASE_SWEEP_AND_PRUNE,
+	BODY_BROADPHASE_SPATIAL_HASH,
+	BODY_BROADPHASE_SPHERE_BOUNDS,
+	NUM_BODY_BROADPHASE_TYPES
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Finds pairs of bodies whose bounds (BODY_BOUNDS_*) overlap. Bounds are refreshed by the scene before FindPairs
+class BodyBroadphase
+{
+public:
+	//-----Public Methods-----
+
+	virtual ~BodyBroadphase() {}
+
+	virtual const char*	GetName() const = 0;
+	virtual void		FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs) = 0;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Sorts every body along x each step and sweeps for overlaps; no state carried between steps
+class SortAndSweepBroadphase : public BodyBroadphase
+{
+public:
+	//-----Public Methods-----
+
+	virtual const char*	GetName() const override { return "sort_and_sweep"; }
+	virtual void		FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs) override;
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<int> m_sortedIndices;
+
+};
+
+
+
+//-------------------------------------------------------------------------------------------------
+// Same test as CollisionScene<BoundingVolumeSphere>: a bounding sphere per body, swept along x.
+// Not meant for use, it's here so the benchmark can count the false pairs spheres give over AABBs
+class SphereBoundsBroadphase : public BodyBroadphase
+{
+public:
+	//-----Public Methods-----
+
+	SphereBoundsBroadphase(float margin = 0.05f) : m_margin(margin) {}
+
+	virtual const char*	GetName() const override { return "sphere_bounds"; }
+	virtual void		FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs) override;
+
+
+private:
+	//-----Private Data-----
+
+	float				m_margin = 0.05f;
+	std::vector<float>	m_radii;
+	std::vector<int>	m_sortedIndices;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+BodyBroadphase*		CreateBodyBroadphase(BodyBroadphaseType type);
+const char*			GetBodyBroadphaseTypeName(BodyBroadphaseType type);
+BodyBroadphaseType	GetBodyBroadphaseTypeFromName(const char* name, BodyBroadphaseType defaultType);
+
+bool DoBodyBoundsOverlap(const BodyStore& store, int indexA, int indexB);
+bool ShouldBodiesCollide(const BodyStore& store, int indexA, int indexB);
@@ -0,0 +1,739 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyCollision.h"
+#include "Game/Physics/BodyStore.h"
+#include <algorithm>
+#include <cfloat>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// World space description of one body's shape, gathered once per pair
+struct BodyShape
+{
+	uint8_t		type = BODY_SHAPE_SPHERE;
+	Float3		center;
+	Float3		axes[3];
+	float		halfExtents[3] = { 0.f, 0.f, 0.f };
+	float		radius = 0.f;
+	Float3		segmentStart;	// Capsules only
+	Float3		segmentEnd;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const int MAX_CLIP_POINTS = 8;
+
+static const int	s_maxAdvanceIterations = 32;
+static const float	s_advanceTolerance = 1e-3f;		// Sweeps stop once they're this close to the surface
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static BodyShape GetBodyShape(const BodyStore& store, int index)
+{
+	BodyShape shape;
+	shape.type = store.GetShapeTypes()[index];
+	shape.center = store.GetFloat3(index, BODY_POSITION_X);
+	GetAxes(store.GetRotation(index), shape.axes[0], shape.axes[1], shape.axes[2]);
+
+	const Float3 halfExtents = store.GetFloat3(index, BODY_SHAPE_HALF_EXTENT_X);
+	shape.halfExtents[0] = halfExtents.x;
+	shape.halfExtents[1] = halfExtents.y;
+	shape.halfExtents[2] = halfExtents.z;
+	shape.radius = store.GetField(BODY_SHAPE_RADIUS)[index];
+
+	const float halfHeight = store.GetField(BODY_SHAPE_HALF_HEIGHT)[index];
+	shape.segmentStart = shape.center - shape.axes[1] * halfHeight;
+	shape.segmentEnd = shape.center + shape.axes[1] * halfHeight;
+
+	return shape;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static void AddContact(int indexA, int indexB, const Float3& position, const Float3& normal, float penetration, std::vector<BodyContact>& out_contacts)
+{
+	BodyContact contact;
+	contact.bodyA = indexA;
+	contact.bodyB = indexB;
+	contact.position = position;
+	contact.normal = normal;
+	contact.penetration = penetration;
+
+	out_contacts.push_back(contact);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static Float3 GetClosestPointOnSegment(const Float3& point, const Float3& start, const Float3& end)
+{
+	const Float3 segment = end - start;
+	const float lengthSquared = LengthSquared(segment);
+	if (lengthSquared < 1e-12f)
+	{
+		return start;
+	}
+
+	float t = Dot(point - start, segment) / lengthSquared;
+	t = (t < 0.f ? 0.f : (t > 1.f ? 1.f : t));
+
+	return start + segment * t;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Closest points between segments p1-q1 and p2-q2 (Ericson, Real-Time Collision Detection 5.1.9)
+static void GetClosestPointsBetweenSegments(const Float3& p1, const Float3& q1, const Float3& p2, const Float3& q2, Float3& out_c1, Float3& out_c2)
+{
+	const Float3 d1 = q1 - p1;
+	const Float3 d2 = q2 - p2;
+	const Float3 r = p1 - p2;
+	const float a = Dot(d1, d1);
+	const float e = Dot(d2, d2);
+	const float f = Dot(d2, r);
+
+	float s = 0.f;
+	float t = 0.f;
+
+	if (a <= 1e-12f && e <= 1e-12f)
+	{
+		out_c1 = p1;
+		out_c2 = p2;
+		return;
+	}
+
+	if (a <= 1e-12f)
+	{
+		t = f / e;
+	}
+	else
+	{
+		const float c = Dot(d1, r);
+		if (e <= 1e-12f)
+		{
+			s = -c / a;
+		}
+		else
+		{
+			const float b = Dot(d1, d2);
+			const float denom = a * e - b * b;
+			s = (denom != 0.f ? (b * f - c * e) / denom : 0.f);
+			s = (s < 0.f ? 0.f : (s > 1.f ? 1.f : s));
+			t = (b * s + f) / e;
+
+			if (t < 0.f)
+			{
+				t = 0.f;
+				s = -c / a;
+			}
+			else if (t > 1.f)
+			{
+				t = 1.f;
+				s = (b - c) / a;
+			}
+		}
+	}
+
+	s = (s < 0.f ? 0.f : (s > 1.f ? 1.f : s));
+	t = (t < 0.f ? 0.f : (t > 1.f ? 1.f : t));
+
+	out_c1 = p1 + d1 * s;
+	out_c2 = p2 + d2 * t;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static float ProjectBoxOntoAxis(const BodyShape& box, const Float3& axis)
+{
+	return box.halfExtents[0] * fabsf(Dot(box.axes[0], axis))
+		+ box.halfExtents[1] * fabsf(Dot(box.axes[1], axis))
+		+ box.halfExtents[2] * fabsf(Dot(box.axes[2], axis));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static Float3 ClampPointToBox(const BodyShape& box, const Float3& point)
+{
+	const Float3 offset = point - box.center;
+	Float3 result = box.center;
+
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		float distance = Dot(offset, box.axes[axisIndex]);
+		const float extent = box.halfExtents[axisIndex];
+		distance = (distance < -extent ? -extent : (distance > extent ? extent : distance));
+		result += box.axes[axisIndex] * distance;
+	}
+
+	return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Distance from the point to the surface of the shape, 0 for points inside it
+static float GetDistanceToShape(const BodyShape& shape, const Float3& point)
+{
+	switch (shape.type)
+	{
+	case BODY_SHAPE_BOX:		return Length(point - ClampPointToBox(shape, point));
+	case BODY_SHAPE_CAPSULE:	return std::max(Length(point - GetClosestPointOnSegment(point, shape.segmentStart, shape.segmentEnd)) - shape.radius, 0.f);
+	case BODY_SHAPE_SPHERE:
+	default:
+		return std::max(Length(point - shape.center) - shape.radius, 0.f);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Normal points from sphere B to sphere A
+static int CollideSpheres(int indexA, const Float3& centerA, float radiusA, int indexB, const Float3& centerB, float radiusB, std::vector<BodyContact>& out_contacts)
+{
+	const Float3 displacement = centerA - centerB;
+	const float distanceSquared = LengthSquared(displacement);
+	const float radiusSum = radiusA + radiusB;
+
+	if (distanceSquared >= radiusSum * radiusSum)
+	{
+		return 0;
+	}
+
+	const float distance = sqrtf(distanceSquared);
+	const Float3 normal = (distance > 1e-6f ? displacement * (1.f / distance) : Float3(0.f, 1.f, 0.f));
+	const float penetration = radiusSum - distance;
+	const Float3 position = centerB + normal * (radiusB - 0.5f * penetration);
+
+	AddContact(indexA, indexB, position, normal, penetration, out_contacts);
+	return 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Sphere is A, box is B
+static int CollideSphereBox(int indexA, const Float3& center, float radius, int indexB, const BodyShape& box, std::vector<BodyContact>& out_contacts)
+{
+	const Float3 closest = ClampPointToBox(box, center);
+	const Float3 displacement = center - closest;
+	const float distanceSquared = LengthSquared(displacement);
+
+	if (distanceSquared > radius * radius)
+	{
+		return 0;
+	}
+
+	if (distanceSquared > 1e-12f)
+	{
+		const float distance = sqrtf(distanceSquared);
+		AddContact(indexA, indexB, closest, displacement * (1.f / distance), radius - distance, out_contacts);
+		return 1;
+	}
+
+	// Center is inside the box, push out through the nearest face
+	const Float3 offset = center - box.center;
+	int bestAxis = 0;
+	float bestDepth = FLT_MAX;
+	float bestSign = 1.f;
+
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		const float distance = Dot(offset, box.axes[axisIndex]);
+		const float depth = box.halfExtents[axisIndex] - fabsf(distance);
+
+		if (depth < bestDepth)
+		{
+			bestDepth = depth;
+			bestAxis = axisIndex;
+			bestSign = (distance < 0.f ? -1.f : 1.f);
+		}
+	}
+
+	AddContact(indexA, indexB, center, box.axes[bestAxis] * bestSign, radius + bestDepth, out_contacts);
+	return 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static int CollideSphereCapsule(int indexA, const BodyShape& sphere, int indexB, const BodyShape& capsule, std::vector<BodyContact>& out_contacts)
+{
+	const Float3 closest = GetClosestPointOnSegment(sphere.center, capsule.segmentStart, capsule.segmentEnd);
+	return CollideSpheres(indexA, sphere.center, sphere.radius, indexB, closest, capsule.radius, out_contacts);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Capsules lying side by side need two contacts to rest without rocking, so parallel segments test their end points
+static int CollideCapsules(int indexA, const BodyShape& capsuleA, int indexB, const BodyShape& capsuleB, std::vector<BodyContact>& out_contacts)
+{
+	const Float3 directionA = SafeNormalize(capsuleA.segmentEnd - capsuleA.segmentStart, capsuleA.axes[1]);
+	const Float3 directionB = SafeNormalize(capsuleB.segmentEnd - capsuleB.segmentStart, capsuleB.axes[1]);
+
+	if (fabsf(Dot(directionA, directionB)) < 0.95f)
+	{
+		Float3 closestA, closestB;
+		GetClosestPointsBetweenSegments(capsuleA.segmentStart, capsuleA.segmentEnd, capsuleB.segmentStart, capsuleB.segmentEnd, closestA, closestB);
+		return CollideSpheres(indexA, closestA, capsuleA.radius, indexB, closestB, capsuleB.radius, out_contacts);
+	}
+
+	int contactCount = 0;
+	const Float3 endPointsA[2] = { capsuleA.segmentStart, capsuleA.segmentEnd };
+	const Float3 endPointsB[2] = { capsuleB.segmentStart, capsuleB.segmentEnd };
+
+	for (int endIndex = 0; endIndex < 2; ++endIndex)
+	{
+		const Float3 closestOnB = GetClosestPointOnSegment(endPointsA[endIndex], capsuleB.segmentStart, capsuleB.segmentEnd);
+		contactCount += CollideSpheres(indexA, endPointsA[endIndex], capsuleA.radius, indexB, closestOnB, capsuleB.radius, out_contacts);
+
+		const Float3 closestOnA = GetClosestPointOnSegment(endPointsB[endIndex], capsuleA.segmentStart, capsuleA.segmentEnd);
+		contactCount += CollideSpheres(indexA, closestOnA, capsuleA.radius, indexB, endPointsB[endIndex], capsuleB.radius, out_contacts);
+	}
+
+	return contactCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Box is A, capsule is B. Tests the two caps plus the point on the segment nearest the box, as spheres
+static int CollideBoxCapsule(int indexA, const BodyShape& box, int indexB, const BodyShape& capsule, std::vector<BodyContact>& out_contacts)
+{
+	// Alternate projections converge on the closest point between a segment and a convex box
+	Float3 segmentPoint = GetClosestPointOnSegment(box.center, capsule.segmentStart, capsule.segmentEnd);
+	for (int iteration = 0; iteration < 3; ++iteration)
+	{
+		segmentPoint = GetClosestPointOnSegment(ClampPointToBox(box, segmentPoint), capsule.segmentStart, capsule.segmentEnd);
+	}
+
+	const Float3 testPoints[3] = { capsule.segmentStart, capsule.segmentEnd, segmentPoint };
+	const int testCount = (LengthSquared(segmentPoint - capsule.segmentStart) < 1e-4f || LengthSquared(segmentPoint - capsule.segmentEnd) < 1e-4f ? 2 : 3);
+
+	int contactCount = 0;
+	for (int testIndex = 0; testIndex < testCount; ++testIndex)
+	{
+		// Sphere-box gives a normal pointing from the box to the capsule, we want capsule to box
+		const size_t firstNew = out_contacts.size();
+		const int added = CollideSphereBox(indexB, testPoints[testIndex], capsule.radius, indexA, box, out_contacts);
+
+		for (size_t contactIndex = firstNew; contactIndex < out_contacts.size(); ++contactIndex)
+		{
+			BodyContact& contact = out_contacts[contactIndex];
+			contact.bodyA = indexA;
+			contact.bodyB = indexB;
+			contact.normal = -contact.normal;
+		}
+
+		contactCount += added;
+	}
+
+	return contactCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Sutherland-Hodgman against the plane Dot(axis, p) <= limit
+static int ClipPolygon(const Float3* points, int pointCount, const Float3& axis, float limit, Float3* out_points)
+{
+	int outCount = 0;
+
+	for (int pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+	{
+		const Float3& current = points[pointIndex];
+		const Float3& next = points[(pointIndex + 1) % pointCount];
+		const float currentDistance = Dot(axis, current) - limit;
+		const float nextDistance = Dot(axis, next) - limit;
+
+		if (currentDistance <= 0.f && outCount < MAX_CLIP_POINTS)
+		{
+			out_points[outCount++] = current;
+		}
+
+		if ((currentDistance < 0.f) != (nextDistance < 0.f) && outCount < MAX_CLIP_POINTS)
+		{
+			const float t = currentDistance / (currentDistance - nextDistance);
+			out_points[outCount++] = current + (next - current) * t;
+		}
+	}
+
+	return outCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Clips the incident box's most opposing face against the reference face, keeping points below it
+// referenceNormal points out of the reference box towards the incident box
+static int GenerateFaceContacts(const BodyShape& reference, int referenceAxis, const Float3& referenceNormal, const BodyShape& incident, int indexA, int indexB, const Float3& contactNormal, std::vector<BodyContact>& out_contacts)
+{
+	// Incident face is the one whose normal is most anti-parallel to the reference normal
+	int incidentAxis = 0;
+	float maxAlignment = -1.f;
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		const float alignment = fabsf(Dot(incident.axes[axisIndex], referenceNormal));
+		if (alignment > maxAlignment)
+		{
+			maxAlignment = alignment;
+			incidentAxis = axisIndex;
+		}
+	}
+
+	const float incidentSign = (Dot(incident.axes[incidentAxis], referenceNormal) > 0.f ? -1.f : 1.f);
+	const Float3 incidentFaceCenter = incident.center + incident.axes[incidentAxis] * (incidentSign * incident.halfExtents[incidentAxis]);
+	const int u = (incidentAxis + 1) % 3;
+	const int v = (incidentAxis + 2) % 3;
+	const Float3 uOffset = incident.axes[u] * incident.halfExtents[u];
+	const Float3 vOffset = incident.axes[v] * incident.halfExtents[v];
+
+	Float3 bufferA[MAX_CLIP_POINTS];
+	Float3 bufferB[MAX_CLIP_POINTS];
+	bufferA[0] = incidentFaceCenter + uOffset + vOffset;
+	bufferA[1] = incidentFaceCenter - uOffset + vOffset;
+	bufferA[2] = incidentFaceCenter - uOffset - vOffset;
+	bufferA[3] = incidentFaceCenter + uOffset - vOffset;
+	int pointCount = 4;
+
+	// Clip against the four side planes of the reference face
+	for (int sideIndex = 1; sideIndex <= 2 && pointCount > 0; ++sideIndex)
+	{
+		const int sideAxis = (referenceAxis + sideIndex) % 3;
+		const Float3& axis = reference.axes[sideAxis];
+		const float centerDistance = Dot(axis, reference.center);
+		const float extent = reference.halfExtents[sideAxis];
+
+		pointCount = ClipPolygon(bufferA, pointCount, axis, centerDistance + extent, bufferB);
+		pointCount = ClipPolygon(bufferB, pointCount, -axis, -centerDistance + extent, bufferA);
+	}
+
+	const float referenceFaceDistance = Dot(referenceNormal, reference.center) + reference.halfExtents[referenceAxis];
+
+	int contactCount = 0;
+	for (int pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+	{
+		const float separation = Dot(referenceNormal, bufferA[pointIndex]) - referenceFaceDistance;
+		if (separation <= 0.f)
+		{
+			const Float3 position = bufferA[pointIndex] - referenceNormal * (0.5f * separation);
+			AddContact(indexA, indexB, position, contactNormal, -separation, out_contacts);
+			contactCount++;
+		}
+	}
+
+	return contactCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Separating axis test over the 15 candidate axes, then face clipping or a single edge-edge contact
+static int CollideBoxes(int indexA, const BodyShape& boxA, int indexB, const BodyShape& boxB, std::vector<BodyContact>& out_contacts)
+{
+	const Float3 displacement = boxB.center - boxA.center;
+
+	float bestScore = FLT_MAX;
+	float bestOverlap = 0.f;
+	int bestAxis = -1;
+	Float3 bestAxisAToB;
+
+	for (int axisIndex = 0; axisIndex < 15; ++axisIndex)
+	{
+		Float3 axis;
+		if (axisIndex < 3)
+		{
+			axis = boxA.axes[axisIndex];
+		}
+		else if (axisIndex < 6)
+		{
+			axis = boxB.axes[axisIndex - 3];
+		}
+		else
+		{
+			axis = Cross(boxA.axes[(axisIndex - 6) / 3], boxB.axes[(axisIndex - 6) % 3]);
+			const float lengthSquared = LengthSquared(axis);
+
+			// Parallel edges, already covered by the face axes
+			if (lengthSquared < 1e-6f)
+			{
+				continue;
+			}
+
+			axis = axis * (1.f / sqrtf(lengthSquared));
+		}
+
+		const float distance = Dot(displacement, axis);
+		const float overlap = ProjectBoxOntoAxis(boxA, axis) + ProjectBoxOntoAxis(boxB, axis) - fabsf(distance);
+
+		if (overlap < 0.f)
+		{
+			return 0;
+		}
+
+		// Favor face contacts, they are far more stable for resting boxes
+		const float score = (axisIndex < 6 ? overlap : 1.05f * overlap + 0.001f);
+		if (score < bestScore)
+		{
+			bestScore = score;
+			bestOverlap = overlap;
+			bestAxis = axisIndex;
+			bestAxisAToB = (distance < 0.f ? -axis : axis);
+		}
+	}
+
+	const Float3 contactNormal = -bestAxisAToB;
+
+	if (bestAxis < 3)
+	{
+		return GenerateFaceContacts(boxA, bestAxis, bestAxisAToB, boxB, indexA, indexB, contactNormal, out_contacts);
+	}
+
+	if (bestAxis < 6)
+	{
+		return GenerateFaceContacts(boxB, bestAxis - 3, -bestAxisAToB, boxA, indexA, indexB, contactNormal, out_contacts);
+	}
+
+	// Edge-edge, find the edge on each box that sits furthest along the axis towards the other box
+	const int edgeAxisA = (bestAxis - 6) / 3;
+	const int edgeAxisB = (bestAxis - 6) % 3;
+
+	Float3 edgeCenterA = boxA.center;
+	Float3 edgeCenterB = boxB.center;
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		if (axisIndex != edgeAxisA)
+		{
+			const float sign = (Dot(boxA.axes[axisIndex], bestAxisAToB) > 0.f ? 1.f : -1.f);
+			edgeCenterA += boxA.axes[axisIndex] * (sign * boxA.halfExtents[axisIndex]);
+		}
+
+		if (axisIndex != edgeAxisB)
+		{
+			const float sign = (Dot(boxB.axes[axisIndex], bestAxisAToB) > 0.f ? -1.f : 1.f);
+			edgeCenterB += boxB.axes[axisIndex] * (sign * boxB.halfExtents[axisIndex]);
+		}
+	}
+
+	const Float3 edgeOffsetA = boxA.axes[edgeAxisA] * boxA.halfExtents[edgeAxisA];
+	const Float3 edgeOffsetB = boxB.axes[edgeAxisB] * boxB.halfExtents[edgeAxisB];
+
+	Float3 closestA, closestB;
+	GetClosestPointsBetweenSegments(edgeCenterA - edgeOffsetA, edgeCenterA + edgeOffsetA, edgeCenterB - edgeOffsetB, edgeCenterB + edgeOffsetB, closestA, closestB);
+
+	AddContact(indexA, indexB, (closestA + closestB) * 0.5f, contactNormal, bestOverlap, out_contacts);
+	return 1;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Flips contacts generated with the bodies swapped, so bodyA/bodyB and the normal match the caller's order
+static void SwapContactBodies(std::vector<BodyContact>& contacts, size_t firstContact)
+{
+	for (size_t contactIndex = firstContact; contactIndex < contacts.size(); ++contactIndex)
+	{
+		BodyContact& contact = contacts[contactIndex];
+		const int temp = contact.bodyA;
+		contact.bodyA = contact.bodyB;
+		contact.bodyB = temp;
+		contact.normal = -contact.normal;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns the number of contacts added
+int CollideBodies(const BodyStore& store, int indexA, int indexB, std::vector<BodyContact>& out_contacts)
+{
+	const uint8_t* shapeTypes = store.GetShapeTypes();
+
+	// Order so the first shape has the lower type, halving the number of cases
+	const bool swapped = (shapeTypes[indexA] > shapeTypes[indexB]);
+	const int first = (swapped ? indexB : indexA);
+	const int second = (swapped ? indexA : indexB);
+
+	const BodyShape shapeA = GetBodyShape(store, first);
+	const BodyShape shapeB = GetBodyShape(store, second);
+	const size_t firstContact = out_contacts.size();
+
+	int contactCount = 0;
+	switch (shapeA.type)
+	{
+	case BODY_SHAPE_SPHERE:
+		switch (shapeB.type)
+		{
+		case BODY_SHAPE_SPHERE:		contactCount = CollideSpheres(first, shapeA.center, shapeA.radius, second, shapeB.center, shapeB.radius, out_contacts); break;
+		case BODY_SHAPE_BOX:		contactCount = CollideSphereBox(first, shapeA.center, shapeA.radius, second, shapeB, out_contacts); break;
+		case BODY_SHAPE_CAPSULE:	contactCount = CollideSphereCapsule(first, shapeA, second, shapeB, out_contacts); break;
+		default:
+			break;
+		}
+		break;
+	case BODY_SHAPE_BOX:
+		switch (shapeB.type)
+		{
+		case BODY_SHAPE_BOX:		contactCount = CollideBoxes(first, shapeA, second, shapeB, out_contacts); break;
+		case BODY_SHAPE_CAPSULE:	contactCount = CollideBoxCapsule(first, shapeA, second, shapeB, out_contacts); break;
+		default:
+			break;
+		}
+		break;
+	case BODY_SHAPE_CAPSULE:
+		contactCount = CollideCapsules(first, shapeA, second, shapeB, out_contacts);
+		break;
+	default:
+		break;
+	}
+
+	if (swapped)
+	{
+		SwapContactBodies(out_contacts, firstContact);
+	}
+
+	return contactCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns the number of contacts added, the plane is always body B (-1)
+int CollideBodyWithPlane(const BodyStore& store, int index, const BodyPlane& plane, std::vector<BodyContact>& out_contacts)
+{
+	const BodyShape shape = GetBodyShape(store, index);
+	int contactCount = 0;
+
+	switch (shape.type)
+	{
+	case BODY_SHAPE_SPHERE:
+	{
+		const float distance = Dot(plane.normal, shape.center) - plane.distance;
+		if (distance < shape.radius)
+		{
+			const float penetration = shape.radius - distance;
+			AddContact(index, -1, shape.center - plane.normal * (shape.radius - 0.5f * penetration), plane.normal, penetration, out_contacts);
+			contactCount++;
+		}
+		break;
+	}
+	case BODY_SHAPE_CAPSULE:
+	{
+		const Float3 endPoints[2] = { shape.segmentStart, shape.segmentEnd };
+		for (int endIndex = 0; endIndex < 2; ++endIndex)
+		{
+			const float distance = Dot(plane.normal, endPoints[endIndex]) - plane.distance;
+			if (distance < shape.radius)
+			{
+				const float penetration = shape.radius - distance;
+				AddContact(index, -1, endPoints[endIndex] - plane.normal * (shape.radius - 0.5f * penetration), plane.normal, penetration, out_contacts);
+				contactCount++;
+			}
+		}
+		break;
+	}
+	case BODY_SHAPE_BOX:
+	{
+		for (int cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+		{
+			const float signX = ((cornerIndex & 1) != 0 ? 1.f : -1.f);
+			const float signY = ((cornerIndex & 2) != 0 ? 1.f : -1.f);
+			const float signZ = ((cornerIndex & 4) != 0 ? 1.f : -1.f);
+			const Float3 corner = shape.center
+				+ shape.axes[0] * (signX * shape.halfExtents[0])
+				+ shape.axes[1] * (signY * shape.halfExtents[1])
+				+ shape.axes[2] * (signZ * shape.halfExtents[2]);
+
+			const float distance = Dot(plane.normal, corner) - plane.distance;
+			if (distance < 0.f)
+			{
+				AddContact(index, -1, corner - plane.normal * (0.5f * distance), plane.normal, -distance, out_contacts);
+				contactCount++;
+			}
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	return contactCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Radius of the largest sphere around the body's position that fits inside its shape
+float GetBodyCoreRadius(const BodyStore& store, int index)
+{
+	switch (store.GetShapeTypes()[index])
+	{
+	case BODY_SHAPE_BOX:
+	{
+		const Float3 halfExtents = store.GetFloat3(index, BODY_SHAPE_HALF_EXTENT_X);
+		return std::min(halfExtents.x, std::min(halfExtents.y, halfExtents.z));
+	}
+	case BODY_SHAPE_CAPSULE:
+	case BODY_SHAPE_SPHERE:
+	default:
+		return store.GetField(BODY_SHAPE_RADIUS)[index];
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Conservative advancement of a sphere moving from start by displacement, against the body where it is now.
+// Distance to a shape changes no faster than the sphere moves, so stepping by distance / speed can never pass
+// through the surface. Spheres that start out touching the body are left to narrowphase and never hit.
+// Returns whether it hit, and the fraction of the displacement it got through before it did
+bool SweepSphereAgainstBody(const BodyStore& store, int index, const Float3& start, const Float3& displacement, float radius, float& out_fraction)
+{
+	const float length = Length(displacement);
+	if (length < 1e-6f)
+	{
+		return false;
+	}
+
+	const BodyShape shape = GetBodyShape(store, index);
+	float distance = GetDistanceToShape(shape, start) - radius;
+	if (distance <= 0.f)
+	{
+		return false;
+	}
+
+	float fraction = 0.f;
+	for (int iteration = 0; iteration < s_maxAdvanceIterations && distance > s_advanceTolerance; ++iteration)
+	{
+		fraction += distance / length;
+		if (fraction > 1.f)
+		{
+			return false;
+		}
+
+		distance = GetDistanceToShape(shape, start + displacement * fraction) - radius;
+	}
+
+	// Out of iterations means a grazing sweep; stopping early there is safe, it carries on next step
+	out_fraction = fraction;
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Same as SweepSphereAgainstBody, solved directly
+bool SweepSphereAgainstPlane(const BodyPlane& plane, const Float3& start, const Float3& displacement, float radius, float& out_fraction)
+{
+	const float distance = Dot(plane.normal, start) - plane.distance - radius;
+	const float closingDistance = -Dot(plane.normal, displacement);
+
+	if (distance <= 0.f || closingDistance <= distance)
+	{
+		return false;
+	}
+
+	out_fraction = distance / closingDistance;
+	return true;
+}
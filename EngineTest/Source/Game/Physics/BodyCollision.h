@@ -0,0 +1,81 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Narrowphase contact generation between bodies in a BodyStore and static planes
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/PhysicsMath.h"
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodyStore;
+
+// Static half space, everything with Dot(normal, point) < distance is inside
+struct BodyPlane
+{
+	Float3	normal = Float3(0.f, 1.f, 0.f);
+	float	distance = 0.f;
+};
+
+// Two dense body indices that the broadphase thinks may be touching, bodyA < bodyB
+struct BodyPair
+{
+	int bodyA = -1;
+	int bodyB = -1;
+};
+
+struct BodyContact
+{
+	int		bodyA = -1;
+	int		bodyB = -1;			// -1 for static geometry
+	Float3	position;
+	Float3	normal;				// Points from B towards A
+	float	penetration = 0.f;
+
+	// Set by the contact cache; the impulses below start out as its warm start values
+	int		cacheIndex = -1;
+	Float3	frictionImpulse;	// World space, projected onto the tangents by the solver
+
+	// Filled in by the solver
+	Float3	rA;
+	Float3	rB;
+	Float3	tangent0;
+	Float3	tangent1;
+	float	normalMass = 0.f;
+	float	tangentMass0 = 0.f;
+	float	tangentMass1 = 0.f;
+	float	velocityBias = 0.f;
+	float	normalImpulse = 0.f;
+	float	tangentImpulse0 = 0.f;
+	float	tangentImpulse1 = 0.f;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+int CollideBodies(const BodyStore& store, int indexA, int indexB, std::vector<BodyContact>& out_contacts);
+int CollideBodyWithPlane(const BodyStore& store, int index, const BodyPlane& plane, std::vector<BodyContact>& out_contacts);
+
+// Time of impact sweeps, for continuous bodies
+float	GetBodyCoreRadius(const BodyStore& store, int index);
+bool	SweepSphereAgainstBody(const BodyStore& store, int index, const Float3& start, const Float3& displacement, float radius, float& out_fraction);
+bool	SweepSphereAgainstPlane(const BodyPlane& plane, const Float3& start, const Float3& displacement, float radius, float& out_fraction);
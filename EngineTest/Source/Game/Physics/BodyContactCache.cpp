@@ -0,0 +1,448 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyContactCache.h"
+#include "Game/Physics/BodySnapshot.h"
+#include "Game/Physics/BodyStore.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const uint32_t	s_planeKeyBit = 0x80000000u;
+static const float		s_minMatchNormalDot = 0.9f;		// Old and new contacts facing further apart than this are different features
+static const int		s_maxMatchedContacts = 32;		// Contacts past this in a manifold are never matched, only fits a bit mask
+static const size_t		s_snapshotManifoldSize = sizeof(uint64_t) + 2 * sizeof(uint32_t) + sizeof(Float3) + sizeof(FloatQuat) + 2 * sizeof(int);
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+static uint8_t* PackValue(const T& value, uint8_t* out_bytes)
+{
+	memcpy(out_bytes, &value, sizeof(T));
+	return out_bytes + sizeof(T);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+static const uint8_t* UnpackValue(const uint8_t* bytes, T& out_value)
+{
+	memcpy(&out_value, bytes, sizeof(T));
+	return bytes + sizeof(T);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static FloatQuat GetConjugate(const FloatQuat& q)
+{
+	return FloatQuat(q.w, -q.x, -q.y, -q.z);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// B in A's space, or A in world space when there is no B
+static void GetRelativeTransform(const BodyStore& store, int indexA, int indexB, Float3& out_position, FloatQuat& out_rotation)
+{
+	const Float3 positionA = store.GetFloat3(indexA, BODY_POSITION_X);
+	const FloatQuat rotationA = store.GetRotation(indexA);
+
+	if (indexB < 0)
+	{
+		out_position = positionA;
+		out_rotation = rotationA;
+		return;
+	}
+
+	out_position = InverseRotate(rotationA, store.GetFloat3(indexB, BODY_POSITION_X) - positionA);
+	out_rotation = Multiply(GetConjugate(rotationA), store.GetRotation(indexB));
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Last step's manifolds become the ones to match against; anything not carried forward this step is gone after it
+void BodyContactCache::BeginStep()
+{
+	std::swap(m_manifolds, m_previousManifolds);
+	std::swap(m_contacts, m_previousContacts);
+	m_manifolds.clear();
+	m_contacts.clear();
+
+	BuildPreviousLookup();
+
+	m_reusedManifoldCount = 0;
+	m_warmStartedContactCount = 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyContactCache::Clear()
+{
+	m_manifolds.clear();
+	m_contacts.clear();
+	m_previousManifolds.clear();
+	m_previousContacts.clear();
+	m_previousLookup.clear();
+	m_lookupMask = 0;
+	m_lookupShift = 64;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns the number of contacts added, like ::CollideBodies
+int BodyContactCache::CollideBodies(const BodyStore& store, int indexA, int indexB, const BodyContactCacheSettings& settings, std::vector<BodyContact>& out_contacts)
+{
+	if (!settings.isEnabled)
+	{
+		return ::CollideBodies(store, indexA, indexB, out_contacts);
+	}
+
+	const BodyHandle handleA = store.GetHandle(indexA);
+	const BodyHandle handleB = store.GetHandle(indexB);
+	const int firstContact = (int)out_contacts.size();
+
+	BodyContactManifold manifold;
+	manifold.key = ((uint64_t)handleA.slot << 32) | handleB.slot;
+	manifold.generationA = handleA.generation;
+	manifold.generationB = handleB.generation;
+	GetRelativeTransform(store, indexA, indexB, manifold.relativePosition, manifold.relativeRotation);
+
+	const BodyContactManifold* previous = FindPreviousManifold(manifold.key, manifold.generationA, manifold.generationB);
+	if (previous == nullptr || !TryReuseManifold(store, *previous, indexA, indexB, manifold.relativePosition, manifold.relativeRotation, settings, out_contacts))
+	{
+		::CollideBodies(store, indexA, indexB, out_contacts);
+		AddManifold(store, previous, manifold, indexA, indexB, settings, out_contacts, firstContact);
+	}
+
+	return (int)out_contacts.size() - firstContact;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns the number of contacts added, like ::CollideBodyWithPlane
+int BodyContactCache::CollideBodyWithPlane(const BodyStore& store, int index, const BodyPlane& plane, int planeIndex, const BodyContactCacheSettings& settings, std::vector<BodyContact>& out_contacts)
+{
+	if (!settings.isEnabled)
+	{
+		return ::CollideBodyWithPlane(store, index, plane, out_contacts);
+	}
+
+	const BodyHandle handle = store.GetHandle(index);
+	const int firstContact = (int)out_contacts.size();
+
+	BodyContactManifold manifold;
+	manifold.key = ((uint64_t)handle.slot << 32) | (s_planeKeyBit | (uint32_t)planeIndex);
+	manifold.generationA = handle.generation;
+	GetRelativeTransform(store, index, -1, manifold.relativePosition, manifold.relativeRotation);
+
+	const BodyContactManifold* previous = FindPreviousManifold(manifold.key, manifold.generationA, manifold.generationB);
+	if (previous == nullptr || !TryReuseManifold(store, *previous, index, -1, manifold.relativePosition, manifold.relativeRotation, settings, out_contacts))
+	{
+		::CollideBodyWithPlane(store, index, plane, out_contacts);
+		AddManifold(store, previous, manifold, index, -1, settings, out_contacts, firstContact);
+	}
+
+	return (int)out_contacts.size() - firstContact;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Reads back what the solver accumulated, for next step's warm start
+void BodyContactCache::StoreImpulses(const std::vector<BodyContact>& contacts)
+{
+	for (const BodyContact& contact : contacts)
+	{
+		if (contact.cacheIndex < 0 || contact.cacheIndex >= (int)m_contacts.size())
+		{
+			continue;
+		}
+
+		CachedBodyContact& cachedContact = m_contacts[contact.cacheIndex];
+		cachedContact.normalImpulse = contact.normalImpulse;
+		cachedContact.frictionImpulse = contact.tangent0 * contact.tangentImpulse0 + contact.tangent1 * contact.tangentImpulse1;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Manifolds have padding, so they're written a member at a time; cached contacts are all floats
+void BodyContactCache::WriteSnapshot(BodySnapshotWriter& writer) const
+{
+	writer.WriteValue((uint32_t)m_manifolds.size());
+
+	// Packed in place rather than a write per member, there can be thousands of these
+	uint8_t* cursor = writer.AppendBytes(m_manifolds.size() * s_snapshotManifoldSize);
+	for (const BodyContactManifold& manifold : m_manifolds)
+	{
+		cursor = PackValue(manifold.key, cursor);
+		cursor = PackValue(manifold.generationA, cursor);
+		cursor = PackValue(manifold.generationB, cursor);
+		cursor = PackValue(manifold.relativePosition, cursor);
+		cursor = PackValue(manifold.relativeRotation, cursor);
+		cursor = PackValue(manifold.firstContact, cursor);
+		cursor = PackValue(manifold.contactCount, cursor);
+	}
+
+	writer.WriteArray(m_contacts);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Only what the next BeginStep reads is restored. The previous step's leftovers and the lookup are rebuilt
+// from it there, so they're left alone
+bool BodyContactCache::ReadSnapshot(BodySnapshotReader& reader)
+{
+	uint32_t manifoldCount = 0;
+	reader.ReadValue(manifoldCount);
+	const uint8_t* cursor = reader.SkipBytes(reader.IsValid() ? manifoldCount * s_snapshotManifoldSize : 0);
+	m_manifolds.resize(cursor != nullptr ? manifoldCount : 0);
+
+	for (BodyContactManifold& manifold : m_manifolds)
+	{
+		cursor = UnpackValue(cursor, manifold.key);
+		cursor = UnpackValue(cursor, manifold.generationA);
+		cursor = UnpackValue(cursor, manifold.generationB);
+		cursor = UnpackValue(cursor, manifold.relativePosition);
+		cursor = UnpackValue(cursor, manifold.relativeRotation);
+		cursor = UnpackValue(cursor, manifold.firstContact);
+		cursor = UnpackValue(cursor, manifold.contactCount);
+	}
+
+	reader.ReadArray(m_contacts);
+
+	bool isValid = (reader.IsValid() && m_manifolds.size() == manifoldCount);
+	for (int manifoldIndex = 0; isValid && manifoldIndex < (int)m_manifolds.size(); ++manifoldIndex)
+	{
+		const BodyContactManifold& manifold = m_manifolds[manifoldIndex];
+		isValid = (manifold.firstContact >= 0 && manifold.contactCount >= 0 && manifold.firstContact + manifold.contactCount <= (int)m_contacts.size());
+	}
+
+	if (!isValid)
+	{
+		Clear();
+	}
+
+	m_reusedManifoldCount = 0;
+	m_warmStartedContactCount = 0;
+
+	return isValid;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Kept at most half full, growing by powers of two. A key already in (a pair collided twice in one step)
+// points at its latest manifold, as the later one is what was kept
+void BodyContactCache::BuildPreviousLookup()
+{
+	const int manifoldCount = (int)m_previousManifolds.size();
+
+	int capacity = std::max((int)m_previousLookup.size(), 16);
+	while (capacity < 2 * manifoldCount)
+	{
+		capacity *= 2;
+	}
+
+	if (capacity != (int)m_previousLookup.size())
+	{
+		m_previousLookup.resize(capacity);
+		m_lookupMask = (uint32_t)(capacity - 1);
+		m_lookupShift = 64;
+		for (int bits = capacity; bits > 1; bits >>= 1)
+		{
+			m_lookupShift--;
+		}
+	}
+
+	std::fill(m_previousLookup.begin(), m_previousLookup.end(), LookupSlot());
+
+	for (int manifoldIndex = 0; manifoldIndex < manifoldCount; ++manifoldIndex)
+	{
+		const uint64_t key = m_previousManifolds[manifoldIndex].key;
+
+		for (uint32_t slotIndex = GetLookupHomeSlot(key);; slotIndex = ((slotIndex + 1) & m_lookupMask))
+		{
+			LookupSlot& slot = m_previousLookup[slotIndex];
+
+			if (slot.index < 0 || slot.key == key)
+			{
+				slot.key = key;
+				slot.index = manifoldIndex;
+				break;
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The table is never full, so an empty slot always ends the probe
+const BodyContactManifold* BodyContactCache::FindPreviousManifold(uint64_t key, uint32_t generationA, uint32_t generationB) const
+{
+	if (m_previousLookup.empty())
+	{
+		return nullptr;
+	}
+
+	for (uint32_t slotIndex = GetLookupHomeSlot(key);; slotIndex = ((slotIndex + 1) & m_lookupMask))
+	{
+		const LookupSlot& slot = m_previousLookup[slotIndex];
+
+		if (slot.index < 0)
+		{
+			return nullptr;
+		}
+
+		if (slot.key == key)
+		{
+			const BodyContactManifold& manifold = m_previousManifolds[slot.index];
+			return (manifold.generationA == generationA && manifold.generationB == generationB ? &manifold : nullptr);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Moves the old contacts along with the bodies and re-measures their penetration, if the pair is close enough to where
+// it was when they were generated. The manifold keeps that original transform, so small moves can't add up unnoticed.
+// Contacts that have come apart aren't handed out, but are kept in case they close again
+bool BodyContactCache::TryReuseManifold(const BodyStore& store, const BodyContactManifold& previous, int indexA, int indexB, const Float3& relativePosition, const FloatQuat& relativeRotation, const BodyContactCacheSettings& settings, std::vector<BodyContact>& out_contacts)
+{
+	const float rotationDot = fabsf(previous.relativeRotation.w * relativeRotation.w + previous.relativeRotation.x * relativeRotation.x
+		+ previous.relativeRotation.y * relativeRotation.y + previous.relativeRotation.z * relativeRotation.z);
+
+	if (LengthSquared(relativePosition - previous.relativePosition) > settings.reuseDistance * settings.reuseDistance || rotationDot < cosf(0.5f * settings.reuseRadians))
+	{
+		return false;
+	}
+
+	const Float3 positionA = store.GetFloat3(indexA, BODY_POSITION_X);
+	const FloatQuat rotationA = store.GetRotation(indexA);
+	const Float3 positionB = (indexB >= 0 ? store.GetFloat3(indexB, BODY_POSITION_X) : Float3());
+	const FloatQuat rotationB = (indexB >= 0 ? store.GetRotation(indexB) : FloatQuat());
+
+	BodyContactManifold manifold = previous;
+	manifold.firstContact = (int)m_contacts.size();
+
+	for (int contactOffset = 0; contactOffset < previous.contactCount; ++contactOffset)
+	{
+		CachedBodyContact cachedContact = m_previousContacts[previous.firstContact + contactOffset];
+
+		const Float3 pointA = positionA + Rotate(rotationA, cachedContact.localPointA);
+		const Float3 pointB = positionB + Rotate(rotationB, cachedContact.localPointB);
+		const Float3 normal = Rotate(rotationB, cachedContact.localNormal);
+		const float penetration = Dot(pointB - pointA, normal);
+
+		if (penetration < 0.f)
+		{
+			cachedContact.normalImpulse = 0.f;
+			cachedContact.frictionImpulse = Float3();
+		}
+		else
+		{
+			BodyContact contact;
+			contact.bodyA = indexA;
+			contact.bodyB = indexB;
+			contact.position = (pointA + pointB) * 0.5f;
+			contact.normal = normal;
+			contact.penetration = penetration;
+			contact.normalImpulse = cachedContact.normalImpulse;
+			contact.frictionImpulse = cachedContact.frictionImpulse;
+			contact.cacheIndex = (int)m_contacts.size();
+
+			out_contacts.push_back(contact);
+			m_warmStartedContactCount++;
+		}
+
+		m_contacts.push_back(cachedContact);
+	}
+
+	m_manifolds.push_back(manifold);
+	m_reusedManifoldCount++;
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Caches the contacts narrowphase just found, each taking the impulses of the closest unclaimed old contact
+// that faces the same way. Pairs with no contacts are kept too, so pairs that stay apart skip narrowphase as well
+void BodyContactCache::AddManifold(const BodyStore& store, const BodyContactManifold* previous, BodyContactManifold manifold, int indexA, int indexB, const BodyContactCacheSettings& settings, std::vector<BodyContact>& contacts, int firstContact)
+{
+	const Float3 positionA = store.GetFloat3(indexA, BODY_POSITION_X);
+	const FloatQuat rotationA = store.GetRotation(indexA);
+	const Float3 positionB = (indexB >= 0 ? store.GetFloat3(indexB, BODY_POSITION_X) : Float3());
+	const FloatQuat rotationB = (indexB >= 0 ? store.GetRotation(indexB) : FloatQuat());
+
+	const float matchDistanceSquared = settings.matchDistance * settings.matchDistance;
+	const int previousContactCount = (previous != nullptr ? std::min(previous->contactCount, s_maxMatchedContacts) : 0);
+	uint32_t claimedMask = 0;
+
+	manifold.firstContact = (int)m_contacts.size();
+	manifold.contactCount = (int)contacts.size() - firstContact;
+
+	for (int contactIndex = firstContact; contactIndex < (int)contacts.size(); ++contactIndex)
+	{
+		BodyContact& contact = contacts[contactIndex];
+		const Float3 pointA = contact.position - contact.normal * (0.5f * contact.penetration);
+		const Float3 pointB = contact.position + contact.normal * (0.5f * contact.penetration);
+
+		CachedBodyContact cachedContact;
+		cachedContact.localPointA = InverseRotate(rotationA, pointA - positionA);
+		cachedContact.localPointB = InverseRotate(rotationB, pointB - positionB);
+		cachedContact.localNormal = InverseRotate(rotationB, contact.normal);
+
+		int bestMatch = -1;
+		float bestDistanceSquared = matchDistanceSquared;
+
+		for (int previousOffset = 0; previousOffset < previousContactCount; ++previousOffset)
+		{
+			const CachedBodyContact& previousContact = m_previousContacts[previous->firstContact + previousOffset];
+			const float distanceSquared = LengthSquared(previousContact.localPointA - cachedContact.localPointA);
+
+			if ((claimedMask & (1u << previousOffset)) == 0 && distanceSquared <= bestDistanceSquared && Dot(previousContact.localNormal, cachedContact.localNormal) >= s_minMatchNormalDot)
+			{
+				bestMatch = previousOffset;
+				bestDistanceSquared = distanceSquared;
+			}
+		}
+
+		if (bestMatch >= 0)
+		{
+			const CachedBodyContact& previousContact = m_previousContacts[previous->firstContact + bestMatch];
+			cachedContact.normalImpulse = previousContact.normalImpulse;
+			cachedContact.frictionImpulse = previousContact.frictionImpulse;
+			claimedMask |= (1u << bestMatch);
+			m_warmStartedContactCount++;
+		}
+
+		contact.normalImpulse = cachedContact.normalImpulse;
+		contact.frictionImpulse = cachedContact.frictionImpulse;
+		contact.cacheIndex = (int)m_contacts.size();
+		m_contacts.push_back(cachedContact);
+	}
+
+	m_manifolds.push_back(manifold);
+}
@@ -0,0 +1,129 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Contact manifolds kept between steps, for warm starting the solver and skipping narrowphase on pairs that barely moved
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyCollision.h"
+#include <cstdint>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodySnapshotReader;
+class BodySnapshotWriter;
+class BodyStore;
+
+struct BodyContactCacheSettings
+{
+	bool	isEnabled = true;
+	float	reuseDistance = 0.005f;		// Narrowphase is skipped while the pair has moved less than this relative to each other...
+	float	reuseRadians = 0.01f;		// ...and turned less than this, since the manifold was last generated
+	float	matchDistance = 0.05f;		// New contacts this close to an old one (on body A) take over its impulses
+};
+
+// A contact as the cache keeps it, in the bodies' local spaces so it can be moved along with them
+struct CachedBodyContact
+{
+	Float3	localPointA;			// Deepest point of A, in A's space
+	Float3	localPointB;			// Deepest point of B, in B's space (world space for planes)
+	Float3	localNormal;			// In B's space, for the same reason
+	float	normalImpulse = 0.f;
+	Float3	frictionImpulse;		// World space, as the tangents are rebuilt from the normal every step
+};
+
+// Everything found between one pair of bodies (or a body and a plane) in one step
+struct BodyContactManifold
+{
+	uint64_t	key = 0;
+	uint32_t	generationA = 0;
+	uint32_t	generationB = 0;
+	Float3		relativePosition;	// B in A's space (A in world space for planes) when narrowphase last ran
+	FloatQuat	relativeRotation;
+	int			firstContact = 0;
+	int			contactCount = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Stands in for CollideBodies/CollideBodyWithPlane. Manifolds are keyed by handle slot (and plane index), so they
+// survive bodies moving around in the store; a manifold nobody asked for in a step is dropped.
+// If the pair has barely moved relative to each other since narrowphase last ran, the old contacts are moved along
+// with the bodies instead of running it again. Otherwise fresh contacts are matched to old ones by their point on A,
+// and matches start with the old accumulated impulses. StoreImpulses reads them back once the solver is done.
+// Pairs whose body indices swap order (after a removal) don't find their old manifold, and just go one step cold
+class BodyContactCache
+{
+public:
+	//-----Public Methods-----
+
+	void	BeginStep();
+	void	Clear();
+
+	int		CollideBodies(const BodyStore& store, int indexA, int indexB, const BodyContactCacheSettings& settings, std::vector<BodyContact>& out_contacts);
+	int		CollideBodyWithPlane(const BodyStore& store, int index, const BodyPlane& plane, int planeIndex, const BodyContactCacheSettings& settings, std::vector<BodyContact>& out_contacts);
+	void	StoreImpulses(const std::vector<BodyContact>& contacts);
+
+	// The manifolds from the last step, which are all the next step looks at
+	void	WriteSnapshot(BodySnapshotWriter& writer) const;
+	bool	ReadSnapshot(BodySnapshotReader& reader);
+
+	int		GetManifoldCount() const { return (int)m_manifolds.size(); }
+	int		GetReusedManifoldCount() const { return m_reusedManifoldCount; }
+	int		GetWarmStartedContactCount() const { return m_warmStartedContactCount; }
+
+
+private:
+	//-----Private Methods-----
+
+	void						BuildPreviousLookup();
+	uint32_t					GetLookupHomeSlot(uint64_t key) const { return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> m_lookupShift); }
+	const BodyContactManifold*	FindPreviousManifold(uint64_t key, uint32_t generationA, uint32_t generationB) const;
+	bool						TryReuseManifold(const BodyStore& store, const BodyContactManifold& previous, int indexA, int indexB, const Float3& relativePosition, const FloatQuat& relativeRotation, const BodyContactCacheSettings& settings, std::vector<BodyContact>& out_contacts);
+	void						AddManifold(const BodyStore& store, const BodyContactManifold* previous, BodyContactManifold manifold, int indexA, int indexB, const BodyContactCacheSettings& settings, std::vector<BodyContact>& contacts, int firstContact);
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<BodyContactManifold>	m_manifolds;
+	std::vector<CachedBodyContact>		m_contacts;
+	std::vector<BodyContactManifold>	m_previousManifolds;
+	std::vector<CachedBodyContact>		m_previousContacts;
+
+	// Key to index in m_previousManifolds, linear probing like ResourceRegistry. Rebuilt every step but only
+	// ever grown, so a scene that has had this many manifolds once doesn't allocate for them again
+	struct LookupSlot
+	{
+		uint64_t	key = 0;
+		int			index = -1;			// -1 is an empty slot
+	};
+
+	std::vector<LookupSlot>				m_previousLookup;
+	uint32_t							m_lookupMask = 0;
+	int									m_lookupShift = 64;
+
+	int									m_reusedManifoldCount = 0;
+	int									m_warmStartedContactCount = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
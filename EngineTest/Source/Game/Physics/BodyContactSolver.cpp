@@ -0,0 +1,501 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyContactSolver.h"
+#include "Game/Physics/BodyStore.h"
+#include <algorithm>
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Velocity state of one side of a contact; static geometry is left zeroed
+struct SolverBody
+{
+	Float3		velocity;
+	Float3		angularVelocity;
+	float		inverseMass = 0.f;
+	FloatSym3	inverseInertia;
+};
+
+// Velocities of the bodies in one batch, gathered lane by lane from the store
+struct BatchVelocities
+{
+	float linearA[3][BODY_CONTACT_BATCH_WIDTH];
+	float angularA[3][BODY_CONTACT_BATCH_WIDTH];
+	float linearB[3][BODY_CONTACT_BATCH_WIDTH];
+	float angularB[3][BODY_CONTACT_BATCH_WIDTH];
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static SolverBody LoadSolverBody(const BodyStore& store, int index)
+{
+	SolverBody body;
+
+	if (index >= 0)
+	{
+		body.velocity = store.GetFloat3(index, BODY_VELOCITY_X);
+		body.angularVelocity = store.GetFloat3(index, BODY_ANGULAR_VELOCITY_X);
+		body.inverseMass = store.GetField(BODY_INVERSE_MASS)[index];
+		body.inverseInertia = store.GetWorldInverseInertia(index);
+	}
+
+	return body;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// 1 / (J M^-1 J^T) for a constraint along direction at offsets rA and rB
+static float CalculateEffectiveMass(const SolverBody& bodyA, const Float3& rA, const SolverBody& bodyB, const Float3& rB, const Float3& direction)
+{
+	const Float3 rACrossD = Cross(rA, direction);
+	const Float3 rBCrossD = Cross(rB, direction);
+	const float k = bodyA.inverseMass + bodyB.inverseMass
+		+ Dot(rACrossD, Multiply(bodyA.inverseInertia, rACrossD))
+		+ Dot(rBCrossD, Multiply(bodyB.inverseInertia, rBCrossD));
+
+	return (k > 0.f ? 1.f / k : 0.f);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static Float3 GetRelativeVelocity(const SolverBody& bodyA, const Float3& rA, const SolverBody& bodyB, const Float3& rB)
+{
+	return (bodyA.velocity + Cross(bodyA.angularVelocity, rA)) - (bodyB.velocity + Cross(bodyB.angularVelocity, rB));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static void SetBatchFloat3(float (&destination)[3][BODY_CONTACT_BATCH_WIDTH], int lane, const Float3& value)
+{
+	destination[0][lane] = value.x;
+	destination[1][lane] = value.y;
+	destination[2][lane] = value.z;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Zeroed lanes have no mass and no bodies, so they solve to a zero impulse
+static void ClearBatch(BodyContactBatch& batch)
+{
+	memset(&batch, 0, sizeof(BodyContactBatch));
+
+	for (int lane = 0; lane < BODY_CONTACT_BATCH_WIDTH; ++lane)
+	{
+		batch.contactIndices[lane] = -1;
+		batch.bodyA[lane] = -1;
+		batch.bodyB[lane] = -1;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static void GatherBatchVelocities(const BodyStore& store, const BodyContactBatch& batch, BatchVelocities& out_velocities)
+{
+	memset(&out_velocities, 0, sizeof(BatchVelocities));
+
+	for (int lane = 0; lane < batch.laneCount; ++lane)
+	{
+		for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+		{
+			if (batch.bodyA[lane] >= 0)
+			{
+				out_velocities.linearA[axisIndex][lane] = store.GetField((BodyField)(BODY_VELOCITY_X + axisIndex))[batch.bodyA[lane]];
+				out_velocities.angularA[axisIndex][lane] = store.GetField((BodyField)(BODY_ANGULAR_VELOCITY_X + axisIndex))[batch.bodyA[lane]];
+			}
+
+			if (batch.bodyB[lane] >= 0)
+			{
+				out_velocities.linearB[axisIndex][lane] = store.GetField((BodyField)(BODY_VELOCITY_X + axisIndex))[batch.bodyB[lane]];
+				out_velocities.angularB[axisIndex][lane] = store.GetField((BodyField)(BODY_ANGULAR_VELOCITY_X + axisIndex))[batch.bodyB[lane]];
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Immovable bodies are skipped, they can be in several islands being solved at once
+static void ScatterBatchVelocities(BodyStore& store, const BodyContactBatch& batch, const BatchVelocities& velocities)
+{
+	for (int lane = 0; lane < batch.laneCount; ++lane)
+	{
+		for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+		{
+			if (batch.bodyA[lane] >= 0 && batch.inverseMassA[lane] > 0.f)
+			{
+				store.GetField((BodyField)(BODY_VELOCITY_X + axisIndex))[batch.bodyA[lane]] = velocities.linearA[axisIndex][lane];
+				store.GetField((BodyField)(BODY_ANGULAR_VELOCITY_X + axisIndex))[batch.bodyA[lane]] = velocities.angularA[axisIndex][lane];
+			}
+
+			if (batch.bodyB[lane] >= 0 && batch.inverseMassB[lane] > 0.f)
+			{
+				store.GetField((BodyField)(BODY_VELOCITY_X + axisIndex))[batch.bodyB[lane]] = velocities.linearB[axisIndex][lane];
+				store.GetField((BodyField)(BODY_ANGULAR_VELOCITY_X + axisIndex))[batch.bodyB[lane]] = velocities.angularB[axisIndex][lane];
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Pushes A along the direction and B against it
+template <typename Lane>
+static void ApplyBatchImpulse(const BodyContactBatch& batch, int directionIndex, int lane, const Lane& impulse, const Lane (&direction)[3], const Lane& inverseMassA, const Lane& inverseMassB,
+	Lane (&linearA)[3], Lane (&angularA)[3], Lane (&linearB)[3], Lane (&angularB)[3])
+{
+	const Lane linearDeltaA = impulse * inverseMassA;
+	const Lane linearDeltaB = impulse * inverseMassB;
+
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		linearA[axisIndex] = linearA[axisIndex] + direction[axisIndex] * linearDeltaA;
+		angularA[axisIndex] = angularA[axisIndex] + Lane::Load(&batch.inertiaAngularA[directionIndex][axisIndex][lane]) * impulse;
+		linearB[axisIndex] = linearB[axisIndex] - direction[axisIndex] * linearDeltaB;
+		angularB[axisIndex] = angularB[axisIndex] - Lane::Load(&batch.inertiaAngularB[directionIndex][axisIndex][lane]) * impulse;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Applies the impulses the batch starts with, so the iterations only have to solve for the change since last step
+template <typename Lane>
+static void WarmStartBatchForLanes(const BodyContactBatch& batch, BatchVelocities& velocities, int lane)
+{
+	const Lane inverseMassA = Lane::Load(&batch.inverseMassA[lane]);
+	const Lane inverseMassB = Lane::Load(&batch.inverseMassB[lane]);
+
+	Lane linearA[3], angularA[3], linearB[3], angularB[3];
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		linearA[axisIndex] = Lane::Load(&velocities.linearA[axisIndex][lane]);
+		angularA[axisIndex] = Lane::Load(&velocities.angularA[axisIndex][lane]);
+		linearB[axisIndex] = Lane::Load(&velocities.linearB[axisIndex][lane]);
+		angularB[axisIndex] = Lane::Load(&velocities.angularB[axisIndex][lane]);
+	}
+
+	for (int directionIndex = 0; directionIndex < NUM_CONTACT_DIRECTIONS; ++directionIndex)
+	{
+		Lane direction[3];
+		for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+		{
+			direction[axisIndex] = Lane::Load(&batch.directions[directionIndex][axisIndex][lane]);
+		}
+
+		ApplyBatchImpulse(batch, directionIndex, lane, Lane::Load(&batch.impulse[directionIndex][lane]), direction, inverseMassA, inverseMassB, linearA, angularA, linearB, angularB);
+	}
+
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		linearA[axisIndex].Store(&velocities.linearA[axisIndex][lane]);
+		angularA[axisIndex].Store(&velocities.angularA[axisIndex][lane]);
+		linearB[axisIndex].Store(&velocities.linearB[axisIndex][lane]);
+		angularB[axisIndex].Store(&velocities.angularB[axisIndex][lane]);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// One iteration over Lane::WIDTH contacts of a batch starting at lane: friction first, then the non-penetration
+// constraint, so the normal impulse gets the final say each iteration
+template <typename Lane>
+static void SolveBatchForLanes(BodyContactBatch& batch, BatchVelocities& velocities, int lane, float friction)
+{
+	static const int s_solveOrder[NUM_CONTACT_DIRECTIONS] = { CONTACT_DIRECTION_TANGENT_0, CONTACT_DIRECTION_TANGENT_1, CONTACT_DIRECTION_NORMAL };
+
+	const Lane zero(0.f);
+	const Lane inverseMassA = Lane::Load(&batch.inverseMassA[lane]);
+	const Lane inverseMassB = Lane::Load(&batch.inverseMassB[lane]);
+
+	Lane linearA[3], angularA[3], linearB[3], angularB[3];
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		linearA[axisIndex] = Lane::Load(&velocities.linearA[axisIndex][lane]);
+		angularA[axisIndex] = Lane::Load(&velocities.angularA[axisIndex][lane]);
+		linearB[axisIndex] = Lane::Load(&velocities.linearB[axisIndex][lane]);
+		angularB[axisIndex] = Lane::Load(&velocities.angularB[axisIndex][lane]);
+	}
+
+	// Friction is clamped to the friction cone of the normal impulse going into this iteration
+	const Lane maxFriction = Lane(friction) * Lane::Load(&batch.impulse[CONTACT_DIRECTION_NORMAL][lane]);
+	const Lane minFriction = zero - maxFriction;
+
+	for (int orderIndex = 0; orderIndex < NUM_CONTACT_DIRECTIONS; ++orderIndex)
+	{
+		const int directionIndex = s_solveOrder[orderIndex];
+
+		Lane direction[3], jacobianA[3], jacobianB[3];
+		for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+		{
+			direction[axisIndex] = Lane::Load(&batch.directions[directionIndex][axisIndex][lane]);
+			jacobianA[axisIndex] = Lane::Load(&batch.angularA[directionIndex][axisIndex][lane]);
+			jacobianB[axisIndex] = Lane::Load(&batch.angularB[directionIndex][axisIndex][lane]);
+		}
+
+		// Relative speed along the direction
+		const Lane speed =
+			(linearA[0] - linearB[0]) * direction[0] + (linearA[1] - linearB[1]) * direction[1] + (linearA[2] - linearB[2]) * direction[2]
+			+ angularA[0] * jacobianA[0] + angularA[1] * jacobianA[1] + angularA[2] * jacobianA[2]
+			- (angularB[0] * jacobianB[0] + angularB[1] * jacobianB[1] + angularB[2] * jacobianB[2]);
+
+		const Lane effectiveMass = Lane::Load(&batch.effectiveMass[directionIndex][lane]);
+		const Lane oldImpulse = Lane::Load(&batch.impulse[directionIndex][lane]);
+		Lane newImpulse;
+
+		if (directionIndex == CONTACT_DIRECTION_NORMAL)
+		{
+			// Accumulated impulse can only ever push
+			newImpulse = Max(oldImpulse + (Lane::Load(&batch.velocityBias[lane]) - speed) * effectiveMass, zero);
+		}
+		else
+		{
+			newImpulse = Min(Max(oldImpulse - speed * effectiveMass, minFriction), maxFriction);
+		}
+
+		newImpulse.Store(&batch.impulse[directionIndex][lane]);
+
+		ApplyBatchImpulse(batch, directionIndex, lane, newImpulse - oldImpulse, direction, inverseMassA, inverseMassB, linearA, angularA, linearB, angularB);
+	}
+
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		linearA[axisIndex].Store(&velocities.linearA[axisIndex][lane]);
+		angularA[axisIndex].Store(&velocities.angularA[axisIndex][lane]);
+		linearB[axisIndex].Store(&velocities.linearB[axisIndex][lane]);
+		angularB[axisIndex].Store(&velocities.angularB[axisIndex][lane]);
+	}
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Precomputes everything about a contact that doesn't change between iterations
+void BodyContactSolver::PrepareContacts(const BodyStore& store, std::vector<BodyContact>& contacts, float deltaSeconds, const BodySolverSettings& settings) const
+{
+	const float inverseDeltaSeconds = (deltaSeconds > 0.f ? 1.f / deltaSeconds : 0.f);
+
+	for (BodyContact& contact : contacts)
+	{
+		const SolverBody bodyA = LoadSolverBody(store, contact.bodyA);
+		const SolverBody bodyB = LoadSolverBody(store, contact.bodyB);
+
+		contact.rA = contact.position - store.GetFloat3(contact.bodyA, BODY_POSITION_X);
+		contact.rB = (contact.bodyB >= 0 ? contact.position - store.GetFloat3(contact.bodyB, BODY_POSITION_X) : Float3(0.f, 0.f, 0.f));
+		contact.tangent0 = GetPerpendicular(contact.normal);
+		contact.tangent1 = Cross(contact.normal, contact.tangent0);
+
+		contact.normalMass = CalculateEffectiveMass(bodyA, contact.rA, bodyB, contact.rB, contact.normal);
+		contact.tangentMass0 = CalculateEffectiveMass(bodyA, contact.rA, bodyB, contact.rB, contact.tangent0);
+		contact.tangentMass1 = CalculateEffectiveMass(bodyA, contact.rA, bodyB, contact.rB, contact.tangent1);
+
+		// Push apart enough to fix some of the penetration this step, or to bounce, whichever is larger
+		const float penetrationError = contact.penetration - settings.penetrationSlop;
+		const float positionBias = (penetrationError > 0.f ? settings.baumgarteFactor * inverseDeltaSeconds * penetrationError : 0.f);
+		const float normalSpeed = Dot(GetRelativeVelocity(bodyA, contact.rA, bodyB, contact.rB), contact.normal);
+		const float restitutionBias = (normalSpeed < -settings.restitutionThreshold ? -settings.restitution * normalSpeed : 0.f);
+
+		contact.velocityBias = (positionBias > restitutionBias ? positionBias : restitutionBias);
+
+		// Friction carried over is in world space, as the tangents can come out different for a slightly different normal
+		const float warmStartFactor = (settings.warmStarting ? settings.warmStartFactor : 0.f);
+		contact.normalImpulse = warmStartFactor * contact.normalImpulse;
+		contact.tangentImpulse0 = warmStartFactor * Dot(contact.frictionImpulse, contact.tangent0);
+		contact.tangentImpulse1 = warmStartFactor * Dot(contact.frictionImpulse, contact.tangent1);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyContactSolver::ClearBatches(int bodyCount)
+{
+	m_batches.clear();
+	m_bodyLastBatch.assign(bodyCount, -1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Greedily puts each contact in the earliest batch with a free lane that comes after every batch its dynamic
+// bodies are already in. Immovable bodies never change velocity, so they can share a batch.
+// Only batches from this call are filled, and the index of the first one is returned
+int BodyContactSolver::BuildBatches(const BodyStore& store, const std::vector<BodyContact>& contacts, int firstContact, int contactCount)
+{
+	const float* inverseMasses = store.GetField(BODY_INVERSE_MASS);
+	const int firstBatch = (int)m_batches.size();
+	int firstOpenBatch = firstBatch;
+
+	for (int contactIndex = firstContact; contactIndex < firstContact + contactCount; ++contactIndex)
+	{
+		const BodyContact& contact = contacts[contactIndex];
+		const bool isDynamicA = (contact.bodyA >= 0 && inverseMasses[contact.bodyA] > 0.f);
+		const bool isDynamicB = (contact.bodyB >= 0 && inverseMasses[contact.bodyB] > 0.f);
+
+		int batchIndex = firstOpenBatch;
+		batchIndex = (isDynamicA ? std::max(batchIndex, m_bodyLastBatch[contact.bodyA] + 1) : batchIndex);
+		batchIndex = (isDynamicB ? std::max(batchIndex, m_bodyLastBatch[contact.bodyB] + 1) : batchIndex);
+
+		while (batchIndex < (int)m_batches.size() && m_batches[batchIndex].laneCount == BODY_CONTACT_BATCH_WIDTH)
+		{
+			batchIndex++;
+		}
+
+		if (batchIndex == (int)m_batches.size())
+		{
+			m_batches.emplace_back();
+			ClearBatch(m_batches.back());
+		}
+
+		AddContactToBatch(store, contact, contactIndex, m_batches[batchIndex]);
+
+		if (isDynamicA)
+		{
+			m_bodyLastBatch[contact.bodyA] = batchIndex;
+		}
+
+		if (isDynamicB)
+		{
+			m_bodyLastBatch[contact.bodyB] = batchIndex;
+		}
+
+		while (firstOpenBatch < (int)m_batches.size() && m_batches[firstOpenBatch].laneCount == BODY_CONTACT_BATCH_WIDTH)
+		{
+			firstOpenBatch++;
+		}
+	}
+
+	return firstBatch;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Runs each batch in the range 4 lanes at once in SSE mode, or lane by lane in scalar mode.
+// Warm starting applies every batch's starting impulses first, in the same order the iterations go in
+void BodyContactSolver::SolveBatches(BodyStore& store, int firstBatch, int batchCount, const BodySolverSettings& settings, BodySimdMode simdMode)
+{
+	const bool useSse = (simdMode == BODY_SIMD_SSE && IsBodySimdModeSupported(BODY_SIMD_SSE));
+	BatchVelocities velocities;
+
+	if (settings.warmStarting)
+	{
+		for (int batchIndex = firstBatch; batchIndex < firstBatch + batchCount; ++batchIndex)
+		{
+			const BodyContactBatch& batch = m_batches[batchIndex];
+			GatherBatchVelocities(store, batch, velocities);
+
+			if (useSse)
+			{
+#ifdef BODY_SIMD_SSE_AVAILABLE
+				WarmStartBatchForLanes<FloatLane4>(batch, velocities, 0);
+#endif
+			}
+			else
+			{
+				for (int lane = 0; lane < batch.laneCount; ++lane)
+				{
+					WarmStartBatchForLanes<FloatLane1>(batch, velocities, lane);
+				}
+			}
+
+			ScatterBatchVelocities(store, batch, velocities);
+		}
+	}
+
+	for (int iteration = 0; iteration < settings.velocityIterations; ++iteration)
+	{
+		for (int batchIndex = firstBatch; batchIndex < firstBatch + batchCount; ++batchIndex)
+		{
+			BodyContactBatch& batch = m_batches[batchIndex];
+			GatherBatchVelocities(store, batch, velocities);
+
+			if (useSse)
+			{
+#ifdef BODY_SIMD_SSE_AVAILABLE
+				SolveBatchForLanes<FloatLane4>(batch, velocities, 0, settings.friction);
+#endif
+			}
+			else
+			{
+				for (int lane = 0; lane < batch.laneCount; ++lane)
+				{
+					SolveBatchForLanes<FloatLane1>(batch, velocities, lane, settings.friction);
+				}
+			}
+
+			ScatterBatchVelocities(store, batch, velocities);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Hands the accumulated impulses back to the contacts they came from
+void BodyContactSolver::StoreImpulses(std::vector<BodyContact>& contacts) const
+{
+	for (const BodyContactBatch& batch : m_batches)
+	{
+		for (int lane = 0; lane < batch.laneCount; ++lane)
+		{
+			BodyContact& contact = contacts[batch.contactIndices[lane]];
+			contact.normalImpulse = batch.impulse[CONTACT_DIRECTION_NORMAL][lane];
+			contact.tangentImpulse0 = batch.impulse[CONTACT_DIRECTION_TANGENT_0][lane];
+			contact.tangentImpulse1 = batch.impulse[CONTACT_DIRECTION_TANGENT_1][lane];
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Copies the prepared contact into the next lane, along with the angular terms for each direction
+void BodyContactSolver::AddContactToBatch(const BodyStore& store, const BodyContact& contact, int contactIndex, BodyContactBatch& batch) const
+{
+	const int lane = batch.laneCount++;
+	const SolverBody bodyA = LoadSolverBody(store, contact.bodyA);
+	const SolverBody bodyB = LoadSolverBody(store, contact.bodyB);
+
+	batch.contactIndices[lane] = contactIndex;
+	batch.bodyA[lane] = contact.bodyA;
+	batch.bodyB[lane] = contact.bodyB;
+	batch.inverseMassA[lane] = bodyA.inverseMass;
+	batch.inverseMassB[lane] = bodyB.inverseMass;
+	batch.velocityBias[lane] = contact.velocityBias;
+
+	const Float3 directions[NUM_CONTACT_DIRECTIONS] = { contact.normal, contact.tangent0, contact.tangent1 };
+	const float effectiveMasses[NUM_CONTACT_DIRECTIONS] = { contact.normalMass, contact.tangentMass0, contact.tangentMass1 };
+	const float impulses[NUM_CONTACT_DIRECTIONS] = { contact.normalImpulse, contact.tangentImpulse0, contact.tangentImpulse1 };
+
+	for (int directionIndex = 0; directionIndex < NUM_CONTACT_DIRECTIONS; ++directionIndex)
+	{
+		const Float3 angularA = Cross(contact.rA, directions[directionIndex]);
+		const Float3 angularB = Cross(contact.rB, directions[directionIndex]);
+
+		SetBatchFloat3(batch.directions[directionIndex], lane, directions[directionIndex]);
+		SetBatchFloat3(batch.angularA[directionIndex], lane, angularA);
+		SetBatchFloat3(batch.angularB[directionIndex], lane, angularB);
+		SetBatchFloat3(batch.inertiaAngularA[directionIndex], lane, Multiply(bodyA.inverseInertia, angularA));
+		SetBatchFloat3(batch.inertiaAngularB[directionIndex], lane, Multiply(bodyB.inverseInertia, angularB));
+
+		batch.effectiveMass[directionIndex][lane] = effectiveMasses[directionIndex];
+		batch.impulse[directionIndex][lane] = impulses[directionIndex];
+	}
+}
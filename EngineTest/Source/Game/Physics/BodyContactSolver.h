@@ -0,0 +1,113 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Sequential impulse contact solver over a BodyStore, solving up to 4 independent contacts at once
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyCollision.h"
+#include "Game/Physics/BodySimd.h"
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodyStore;
+
+struct BodySolverSettings
+{
+	int		velocityIterations = 8;
+	float	friction = 0.5f;
+	float	restitution = 0.1f;
+	float	restitutionThreshold = 1.f;		// Closing speeds below this don't bounce, keeps resting contacts quiet
+	float	baumgarteFactor = 0.2f;			// Fraction of the penetration corrected per step
+	float	penetrationSlop = 0.01f;		// Penetration allowed before correcting, avoids jitter
+	bool	warmStarting = true;			// Start from the impulses the contact cache carried over, instead of zero
+	float	warmStartFactor = 1.f;			// Scale on those impulses
+};
+
+// Impulse directions, in the order they are stored in a batch
+enum BodyContactDirection
+{
+	CONTACT_DIRECTION_NORMAL,
+	CONTACT_DIRECTION_TANGENT_0,
+	CONTACT_DIRECTION_TANGENT_1,
+	NUM_CONTACT_DIRECTIONS
+};
+
+const int BODY_CONTACT_BATCH_WIDTH = 4;
+
+// Up to BODY_CONTACT_BATCH_WIDTH contacts that share no dynamic body, so they can be solved side by side.
+// Everything the iterations need is stored lane by lane; unused lanes are zeroed and have no effect
+struct BodyContactBatch
+{
+	int		laneCount;
+	int		contactIndices[BODY_CONTACT_BATCH_WIDTH];
+	int		bodyA[BODY_CONTACT_BATCH_WIDTH];
+	int		bodyB[BODY_CONTACT_BATCH_WIDTH];
+	float	inverseMassA[BODY_CONTACT_BATCH_WIDTH];
+	float	inverseMassB[BODY_CONTACT_BATCH_WIDTH];
+	float	velocityBias[BODY_CONTACT_BATCH_WIDTH];
+
+	// Per direction
+	float	directions[NUM_CONTACT_DIRECTIONS][3][BODY_CONTACT_BATCH_WIDTH];
+	float	angularA[NUM_CONTACT_DIRECTIONS][3][BODY_CONTACT_BATCH_WIDTH];			// rA x direction
+	float	angularB[NUM_CONTACT_DIRECTIONS][3][BODY_CONTACT_BATCH_WIDTH];			// rB x direction
+	float	inertiaAngularA[NUM_CONTACT_DIRECTIONS][3][BODY_CONTACT_BATCH_WIDTH];	// World inverse inertia of A * (rA x direction)
+	float	inertiaAngularB[NUM_CONTACT_DIRECTIONS][3][BODY_CONTACT_BATCH_WIDTH];
+	float	effectiveMass[NUM_CONTACT_DIRECTIONS][BODY_CONTACT_BATCH_WIDTH];
+	float	impulse[NUM_CONTACT_DIRECTIONS][BODY_CONTACT_BATCH_WIDTH];			// Accumulated over the iterations
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Contacts are grouped into batches by BuildBatches; a body's contacts always land in batches in the order
+// they were found, so the result only depends on the contact order. Batch ranges built from contact ranges
+// that share no dynamic bodies (i.e. islands) can be solved on different threads at the same time.
+// The scalar mode runs the batches lane by lane through the same code as the SSE mode, so both give the same answer
+class BodyContactSolver
+{
+public:
+	//-----Public Methods-----
+
+	void	PrepareContacts(const BodyStore& store, std::vector<BodyContact>& contacts, float deltaSeconds, const BodySolverSettings& settings) const;
+
+	void	ClearBatches(int bodyCount);
+	int		BuildBatches(const BodyStore& store, const std::vector<BodyContact>& contacts, int firstContact, int contactCount);
+	void	SolveBatches(BodyStore& store, int firstBatch, int batchCount, const BodySolverSettings& settings, BodySimdMode simdMode);
+	void	StoreImpulses(std::vector<BodyContact>& contacts) const;
+
+	int		GetBatchCount() const { return (int)m_batches.size(); }
+
+
+private:
+	//-----Private Methods-----
+
+	void	AddContactToBatch(const BodyStore& store, const BodyContact& contact, int contactIndex, BodyContactBatch& batch) const;
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<BodyContactBatch>	m_batches;
+	std::vector<int>				m_bodyLastBatch;	// Scratch for BuildBatches
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,62 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: Conversions between the body store's plain float math and the engine's math types, for the
+///				 places where game code hands values to or from a BodyScene
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/PhysicsMath.h"
+#include "Engine/Math/Quaternion.h"
+#include "Engine/Math/Vector3.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+inline Float3 ToFloat3(const Vector3& vector)
+{
+	return Float3(vector.x, vector.y, vector.z);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline Vector3 ToVector3(const Float3& vector)
+{
+	return Vector3(vector.x, vector.y, vector.z);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Through Euler angles, as CreateQuatFromEulerDegrees uses the same order as the engine's quaternions
+inline Quaternion ToQuaternion(const FloatQuat& rotation)
+{
+	return Quaternion::CreateFromEulerAnglesDegrees(ToVector3(GetEulerDegrees(rotation)));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline FloatQuat ToFloatQuat(const Quaternion& rotation)
+{
+	return CreateQuatFromEulerDegrees(ToFloat3(rotation.GetAsEulerAnglesDegrees()));
+}
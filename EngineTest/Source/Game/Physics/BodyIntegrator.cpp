@@ -0,0 +1,234 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyIntegrator.h"
+#include "Game/Physics/BodyStore.h"
+#include "Engine/Core/EngineCommon.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Field pointers for one pass, looked up once instead of per lane group
+struct IntegratorFields
+{
+	IntegratorFields(BodyStore& store)
+	{
+		flags = store.GetFlags();
+		for (int fieldIndex = 0; fieldIndex < NUM_BODY_FIELDS; ++fieldIndex)
+		{
+			fields[fieldIndex] = store.GetField((BodyField)fieldIndex);
+		}
+	}
+
+	float* operator[](BodyField field) const { return fields[field]; }
+
+	const uint8_t*	flags;
+	float*			fields[NUM_BODY_FIELDS];
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Gravity and constant acceleration, then the lateral speed clamp, for Lane::WIDTH bodies starting at index
+// Immovable and sleeping bodies keep their velocity untouched
+template <typename Lane>
+static void IntegrateVelocitiesForLanes(const IntegratorFields& fields, int index, const Float3& gravity, float deltaSeconds)
+{
+	const Lane zero(0.f);
+	const Lane one(1.f);
+	const Lane dt(deltaSeconds);
+
+	const Lane asleep = Lane::LoadFlags(fields.flags + index, BODY_FLAG_ASLEEP);
+	const auto isDynamic = IsGreaterThan(Lane::Load(fields[BODY_INVERSE_MASS] + index), zero) & IsGreaterThan(Lane(0.5f), asleep);
+	const Lane gravityScale = Lane::LoadFlags(fields.flags + index, BODY_FLAG_AFFECTED_BY_GRAVITY);
+
+	const Lane oldVelocityX = Lane::Load(fields[BODY_VELOCITY_X] + index);
+	const Lane oldVelocityY = Lane::Load(fields[BODY_VELOCITY_Y] + index);
+	const Lane oldVelocityZ = Lane::Load(fields[BODY_VELOCITY_Z] + index);
+
+	Lane velocityX = oldVelocityX + (Lane::Load(fields[BODY_ACCELERATION_X] + index) + Lane(gravity.x) * gravityScale) * dt;
+	Lane velocityY = oldVelocityY + (Lane::Load(fields[BODY_ACCELERATION_Y] + index) + Lane(gravity.y) * gravityScale) * dt;
+	Lane velocityZ = oldVelocityZ + (Lane::Load(fields[BODY_ACCELERATION_Z] + index) + Lane(gravity.z) * gravityScale) * dt;
+
+	// Scale of 1 for every lane that isn't over its limit (or has none)
+	const Lane maxLateralSpeed = Lane::Load(fields[BODY_MAX_LATERAL_SPEED] + index);
+	const Lane lateralSpeedSquared = velocityX * velocityX + velocityZ * velocityZ;
+	const auto needsClamp = IsGreaterThan(maxLateralSpeed, zero) & IsGreaterThan(lateralSpeedSquared, maxLateralSpeed * maxLateralSpeed);
+	const Lane clampScale = Select(needsClamp, maxLateralSpeed / Sqrt(Max(lateralSpeedSquared, Lane(1e-12f))), one);
+
+	velocityX = velocityX * clampScale;
+	velocityZ = velocityZ * clampScale;
+
+	Select(isDynamic, velocityX, oldVelocityX).Store(fields[BODY_VELOCITY_X] + index);
+	Select(isDynamic, velocityY, oldVelocityY).Store(fields[BODY_VELOCITY_Y] + index);
+	Select(isDynamic, velocityZ, oldVelocityZ).Store(fields[BODY_VELOCITY_Z] + index);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Moves every body by its velocity, and for awake dynamic bodies that can rotate, integrates the orientation
+// (q += 0.5 * (0, w) * q * dt, renormalized) and rebuilds the world inverse inertia from it
+template <typename Lane>
+static void IntegratePositionsForLanes(const IntegratorFields& fields, int index, float deltaSeconds)
+{
+	const Lane zero(0.f);
+	const Lane one(1.f);
+	const Lane two(2.f);
+	const Lane dt(deltaSeconds);
+	const Lane halfDt(0.5f * deltaSeconds);
+
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		float* positions = fields[(BodyField)(BODY_POSITION_X + axisIndex)] + index;
+		const Lane velocity = Lane::Load(fields[(BodyField)(BODY_VELOCITY_X + axisIndex)] + index);
+
+		(Lane::Load(positions) + velocity * dt).Store(positions);
+	}
+
+	const Lane rotationLocked = Lane::LoadFlags(fields.flags + index, BODY_FLAG_ROTATION_LOCKED);
+	const Lane asleep = Lane::LoadFlags(fields.flags + index, BODY_FLAG_ASLEEP);
+	const auto canRotate = IsGreaterThan(Lane::Load(fields[BODY_INVERSE_MASS] + index), zero) & IsGreaterThan(Lane(0.5f), rotationLocked + asleep);
+
+	const Lane wx = Lane::Load(fields[BODY_ANGULAR_VELOCITY_X] + index);
+	const Lane wy = Lane::Load(fields[BODY_ANGULAR_VELOCITY_Y] + index);
+	const Lane wz = Lane::Load(fields[BODY_ANGULAR_VELOCITY_Z] + index);
+	const Lane oldQw = Lane::Load(fields[BODY_ROTATION_W] + index);
+	const Lane oldQx = Lane::Load(fields[BODY_ROTATION_X] + index);
+	const Lane oldQy = Lane::Load(fields[BODY_ROTATION_Y] + index);
+	const Lane oldQz = Lane::Load(fields[BODY_ROTATION_Z] + index);
+
+	// (0, w) * q
+	const Lane spinW = zero - (wx * oldQx + wy * oldQy + wz * oldQz);
+	const Lane spinX = wx * oldQw + wy * oldQz - wz * oldQy;
+	const Lane spinY = wy * oldQw + wz * oldQx - wx * oldQz;
+	const Lane spinZ = wz * oldQw + wx * oldQy - wy * oldQx;
+
+	Lane qw = oldQw + spinW * halfDt;
+	Lane qx = oldQx + spinX * halfDt;
+	Lane qy = oldQy + spinY * halfDt;
+	Lane qz = oldQz + spinZ * halfDt;
+
+	const Lane inverseLength = one / Sqrt(Max(qw * qw + qx * qx + qy * qy + qz * qz, Lane(1e-12f)));
+	qw = qw * inverseLength;
+	qx = qx * inverseLength;
+	qy = qy * inverseLength;
+	qz = qz * inverseLength;
+
+	Select(canRotate, qw, oldQw).Store(fields[BODY_ROTATION_W] + index);
+	Select(canRotate, qx, oldQx).Store(fields[BODY_ROTATION_X] + index);
+	Select(canRotate, qy, oldQy).Store(fields[BODY_ROTATION_Y] + index);
+	Select(canRotate, qz, oldQz).Store(fields[BODY_ROTATION_Z] + index);
+
+	// Columns of the new rotation matrix, same as GetAxes
+	const Lane xx = qx * qx;
+	const Lane yy = qy * qy;
+	const Lane zz = qz * qz;
+	const Lane xy = qx * qy;
+	const Lane xz = qx * qz;
+	const Lane yz = qy * qz;
+	const Lane wxq = qw * qx;
+	const Lane wyq = qw * qy;
+	const Lane wzq = qw * qz;
+
+	const Lane xAxisX = one - two * (yy + zz);
+	const Lane xAxisY = two * (xy + wzq);
+	const Lane xAxisZ = two * (xz - wyq);
+	const Lane yAxisX = two * (xy - wzq);
+	const Lane yAxisY = one - two * (xx + zz);
+	const Lane yAxisZ = two * (yz + wxq);
+	const Lane zAxisX = two * (xz + wyq);
+	const Lane zAxisY = two * (yz - wxq);
+	const Lane zAxisZ = one - two * (xx + yy);
+
+	// R * diag(d) * R^T, as RotateDiagonal
+	const Lane dx = Lane::Load(fields[BODY_LOCAL_INVERSE_INERTIA_X] + index);
+	const Lane dy = Lane::Load(fields[BODY_LOCAL_INVERSE_INERTIA_Y] + index);
+	const Lane dz = Lane::Load(fields[BODY_LOCAL_INVERSE_INERTIA_Z] + index);
+
+	const Lane inertia[6] =
+	{
+		dx * xAxisX * xAxisX + dy * yAxisX * yAxisX + dz * zAxisX * zAxisX,
+		dx * xAxisY * xAxisY + dy * yAxisY * yAxisY + dz * zAxisY * zAxisY,
+		dx * xAxisZ * xAxisZ + dy * yAxisZ * yAxisZ + dz * zAxisZ * zAxisZ,
+		dx * xAxisX * xAxisY + dy * yAxisX * yAxisY + dz * zAxisX * zAxisY,
+		dx * xAxisX * xAxisZ + dy * yAxisX * yAxisZ + dz * zAxisX * zAxisZ,
+		dx * xAxisY * xAxisZ + dy * yAxisY * yAxisZ + dz * zAxisY * zAxisZ
+	};
+
+	for (int componentIndex = 0; componentIndex < 6; ++componentIndex)
+	{
+		float* worldInertia = fields[(BodyField)(BODY_WORLD_INVERSE_INERTIA_XX + componentIndex)] + index;
+		Select(canRotate, inertia[componentIndex], Lane::Load(worldInertia)).Store(worldInertia);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Runs 4 bodies at a time in SSE mode, then finishes the remainder (or everything, in scalar mode) one
+// at a time through the same code, so every body sees the same operations in either mode
+void IntegrateBodyVelocities(BodyStore& store, const Float3& gravity, float deltaSeconds, BodySimdMode simdMode)
+{
+	const IntegratorFields fields(store);
+	const int bodyCount = store.GetCount();
+	int bodyIndex = 0;
+
+#ifdef BODY_SIMD_SSE_AVAILABLE
+	if (simdMode == BODY_SIMD_SSE)
+	{
+		for (; bodyIndex + FloatLane4::WIDTH <= bodyCount; bodyIndex += FloatLane4::WIDTH)
+		{
+			IntegrateVelocitiesForLanes<FloatLane4>(fields, bodyIndex, gravity, deltaSeconds);
+		}
+	}
+#else
+	UNUSED(simdMode);
+#endif
+
+	for (; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		IntegrateVelocitiesForLanes<FloatLane1>(fields, bodyIndex, gravity, deltaSeconds);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void IntegrateBodyPositions(BodyStore& store, float deltaSeconds, BodySimdMode simdMode)
+{
+	const IntegratorFields fields(store);
+	const int bodyCount = store.GetCount();
+	int bodyIndex = 0;
+
+#ifdef BODY_SIMD_SSE_AVAILABLE
+	if (simdMode == BODY_SIMD_SSE)
+	{
+		for (; bodyIndex + FloatLane4::WIDTH <= bodyCount; bodyIndex += FloatLane4::WIDTH)
+		{
+			IntegratePositionsForLanes<FloatLane4>(fields, bodyIndex, deltaSeconds);
+		}
+	}
+#else
+	UNUSED(simdMode);
+#endif
+
+	for (; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		IntegratePositionsForLanes<FloatLane1>(fields, bodyIndex, deltaSeconds);
+	}
+}
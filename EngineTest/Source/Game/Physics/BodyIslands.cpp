@@ -0,0 +1,166 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyIslands.h"
+#include "Game/Physics/BodyStore.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Union-find over the contacts, then counting sorts of the bodies and contacts by island.
+// Contacts with no awake dynamic body in them belong to no island and are dropped
+void BodyIslandBuilder::BuildIslands(const BodyStore& store, std::vector<BodyContact>& contacts)
+{
+	const int bodyCount = store.GetCount();
+
+	m_parents.resize(bodyCount);
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		m_parents[bodyIndex] = bodyIndex;
+	}
+
+	for (const BodyContact& contact : contacts)
+	{
+		if (contact.bodyA >= 0 && contact.bodyB >= 0 && store.IsAwakeAndDynamic(contact.bodyA) && store.IsAwakeAndDynamic(contact.bodyB))
+		{
+			Join(contact.bodyA, contact.bodyB);
+		}
+	}
+
+	// Roots are the lowest body in their island (see Join), so islands get numbered in order of their roots
+	m_islands.clear();
+	m_bodyIslands.assign(bodyCount, -1);
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if (!store.IsAwakeAndDynamic(bodyIndex))
+		{
+			continue;
+		}
+
+		const int root = FindRoot(bodyIndex);
+		if (m_bodyIslands[root] < 0)
+		{
+			m_bodyIslands[root] = (int)m_islands.size();
+			m_islands.emplace_back();
+		}
+
+		m_bodyIslands[bodyIndex] = m_bodyIslands[root];
+		m_islands[m_bodyIslands[bodyIndex]].bodyCount++;
+	}
+
+	// Bodies, grouped by island in index order
+	int bodyTotal = 0;
+	for (BodyIsland& island : m_islands)
+	{
+		island.firstBody = bodyTotal;
+		bodyTotal += island.bodyCount;
+		island.bodyCount = 0;
+	}
+
+	m_islandBodies.resize(bodyTotal);
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if (m_bodyIslands[bodyIndex] >= 0)
+		{
+			BodyIsland& island = m_islands[m_bodyIslands[bodyIndex]];
+			m_islandBodies[island.firstBody + island.bodyCount] = bodyIndex;
+			island.bodyCount++;
+		}
+	}
+
+	// Contacts, grouped by island in the order they were found
+	const int contactCount = (int)contacts.size();
+	m_contactIslands.resize(contactCount);
+
+	for (int contactIndex = 0; contactIndex < contactCount; ++contactIndex)
+	{
+		const BodyContact& contact = contacts[contactIndex];
+		int islandIndex = (contact.bodyA >= 0 ? m_bodyIslands[contact.bodyA] : -1);
+		islandIndex = (islandIndex < 0 && contact.bodyB >= 0 ? m_bodyIslands[contact.bodyB] : islandIndex);
+
+		m_contactIslands[contactIndex] = islandIndex;
+		if (islandIndex >= 0)
+		{
+			m_islands[islandIndex].contactCount++;
+		}
+	}
+
+	int contactTotal = 0;
+	for (BodyIsland& island : m_islands)
+	{
+		island.firstContact = contactTotal;
+		contactTotal += island.contactCount;
+		island.contactCount = 0;
+	}
+
+	m_sortedContacts.resize(contactTotal);
+	for (int contactIndex = 0; contactIndex < contactCount; ++contactIndex)
+	{
+		const int islandIndex = m_contactIslands[contactIndex];
+		if (islandIndex >= 0)
+		{
+			BodyIsland& island = m_islands[islandIndex];
+			m_sortedContacts[island.firstContact + island.contactCount] = contacts[contactIndex];
+			island.contactCount++;
+		}
+	}
+
+	contacts.swap(m_sortedContacts);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// With path halving
+int BodyIslandBuilder::FindRoot(int bodyIndex)
+{
+	while (m_parents[bodyIndex] != bodyIndex)
+	{
+		m_parents[bodyIndex] = m_parents[m_parents[bodyIndex]];
+		bodyIndex = m_parents[bodyIndex];
+	}
+
+	return bodyIndex;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Lower index always becomes the root, so the result doesn't depend on the order of the joins
+void BodyIslandBuilder::Join(int bodyIndexA, int bodyIndexB)
+{
+	const int rootA = FindRoot(bodyIndexA);
+	const int rootB = FindRoot(bodyIndexB);
+
+	if (rootA < rootB)
+	{
+		m_parents[rootB] = rootA;
+	}
+	else if (rootB < rootA)
+	{
+		m_parents[rootA] = rootB;
+	}
+}
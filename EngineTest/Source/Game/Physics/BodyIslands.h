@@ -0,0 +1,81 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Groups awake bodies and their contacts into islands that can be solved independently
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyCollision.h"
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodyStore;
+
+// Ranges into the builder's body list, the (reordered) contact list and the solver's batches
+struct BodyIsland
+{
+	int firstBody = 0;
+	int bodyCount = 0;
+	int firstContact = 0;
+	int contactCount = 0;
+	int firstBatch = 0;
+	int batchCount = 0;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Two awake dynamic bodies touching are in the same island; immovable bodies don't join islands together.
+// Islands are numbered by their lowest body index, and bodies and contacts keep their relative order within
+// an island, so the grouping only depends on the contacts and never on how the islands are solved
+class BodyIslandBuilder
+{
+public:
+	//-----Public Methods-----
+
+	void							BuildIslands(const BodyStore& store, std::vector<BodyContact>& contacts);
+
+	std::vector<BodyIsland>&		GetIslands() { return m_islands; }
+	const std::vector<BodyIsland>&	GetIslands() const { return m_islands; }
+	const std::vector<int>&			GetIslandBodies() const { return m_islandBodies; }
+
+
+private:
+	//-----Private Methods-----
+
+	int		FindRoot(int bodyIndex);
+	void	Join(int bodyIndexA, int bodyIndexB);
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<BodyIsland>		m_islands;
+	std::vector<int>			m_islandBodies;		// Body indices, grouped by island
+
+	// Scratch
+	std::vector<int>			m_parents;
+	std::vector<int>			m_bodyIslands;
+	std::vector<int>			m_contactIslands;
+	std::vector<BodyContact>	m_sortedContacts;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
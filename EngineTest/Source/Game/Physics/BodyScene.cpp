@@ -0,0 +1,624 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyScene.h"
+#include "Game/Physics/BodyBroadphase.h"
+#include "Game/Physics/BodyIntegrator.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Game/Framework/Profiler.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Job/Job.h"
+#include <algorithm>
+#include <cmath>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static Float3 DegreesToRadians(const Float3& degrees)
+{
+	return degrees * (PHYSICS_PI / 180.f);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static BodyDefinition MakeDefinition(BodyShapeType shapeType, float inverseMass, const Float3& position, const Float3& rotationDegrees, const Float3& velocity, const Float3& angularVelocityDegrees, bool hasGravity)
+{
+	BodyDefinition definition;
+	definition.shapeType = shapeType;
+	definition.inverseMass = inverseMass;
+	definition.position = position;
+	definition.rotation = CreateQuatFromEulerDegrees(rotationDegrees);
+	definition.velocity = velocity;
+	definition.angularVelocityRadians = DegreesToRadians(angularVelocityDegrees);
+	definition.affectedByGravity = hasGravity;
+
+	return definition;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Orders contacts by body pair so the solver sees the same order no matter which broadphase found them
+static bool IsPairLessThan(const BodyPair& a, const BodyPair& b)
+{
+	return (a.bodyA < b.bodyA) || (a.bodyA == b.bodyA && a.bodyB < b.bodyB);
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void BodyIslandSolveJob::Execute()
+{
+	for (int islandIndex = 0; islandIndex < m_islandCount; ++islandIndex)
+	{
+		const BodyIsland& island = m_islands[islandIndex];
+		m_solver.SolveBatches(m_store, island.firstBatch, island.batchCount, m_settings.solver, m_settings.simdMode);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyScene::BodyScene()
+{
+	m_broadphase = CreateBodyBroadphase(m_broadphaseType);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyScene::~BodyScene()
+{
+	SAFE_DELETE(m_broadphase);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyHandle BodyScene::AddBox(const Float3& extents, float inverseMass, const Float3& position, const Float3& rotationDegrees /*= Float3()*/, const Float3& velocity /*= Float3()*/, const Float3& angularVelocityDegrees /*= Float3()*/, bool hasGravity /*= true*/)
+{
+	BodyDefinition definition = MakeDefinition(BODY_SHAPE_BOX, inverseMass, position, rotationDegrees, velocity, angularVelocityDegrees, hasGravity);
+	definition.halfExtents = extents;
+
+	return AddBody(definition);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyHandle BodyScene::AddSphere(float radius, float inverseMass, const Float3& position, const Float3& rotationDegrees /*= Float3()*/, const Float3& velocity /*= Float3()*/, const Float3& angularVelocityDegrees /*= Float3()*/, bool hasGravity /*= true*/)
+{
+	BodyDefinition definition = MakeDefinition(BODY_SHAPE_SPHERE, inverseMass, position, rotationDegrees, velocity, angularVelocityDegrees, hasGravity);
+	definition.radius = radius;
+
+	return AddBody(definition);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Like Game::SpawnCapsule, the segment runs from -cylinderHeight to +cylinderHeight along local y
+BodyHandle BodyScene::AddCapsule(float cylinderHeight, float radius, float inverseMass, const Float3& position, const Float3& rotationDegrees /*= Float3()*/, const Float3& velocity /*= Float3()*/, const Float3& angularVelocityDegrees /*= Float3()*/, bool hasGravity /*= true*/)
+{
+	BodyDefinition definition = MakeDefinition(BODY_SHAPE_CAPSULE, inverseMass, position, rotationDegrees, velocity, angularVelocityDegrees, hasGravity);
+	definition.radius = radius;
+	definition.halfHeight = cylinderHeight;
+
+	return AddBody(definition);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyHandle BodyScene::AddBody(const BodyDefinition& definition)
+{
+	return m_store.AddBody(definition);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyScene::RemoveBody(BodyHandle handle)
+{
+	m_store.RemoveBody(handle);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Static half space, everything on the side opposite the normal is solid
+void BodyScene::AddPlane(const Float3& normal, float distance)
+{
+	BodyPlane plane;
+	plane.normal = SafeNormalize(normal, Float3(0.f, 1.f, 0.f));
+	plane.distance = distance;
+
+	m_planes.push_back(plane);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// New broadphases start empty, so this can be done between any two steps
+void BodyScene::SetBroadphase(BodyBroadphaseType type)
+{
+	if (type == m_broadphaseType)
+	{
+		return;
+	}
+
+	SAFE_DELETE(m_broadphase);
+	m_broadphaseType = type;
+	m_broadphase = CreateBodyBroadphase(type);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The sleep timer is left alone, so a body that is nudged but stays still goes back to sleep with its island
+void BodyScene::WakeBody(BodyHandle handle)
+{
+	const int index = m_store.GetIndex(handle);
+	if (index >= 0)
+	{
+		m_store.SetFlag(index, BODY_FLAG_ASLEEP, false);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyScene::DoPhysicsStep(float deltaSeconds)
+{
+	m_lastStepStats = BodySceneStats();
+
+	const double startTime = Profiler::GetSeconds();
+
+	IntegrateBodyVelocities(m_store, m_settings.gravity, deltaSeconds, m_settings.simdMode);
+	UpdateBounds();
+
+	const double integrateEndTime = Profiler::GetSeconds();
+
+	FindPairs();
+	WakeTouchedBodies();
+
+	const double broadphaseEndTime = Profiler::GetSeconds();
+
+	FindContacts();
+
+	const double narrowphaseEndTime = Profiler::GetSeconds();
+
+	SolveIslands(deltaSeconds);
+
+	const double solveEndTime = Profiler::GetSeconds();
+
+	IntegrateBodyPositions(m_store, deltaSeconds, m_settings.simdMode);
+
+	const double timeOfImpactStartTime = Profiler::GetSeconds();
+
+	SolveTimeOfImpact(deltaSeconds);
+
+	const double timeOfImpactEndTime = Profiler::GetSeconds();
+
+	UpdateSleep(deltaSeconds);
+
+	m_stepIndex++;
+	m_simulatedSeconds += (double)deltaSeconds;
+
+	const double endTime = Profiler::GetSeconds();
+
+	m_lastStepStats.integrateSeconds = (integrateEndTime - startTime) + (timeOfImpactStartTime - solveEndTime) + (endTime - timeOfImpactEndTime);
+	m_lastStepStats.broadphaseSeconds = broadphaseEndTime - integrateEndTime;
+	m_lastStepStats.narrowphaseSeconds = narrowphaseEndTime - broadphaseEndTime;
+	m_lastStepStats.solveSeconds = solveEndTime - narrowphaseEndTime;
+	m_lastStepStats.timeOfImpactSeconds = timeOfImpactEndTime - timeOfImpactStartTime;
+	m_lastStepStats.pairCount = (int)m_pairs.size();
+	m_lastStepStats.contactCount = (int)m_contacts.size();
+	m_lastStepStats.islandCount = (int)m_islandBuilder.GetIslands().size();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Pairs, contacts, islands and the solver's batches are all rebuilt from scratch every step, so they're left out
+void BodyScene::SaveSnapshot(BodySnapshot& out_snapshot) const
+{
+	BodySnapshotHeader header;
+	header.magic = BODY_SNAPSHOT_MAGIC;
+	header.version = BODY_SNAPSHOT_VERSION;
+	header.stepIndex = m_stepIndex;
+	header.simulatedSeconds = m_simulatedSeconds;
+
+	BodySnapshotWriter writer(out_snapshot);
+	writer.WriteValue(header);
+	writer.WriteArray(m_planes);
+
+	m_store.WriteSnapshot(writer);
+	m_contactCache.WriteSnapshot(writer);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The broadphase is thrown away rather than saved, as the ones that keep state between steps (the tree, sweep
+// and prune) track bodies by slot and position and would be stale. Every broadphase finds exactly the
+// overlapping pairs and FindPairs sorts them, so a fresh one gives the same pairs; it just rebuilds next step
+bool BodyScene::RestoreSnapshot(const BodySnapshot& snapshot)
+{
+	BodySnapshotHeader header;
+	BodySnapshotReader reader(snapshot);
+
+	bool isValid = (snapshot.GetHeader(header) && reader.ReadValue(header) && reader.ReadArray(m_planes));
+	isValid = (m_store.ReadSnapshot(reader) && isValid);
+	isValid = (m_contactCache.ReadSnapshot(reader) && isValid);
+	isValid = (isValid && reader.GetRemainingSize() == 0);
+
+	if (!isValid)
+	{
+		m_store.Clear();
+		m_contactCache.Clear();
+		m_planes.clear();
+		header = BodySnapshotHeader();
+	}
+
+	m_stepIndex = header.stepIndex;
+	m_simulatedSeconds = header.simulatedSeconds;
+	m_lastStepStats = BodySceneStats();
+
+	SAFE_DELETE(m_broadphase);
+	m_broadphase = CreateBodyBroadphase(m_broadphaseType);
+
+	return isValid;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Only finds where things are, RestoreSnapshot is still what checks the contents make sense
+bool BodyScene::GetSnapshotLayout(const BodySnapshot& snapshot, BodySnapshotLayout& out_layout)
+{
+	BodySnapshotHeader header;
+	BodySnapshotReader reader(snapshot);
+
+	uint32_t planeCount = 0;
+	bool isValid = (snapshot.GetHeader(header) && reader.SkipBytes(sizeof(header)) != nullptr && reader.ReadValue(planeCount));
+	isValid = (isValid && reader.SkipBytes(sizeof(BodyPlane) * planeCount) != nullptr);
+	isValid = (isValid && BodyStore::ReadSnapshotLayout(reader, out_layout));
+
+	out_layout.contactCacheOffset = reader.GetReadSize();
+	return isValid;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// World AABB of each shape, padded by the bounds margin
+void BodyScene::UpdateBounds()
+{
+	const int bodyCount = m_store.GetCount();
+	const uint8_t* shapeTypes = m_store.GetShapeTypes();
+	const float* radii = m_store.GetField(BODY_SHAPE_RADIUS);
+	const float* halfHeights = m_store.GetField(BODY_SHAPE_HALF_HEIGHT);
+	float* minX = m_store.GetField(BODY_BOUNDS_MIN_X);
+	float* minY = m_store.GetField(BODY_BOUNDS_MIN_Y);
+	float* minZ = m_store.GetField(BODY_BOUNDS_MIN_Z);
+	float* maxX = m_store.GetField(BODY_BOUNDS_MAX_X);
+	float* maxY = m_store.GetField(BODY_BOUNDS_MAX_Y);
+	float* maxZ = m_store.GetField(BODY_BOUNDS_MAX_Z);
+
+	const float margin = m_settings.boundsMargin;
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const Float3 position = m_store.GetFloat3(bodyIndex, BODY_POSITION_X);
+		Float3 halfSize;
+
+		switch (shapeTypes[bodyIndex])
+		{
+		case BODY_SHAPE_BOX:
+		{
+			Float3 xAxis, yAxis, zAxis;
+			GetAxes(m_store.GetRotation(bodyIndex), xAxis, yAxis, zAxis);
+
+			const Float3 extents = m_store.GetFloat3(bodyIndex, BODY_SHAPE_HALF_EXTENT_X);
+			halfSize.x = fabsf(xAxis.x) * extents.x + fabsf(yAxis.x) * extents.y + fabsf(zAxis.x) * extents.z;
+			halfSize.y = fabsf(xAxis.y) * extents.x + fabsf(yAxis.y) * extents.y + fabsf(zAxis.y) * extents.z;
+			halfSize.z = fabsf(xAxis.z) * extents.x + fabsf(yAxis.z) * extents.y + fabsf(zAxis.z) * extents.z;
+			break;
+		}
+		case BODY_SHAPE_CAPSULE:
+		{
+			const Float3 segment = Rotate(m_store.GetRotation(bodyIndex), Float3(0.f, halfHeights[bodyIndex], 0.f));
+			halfSize = Float3(fabsf(segment.x) + radii[bodyIndex], fabsf(segment.y) + radii[bodyIndex], fabsf(segment.z) + radii[bodyIndex]);
+			break;
+		}
+		case BODY_SHAPE_SPHERE:
+		default:
+			halfSize = Float3(radii[bodyIndex], radii[bodyIndex], radii[bodyIndex]);
+			break;
+		}
+
+		minX[bodyIndex] = position.x - halfSize.x - margin;
+		minY[bodyIndex] = position.y - halfSize.y - margin;
+		minZ[bodyIndex] = position.z - halfSize.z - margin;
+		maxX[bodyIndex] = position.x + halfSize.x + margin;
+		maxY[bodyIndex] = position.y + halfSize.y + margin;
+		maxZ[bodyIndex] = position.z + halfSize.z + margin;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyScene::FindPairs()
+{
+	m_pairs.clear();
+	m_broadphase->FindPairs(m_store, m_pairs);
+
+	std::sort(m_pairs.begin(), m_pairs.end(), IsPairLessThan);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Any sleeping body paired with an awake one wakes up, before contacts are found so it gets its plane contacts too.
+// Its own sleeping neighbours wake on the next step, once it can pair with them
+void BodyScene::WakeTouchedBodies()
+{
+	for (const BodyPair& pair : m_pairs)
+	{
+		if (m_store.HasFlag(pair.bodyA, BODY_FLAG_ASLEEP))
+		{
+			m_store.SetFlag(pair.bodyA, BODY_FLAG_ASLEEP, false);
+		}
+
+		if (m_store.HasFlag(pair.bodyB, BODY_FLAG_ASLEEP))
+		{
+			m_store.SetFlag(pair.bodyB, BODY_FLAG_ASLEEP, false);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Planes first, then body pairs, both in index order. Everything goes through the contact cache, which
+// either reuses last step's manifold or runs narrowphase and matches the result against it
+void BodyScene::FindContacts()
+{
+	m_contacts.clear();
+	m_contactCache.BeginStep();
+
+	const int bodyCount = m_store.GetCount();
+	const int planeCount = (int)m_planes.size();
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if (!m_store.IsAwakeAndDynamic(bodyIndex))
+		{
+			continue;
+		}
+
+		for (int planeIndex = 0; planeIndex < planeCount; ++planeIndex)
+		{
+			m_contactCache.CollideBodyWithPlane(m_store, bodyIndex, m_planes[planeIndex], planeIndex, m_settings.contactCache, m_contacts);
+		}
+	}
+
+	for (const BodyPair& pair : m_pairs)
+	{
+		m_contactCache.CollideBodies(m_store, pair.bodyA, pair.bodyB, m_settings.contactCache, m_contacts);
+	}
+
+	m_lastStepStats.reusedManifoldCount = m_contactCache.GetReusedManifoldCount();
+	m_lastStepStats.warmStartedContactCount = m_contactCache.GetWarmStartedContactCount();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Splits the contacts into islands and batches each island on its own, then solves runs of islands as jobs.
+// Batches only depend on the island's contacts, and every island is solved start to finish by one job,
+// so the result is the same for any number of threads (including none)
+void BodyScene::SolveIslands(float deltaSeconds)
+{
+	m_islandBuilder.BuildIslands(m_store, m_contacts);
+	m_solver.PrepareContacts(m_store, m_contacts, deltaSeconds, m_settings.solver);
+	m_solver.ClearBatches(m_store.GetCount());
+
+	std::vector<BodyIsland>& islands = m_islandBuilder.GetIslands();
+	for (BodyIsland& island : islands)
+	{
+		island.firstBatch = m_solver.BuildBatches(m_store, m_contacts, island.firstContact, island.contactCount);
+		island.batchCount = m_solver.GetBatchCount() - island.firstBatch;
+	}
+
+	const bool runAsJobs = (m_settings.solveIslandsInParallel && g_jobScheduler != nullptr && g_jobScheduler->GetWorkerCount() > 0);
+	m_solveJobs.clear();
+
+	const int islandCount = (int)islands.size();
+	int firstIsland = 0;
+	while (firstIsland < islandCount)
+	{
+		int endIsland = firstIsland;
+		int jobContactCount = 0;
+
+		while (endIsland < islandCount && (jobContactCount == 0 || jobContactCount + islands[endIsland].contactCount <= m_settings.contactsPerSolveJob || !runAsJobs))
+		{
+			jobContactCount += islands[endIsland].contactCount;
+			endIsland++;
+		}
+
+		m_solveJobs.emplace_back(m_solver, m_store, m_settings, islands.data() + firstIsland, endIsland - firstIsland);
+		firstIsland = endIsland;
+	}
+
+	if (runAsJobs)
+	{
+		// Children of whatever job is stepping the scene, if any, so waiting on that job covers these too
+		const JobHandle parent = JobScheduler::GetCurrentJob();
+		m_solveJobHandles.clear();
+
+		for (BodyIslandSolveJob& job : m_solveJobs)
+		{
+			m_solveJobHandles.push_back(g_jobScheduler->Submit(&job, parent));
+		}
+
+		for (const JobHandle& handle : m_solveJobHandles)
+		{
+			g_jobScheduler->Wait(handle);
+		}
+	}
+	else
+	{
+		for (BodyIslandSolveJob& job : m_solveJobs)
+		{
+			job.Execute();
+		}
+	}
+
+	m_solver.StoreImpulses(m_contacts);
+	m_contactCache.StoreImpulses(m_contacts);
+	m_lastStepStats.solveJobCount = (int)m_solveJobs.size();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Runs after positions are integrated. Each continuous body that moved far enough to tunnel sweeps its core sphere
+// from where it started against the planes and every body whose bounds the sweep crosses, and is pulled back
+// to the first hit. Velocity is left alone, so the contact is handled next step like any other.
+// Other bodies are swept against where they ended up, using the motion relative to them. This is linear in the
+// body count per swept body, which is fine for the few projectiles it's meant for; everything else skips it
+void BodyScene::SolveTimeOfImpact(float deltaSeconds)
+{
+	const int bodyCount = m_store.GetCount();
+	const int planeCount = (int)m_planes.size();
+	const uint8_t* flags = m_store.GetFlags();
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if ((flags[bodyIndex] & BODY_FLAG_CONTINUOUS) == 0 || !m_store.IsAwakeAndDynamic(bodyIndex))
+		{
+			continue;
+		}
+
+		const Float3 displacement = m_store.GetFloat3(bodyIndex, BODY_VELOCITY_X) * deltaSeconds;
+		const float coreRadius = GetBodyCoreRadius(m_store, bodyIndex);
+
+		if (LengthSquared(displacement) <= (m_settings.continuousMotionThreshold * coreRadius) * (m_settings.continuousMotionThreshold * coreRadius))
+		{
+			continue;
+		}
+
+		m_lastStepStats.sweptBodyCount++;
+
+		const Float3 end = m_store.GetFloat3(bodyIndex, BODY_POSITION_X);
+		const Float3 start = end - displacement;
+		const float sweepRadius = std::max(coreRadius - m_settings.timeOfImpactDepth, 0.5f * coreRadius);
+		const FloatAabb sweptBounds = Expand(Union(FloatAabb(start, start), FloatAabb(end, end)), sweepRadius);
+
+		float firstHit = 1.f;
+		float fraction = 1.f;
+
+		for (int planeIndex = 0; planeIndex < planeCount; ++planeIndex)
+		{
+			if (SweepSphereAgainstPlane(m_planes[planeIndex], start, displacement, sweepRadius, fraction))
+			{
+				firstHit = std::min(firstHit, fraction);
+			}
+		}
+
+		for (int otherIndex = 0; otherIndex < bodyCount; ++otherIndex)
+		{
+			if (otherIndex == bodyIndex)
+			{
+				continue;
+			}
+
+			// Bounds are from the start of the step, so they're stretched over the other body's move too
+			const Float3 otherDisplacement = m_store.GetFloat3(otherIndex, BODY_VELOCITY_X) * deltaSeconds;
+			const FloatAabb otherStartBounds = m_store.GetBounds(otherIndex);
+			const FloatAabb otherBounds = Union(otherStartBounds, FloatAabb(otherStartBounds.mins + otherDisplacement, otherStartBounds.maxs + otherDisplacement));
+
+			if (DoAabbsOverlap(sweptBounds, otherBounds)
+				&& SweepSphereAgainstBody(m_store, otherIndex, start + otherDisplacement, displacement - otherDisplacement, sweepRadius, fraction))
+			{
+				firstHit = std::min(firstHit, fraction);
+			}
+		}
+
+		if (firstHit < 1.f)
+		{
+			m_store.SetFloat3(bodyIndex, BODY_POSITION_X, start + displacement * firstHit);
+			m_lastStepStats.timeOfImpactCount++;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bodies count how long they've been slow; an island sleeps once all of its bodies have been slow long enough.
+// Bodies that can't sleep never count up, which keeps their whole island awake
+void BodyScene::UpdateSleep(float deltaSeconds)
+{
+	const int bodyCount = m_store.GetCount();
+	float* sleepSeconds = m_store.GetField(BODY_SLEEP_SECONDS);
+
+	const float linearLimitSquared = m_settings.sleepLinearSpeed * m_settings.sleepLinearSpeed;
+	const float angularLimitSquared = m_settings.sleepAngularSpeed * m_settings.sleepAngularSpeed;
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if (!m_store.IsAwakeAndDynamic(bodyIndex))
+		{
+			continue;
+		}
+
+		const Float3 velocity = m_store.GetFloat3(bodyIndex, BODY_VELOCITY_X);
+		const Float3 angularVelocity = m_store.GetFloat3(bodyIndex, BODY_ANGULAR_VELOCITY_X);
+		const bool isSlow = (Dot(velocity, velocity) < linearLimitSquared && Dot(angularVelocity, angularVelocity) < angularLimitSquared);
+
+		if (isSlow && m_store.HasFlag(bodyIndex, BODY_FLAG_CAN_SLEEP))
+		{
+			sleepSeconds[bodyIndex] += deltaSeconds;
+		}
+		else
+		{
+			sleepSeconds[bodyIndex] = 0.f;
+		}
+	}
+
+	const std::vector<int>& islandBodies = m_islandBuilder.GetIslandBodies();
+	for (const BodyIsland& island : m_islandBuilder.GetIslands())
+	{
+		float islandSleepSeconds = m_settings.timeToSleep;
+		for (int bodyOffset = 0; bodyOffset < island.bodyCount; ++bodyOffset)
+		{
+			islandSleepSeconds = std::min(islandSleepSeconds, sleepSeconds[islandBodies[island.firstBody + bodyOffset]]);
+		}
+
+		if (islandSleepSeconds < m_settings.timeToSleep)
+		{
+			continue;
+		}
+
+		for (int bodyOffset = 0; bodyOffset < island.bodyCount; ++bodyOffset)
+		{
+			const int bodyIndex = islandBodies[island.firstBody + bodyOffset];
+			m_store.SetFlag(bodyIndex, BODY_FLAG_ASLEEP, true);
+			m_store.SetFloat3(bodyIndex, BODY_VELOCITY_X, Float3());
+			m_store.SetFloat3(bodyIndex, BODY_ANGULAR_VELOCITY_X, Float3());
+		}
+	}
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if (m_store.HasFlag(bodyIndex, BODY_FLAG_ASLEEP))
+		{
+			m_lastStepStats.sleepingBodyCount++;
+		}
+	}
+}
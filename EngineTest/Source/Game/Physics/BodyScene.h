@@ -0,0 +1,180 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Rigid body simulation over a BodyStore, stepping every body in bulk passes
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyBroadphase.h"
+#include "Game/Physics/BodyCollision.h"
+#include "Game/Physics/BodyContactCache.h"
+#include "Game/Physics/BodyContactSolver.h"
+#include "Game/Physics/BodyIslands.h"
+#include "Game/Physics/BodySimd.h"
+#include "Game/Physics/BodySnapshot.h"
+#include "Game/Physics/BodyStore.h"
+#include "Game/Framework/JobScheduler.h"
+#include "Engine/Job/Job.h"
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+struct BodySceneSettings
+{
+	Float3				gravity = Float3(0.f, -9.8f, 0.f);
+	float				boundsMargin = 0.05f;		// Added to each side of the bounds, so resting contacts stay paired
+	BodySimdMode		simdMode = GetBestBodySimdMode();
+	BodySolverSettings	solver;
+	BodyContactCacheSettings	contactCache;
+	bool				solveIslandsInParallel = true;	// On g_jobScheduler, when there is one
+	int					contactsPerSolveJob = 128;		// Small islands are grouped into jobs of about this many contacts
+
+	// BODY_FLAG_CONTINUOUS bodies moving further than this fraction of their core radius in a step are swept,
+	// and stopped timeOfImpactDepth past first touch so narrowphase finds the contact next step
+	float				continuousMotionThreshold = 0.5f;
+	float				timeOfImpactDepth = 0.005f;
+
+	// Islands of CAN_SLEEP bodies that stay below both speeds for timeToSleep go to sleep together
+	float				sleepLinearSpeed = 0.05f;
+	float				sleepAngularSpeed = 0.05f;
+	float				timeToSleep = 0.5f;
+};
+
+// Timings and counts from the most recent DoPhysicsStep
+struct BodySceneStats
+{
+	double	integrateSeconds = 0.0;
+	double	broadphaseSeconds = 0.0;
+	double	narrowphaseSeconds = 0.0;
+	double	solveSeconds = 0.0;
+	double	timeOfImpactSeconds = 0.0;
+	int		pairCount = 0;
+	int		contactCount = 0;
+	int		reusedManifoldCount = 0;		// Pairs that skipped narrowphase
+	int		warmStartedContactCount = 0;
+	int		islandCount = 0;
+	int		solveJobCount = 0;
+	int		sleepingBodyCount = 0;
+	int		sweptBodyCount = 0;				// Continuous bodies moving fast enough to be swept
+	int		timeOfImpactCount = 0;			// Swept bodies that hit something and were pulled back
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Solves a run of consecutive islands; islands share no dynamic bodies, so jobs never touch the same velocities
+class BodyIslandSolveJob : public Job
+{
+public:
+	//-----Public Methods-----
+
+	BodyIslandSolveJob(BodyContactSolver& solver, BodyStore& store, const BodySceneSettings& settings, const BodyIsland* islands, int islandCount)
+		: m_solver(solver), m_store(store), m_settings(settings), m_islands(islands), m_islandCount(islandCount) {}
+
+	virtual void Execute() override;
+	virtual void Finalize() override {}
+
+
+private:
+	//-----Private Data-----
+
+	BodyContactSolver&			m_solver;
+	BodyStore&					m_store;
+	const BodySceneSettings&	m_settings;
+	const BodyIsland*			m_islands = nullptr;
+	int							m_islandCount = 0;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+class BodyScene
+{
+public:
+	//-----Public Methods-----
+
+	BodyScene();
+	~BodyScene();
+
+	// Same arguments as the Game spawn helpers, so scenes can be built against either
+	BodyHandle					AddBox(const Float3& extents, float inverseMass, const Float3& position, const Float3& rotationDegrees = Float3(), const Float3& velocity = Float3(), const Float3& angularVelocityDegrees = Float3(), bool hasGravity = true);
+	BodyHandle					AddSphere(float radius, float inverseMass, const Float3& position, const Float3& rotationDegrees = Float3(), const Float3& velocity = Float3(), const Float3& angularVelocityDegrees = Float3(), bool hasGravity = true);
+	BodyHandle					AddCapsule(float cylinderHeight, float radius, float inverseMass, const Float3& position, const Float3& rotationDegrees = Float3(), const Float3& velocity = Float3(), const Float3& angularVelocityDegrees = Float3(), bool hasGravity = true);
+	BodyHandle					AddBody(const BodyDefinition& definition);
+	void						RemoveBody(BodyHandle handle);
+	void						AddPlane(const Float3& normal, float distance);
+	void						WakeBody(BodyHandle handle);
+	void						SetBroadphase(BodyBroadphaseType type);
+
+	void						DoPhysicsStep(float deltaSeconds);
+
+	// Restoring puts back every body, plane, cached manifold and the step clock, so stepping on from there
+	// gives bit identical results to the steps that followed the save. Fails (leaving the scene empty) if
+	// the snapshot is corrupt
+	void						SaveSnapshot(BodySnapshot& out_snapshot) const;
+	bool						RestoreSnapshot(const BodySnapshot& snapshot);
+	static bool					GetSnapshotLayout(const BodySnapshot& snapshot, BodySnapshotLayout& out_layout);
+
+	BodyStore&					GetStore() { return m_store; }
+	const BodyStore&			GetStore() const { return m_store; }
+	BodySceneSettings&			GetSettings() { return m_settings; }
+	const BodySceneStats&		GetLastStepStats() const { return m_lastStepStats; }
+	const BodyBroadphase*		GetBroadphase() const { return m_broadphase; }
+	const std::vector<BodyContact>&	GetContacts() const { return m_contacts; }		// From the last step
+	uint64_t					GetStepIndex() const { return m_stepIndex; }			// Steps taken so far
+	double						GetSimulatedSeconds() const { return m_simulatedSeconds; }
+
+
+private:
+	//-----Private Methods-----
+
+	void UpdateBounds();
+	void FindPairs();
+	void WakeTouchedBodies();
+	void FindContacts();
+	void SolveIslands(float deltaSeconds);
+	void SolveTimeOfImpact(float deltaSeconds);
+	void UpdateSleep(float deltaSeconds);
+
+
+private:
+	//-----Private Data-----
+
+	BodySceneSettings			m_settings;
+	BodySceneStats				m_lastStepStats;
+
+	BodyStore					m_store;
+	std::vector<BodyPlane>		m_planes;
+	BodyBroadphase*				m_broadphase = nullptr;
+	BodyBroadphaseType			m_broadphaseType = BODY_BROADPHASE_SORT_AND_SWEEP;
+	BodyIslandBuilder			m_islandBuilder;
+	BodyContactSolver			m_solver;
+	BodyContactCache			m_contactCache;
+
+	std::vector<BodyPair>		m_pairs;
+	std::vector<BodyContact>	m_contacts;
+	std::vector<BodyIslandSolveJob>	m_solveJobs;		// Kept between steps along with their handles, so solving doesn't allocate
+	std::vector<JobHandle>		m_solveJobHandles;
+
+	uint64_t					m_stepIndex = 0;
+	double						m_simulatedSeconds = 0.0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
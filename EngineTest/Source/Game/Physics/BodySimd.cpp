@@ -0,0 +1,82 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodySimd.h"
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char* s_simdModeNames[NUM_BODY_SIMD_MODES] = { "scalar", "sse" };
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// SSE2 is part of the x64 baseline (and of any x86 target the compiler accepts __SSE2__ for), so
+// support is decided at compile time rather than with cpuid
+bool IsBodySimdModeSupported(BodySimdMode mode)
+{
+	switch (mode)
+	{
+	case BODY_SIMD_SCALAR:
+		return true;
+	case BODY_SIMD_SSE:
+#ifdef BODY_SIMD_SSE_AVAILABLE
+		return true;
+#else
+		return false;
+#endif
+	default:
+		return false;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodySimdMode GetBestBodySimdMode()
+{
+	return (IsBodySimdModeSupported(BODY_SIMD_SSE) ? BODY_SIMD_SSE : BODY_SIMD_SCALAR);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+const char* GetBodySimdModeName(BodySimdMode mode)
+{
+	if (mode >= 0 && mode < NUM_BODY_SIMD_MODES)
+	{
+		return s_simdModeNames[mode];
+	}
+
+	return "unknown";
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodySimdMode GetBodySimdModeFromName(const char* name, BodySimdMode defaultMode)
+{
+	for (int modeIndex = 0; modeIndex < NUM_BODY_SIMD_MODES; ++modeIndex)
+	{
+		if (strcmp(name, s_simdModeNames[modeIndex]) == 0)
+		{
+			return (BodySimdMode)modeIndex;
+		}
+	}
+
+	return defaultMode;
+}
@@ -0,0 +1,150 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Lane types for writing the body passes once and running them 1 or 4 bodies at a time.
+///				 FloatLane1 is the scalar fallback, and does the exact same operations per lane as FloatLane4
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cmath>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BODY_SIMD_SSE_AVAILABLE
+#include <emmintrin.h>
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+enum BodySimdMode
+{
+	BODY_SIMD_SCALAR,
+	BODY_SIMD_SSE,
+	NUM_BODY_SIMD_MODES
+};
+
+
+//-------------------------------------------------------------------------------------------------
+struct FloatLane1
+{
+	static const int WIDTH = 1;
+
+	FloatLane1() {}
+	explicit FloatLane1(float value_) : value(value_) {}
+
+	static FloatLane1	Load(const float* source) { return FloatLane1(*source); }
+	void				Store(float* destination) const { *destination = value; }
+
+	// 1.f for each lane whose flags byte has the bit set, otherwise 0.f
+	static FloatLane1	LoadFlags(const uint8_t* flags, uint8_t flag) { return FloatLane1((flags[0] & flag) != 0 ? 1.f : 0.f); }
+
+	FloatLane1 operator+(const FloatLane1& other) const { return FloatLane1(value + other.value); }
+	FloatLane1 operator-(const FloatLane1& other) const { return FloatLane1(value - other.value); }
+	FloatLane1 operator*(const FloatLane1& other) const { return FloatLane1(value * other.value); }
+	FloatLane1 operator/(const FloatLane1& other) const { return FloatLane1(value / other.value); }
+
+	float value = 0.f;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// All bits set or clear per lane, from comparisons
+struct MaskLane1
+{
+	explicit MaskLane1(bool value_) : value(value_) {}
+
+	MaskLane1 operator&(const MaskLane1& other) const { return MaskLane1(value && other.value); }
+
+	bool value;
+};
+
+#ifdef BODY_SIMD_SSE_AVAILABLE
+
+//-------------------------------------------------------------------------------------------------
+struct FloatLane4
+{
+	static const int WIDTH = 4;
+
+	FloatLane4() : value(_mm_setzero_ps()) {}
+	explicit FloatLane4(float value_) : value(_mm_set1_ps(value_)) {}
+	explicit FloatLane4(__m128 value_) : value(value_) {}
+
+	// Unaligned, body arrays are plain std::vectors
+	static FloatLane4	Load(const float* source) { return FloatLane4(_mm_loadu_ps(source)); }
+	void				Store(float* destination) const { _mm_storeu_ps(destination, value); }
+
+	static FloatLane4 LoadFlags(const uint8_t* flags, uint8_t flag)
+	{
+		return FloatLane4(_mm_setr_ps(
+			(flags[0] & flag) != 0 ? 1.f : 0.f,
+			(flags[1] & flag) != 0 ? 1.f : 0.f,
+			(flags[2] & flag) != 0 ? 1.f : 0.f,
+			(flags[3] & flag) != 0 ? 1.f : 0.f));
+	}
+
+	FloatLane4 operator+(const FloatLane4& other) const { return FloatLane4(_mm_add_ps(value, other.value)); }
+	FloatLane4 operator-(const FloatLane4& other) const { return FloatLane4(_mm_sub_ps(value, other.value)); }
+	FloatLane4 operator*(const FloatLane4& other) const { return FloatLane4(_mm_mul_ps(value, other.value)); }
+	FloatLane4 operator/(const FloatLane4& other) const { return FloatLane4(_mm_div_ps(value, other.value)); }
+
+	__m128 value;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+struct MaskLane4
+{
+	explicit MaskLane4(__m128 value_) : value(value_) {}
+
+	MaskLane4 operator&(const MaskLane4& other) const { return MaskLane4(_mm_and_ps(value, other.value)); }
+
+	__m128 value;
+};
+
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+bool			IsBodySimdModeSupported(BodySimdMode mode);
+BodySimdMode	GetBestBodySimdMode();
+const char*		GetBodySimdModeName(BodySimdMode mode);
+BodySimdMode	GetBodySimdModeFromName(const char* name, BodySimdMode defaultMode);
+
+
+//-------------------------------------------------------------------------------------------------
+inline FloatLane1	Sqrt(const FloatLane1& a) { return FloatLane1(sqrtf(a.value)); }
+inline FloatLane1	Min(const FloatLane1& a, const FloatLane1& b) { return FloatLane1(a.value < b.value ? a.value : b.value); }
+inline FloatLane1	Max(const FloatLane1& a, const FloatLane1& b) { return FloatLane1(a.value > b.value ? a.value : b.value); }
+inline MaskLane1	IsGreaterThan(const FloatLane1& a, const FloatLane1& b) { return MaskLane1(a.value > b.value); }
+inline FloatLane1	Select(const MaskLane1& mask, const FloatLane1& ifTrue, const FloatLane1& ifFalse) { return (mask.value ? ifTrue : ifFalse); }
+
+
+#ifdef BODY_SIMD_SSE_AVAILABLE
+
+//-------------------------------------------------------------------------------------------------
+inline FloatLane4	Sqrt(const FloatLane4& a) { return FloatLane4(_mm_sqrt_ps(a.value)); }
+inline FloatLane4	Min(const FloatLane4& a, const FloatLane4& b) { return FloatLane4(_mm_min_ps(a.value, b.value)); }
+inline FloatLane4	Max(const FloatLane4& a, const FloatLane4& b) { return FloatLane4(_mm_max_ps(a.value, b.value)); }
+inline MaskLane4	IsGreaterThan(const FloatLane4& a, const FloatLane4& b) { return MaskLane4(_mm_cmpgt_ps(a.value, b.value)); }
+inline FloatLane4	Select(const MaskLane4& mask, const FloatLane4& ifTrue, const FloatLane4& ifFalse) { return FloatLane4(_mm_or_ps(_mm_and_ps(mask.value, ifTrue.value), _mm_andnot_ps(mask.value, ifFalse.value))); }
+
+#endif
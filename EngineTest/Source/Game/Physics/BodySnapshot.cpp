@@ -0,0 +1,561 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodySnapshot.h"
+#include "Game/Framework/Lz4Compression.h"
+#include "Game/Physics/BodyScene.h"
+#include "Game/Physics/BodyStore.h"
+#include "Game/Physics/PhysicsMath.h"
+#include <cmath>
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+enum BodySnapshotDeltaMode : uint32_t
+{
+	BODY_SNAPSHOT_DELTA_WHOLE,		// The whole snapshot XORed against the base, exact
+	BODY_SNAPSHOT_DELTA_BODIES		// The header and planes, then only the bodies that changed, quantized
+};
+
+// Leads every delta; the compressed stream follows
+struct BodySnapshotDeltaHeader
+{
+	uint32_t magic = 0;
+	uint32_t mode = BODY_SNAPSHOT_DELTA_WHOLE;
+	uint32_t snapshotSize = 0;		// Once decoded
+	uint32_t streamSize = 0;		// Once decompressed
+};
+
+// Consecutive fields quantized together; a body only writes the groups whose quantized values changed
+struct BodyDeltaGroup
+{
+	BodyField	firstField;
+	int			componentCount;
+	float		stepsPerUnit;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const uint32_t s_deltaMagic = 0x444E5342; // "BSND"
+
+static const BodyDeltaGroup s_deltaGroups[] =
+{
+	{ BODY_POSITION_X,			3,	1024.f },	// Millimeter or so
+	{ BODY_ROTATION_W,			4,	32767.f },	// Unit quaternion, renormalized on decode
+	{ BODY_VELOCITY_X,			3,	1024.f },
+	{ BODY_ANGULAR_VELOCITY_X,	3,	1024.f },
+	{ BODY_SLEEP_SECONDS,		1,	1024.f }
+};
+static const int s_deltaGroupCount = (int)(sizeof(s_deltaGroups) / sizeof(s_deltaGroups[0]));
+
+// Only set by game code, so almost never change; sent exactly, all together, when any of them does.
+// The world inverse inertia isn't sent at all, it's rebuilt from the rotation on decode
+static const BodyField s_exactDeltaFields[] =
+{
+	BODY_ACCELERATION_X, BODY_ACCELERATION_Y, BODY_ACCELERATION_Z,
+	BODY_INVERSE_MASS, BODY_LOCAL_INVERSE_INERTIA_X, BODY_LOCAL_INVERSE_INERTIA_Y, BODY_LOCAL_INVERSE_INERTIA_Z,
+	BODY_MAX_LATERAL_SPEED,
+	BODY_SHAPE_RADIUS, BODY_SHAPE_HALF_HEIGHT, BODY_SHAPE_HALF_EXTENT_X, BODY_SHAPE_HALF_EXTENT_Y, BODY_SHAPE_HALF_EXTENT_Z
+};
+
+// Per body mask bits, after one per group
+static const uint8_t s_deltaRotationBit = (uint8_t)(1 << 1);
+static const uint8_t s_deltaFlagsBit = (uint8_t)(1 << s_deltaGroupCount);
+static const uint8_t s_deltaExactFieldsBit = (uint8_t)(1 << (s_deltaGroupCount + 1));
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Wherever the base is shorter than the snapshot, it counts as zeros; XOR is its own inverse, so this both
+// makes and undoes a delta
+static void XorWithBase(const BodySnapshot& base, const uint8_t* source, size_t size, uint8_t* out_destination)
+{
+	const size_t overlapSize = (base.GetSize() < size ? base.GetSize() : size);
+	const uint8_t* baseData = base.GetData();
+
+	for (size_t byteIndex = 0; byteIndex < overlapSize; ++byteIndex)
+	{
+		out_destination[byteIndex] = source[byteIndex] ^ baseData[byteIndex];
+	}
+
+	if (out_destination != source && size > overlapSize)
+	{
+		memcpy(out_destination + overlapSize, source + overlapSize, size - overlapSize);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Snapshot data has no alignment guarantees, so fields are copied in and out
+static float LoadField(const uint8_t* data, const BodySnapshotLayout& layout, int field, uint32_t bodyIndex)
+{
+	float value;
+	memcpy(&value, data + layout.fieldsOffset + sizeof(float) * ((size_t)field * layout.bodyCount + bodyIndex), sizeof(float));
+
+	return value;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static void StoreField(uint8_t* data, const BodySnapshotLayout& layout, int field, uint32_t bodyIndex, float value)
+{
+	memcpy(data + layout.fieldsOffset + sizeof(float) * ((size_t)field * layout.bodyCount + bodyIndex), &value, sizeof(float));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Clamped well inside int32_t, and NaN goes to the bottom, so the cast is always defined
+static int64_t Quantize(float value, float stepsPerUnit)
+{
+	const float scaled = value * stepsPerUnit;
+	const float clamped = (scaled < 1e9f ? (scaled > -1e9f ? scaled : -1e9f) : 1e9f);
+
+	return (int64_t)floorf(clamped + 0.5f);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Small changes either way take a byte or two
+static void WriteVarint(std::vector<uint8_t>& out_stream, int64_t signedValue)
+{
+	uint64_t value = ((uint64_t)signedValue << 1) ^ (uint64_t)(signedValue >> 63);
+	while (value >= 0x80)
+	{
+		out_stream.push_back((uint8_t)(value | 0x80));
+		value >>= 7;
+	}
+
+	out_stream.push_back((uint8_t)value);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool ReadVarint(const uint8_t*& cursor, const uint8_t* end, int64_t& out_signedValue)
+{
+	uint64_t value = 0;
+	for (int shift = 0; shift < 64 && cursor < end; shift += 7)
+	{
+		const uint8_t byte = *cursor++;
+		value |= (uint64_t)(byte & 0x7F) << shift;
+
+		if ((byte & 0x80) == 0)
+		{
+			out_signedValue = (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Same bodies in the same slots, with the same shapes and planes, so the body arrays line up one to one
+static bool CanDeltaBodies(const BodySnapshot& base, const BodySnapshotLayout& baseLayout, const BodySnapshot& snapshot, const BodySnapshotLayout& layout)
+{
+	if (baseLayout.bodyCount != layout.bodyCount || baseLayout.storeOffset != layout.storeOffset || baseLayout.contactCacheOffset != layout.contactCacheOffset)
+	{
+		return false;
+	}
+
+	const uint8_t* baseData = base.GetData();
+	const uint8_t* data = snapshot.GetData();
+
+	return (memcmp(baseData + baseLayout.shapeTypesOffset, data + layout.shapeTypesOffset, layout.bodyCount) == 0
+		&& memcmp(baseData + baseLayout.slotsOffset, data + layout.slotsOffset, layout.contactCacheOffset - layout.slotsOffset) == 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The header and planes as they are, then a mask for every body, then each group's changes for the bodies
+// whose mask has it. Going a group at a time keeps the reads to a few field arrays at once
+static void WriteBodyDeltas(const BodySnapshot& base, const BodySnapshotLayout& baseLayout, const BodySnapshot& snapshot, const BodySnapshotLayout& layout, std::vector<uint8_t>& out_stream)
+{
+	const uint8_t* baseData = base.GetData();
+	const uint8_t* data = snapshot.GetData();
+	const uint8_t* baseFlags = baseData + baseLayout.flagsOffset;
+	const uint8_t* flags = data + layout.flagsOffset;
+	const uint32_t bodyCount = layout.bodyCount;
+
+	out_stream.insert(out_stream.end(), data, data + layout.storeOffset);
+
+	const size_t masksOffset = out_stream.size();
+	out_stream.resize(masksOffset + bodyCount, 0);
+
+	for (int groupIndex = 0; groupIndex < s_deltaGroupCount; ++groupIndex)
+	{
+		const BodyDeltaGroup& group = s_deltaGroups[groupIndex];
+
+		for (uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+		{
+			// Asleep in both, so nothing moved it
+			if ((flags[bodyIndex] & BODY_FLAG_ASLEEP) != 0 && flags[bodyIndex] == baseFlags[bodyIndex])
+			{
+				continue;
+			}
+
+			int64_t changes[4];
+			bool hasChanged = false;
+			for (int componentIndex = 0; componentIndex < group.componentCount; ++componentIndex)
+			{
+				const int field = group.firstField + componentIndex;
+				changes[componentIndex] = Quantize(LoadField(data, layout, field, bodyIndex), group.stepsPerUnit) - Quantize(LoadField(baseData, baseLayout, field, bodyIndex), group.stepsPerUnit);
+				hasChanged = (hasChanged || changes[componentIndex] != 0);
+			}
+
+			if (hasChanged)
+			{
+				out_stream[masksOffset + bodyIndex] |= (uint8_t)(1 << groupIndex);
+
+				for (int componentIndex = 0; componentIndex < group.componentCount; ++componentIndex)
+				{
+					WriteVarint(out_stream, changes[componentIndex]);
+				}
+			}
+		}
+	}
+
+	for (uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if (flags[bodyIndex] != baseFlags[bodyIndex])
+		{
+			out_stream[masksOffset + bodyIndex] |= s_deltaFlagsBit;
+			out_stream.push_back(flags[bodyIndex]);
+		}
+	}
+
+	// Marked a field at a time, then written a body at a time, which hardly ever happens
+	bool anyExactFieldChanged = false;
+	for (BodyField field : s_exactDeltaFields)
+	{
+		for (uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+		{
+			const float value = LoadField(data, layout, field, bodyIndex);
+			const float baseValue = LoadField(baseData, baseLayout, field, bodyIndex);
+
+			if (memcmp(&value, &baseValue, sizeof(float)) != 0)
+			{
+				out_stream[masksOffset + bodyIndex] |= s_deltaExactFieldsBit;
+				anyExactFieldChanged = true;
+			}
+		}
+	}
+
+	for (uint32_t bodyIndex = 0; anyExactFieldChanged && bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if ((out_stream[masksOffset + bodyIndex] & s_deltaExactFieldsBit) == 0)
+		{
+			continue;
+		}
+
+		for (BodyField field : s_exactDeltaFields)
+		{
+			const float value = LoadField(data, layout, field, bodyIndex);
+			const uint8_t* bytes = (const uint8_t*)&value;
+			out_stream.insert(out_stream.end(), bytes, bytes + sizeof(float));
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Quantizing leaves the rotation slightly off unit length, and the world inertia follows the rotation (or
+// stays put, for bodies that can't rotate, as the integrator leaves it)
+static void RebuildRotation(uint8_t* data, const BodySnapshotLayout& layout, uint32_t bodyIndex)
+{
+	const FloatQuat rotation = Normalize(FloatQuat(LoadField(data, layout, BODY_ROTATION_W, bodyIndex), LoadField(data, layout, BODY_ROTATION_X, bodyIndex),
+		LoadField(data, layout, BODY_ROTATION_Y, bodyIndex), LoadField(data, layout, BODY_ROTATION_Z, bodyIndex)));
+
+	StoreField(data, layout, BODY_ROTATION_W, bodyIndex, rotation.w);
+	StoreField(data, layout, BODY_ROTATION_X, bodyIndex, rotation.x);
+	StoreField(data, layout, BODY_ROTATION_Y, bodyIndex, rotation.y);
+	StoreField(data, layout, BODY_ROTATION_Z, bodyIndex, rotation.z);
+
+	if ((data[layout.flagsOffset + bodyIndex] & BODY_FLAG_ROTATION_LOCKED) != 0)
+	{
+		return;
+	}
+
+	const Float3 localInverseInertia(LoadField(data, layout, BODY_LOCAL_INVERSE_INERTIA_X, bodyIndex), LoadField(data, layout, BODY_LOCAL_INVERSE_INERTIA_Y, bodyIndex),
+		LoadField(data, layout, BODY_LOCAL_INVERSE_INERTIA_Z, bodyIndex));
+	const FloatSym3 worldInverseInertia = RotateDiagonal(rotation, localInverseInertia);
+
+	StoreField(data, layout, BODY_WORLD_INVERSE_INERTIA_XX, bodyIndex, worldInverseInertia.xx);
+	StoreField(data, layout, BODY_WORLD_INVERSE_INERTIA_YY, bodyIndex, worldInverseInertia.yy);
+	StoreField(data, layout, BODY_WORLD_INVERSE_INERTIA_ZZ, bodyIndex, worldInverseInertia.zz);
+	StoreField(data, layout, BODY_WORLD_INVERSE_INERTIA_XY, bodyIndex, worldInverseInertia.xy);
+	StoreField(data, layout, BODY_WORLD_INVERSE_INERTIA_XZ, bodyIndex, worldInverseInertia.xz);
+	StoreField(data, layout, BODY_WORLD_INVERSE_INERTIA_YZ, bodyIndex, worldInverseInertia.yz);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Starts from the base and applies the changes over it, in the order WriteBodyDeltas wrote them. The
+// contact cache is left empty
+static bool ReadBodyDeltas(const BodySnapshot& base, const BodySnapshotLayout& baseLayout, const uint8_t* stream, size_t streamSize, std::vector<uint8_t>& out_data)
+{
+	const uint8_t* baseData = base.GetData();
+	const uint32_t bodyCount = baseLayout.bodyCount;
+
+	if (streamSize < baseLayout.storeOffset + bodyCount)
+	{
+		return false;
+	}
+
+	uint8_t* data = out_data.data();
+	memcpy(data, stream, baseLayout.storeOffset);
+	memcpy(data + baseLayout.storeOffset, baseData + baseLayout.storeOffset, baseLayout.contactCacheOffset - baseLayout.storeOffset);
+	memset(data + baseLayout.contactCacheOffset, 0, out_data.size() - baseLayout.contactCacheOffset);
+
+	const uint8_t* masks = stream + baseLayout.storeOffset;
+	const uint8_t* cursor = masks + bodyCount;
+	const uint8_t* end = stream + streamSize;
+
+	for (int groupIndex = 0; groupIndex < s_deltaGroupCount; ++groupIndex)
+	{
+		const BodyDeltaGroup& group = s_deltaGroups[groupIndex];
+
+		for (uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+		{
+			if ((masks[bodyIndex] & (1 << groupIndex)) == 0)
+			{
+				continue;
+			}
+
+			for (int componentIndex = 0; componentIndex < group.componentCount; ++componentIndex)
+			{
+				int64_t change = 0;
+				if (!ReadVarint(cursor, end, change))
+				{
+					return false;
+				}
+
+				const int field = group.firstField + componentIndex;
+				const int64_t quantized = Quantize(LoadField(baseData, baseLayout, field, bodyIndex), group.stepsPerUnit) + change;
+				StoreField(data, baseLayout, field, bodyIndex, (float)quantized / group.stepsPerUnit);
+			}
+		}
+	}
+
+	for (uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if ((masks[bodyIndex] & s_deltaFlagsBit) != 0)
+		{
+			if (cursor >= end)
+			{
+				return false;
+			}
+
+			data[baseLayout.flagsOffset + bodyIndex] = *cursor++;
+		}
+	}
+
+	const size_t exactFieldCount = sizeof(s_exactDeltaFields) / sizeof(s_exactDeltaFields[0]);
+	for (uint32_t bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		if ((masks[bodyIndex] & s_deltaExactFieldsBit) != 0)
+		{
+			if ((size_t)(end - cursor) < exactFieldCount * sizeof(float))
+			{
+				return false;
+			}
+
+			for (BodyField field : s_exactDeltaFields)
+			{
+				float value;
+				memcpy(&value, cursor, sizeof(float));
+				StoreField(data, baseLayout, field, bodyIndex, value);
+				cursor += sizeof(float);
+			}
+		}
+
+		if ((masks[bodyIndex] & (s_deltaRotationBit | s_deltaExactFieldsBit)) != 0)
+		{
+			RebuildRotation(data, baseLayout, bodyIndex);
+		}
+	}
+
+	return (cursor == end);
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+bool BodySnapshot::GetHeader(BodySnapshotHeader& out_header) const
+{
+	if (m_data.size() < sizeof(BodySnapshotHeader))
+	{
+		return false;
+	}
+
+	memcpy(&out_header, m_data.data(), sizeof(BodySnapshotHeader));
+	return (out_header.magic == BODY_SNAPSHOT_MAGIC && out_header.version == BODY_SNAPSHOT_VERSION);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodySnapshotWriter::WriteBytes(const void* bytes, size_t byteCount)
+{
+	const uint8_t* source = (const uint8_t*)bytes;
+	m_data.insert(m_data.end(), source, source + byteCount);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Snapshots are reused, so once the buffer has grown the resize doesn't allocate
+uint8_t* BodySnapshotWriter::AppendBytes(size_t byteCount)
+{
+	const size_t offset = m_data.size();
+	m_data.resize(offset + byteCount);
+
+	return m_data.data() + offset;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool BodySnapshotReader::ReadBytes(void* out_bytes, size_t byteCount)
+{
+	if (!m_isValid || (size_t)(m_end - m_cursor) < byteCount)
+	{
+		m_isValid = false;
+		return false;
+	}
+
+	if (byteCount > 0)
+	{
+		memcpy(out_bytes, m_cursor, byteCount);
+		m_cursor += byteCount;
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+const uint8_t* BodySnapshotReader::SkipBytes(size_t byteCount)
+{
+	if (!m_isValid || (size_t)(m_end - m_cursor) < byteCount)
+	{
+		m_isValid = false;
+		return nullptr;
+	}
+
+	const uint8_t* bytes = m_cursor;
+	m_cursor += byteCount;
+
+	return bytes;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool BodySnapshotDeltaCodec::Encode(const BodySnapshot& base, const BodySnapshot& snapshot, std::vector<uint8_t>& out_delta)
+{
+	BodySnapshotLayout baseLayout;
+	BodySnapshotLayout layout;
+	const bool canDeltaBodies = (BodyScene::GetSnapshotLayout(base, baseLayout) && BodyScene::GetSnapshotLayout(snapshot, layout)
+		&& CanDeltaBodies(base, baseLayout, snapshot, layout));
+
+	BodySnapshotDeltaHeader header;
+	header.magic = s_deltaMagic;
+
+	if (canDeltaBodies)
+	{
+		m_buffer.clear();
+		WriteBodyDeltas(base, baseLayout, snapshot, layout, m_buffer);
+
+		header.mode = BODY_SNAPSHOT_DELTA_BODIES;
+		header.snapshotSize = (uint32_t)(layout.contactCacheOffset + 2 * sizeof(uint32_t));
+	}
+	else
+	{
+		m_buffer.resize(snapshot.GetSize());
+		XorWithBase(base, snapshot.GetData(), snapshot.GetSize(), m_buffer.data());
+
+		header.mode = BODY_SNAPSHOT_DELTA_WHOLE;
+		header.snapshotSize = (uint32_t)snapshot.GetSize();
+	}
+
+	header.streamSize = (uint32_t)m_buffer.size();
+
+	out_delta.resize(sizeof(header) + GetLz4MaxCompressedSize(m_buffer.size()));
+	memcpy(out_delta.data(), &header, sizeof(header));
+
+	const size_t compressedSize = CompressLz4(m_buffer.data(), m_buffer.size(), out_delta.data() + sizeof(header), out_delta.size() - sizeof(header));
+	if (compressedSize == 0 && m_buffer.size() > 0)
+	{
+		out_delta.clear();
+		return false;
+	}
+
+	out_delta.resize(sizeof(header) + compressedSize);
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool BodySnapshotDeltaCodec::Decode(const BodySnapshot& base, const uint8_t* delta, size_t deltaSize, BodySnapshot& out_snapshot)
+{
+	BodySnapshotDeltaHeader header;
+	if (deltaSize < sizeof(header))
+	{
+		return false;
+	}
+
+	memcpy(&header, delta, sizeof(header));
+	if (header.magic != s_deltaMagic || header.streamSize > GetLz4MaxDecompressedSize(deltaSize - sizeof(header)))
+	{
+		return false;
+	}
+
+	m_buffer.resize(header.streamSize);
+	if (header.streamSize > 0 && DecompressLz4(delta + sizeof(header), deltaSize - sizeof(header), m_buffer.data(), m_buffer.size()) != header.streamSize)
+	{
+		return false;
+	}
+
+	std::vector<uint8_t>& data = out_snapshot.GetBuffer();
+	bool isValid = false;
+
+	if (header.mode == BODY_SNAPSHOT_DELTA_WHOLE && header.snapshotSize == header.streamSize)
+	{
+		data.resize(header.snapshotSize);
+		XorWithBase(base, m_buffer.data(), m_buffer.size(), data.data());
+		isValid = true;
+	}
+	else if (header.mode == BODY_SNAPSHOT_DELTA_BODIES)
+	{
+		BodySnapshotLayout baseLayout;
+		isValid = (BodyScene::GetSnapshotLayout(base, baseLayout) && header.snapshotSize == baseLayout.contactCacheOffset + 2 * sizeof(uint32_t));
+
+		if (isValid)
+		{
+			data.resize(header.snapshotSize);
+			isValid = ReadBodyDeltas(base, baseLayout, m_buffer.data(), m_buffer.size(), data);
+		}
+	}
+
+	if (!isValid)
+	{
+		data.clear();
+	}
+
+	return isValid;
+}
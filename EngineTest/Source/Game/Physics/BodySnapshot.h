@@ -0,0 +1,196 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Binary snapshots of a BodyScene for rollback, and deltas between consecutive snapshots
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Leads every snapshot, so it can be checked before anything in the scene is touched
+struct BodySnapshotHeader
+{
+	uint32_t	magic = 0;
+	uint32_t	version = 0;
+	uint64_t	stepIndex = 0;
+	double		simulatedSeconds = 0.0;
+};
+
+// Where each part of a BodyScene snapshot sits, in bytes from its start, so deltas can work body by body
+struct BodySnapshotLayout
+{
+	uint32_t	bodyCount = 0;
+	size_t		storeOffset = 0;			// After the header and planes; the body count comes first
+	size_t		fieldsOffset = 0;			// BODY_SNAPSHOT_FIELD_COUNT arrays of bodyCount floats, in BodyField order
+	size_t		shapeTypesOffset = 0;
+	size_t		flagsOffset = 0;
+	size_t		slotsOffset = 0;			// Index to slot, then the slot tables
+	size_t		contactCacheOffset = 0;		// Runs to the end
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+const uint32_t BODY_SNAPSHOT_MAGIC = 0x504E5342; // "BSNP"
+const uint32_t BODY_SNAPSHOT_VERSION = 1;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Everything a BodyScene needs to carry on exactly as it would have from the step it was taken after.
+// Native endianness and float layout, so only meant for the same build on the same kind of machine.
+// Reuse one per frame slot; once its buffer has grown, saving into it again doesn't allocate
+class BodySnapshot
+{
+public:
+	//-----Public Methods-----
+
+	void					Clear() { m_data.clear(); }
+
+	const uint8_t*			GetData() const { return m_data.data(); }
+	size_t					GetSize() const { return m_data.size(); }
+	bool					IsEmpty() const { return m_data.size() == 0; }
+	bool					GetHeader(BodySnapshotHeader& out_header) const;
+
+	std::vector<uint8_t>&	GetBuffer() { return m_data; }
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<uint8_t> m_data;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Appends plain values and arrays to a snapshot. Structs with padding should be written a member at a
+// time, so the padding's garbage doesn't end up in the snapshot (and in its hash and deltas)
+class BodySnapshotWriter
+{
+public:
+	//-----Public Methods-----
+
+	BodySnapshotWriter(BodySnapshot& snapshot) : m_data(snapshot.GetBuffer()) { m_data.clear(); }
+
+	template <typename T>
+	void	WriteValue(const T& value) { WriteBytes(&value, sizeof(T)); }
+	template <typename T>
+	void	WriteArray(const std::vector<T>& values);		// Count, then the values
+	template <typename T>
+	void	WriteValues(const T* values, size_t count) { WriteBytes(values, sizeof(T) * count); }
+	void	WriteBytes(const void* bytes, size_t byteCount);
+	uint8_t* AppendBytes(size_t byteCount);					// For filling in place; only valid until the next write
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<uint8_t>& m_data;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Reads back what BodySnapshotWriter wrote. Every read is bounds checked; once one fails, so does every
+// read after it, so callers can read everything and check IsValid once at the end
+class BodySnapshotReader
+{
+public:
+	//-----Public Methods-----
+
+	BodySnapshotReader(const BodySnapshot& snapshot) : m_start(snapshot.GetData()), m_cursor(snapshot.GetData()), m_end(snapshot.GetData() + snapshot.GetSize()) {}
+
+	template <typename T>
+	bool	ReadValue(T& out_value) { return ReadBytes(&out_value, sizeof(T)); }
+	template <typename T>
+	bool	ReadArray(std::vector<T>& out_values, uint32_t maxCount = 0xFFFFFFFF);
+	template <typename T>
+	bool	ReadValues(T* out_values, size_t count) { return ReadBytes(out_values, sizeof(T) * count); }
+	bool	ReadBytes(void* out_bytes, size_t byteCount);
+	const uint8_t* SkipBytes(size_t byteCount);				// Returns the skipped bytes to read in place, nullptr if there aren't enough
+
+	bool	IsValid() const { return m_isValid; }
+	size_t	GetRemainingSize() const { return (size_t)(m_end - m_cursor); }
+	size_t	GetReadSize() const { return (size_t)(m_cursor - m_start); }
+
+
+private:
+	//-----Private Data-----
+
+	const uint8_t*	m_start = nullptr;
+	const uint8_t*	m_cursor = nullptr;
+	const uint8_t*	m_end = nullptr;
+	bool			m_isValid = true;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Deltas for sending a scene's state elsewhere, not for rollback, which should keep whole snapshots.
+// While the bodies and their slots match the base's, only bodies whose state changed are written, a
+// mask and the changed field groups each, with positions, rotations and velocities quantized; sleeping
+// bodies are skipped outright, and the contact cache is left out (the scene restored from it cold
+// starts its first step). A decoded snapshot is then within about 1/2048 of a unit of the original.
+// Anything else, like bodies added or removed, is an exact XOR of the whole snapshot against the base.
+// Either way, decoding needs the same base; encode against what the other side decoded last, so the
+// quantizing can't build up. Keeps its scratch buffer between calls, so neither allocates once it's grown
+class BodySnapshotDeltaCodec
+{
+public:
+	//-----Public Methods-----
+
+	bool Encode(const BodySnapshot& base, const BodySnapshot& snapshot, std::vector<uint8_t>& out_delta);
+	bool Decode(const BodySnapshot& base, const uint8_t* delta, size_t deltaSize, BodySnapshot& out_snapshot);
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<uint8_t> m_buffer;
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+void BodySnapshotWriter::WriteArray(const std::vector<T>& values)
+{
+	WriteValue((uint32_t)values.size());
+	WriteBytes(values.data(), sizeof(T) * values.size());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+bool BodySnapshotReader::ReadArray(std::vector<T>& out_values, uint32_t maxCount /*= 0xFFFFFFFF*/)
+{
+	uint32_t count = 0;
+	if (!ReadValue(count) || count > maxCount || GetRemainingSize() < sizeof(T) * (size_t)count)
+	{
+		m_isValid = false;
+		return false;
+	}
+
+	out_values.resize(count);
+	return ReadBytes(out_values.data(), sizeof(T) * count);
+}
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
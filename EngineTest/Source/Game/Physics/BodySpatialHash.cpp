@@ -0,0 +1,256 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodySpatialHash.h"
+#include "Game/Physics/BodyStore.h"
+#include <algorithm>
+#include <cmath>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const int	s_maxCellsPerBody = 64;		// Past this a body is tested against everything instead
+static const float	s_autoCellSizeScale = 2.f;	// Auto cells are this many average bodies across
+static const float	s_minCellSize = 0.01f;
+static const float	s_maxCellCoordinate = 1e8f;	// Keeps far away bodies from overflowing the cell coordinates
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static int GetCellCoordinate(float value, float inverseCellSize)
+{
+	const float cell = floorf(value * inverseCellSize);
+	return (int)std::max(std::min(cell, s_maxCellCoordinate), -s_maxCellCoordinate);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint32_t HashCell(int x, int y, int z)
+{
+	return ((uint32_t)x * 73856093u) ^ ((uint32_t)y * 19349663u) ^ ((uint32_t)z * 83492791u);
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void SpatialHashBroadphase::FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs)
+{
+	m_lastCellSize = ChooseCellSize(store);
+	FillBuckets(store, m_lastCellSize);
+
+	const int bucketCount = (int)m_bucketStarts.size() - 1;
+	for (int bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+	{
+		FindBucketPairs(store, bucketIndex, out_pairs);
+	}
+
+	FindOversizedPairs(store, out_pairs);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// A couple of average bodies across, so most bodies touch a few cells and most cells hold a few bodies
+float SpatialHashBroadphase::ChooseCellSize(const BodyStore& store) const
+{
+	if (m_cellSize > 0.f)
+	{
+		return m_cellSize;
+	}
+
+	const int bodyCount = store.GetCount();
+	if (bodyCount == 0)
+	{
+		return 1.f;
+	}
+
+	double totalSize = 0.0;
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const FloatAabb bounds = store.GetBounds(bodyIndex);
+		totalSize += std::max(bounds.maxs.x - bounds.mins.x, std::max(bounds.maxs.y - bounds.mins.y, bounds.maxs.z - bounds.mins.z));
+	}
+
+	return std::max(s_autoCellSizeScale * (float)(totalSize / (double)bodyCount), s_minCellSize);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Counting sort of every (cell, body) entry by bucket, so each bucket's entries end up next to each other
+void SpatialHashBroadphase::FillBuckets(const BodyStore& store, float cellSize)
+{
+	const int bodyCount = store.GetCount();
+	const float inverseCellSize = 1.f / cellSize;
+
+	m_entries.clear();
+	m_oversizedBodies.clear();
+	m_minCells.resize(3 * bodyCount);
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const FloatAabb bounds = store.GetBounds(bodyIndex);
+		int* minCell = &m_minCells[3 * bodyIndex];
+		int maxCell[3];
+
+		int64_t cellCount = 1;
+		for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+		{
+			minCell[axisIndex] = GetCellCoordinate((&bounds.mins.x)[axisIndex], inverseCellSize);
+			maxCell[axisIndex] = GetCellCoordinate((&bounds.maxs.x)[axisIndex], inverseCellSize);
+			cellCount *= (int64_t)(maxCell[axisIndex] - minCell[axisIndex] + 1);
+		}
+
+		if (cellCount > s_maxCellsPerBody)
+		{
+			m_oversizedBodies.push_back(bodyIndex);
+			continue;
+		}
+
+		SpatialHashEntry entry;
+		entry.bodyIndex = bodyIndex;
+
+		for (entry.cell[0] = minCell[0]; entry.cell[0] <= maxCell[0]; ++entry.cell[0])
+		{
+			for (entry.cell[1] = minCell[1]; entry.cell[1] <= maxCell[1]; ++entry.cell[1])
+			{
+				for (entry.cell[2] = minCell[2]; entry.cell[2] <= maxCell[2]; ++entry.cell[2])
+				{
+					m_entries.push_back(entry);
+				}
+			}
+		}
+	}
+
+	// Twice as many buckets as entries keeps collisions between different cells rare
+	int bucketCount = 16;
+	while (bucketCount < 2 * (int)m_entries.size())
+	{
+		bucketCount *= 2;
+	}
+
+	const uint32_t bucketMask = (uint32_t)bucketCount - 1;
+	const int entryCount = (int)m_entries.size();
+
+	m_entryBuckets.resize(entryCount);
+	m_bucketStarts.assign(bucketCount + 1, 0);
+
+	for (int entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+	{
+		const SpatialHashEntry& entry = m_entries[entryIndex];
+		m_entryBuckets[entryIndex] = HashCell(entry.cell[0], entry.cell[1], entry.cell[2]) & bucketMask;
+		m_bucketStarts[m_entryBuckets[entryIndex] + 1]++;
+	}
+
+	for (int bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+	{
+		m_bucketStarts[bucketIndex + 1] += m_bucketStarts[bucketIndex];
+	}
+
+	// Fill using the starts as write cursors, then shift them back down by a bucket
+	m_bucketEntries.resize(entryCount);
+	for (int entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+	{
+		m_bucketEntries[m_bucketStarts[m_entryBuckets[entryIndex]]++] = m_entries[entryIndex];
+	}
+
+	for (int bucketIndex = bucketCount; bucketIndex > 0; --bucketIndex)
+	{
+		m_bucketStarts[bucketIndex] = m_bucketStarts[bucketIndex - 1];
+	}
+
+	m_bucketStarts[0] = 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Buckets can hold more than one cell, so entries are only paired with others from the same cell
+void SpatialHashBroadphase::FindBucketPairs(const BodyStore& store, int bucketIndex, std::vector<BodyPair>& out_pairs) const
+{
+	const int startIndex = m_bucketStarts[bucketIndex];
+	const int endIndex = m_bucketStarts[bucketIndex + 1];
+
+	for (int entryIndex = startIndex; entryIndex < endIndex; ++entryIndex)
+	{
+		const SpatialHashEntry& entryA = m_bucketEntries[entryIndex];
+		const int* minCellA = &m_minCells[3 * entryA.bodyIndex];
+
+		for (int otherEntryIndex = entryIndex + 1; otherEntryIndex < endIndex; ++otherEntryIndex)
+		{
+			const SpatialHashEntry& entryB = m_bucketEntries[otherEntryIndex];
+			if (entryA.cell[0] != entryB.cell[0] || entryA.cell[1] != entryB.cell[1] || entryA.cell[2] != entryB.cell[2])
+			{
+				continue;
+			}
+
+			// Lowest cell both bodies touch, which is the one cell that reports the pair
+			const int* minCellB = &m_minCells[3 * entryB.bodyIndex];
+			if (std::max(minCellA[0], minCellB[0]) != entryA.cell[0] || std::max(minCellA[1], minCellB[1]) != entryA.cell[1] || std::max(minCellA[2], minCellB[2]) != entryA.cell[2])
+			{
+				continue;
+			}
+
+			if (ShouldBodiesCollide(store, entryA.bodyIndex, entryB.bodyIndex) && DoBodyBoundsOverlap(store, entryA.bodyIndex, entryB.bodyIndex))
+			{
+				BodyPair pair;
+				pair.bodyA = std::min(entryA.bodyIndex, entryB.bodyIndex);
+				pair.bodyB = std::max(entryA.bodyIndex, entryB.bodyIndex);
+				out_pairs.push_back(pair);
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Brute force, as there should only ever be a few of these. Oversized pairs are reported from the later body
+void SpatialHashBroadphase::FindOversizedPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs) const
+{
+	const int bodyCount = store.GetCount();
+
+	for (int oversizedIndex = 0; oversizedIndex < (int)m_oversizedBodies.size(); ++oversizedIndex)
+	{
+		const int indexA = m_oversizedBodies[oversizedIndex];
+		int nextOversizedIndex = 0;
+
+		for (int indexB = 0; indexB < bodyCount; ++indexB)
+		{
+			// Both lists are in body order, so this walks along with indexB
+			const bool isBOversized = (nextOversizedIndex < (int)m_oversizedBodies.size() && m_oversizedBodies[nextOversizedIndex] == indexB);
+			if (isBOversized)
+			{
+				nextOversizedIndex++;
+			}
+
+			if (indexB == indexA || (isBOversized && indexB > indexA))
+			{
+				continue;
+			}
+
+			if (ShouldBodiesCollide(store, indexA, indexB) && DoBodyBoundsOverlap(store, indexA, indexB))
+			{
+				BodyPair pair;
+				pair.bodyA = std::min(indexA, indexB);
+				pair.bodyB = std::max(indexA, indexB);
+				out_pairs.push_back(pair);
+			}
+		}
+	}
+}
@@ -0,0 +1,84 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Uniform grid broadphase, hashed into buckets so the world doesn't need bounds up front
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyBroadphase.h"
+#include <cstdint>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// One body in one cell
+struct SpatialHashEntry
+{
+	int cell[3];
+	int bodyIndex = -1;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Rebuilt every step: each body goes in every cell its bounds touch, the entries are counting sorted into hash
+// buckets, and only bodies sharing a cell get tested. Nothing is sorted by position, so the cost is linear in
+// bodies plus pairs however they're spread out, which suits wide flat levels.
+// A pair is only reported from the lowest cell both bodies touch, so pairs sharing several cells aren't repeated.
+// Bodies touching more than a handful of cells are kept out of the grid and tested against everything instead
+class SpatialHashBroadphase : public BodyBroadphase
+{
+public:
+	//-----Public Methods-----
+
+	// Cell size <= 0 picks one each step from the average body size
+	SpatialHashBroadphase(float cellSize = 0.f) : m_cellSize(cellSize) {}
+
+	virtual const char*	GetName() const override { return "spatial_hash"; }
+	virtual void		FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs) override;
+
+	float				GetLastCellSize() const { return m_lastCellSize; }
+
+
+private:
+	//-----Private Methods-----
+
+	float	ChooseCellSize(const BodyStore& store) const;
+	void	FillBuckets(const BodyStore& store, float cellSize);
+	void	FindBucketPairs(const BodyStore& store, int bucketIndex, std::vector<BodyPair>& out_pairs) const;
+	void	FindOversizedPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs) const;
+
+
+private:
+	//-----Private Data-----
+
+	float							m_cellSize = 0.f;
+	float							m_lastCellSize = 0.f;
+
+	std::vector<int>				m_minCells;			// 3 per body
+	std::vector<int>				m_oversizedBodies;
+	std::vector<SpatialHashEntry>	m_entries;			// In body order
+	std::vector<SpatialHashEntry>	m_bucketEntries;	// Same entries, grouped by bucket
+	std::vector<int>				m_bucketStarts;		// One past the bucket count, so bucket i is [starts[i], starts[i + 1])
+	std::vector<uint32_t>			m_entryBuckets;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,456 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyStore.h"
+#include "Game/Physics/BodySnapshot.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+template <typename T>
+static void SwapRemove(std::vector<T>& values, int index)
+{
+	values[index] = values.back();
+	values.pop_back();
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void BodyStore::Reserve(int bodyCount)
+{
+	for (int fieldIndex = 0; fieldIndex < NUM_BODY_FIELDS; ++fieldIndex)
+	{
+		m_fields[fieldIndex].reserve(bodyCount);
+	}
+
+	m_shapeTypes.reserve(bodyCount);
+	m_flags.reserve(bodyCount);
+	m_indexToSlot.reserve(bodyCount);
+	m_slotToIndex.reserve(bodyCount);
+	m_slotGenerations.reserve(bodyCount);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyStore::Clear()
+{
+	for (int fieldIndex = 0; fieldIndex < NUM_BODY_FIELDS; ++fieldIndex)
+	{
+		m_fields[fieldIndex].clear();
+	}
+
+	m_shapeTypes.clear();
+	m_flags.clear();
+	m_indexToSlot.clear();
+
+	// Keep generations so handles from before the clear stay invalid
+	m_freeSlots.clear();
+	for (uint32_t slot = 0; slot < (uint32_t)m_slotToIndex.size(); ++slot)
+	{
+		if (m_slotToIndex[slot] >= 0)
+		{
+			m_slotGenerations[slot]++;
+			m_slotToIndex[slot] = -1;
+		}
+
+		m_freeSlots.push_back(slot);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyHandle BodyStore::AddBody(const BodyDefinition& definition)
+{
+	const int index = GetCount();
+
+	for (int fieldIndex = 0; fieldIndex < NUM_BODY_FIELDS; ++fieldIndex)
+	{
+		m_fields[fieldIndex].push_back(0.f);
+	}
+
+	m_shapeTypes.push_back(definition.shapeType);
+	m_flags.push_back(0);
+
+	SetFloat3(index, BODY_POSITION_X, definition.position);
+	SetRotation(index, Normalize(definition.rotation));
+	SetFloat3(index, BODY_VELOCITY_X, definition.velocity);
+	SetFloat3(index, BODY_ACCELERATION_X, definition.acceleration);
+	m_fields[BODY_INVERSE_MASS][index] = definition.inverseMass;
+	m_fields[BODY_MAX_LATERAL_SPEED][index] = definition.maxLateralSpeed;
+	m_fields[BODY_SHAPE_RADIUS][index] = definition.radius;
+	m_fields[BODY_SHAPE_HALF_HEIGHT][index] = definition.halfHeight;
+	SetFloat3(index, BODY_SHAPE_HALF_EXTENT_X, definition.halfExtents);
+
+	SetFlag(index, BODY_FLAG_AFFECTED_BY_GRAVITY, definition.affectedByGravity);
+	SetFlag(index, BODY_FLAG_ROTATION_LOCKED, definition.rotationLocked);
+	SetFlag(index, BODY_FLAG_CAN_SLEEP, definition.canSleep);
+	SetFlag(index, BODY_FLAG_CONTINUOUS, definition.continuousCollision);
+
+	if (!definition.rotationLocked)
+	{
+		SetFloat3(index, BODY_ANGULAR_VELOCITY_X, definition.angularVelocityRadians);
+	}
+
+	SetInverseInertiaFromShape(index);
+	UpdateWorldInverseInertia(index);
+
+	// Find a slot for the handle
+	uint32_t slot;
+	if (m_freeSlots.size() > 0)
+	{
+		slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+	else
+	{
+		slot = (uint32_t)m_slotToIndex.size();
+		m_slotToIndex.push_back(-1);
+		m_slotGenerations.push_back(0);
+	}
+
+	m_slotToIndex[slot] = index;
+	m_indexToSlot.push_back(slot);
+
+	BodyHandle handle;
+	handle.slot = slot;
+	handle.generation = m_slotGenerations[slot];
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyStore::RemoveBody(BodyHandle handle)
+{
+	const int index = GetIndex(handle);
+	if (index < 0)
+	{
+		return;
+	}
+
+	const int lastIndex = GetCount() - 1;
+	const uint32_t lastSlot = m_indexToSlot[lastIndex];
+
+	for (int fieldIndex = 0; fieldIndex < NUM_BODY_FIELDS; ++fieldIndex)
+	{
+		SwapRemove(m_fields[fieldIndex], index);
+	}
+
+	SwapRemove(m_shapeTypes, index);
+	SwapRemove(m_flags, index);
+	SwapRemove(m_indexToSlot, index);
+
+	m_slotToIndex[lastSlot] = index;
+	m_slotToIndex[handle.slot] = -1;
+	m_slotGenerations[handle.slot]++;
+	m_freeSlots.push_back(handle.slot);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool BodyStore::IsValid(BodyHandle handle) const
+{
+	return GetIndex(handle) >= 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns -1 if the handle doesn't refer to a live body
+int BodyStore::GetIndex(BodyHandle handle) const
+{
+	if (handle.slot >= (uint32_t)m_slotToIndex.size() || m_slotGenerations[handle.slot] != handle.generation)
+	{
+		return -1;
+	}
+
+	return m_slotToIndex[handle.slot];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+BodyHandle BodyStore::GetHandle(int index) const
+{
+	BodyHandle handle;
+	handle.slot = m_indexToSlot[index];
+	handle.generation = m_slotGenerations[handle.slot];
+
+	return handle;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+Float3 BodyStore::GetFloat3(int index, BodyField xField) const
+{
+	return Float3(m_fields[xField][index], m_fields[xField + 1][index], m_fields[xField + 2][index]);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyStore::SetFloat3(int index, BodyField xField, const Float3& value)
+{
+	m_fields[xField][index] = value.x;
+	m_fields[xField + 1][index] = value.y;
+	m_fields[xField + 2][index] = value.z;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+FloatQuat BodyStore::GetRotation(int index) const
+{
+	return FloatQuat(m_fields[BODY_ROTATION_W][index], m_fields[BODY_ROTATION_X][index], m_fields[BODY_ROTATION_Y][index], m_fields[BODY_ROTATION_Z][index]);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyStore::SetRotation(int index, const FloatQuat& rotation)
+{
+	m_fields[BODY_ROTATION_W][index] = rotation.w;
+	m_fields[BODY_ROTATION_X][index] = rotation.x;
+	m_fields[BODY_ROTATION_Y][index] = rotation.y;
+	m_fields[BODY_ROTATION_Z][index] = rotation.z;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+FloatSym3 BodyStore::GetWorldInverseInertia(int index) const
+{
+	FloatSym3 result;
+	result.xx = m_fields[BODY_WORLD_INVERSE_INERTIA_XX][index];
+	result.yy = m_fields[BODY_WORLD_INVERSE_INERTIA_YY][index];
+	result.zz = m_fields[BODY_WORLD_INVERSE_INERTIA_ZZ][index];
+	result.xy = m_fields[BODY_WORLD_INVERSE_INERTIA_XY][index];
+	result.xz = m_fields[BODY_WORLD_INVERSE_INERTIA_XZ][index];
+	result.yz = m_fields[BODY_WORLD_INVERSE_INERTIA_YZ][index];
+
+	return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+FloatAabb BodyStore::GetBounds(int index) const
+{
+	return FloatAabb(GetFloat3(index, BODY_BOUNDS_MIN_X), GetFloat3(index, BODY_BOUNDS_MAX_X));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Rotation locked bodies get a zero tensor, so contacts can never spin them
+void BodyStore::UpdateWorldInverseInertia(int index)
+{
+	FloatSym3 world;
+
+	if (!HasFlag(index, BODY_FLAG_ROTATION_LOCKED))
+	{
+		world = RotateDiagonal(GetRotation(index), GetFloat3(index, BODY_LOCAL_INVERSE_INERTIA_X));
+	}
+
+	m_fields[BODY_WORLD_INVERSE_INERTIA_XX][index] = world.xx;
+	m_fields[BODY_WORLD_INVERSE_INERTIA_YY][index] = world.yy;
+	m_fields[BODY_WORLD_INVERSE_INERTIA_ZZ][index] = world.zz;
+	m_fields[BODY_WORLD_INVERSE_INERTIA_XY][index] = world.xy;
+	m_fields[BODY_WORLD_INVERSE_INERTIA_XZ][index] = world.xz;
+	m_fields[BODY_WORLD_INVERSE_INERTIA_YZ][index] = world.yz;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void BodyStore::SetFlag(int index, BodyFlag flag, bool value)
+{
+	if (value)
+	{
+		m_flags[index] |= flag;
+	}
+	else
+	{
+		m_flags[index] &= ~flag;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The field arrays are written whole, one after another, so a field that doesn't change between two
+// snapshots (most of them) is one long identical run for the delta
+void BodyStore::WriteSnapshot(BodySnapshotWriter& writer) const
+{
+	const uint32_t bodyCount = (uint32_t)GetCount();
+	writer.WriteValue(bodyCount);
+
+	for (int fieldIndex = 0; fieldIndex < BODY_SNAPSHOT_FIELD_COUNT; ++fieldIndex)
+	{
+		writer.WriteValues(m_fields[fieldIndex].data(), bodyCount);
+	}
+
+	writer.WriteValues(m_shapeTypes.data(), bodyCount);
+	writer.WriteValues(m_flags.data(), bodyCount);
+	writer.WriteValues(m_indexToSlot.data(), bodyCount);
+
+	writer.WriteArray(m_slotToIndex);
+	writer.WriteValues(m_slotGenerations.data(), m_slotGenerations.size());
+	writer.WriteArray(m_freeSlots);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Checks the slots point where they should before returning; on failure the store is left empty
+bool BodyStore::ReadSnapshot(BodySnapshotReader& reader)
+{
+	const size_t bytesPerBody = BODY_SNAPSHOT_FIELD_COUNT * sizeof(float) + 2 * sizeof(uint8_t) + sizeof(uint32_t);
+
+	uint32_t bodyCount = 0;
+	bool isValid = (reader.ReadValue(bodyCount) && reader.GetRemainingSize() >= bodyCount * bytesPerBody);
+	bodyCount = (isValid ? bodyCount : 0);
+
+	for (int fieldIndex = 0; fieldIndex < NUM_BODY_FIELDS; ++fieldIndex)
+	{
+		m_fields[fieldIndex].resize(bodyCount);
+	}
+
+	m_shapeTypes.resize(bodyCount);
+	m_flags.resize(bodyCount);
+	m_indexToSlot.resize(bodyCount);
+
+	for (int fieldIndex = 0; fieldIndex < BODY_SNAPSHOT_FIELD_COUNT; ++fieldIndex)
+	{
+		reader.ReadValues(m_fields[fieldIndex].data(), bodyCount);
+	}
+
+	reader.ReadValues(m_shapeTypes.data(), bodyCount);
+	reader.ReadValues(m_flags.data(), bodyCount);
+	reader.ReadValues(m_indexToSlot.data(), bodyCount);
+
+	reader.ReadArray(m_slotToIndex);
+	m_slotGenerations.resize(reader.GetRemainingSize() >= sizeof(uint32_t) * m_slotToIndex.size() ? m_slotToIndex.size() : 0);
+	reader.ReadValues(m_slotGenerations.data(), m_slotToIndex.size());
+	reader.ReadArray(m_freeSlots, (uint32_t)m_slotToIndex.size());
+
+	isValid = (isValid && reader.IsValid());
+	for (uint32_t bodyIndex = 0; isValid && bodyIndex < bodyCount; ++bodyIndex)
+	{
+		isValid = (m_indexToSlot[bodyIndex] < (uint32_t)m_slotToIndex.size() && m_slotToIndex[m_indexToSlot[bodyIndex]] == (int)bodyIndex);
+	}
+
+	for (uint32_t slot = 0; isValid && slot < (uint32_t)m_slotToIndex.size(); ++slot)
+	{
+		isValid = (m_slotToIndex[slot] < (int)bodyCount);
+	}
+
+	if (!isValid)
+	{
+		for (int fieldIndex = 0; fieldIndex < NUM_BODY_FIELDS; ++fieldIndex)
+		{
+			m_fields[fieldIndex].clear();
+		}
+
+		m_shapeTypes.clear();
+		m_flags.clear();
+		m_indexToSlot.clear();
+		m_slotToIndex.clear();
+		m_slotGenerations.clear();
+		m_freeSlots.clear();
+	}
+
+	return isValid;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Steps over what WriteSnapshot wrote, noting where each part starts; nothing in it is checked
+bool BodyStore::ReadSnapshotLayout(BodySnapshotReader& reader, BodySnapshotLayout& out_layout)
+{
+	out_layout.storeOffset = reader.GetReadSize();
+	reader.ReadValue(out_layout.bodyCount);
+	const size_t bodyCount = (reader.IsValid() ? out_layout.bodyCount : 0);
+
+	out_layout.fieldsOffset = reader.GetReadSize();
+	reader.SkipBytes(BODY_SNAPSHOT_FIELD_COUNT * sizeof(float) * bodyCount);
+	out_layout.shapeTypesOffset = reader.GetReadSize();
+	reader.SkipBytes(sizeof(uint8_t) * bodyCount);
+	out_layout.flagsOffset = reader.GetReadSize();
+	reader.SkipBytes(sizeof(uint8_t) * bodyCount);
+	out_layout.slotsOffset = reader.GetReadSize();
+	reader.SkipBytes(sizeof(uint32_t) * bodyCount);
+
+	uint32_t slotCount = 0;
+	reader.ReadValue(slotCount);
+	reader.SkipBytes((sizeof(int) + sizeof(uint32_t)) * (reader.IsValid() ? slotCount : 0));
+
+	uint32_t freeSlotCount = 0;
+	reader.ReadValue(freeSlotCount);
+	reader.SkipBytes(sizeof(uint32_t) * (reader.IsValid() ? freeSlotCount : 0));
+
+	return reader.IsValid();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Solid shape tensors, same as RigidBody's SetInertiaTensor_Box/Sphere/Capsule
+void BodyStore::SetInverseInertiaFromShape(int index)
+{
+	const float inverseMass = m_fields[BODY_INVERSE_MASS][index];
+	if (inverseMass <= 0.f)
+	{
+		SetFloat3(index, BODY_LOCAL_INVERSE_INERTIA_X, Float3(0.f, 0.f, 0.f));
+		return;
+	}
+
+	const float mass = 1.f / inverseMass;
+	Float3 inertia;
+
+	switch (m_shapeTypes[index])
+	{
+	case BODY_SHAPE_BOX:
+	{
+		// Half extents, so (1/12)m(2a)^2 = (1/3)ma^2
+		const Float3 extents = GetFloat3(index, BODY_SHAPE_HALF_EXTENT_X);
+		inertia.x = (mass / 3.f) * (extents.y * extents.y + extents.z * extents.z);
+		inertia.y = (mass / 3.f) * (extents.x * extents.x + extents.z * extents.z);
+		inertia.z = (mass / 3.f) * (extents.x * extents.x + extents.y * extents.y);
+		break;
+	}
+	case BODY_SHAPE_CAPSULE:
+	{
+		// Approximated as a solid cylinder spanning the full capsule height
+		const float radius = m_fields[BODY_SHAPE_RADIUS][index];
+		const float height = 2.f * (m_fields[BODY_SHAPE_HALF_HEIGHT][index] + radius);
+		inertia.x = (mass / 12.f) * (3.f * radius * radius + height * height);
+		inertia.y = 0.5f * mass * radius * radius;
+		inertia.z = inertia.x;
+		break;
+	}
+	case BODY_SHAPE_SPHERE:
+	default:
+	{
+		const float radius = m_fields[BODY_SHAPE_RADIUS][index];
+		inertia.x = 0.4f * mass * radius * radius;
+		inertia.y = inertia.x;
+		inertia.z = inertia.x;
+		break;
+	}
+	}
+
+	SetFloat3(index, BODY_LOCAL_INVERSE_INERTIA_X, Float3(1.f / inertia.x, 1.f / inertia.y, 1.f / inertia.z));
+}
@@ -0,0 +1,200 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Structure-of-arrays storage for rigid bodies, so bulk passes walk contiguous memory
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/PhysicsMath.h"
+#include <cstdint>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class BodySnapshotReader;
+class BodySnapshotWriter;
+struct BodySnapshotLayout;
+
+// One contiguous float array per field; x/y/z (and w/x/y/z) components must stay adjacent and in order
+enum BodyField
+{
+	BODY_POSITION_X,
+	BODY_POSITION_Y,
+	BODY_POSITION_Z,
+	BODY_ROTATION_W,
+	BODY_ROTATION_X,
+	BODY_ROTATION_Y,
+	BODY_ROTATION_Z,
+	BODY_VELOCITY_X,
+	BODY_VELOCITY_Y,
+	BODY_VELOCITY_Z,
+	BODY_ANGULAR_VELOCITY_X,	// Radians per second, world space
+	BODY_ANGULAR_VELOCITY_Y,
+	BODY_ANGULAR_VELOCITY_Z,
+	BODY_ACCELERATION_X,		// Constant acceleration applied every step, like RigidBody::SetAcceleration
+	BODY_ACCELERATION_Y,
+	BODY_ACCELERATION_Z,
+	BODY_INVERSE_MASS,
+	BODY_LOCAL_INVERSE_INERTIA_X,
+	BODY_LOCAL_INVERSE_INERTIA_Y,
+	BODY_LOCAL_INVERSE_INERTIA_Z,
+	BODY_WORLD_INVERSE_INERTIA_XX,
+	BODY_WORLD_INVERSE_INERTIA_YY,
+	BODY_WORLD_INVERSE_INERTIA_ZZ,
+	BODY_WORLD_INVERSE_INERTIA_XY,
+	BODY_WORLD_INVERSE_INERTIA_XZ,
+	BODY_WORLD_INVERSE_INERTIA_YZ,
+	BODY_MAX_LATERAL_SPEED,		// <= 0 for no limit
+	BODY_SLEEP_SECONDS,			// How long the body has been slow enough to sleep
+	BODY_SHAPE_RADIUS,			// Spheres and capsules
+	BODY_SHAPE_HALF_HEIGHT,		// Capsules, along local y, not including the caps
+	BODY_SHAPE_HALF_EXTENT_X,	// Boxes
+	BODY_SHAPE_HALF_EXTENT_Y,
+	BODY_SHAPE_HALF_EXTENT_Z,
+	BODY_BOUNDS_MIN_X,			// World AABB, refreshed each step before the broadphase
+	BODY_BOUNDS_MIN_Y,
+	BODY_BOUNDS_MIN_Z,
+	BODY_BOUNDS_MAX_X,
+	BODY_BOUNDS_MAX_Y,
+	BODY_BOUNDS_MAX_Z,
+	NUM_BODY_FIELDS
+};
+
+enum BodyShapeType : uint8_t
+{
+	BODY_SHAPE_SPHERE,
+	BODY_SHAPE_BOX,
+	BODY_SHAPE_CAPSULE
+};
+
+enum BodyFlag : uint8_t
+{
+	BODY_FLAG_AFFECTED_BY_GRAVITY	= (1 << 0),
+	BODY_FLAG_ROTATION_LOCKED		= (1 << 1),
+	BODY_FLAG_CAN_SLEEP				= (1 << 2),
+	BODY_FLAG_ASLEEP				= (1 << 3),	// Skipped by every pass until something awake touches it
+	BODY_FLAG_CONTINUOUS			= (1 << 4)	// Swept each step it moves far, so it can't tunnel through anything
+};
+
+// Stays valid across removals of other bodies; the generation catches use after removal
+struct BodyHandle
+{
+	static const uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+	bool operator==(const BodyHandle& other) const { return slot == other.slot && generation == other.generation; }
+	bool operator!=(const BodyHandle& other) const { return !(*this == other); }
+
+	uint32_t slot = INVALID_SLOT;
+	uint32_t generation = 0;
+};
+
+// Everything needed to add a body, mirrors what the Game spawn helpers set on a RigidBody
+struct BodyDefinition
+{
+	BodyShapeType	shapeType = BODY_SHAPE_SPHERE;
+	Float3			halfExtents = Float3(0.5f, 0.5f, 0.5f);
+	float			radius = 0.5f;
+	float			halfHeight = 0.5f;
+
+	float			inverseMass = 1.f;
+	Float3			position;
+	FloatQuat		rotation;
+	Float3			velocity;
+	Float3			angularVelocityRadians;
+	Float3			acceleration;
+	float			maxLateralSpeed = 0.f;
+
+	bool			affectedByGravity = true;
+	bool			rotationLocked = false;
+	bool			canSleep = true;
+	bool			continuousCollision = false;	// For small fast bodies, see BodyScene::SolveTimeOfImpact
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Bounds are rewritten by BodyScene::UpdateBounds before anything reads them, so snapshots skip them
+const int BODY_SNAPSHOT_FIELD_COUNT = BODY_BOUNDS_MIN_X;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Bodies are kept densely packed; removal swaps the last body into the hole, so dense indices are only
+// stable between adds/removes. Hold onto BodyHandles, and resolve them to an index when needed
+class BodyStore
+{
+public:
+	//-----Public Methods-----
+
+	void			Reserve(int bodyCount);
+	void			Clear();
+
+	BodyHandle		AddBody(const BodyDefinition& definition);
+	void			RemoveBody(BodyHandle handle);
+
+	bool			IsValid(BodyHandle handle) const;
+	int				GetIndex(BodyHandle handle) const;
+	BodyHandle		GetHandle(int index) const;
+	int				GetCount() const { return (int)m_shapeTypes.size(); }
+	int				GetSlotCount() const { return (int)m_slotGenerations.size(); }	// Live and free, so the most bodies there have been at once
+
+	float*			GetField(BodyField field) { return m_fields[field].data(); }
+	const float*	GetField(BodyField field) const { return m_fields[field].data(); }
+	uint8_t*		GetShapeTypes() { return m_shapeTypes.data(); }
+	const uint8_t*	GetShapeTypes() const { return m_shapeTypes.data(); }
+	uint8_t*		GetFlags() { return m_flags.data(); }
+	const uint8_t*	GetFlags() const { return m_flags.data(); }
+
+	// Single body access, for gameplay code - bulk passes should use the arrays above
+	Float3			GetFloat3(int index, BodyField xField) const;
+	void			SetFloat3(int index, BodyField xField, const Float3& value);
+	FloatQuat		GetRotation(int index) const;
+	void			SetRotation(int index, const FloatQuat& rotation);
+	FloatSym3		GetWorldInverseInertia(int index) const;
+	FloatAabb		GetBounds(int index) const;
+	void			UpdateWorldInverseInertia(int index);
+	bool			HasFlag(int index, BodyFlag flag) const { return (m_flags[index] & flag) != 0; }
+	bool			IsAwakeAndDynamic(int index) const { return m_fields[BODY_INVERSE_MASS][index] > 0.f && !HasFlag(index, BODY_FLAG_ASLEEP); }
+	void			SetFlag(int index, BodyFlag flag, bool value);
+
+	// Every body and the handle slots, so handles taken before a snapshot still resolve after restoring it
+	void			WriteSnapshot(BodySnapshotWriter& writer) const;
+	bool			ReadSnapshot(BodySnapshotReader& reader);
+	static bool		ReadSnapshotLayout(BodySnapshotReader& reader, BodySnapshotLayout& out_layout);
+
+
+private:
+	//-----Private Methods-----
+
+	void SetInverseInertiaFromShape(int index);
+
+
+private:
+	//-----Private Data-----
+
+	std::vector<float>		m_fields[NUM_BODY_FIELDS];
+	std::vector<uint8_t>	m_shapeTypes;
+	std::vector<uint8_t>	m_flags;
+
+	// Handle indirection
+	std::vector<uint32_t>	m_indexToSlot;
+	std::vector<int>		m_slotToIndex;
+	std::vector<uint32_t>	m_slotGenerations;
+	std::vector<uint32_t>	m_freeSlots;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
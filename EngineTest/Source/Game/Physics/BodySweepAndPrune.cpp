@@ -0,0 +1,395 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodySweepAndPrune.h"
+#include "Game/Physics/BodyStore.h"
+#include <algorithm>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Each new body walks its endpoints down the whole of every axis, so past this many it's cheaper to sort from scratch
+static const int s_maxIncrementalAdds = 16;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Mins go before maxes at the same value, so touching bounds count as overlapping like DoBodyBoundsOverlap
+static bool IsEndpointLessThan(const SapEndpoint& a, const SapEndpoint& b)
+{
+	return (a.value < b.value) || (a.value == b.value && !a.IsMax() && b.IsMax());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Same order, with ties broken on slot so the rebuild doesn't depend on the sort implementation
+static bool IsEndpointBefore(const SapEndpoint& a, const SapEndpoint& b)
+{
+	if (a.value != b.value)
+	{
+		return (a.value < b.value);
+	}
+
+	if (a.IsMax() != b.IsMax())
+	{
+		return b.IsMax();
+	}
+
+	return (a.data < b.data);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint64_t GetPairKey(uint32_t slotA, uint32_t slotB)
+{
+	return (slotA < slotB ? ((uint64_t)slotA << 32) | slotB : ((uint64_t)slotB << 32) | slotA);
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void SweepAndPruneBroadphase::FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs)
+{
+	SyncProxies(store);
+	RemoveStaleProxies();
+
+	m_lastSwapCount = 0;
+
+	if ((int)m_addedSlots.size() > s_maxIncrementalAdds)
+	{
+		Rebuild(store);
+	}
+	else
+	{
+		AddNewProxies();
+
+		UpdateAxis(store, 0);
+		UpdateAxis(store, 1);
+	}
+
+	for (uint64_t pairKey : m_pairs)
+	{
+		const int indexA = m_proxies[(uint32_t)(pairKey >> 32)].bodyIndex;
+		const int indexB = m_proxies[(uint32_t)pairKey].bodyIndex;
+
+		if (ShouldBodiesCollide(store, indexA, indexB) && DoBodyBoundsOverlap(store, indexA, indexB))
+		{
+			BodyPair pair;
+			pair.bodyA = std::min(indexA, indexB);
+			pair.bodyB = std::max(indexA, indexB);
+			out_pairs.push_back(pair);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Points each slot at its body's current index, noting which bodies are new and which went away.
+// A slot reused by a new body counts as both
+void SweepAndPruneBroadphase::SyncProxies(const BodyStore& store)
+{
+	m_stepCount++;
+	m_addedSlots.clear();
+	m_removedCount = 0;
+
+	const int bodyCount = store.GetCount();
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const BodyHandle handle = store.GetHandle(bodyIndex);
+		if (handle.slot >= (uint32_t)m_proxies.size())
+		{
+			m_proxies.resize(handle.slot + 1);
+		}
+
+		SapProxy& proxy = m_proxies[handle.slot];
+		if (proxy.isActive && proxy.generation != handle.generation)
+		{
+			proxy.isActive = false;
+			proxy.removedStep = m_stepCount;
+			m_activeCount--;
+			m_removedCount++;
+		}
+
+		if (!proxy.isActive)
+		{
+			proxy.isActive = true;
+			proxy.generation = handle.generation;
+			m_activeCount++;
+			m_addedSlots.push_back(handle.slot);
+		}
+
+		proxy.bodyIndex = bodyIndex;
+		proxy.lastSeenStep = m_stepCount;
+	}
+
+	for (SapProxy& proxy : m_proxies)
+	{
+		if (proxy.isActive && proxy.lastSeenStep != m_stepCount)
+		{
+			proxy.isActive = false;
+			proxy.removedStep = m_stepCount;
+			proxy.bodyIndex = -1;
+			m_activeCount--;
+			m_removedCount++;
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Drops the endpoints and pairs of every body removed this step, before any new body in the same slot is added
+void SweepAndPruneBroadphase::RemoveStaleProxies()
+{
+	if (m_removedCount == 0)
+	{
+		return;
+	}
+
+	for (std::vector<SapEndpoint>& endpoints : m_endpoints)
+	{
+		endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(), [this](const SapEndpoint& endpoint)
+		{
+			return (m_proxies[endpoint.GetSlot()].removedStep == m_stepCount);
+		}), endpoints.end());
+	}
+
+	for (std::unordered_set<uint64_t>::iterator pairItr = m_pairs.begin(); pairItr != m_pairs.end();)
+	{
+		const bool isRemoved = (m_proxies[(uint32_t)(*pairItr >> 32)].removedStep == m_stepCount || m_proxies[(uint32_t)*pairItr].removedStep == m_stepCount);
+		pairItr = (isRemoved ? m_pairs.erase(pairItr) : ++pairItr);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// New endpoints go on the end of each axis, as if the body was off past everything else, and the insertion sort
+// moves them into place; every max it passes on the way down is a pair to check
+void SweepAndPruneBroadphase::AddNewProxies()
+{
+	for (uint32_t slot : m_addedSlots)
+	{
+		for (std::vector<SapEndpoint>& endpoints : m_endpoints)
+		{
+			SapEndpoint endpoint;
+			endpoint.data = (slot << 1);
+			endpoints.push_back(endpoint);
+
+			endpoint.data |= 1;
+			endpoints.push_back(endpoint);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Each endpoint only moves left, past the ones bigger than it now. Any pair whose order changed started or stopped overlapping
+void SweepAndPruneBroadphase::UpdateAxis(const BodyStore& store, int sortedAxisIndex)
+{
+	RefreshEndpointValues(store, sortedAxisIndex);
+
+	std::vector<SapEndpoint>& endpoints = m_endpoints[sortedAxisIndex];
+	const int endpointCount = (int)endpoints.size();
+
+	for (int endpointIndex = 1; endpointIndex < endpointCount; ++endpointIndex)
+	{
+		const SapEndpoint endpoint = endpoints[endpointIndex];
+		int insertIndex = endpointIndex;
+
+		while (insertIndex > 0 && IsEndpointLessThan(endpoint, endpoints[insertIndex - 1]))
+		{
+			const SapEndpoint& passed = endpoints[insertIndex - 1];
+
+			if (endpoint.IsMax() != passed.IsMax() && endpoint.GetSlot() != passed.GetSlot())
+			{
+				if (!endpoint.IsMax())
+				{
+					// Our min went below their max, so we overlap on this axis now
+					const int indexA = m_proxies[endpoint.GetSlot()].bodyIndex;
+					const int indexB = m_proxies[passed.GetSlot()].bodyIndex;
+
+					if (DoOverlapOnSortedAxes(store, indexA, indexB))
+					{
+						AddPair(endpoint.GetSlot(), passed.GetSlot());
+					}
+				}
+				else
+				{
+					// Our max went below their min, so we don't
+					RemovePair(endpoint.GetSlot(), passed.GetSlot());
+				}
+			}
+
+			endpoints[insertIndex] = passed;
+			insertIndex--;
+			m_lastSwapCount++;
+		}
+
+		endpoints[insertIndex] = endpoint;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Sorts both axes from scratch, then finds the overlapping pairs with one sweep along the first
+void SweepAndPruneBroadphase::Rebuild(const BodyStore& store)
+{
+	const int bodyCount = store.GetCount();
+	ChooseSortedAxes(store);
+
+	for (int sortedAxisIndex = 0; sortedAxisIndex < 2; ++sortedAxisIndex)
+	{
+		std::vector<SapEndpoint>& endpoints = m_endpoints[sortedAxisIndex];
+		endpoints.resize(2 * bodyCount);
+
+		for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+		{
+			endpoints[2 * bodyIndex + 0].data = (store.GetHandle(bodyIndex).slot << 1);
+			endpoints[2 * bodyIndex + 1].data = (store.GetHandle(bodyIndex).slot << 1) | 1;
+		}
+
+		RefreshEndpointValues(store, sortedAxisIndex);
+		std::sort(endpoints.begin(), endpoints.end(), IsEndpointBefore);
+	}
+
+	m_pairs.clear();
+	m_sweepSlots.clear();
+	m_sweepPositions.resize(m_proxies.size());
+
+	for (const SapEndpoint& endpoint : m_endpoints[0])
+	{
+		const uint32_t slot = endpoint.GetSlot();
+
+		if (endpoint.IsMax())
+		{
+			// Swap remove from the open list
+			const int position = m_sweepPositions[slot];
+			m_sweepSlots[position] = m_sweepSlots.back();
+			m_sweepPositions[m_sweepSlots[position]] = position;
+			m_sweepSlots.pop_back();
+			continue;
+		}
+
+		const int bodyIndex = m_proxies[slot].bodyIndex;
+		for (uint32_t openSlot : m_sweepSlots)
+		{
+			if (DoOverlapOnSortedAxes(store, bodyIndex, m_proxies[openSlot].bodyIndex))
+			{
+				AddPair(slot, openSlot);
+			}
+		}
+
+		m_sweepPositions[slot] = (int)m_sweepSlots.size();
+		m_sweepSlots.push_back(slot);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Keeps the two axes with the most spread in body centers, widest first so the rebuild sweep has the fewest open bodies
+void SweepAndPruneBroadphase::ChooseSortedAxes(const BodyStore& store)
+{
+	const int bodyCount = store.GetCount();
+	if (bodyCount == 0)
+	{
+		return;
+	}
+
+	double sums[3] = {};
+	double squaredSums[3] = {};
+
+	for (int bodyIndex = 0; bodyIndex < bodyCount; ++bodyIndex)
+	{
+		const Float3 position = store.GetFloat3(bodyIndex, BODY_POSITION_X);
+		for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+		{
+			const double value = (double)(&position.x)[axisIndex];
+			sums[axisIndex] += value;
+			squaredSums[axisIndex] += value * value;
+		}
+	}
+
+	double variances[3];
+	int axes[3] = { 0, 1, 2 };
+
+	for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+	{
+		const double mean = sums[axisIndex] / (double)bodyCount;
+		variances[axisIndex] = squaredSums[axisIndex] / (double)bodyCount - mean * mean;
+	}
+
+	std::sort(axes, axes + 3, [&variances](int a, int b)
+	{
+		return (variances[a] > variances[b]) || (variances[a] == variances[b] && a < b);
+	});
+
+	m_sortedAxes[0] = axes[0];
+	m_sortedAxes[1] = axes[1];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void SweepAndPruneBroadphase::RefreshEndpointValues(const BodyStore& store, int sortedAxisIndex)
+{
+	const int axisIndex = m_sortedAxes[sortedAxisIndex];
+	const float* mins = store.GetField((BodyField)(BODY_BOUNDS_MIN_X + axisIndex));
+	const float* maxs = store.GetField((BodyField)(BODY_BOUNDS_MAX_X + axisIndex));
+
+	for (SapEndpoint& endpoint : m_endpoints[sortedAxisIndex])
+	{
+		const int bodyIndex = m_proxies[endpoint.GetSlot()].bodyIndex;
+		endpoint.value = (endpoint.IsMax() ? maxs[bodyIndex] : mins[bodyIndex]);
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool SweepAndPruneBroadphase::DoOverlapOnSortedAxes(const BodyStore& store, int indexA, int indexB) const
+{
+	for (int sortedAxisIndex = 0; sortedAxisIndex < 2; ++sortedAxisIndex)
+	{
+		const int axisIndex = m_sortedAxes[sortedAxisIndex];
+		const float* mins = store.GetField((BodyField)(BODY_BOUNDS_MIN_X + axisIndex));
+		const float* maxs = store.GetField((BodyField)(BODY_BOUNDS_MAX_X + axisIndex));
+
+		if (mins[indexA] > maxs[indexB] || mins[indexB] > maxs[indexA])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void SweepAndPruneBroadphase::AddPair(uint32_t slotA, uint32_t slotB)
+{
+	m_pairs.insert(GetPairKey(slotA, slotB));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void SweepAndPruneBroadphase::RemovePair(uint32_t slotA, uint32_t slotB)
+{
+	m_pairs.erase(GetPairKey(slotA, slotB));
+}
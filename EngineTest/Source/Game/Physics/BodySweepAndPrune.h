@@ -0,0 +1,107 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Persistent multi-axis sweep and prune, kept sorted by insertion sort so coherent steps cost close to O(n)
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/BodyBroadphase.h"
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// One end of a body's bounds on one axis
+struct SapEndpoint
+{
+	float		value = 0.f;
+	uint32_t	data = 0;		// Handle slot << 1, low bit set for a max
+
+	uint32_t	GetSlot() const { return data >> 1; }
+	bool		IsMax() const { return (data & 1) != 0; }
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Two axes keep their endpoints sorted from the last step, so an insertion sort only has to move the few that
+// crossed each other. Each crossing is where a pair starts or stops overlapping, which keeps the set of pairs
+// overlapping on both axes up to date without ever sweeping: a min passing a max checks the other axis and adds
+// the pair, a max passing a min removes it. The third axis is only checked when pairs are handed out.
+// The two axes are the ones bodies are most spread out along, picked whenever everything is resorted; on a flat
+// level that's x and z, as sorting on height would have nearly every endpoint crossing others every step.
+// Adding a lot of bodies at once resorts everything from scratch instead of walking each one down the axes.
+// Bodies are tracked by handle slot, like the AABB tree
+class SweepAndPruneBroadphase : public BodyBroadphase
+{
+public:
+	//-----Public Methods-----
+
+	virtual const char*	GetName() const override { return "sweep_and_prune"; }
+	virtual void		FindPairs(const BodyStore& store, std::vector<BodyPair>& out_pairs) override;
+
+	int					GetLastSwapCount() const { return m_lastSwapCount; }
+
+
+private:
+	//-----Private Methods-----
+
+	void	SyncProxies(const BodyStore& store);
+	void	RemoveStaleProxies();
+	void	AddNewProxies();
+	void	UpdateAxis(const BodyStore& store, int sortedAxisIndex);
+	void	Rebuild(const BodyStore& store);
+	void	ChooseSortedAxes(const BodyStore& store);
+
+	void	RefreshEndpointValues(const BodyStore& store, int sortedAxisIndex);
+	bool	DoOverlapOnSortedAxes(const BodyStore& store, int indexA, int indexB) const;
+	void	AddPair(uint32_t slotA, uint32_t slotB);
+	void	RemovePair(uint32_t slotA, uint32_t slotB);
+
+
+private:
+	//-----Private Data-----
+
+	// Per handle slot
+	struct SapProxy
+	{
+		int			bodyIndex = -1;		// Refreshed every step
+		uint32_t	generation = 0;
+		uint32_t	lastSeenStep = 0;
+		uint32_t	removedStep = 0;	// Step its old endpoints and pairs get dropped in
+		bool		isActive = false;
+	};
+
+	std::vector<SapProxy>			m_proxies;
+	int								m_sortedAxes[2] = { 0, 2 };
+	std::vector<SapEndpoint>		m_endpoints[2];		// Per sorted axis
+	std::unordered_set<uint64_t>	m_pairs;			// Slot pairs overlapping on both sorted axes, lower slot in the high bits
+	std::vector<uint32_t>			m_addedSlots;
+	std::vector<uint32_t>			m_sweepSlots;		// Rebuild only
+	std::vector<int>				m_sweepPositions;	// Rebuild only, per slot
+	uint32_t						m_stepCount = 0;
+	int								m_activeCount = 0;
+	int								m_removedCount = 0;
+	int								m_lastSwapCount = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,328 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Plain float vector/quaternion math for the body store. Kept free of engine types so the
+///				 structure-of-arrays data can be read and written without conversions
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+struct Float3
+{
+	Float3() {}
+	Float3(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+
+	Float3	operator+(const Float3& other) const { return Float3(x + other.x, y + other.y, z + other.z); }
+	Float3	operator-(const Float3& other) const { return Float3(x - other.x, y - other.y, z - other.z); }
+	Float3	operator-() const { return Float3(-x, -y, -z); }
+	Float3	operator*(float scalar) const { return Float3(x * scalar, y * scalar, z * scalar); }
+	void	operator+=(const Float3& other) { x += other.x; y += other.y; z += other.z; }
+	void	operator-=(const Float3& other) { x -= other.x; y -= other.y; z -= other.z; }
+
+	float x = 0.f;
+	float y = 0.f;
+	float z = 0.f;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Unit quaternion, w is the scalar part
+struct FloatQuat
+{
+	FloatQuat() {}
+	FloatQuat(float w_, float x_, float y_, float z_) : w(w_), x(x_), y(y_), z(z_) {}
+
+	float w = 1.f;
+	float x = 0.f;
+	float y = 0.f;
+	float z = 0.f;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Symmetric 3x3, used for world space inverse inertia tensors
+struct FloatSym3
+{
+	float xx = 0.f;
+	float yy = 0.f;
+	float zz = 0.f;
+	float xy = 0.f;
+	float xz = 0.f;
+	float yz = 0.f;
+};
+
+
+
+//-------------------------------------------------------------------------------------------------
+// Axis aligned box, for broadphase bookkeeping
+struct FloatAabb
+{
+	FloatAabb() {}
+	FloatAabb(const Float3& mins_, const Float3& maxs_) : mins(mins_), maxs(maxs_) {}
+
+	Float3 mins;
+	Float3 maxs;
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+const float PHYSICS_PI = 3.14159265358979f;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+inline float Dot(const Float3& a, const Float3& b)
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline Float3 Cross(const Float3& a, const Float3& b)
+{
+	return Float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline float LengthSquared(const Float3& v)
+{
+	return Dot(v, v);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline float Length(const Float3& v)
+{
+	return sqrtf(Dot(v, v));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Returns the fallback if the vector is too short to normalize
+inline Float3 SafeNormalize(const Float3& v, const Float3& fallback)
+{
+	const float lengthSquared = LengthSquared(v);
+	if (lengthSquared < 1e-12f)
+	{
+		return fallback;
+	}
+
+	return v * (1.f / sqrtf(lengthSquared));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Any unit vector perpendicular to the given unit vector
+inline Float3 GetPerpendicular(const Float3& unit)
+{
+	if (fabsf(unit.x) >= 0.57735f)
+	{
+		return SafeNormalize(Float3(unit.y, -unit.x, 0.f), Float3(0.f, 1.f, 0.f));
+	}
+
+	return SafeNormalize(Float3(0.f, unit.z, -unit.y), Float3(1.f, 0.f, 0.f));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline FloatQuat Multiply(const FloatQuat& a, const FloatQuat& b)
+{
+	return FloatQuat(
+		a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+		a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+		a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+		a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline FloatQuat Normalize(const FloatQuat& q)
+{
+	const float lengthSquared = q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+	if (lengthSquared < 1e-12f)
+	{
+		return FloatQuat();
+	}
+
+	const float inverseLength = 1.f / sqrtf(lengthSquared);
+	return FloatQuat(q.w * inverseLength, q.x * inverseLength, q.y * inverseLength, q.z * inverseLength);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline FloatQuat CreateQuatFromAxisAngle(const Float3& unitAxis, float radians)
+{
+	const float halfAngle = 0.5f * radians;
+	const float s = sinf(halfAngle);
+
+	return FloatQuat(cosf(halfAngle), unitAxis.x * s, unitAxis.y * s, unitAxis.z * s);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Applies roll (z), then pitch (x), then yaw (y)
+inline FloatQuat CreateQuatFromEulerDegrees(const Float3& degrees)
+{
+	const float toRadians = PHYSICS_PI / 180.f;
+	const FloatQuat pitch = CreateQuatFromAxisAngle(Float3(1.f, 0.f, 0.f), degrees.x * toRadians);
+	const FloatQuat yaw = CreateQuatFromAxisAngle(Float3(0.f, 1.f, 0.f), degrees.y * toRadians);
+	const FloatQuat roll = CreateQuatFromAxisAngle(Float3(0.f, 0.f, 1.f), degrees.z * toRadians);
+
+	return Normalize(Multiply(yaw, Multiply(pitch, roll)));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Inverse of CreateQuatFromEulerDegrees; pitch is kept in [-90, 90], and at +-90 the roll is folded into the yaw
+inline Float3 GetEulerDegrees(const FloatQuat& q)
+{
+	const float toDegrees = 180.f / PHYSICS_PI;
+
+	// Terms of the rotation matrix yaw * pitch * roll, by row and column
+	const float m02 = 2.f * (q.x * q.z + q.w * q.y);
+	const float m10 = 2.f * (q.x * q.y + q.w * q.z);
+	const float m11 = 1.f - 2.f * (q.x * q.x + q.z * q.z);
+	const float m12 = 2.f * (q.y * q.z - q.w * q.x);
+	const float m22 = 1.f - 2.f * (q.x * q.x + q.y * q.y);
+
+	const float sinPitch = std::min(std::max(-m12, -1.f), 1.f);
+	if (fabsf(sinPitch) > 0.999999f)
+	{
+		const float m00 = 1.f - 2.f * (q.y * q.y + q.z * q.z);
+		const float m20 = 2.f * (q.x * q.z - q.w * q.y);
+
+		return Float3(asinf(sinPitch) * toDegrees, atan2f(-m20, m00) * toDegrees, 0.f);
+	}
+
+	return Float3(asinf(sinPitch) * toDegrees, atan2f(m02, m22) * toDegrees, atan2f(m10, m11) * toDegrees);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline Float3 Rotate(const FloatQuat& q, const Float3& v)
+{
+	// v + 2w(u x v) + 2u x (u x v), u being the vector part
+	const Float3 u(q.x, q.y, q.z);
+	const Float3 t = Cross(u, v) * 2.f;
+
+	return v + t * q.w + Cross(u, t);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline Float3 InverseRotate(const FloatQuat& q, const Float3& v)
+{
+	return Rotate(FloatQuat(q.w, -q.x, -q.y, -q.z), v);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Columns of the rotation matrix, i.e. the body's local axes in world space
+inline void GetAxes(const FloatQuat& q, Float3& out_xAxis, Float3& out_yAxis, Float3& out_zAxis)
+{
+	const float xx = q.x * q.x;
+	const float yy = q.y * q.y;
+	const float zz = q.z * q.z;
+	const float xy = q.x * q.y;
+	const float xz = q.x * q.z;
+	const float yz = q.y * q.z;
+	const float wx = q.w * q.x;
+	const float wy = q.w * q.y;
+	const float wz = q.w * q.z;
+
+	out_xAxis = Float3(1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy));
+	out_yAxis = Float3(2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx));
+	out_zAxis = Float3(2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline Float3 Multiply(const FloatSym3& m, const Float3& v)
+{
+	return Float3(
+		m.xx * v.x + m.xy * v.y + m.xz * v.z,
+		m.xy * v.x + m.yy * v.y + m.yz * v.z,
+		m.xz * v.x + m.yz * v.y + m.zz * v.z);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// R * diag(d) * R^T, for taking a local diagonal inverse inertia into world space
+inline FloatSym3 RotateDiagonal(const FloatQuat& q, const Float3& diagonal)
+{
+	Float3 xAxis, yAxis, zAxis;
+	GetAxes(q, xAxis, yAxis, zAxis);
+
+	FloatSym3 result;
+	result.xx = diagonal.x * xAxis.x * xAxis.x + diagonal.y * yAxis.x * yAxis.x + diagonal.z * zAxis.x * zAxis.x;
+	result.yy = diagonal.x * xAxis.y * xAxis.y + diagonal.y * yAxis.y * yAxis.y + diagonal.z * zAxis.y * zAxis.y;
+	result.zz = diagonal.x * xAxis.z * xAxis.z + diagonal.y * yAxis.z * yAxis.z + diagonal.z * zAxis.z * zAxis.z;
+	result.xy = diagonal.x * xAxis.x * xAxis.y + diagonal.y * yAxis.x * yAxis.y + diagonal.z * zAxis.x * zAxis.y;
+	result.xz = diagonal.x * xAxis.x * xAxis.z + diagonal.y * yAxis.x * yAxis.z + diagonal.z * zAxis.x * zAxis.z;
+	result.yz = diagonal.x * xAxis.y * xAxis.z + diagonal.y * yAxis.y * yAxis.z + diagonal.z * zAxis.y * zAxis.z;
+
+	return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline FloatAabb Union(const FloatAabb& a, const FloatAabb& b)
+{
+	return FloatAabb(
+		Float3(std::min(a.mins.x, b.mins.x), std::min(a.mins.y, b.mins.y), std::min(a.mins.z, b.mins.z)),
+		Float3(std::max(a.maxs.x, b.maxs.x), std::max(a.maxs.y, b.maxs.y), std::max(a.maxs.z, b.maxs.z)));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline FloatAabb Expand(const FloatAabb& box, float amount)
+{
+	return FloatAabb(box.mins - Float3(amount, amount, amount), box.maxs + Float3(amount, amount, amount));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline bool Contains(const FloatAabb& outer, const FloatAabb& inner)
+{
+	return outer.mins.x <= inner.mins.x && outer.mins.y <= inner.mins.y && outer.mins.z <= inner.mins.z
+		&& outer.maxs.x >= inner.maxs.x && outer.maxs.y >= inner.maxs.y && outer.maxs.z >= inner.maxs.z;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline bool DoAabbsOverlap(const FloatAabb& a, const FloatAabb& b)
+{
+	return a.mins.x <= b.maxs.x && b.mins.x <= a.maxs.x
+		&& a.mins.y <= b.maxs.y && b.mins.y <= a.maxs.y
+		&& a.mins.z <= b.maxs.z && b.mins.z <= a.maxs.z;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+inline float GetSurfaceArea(const FloatAabb& box)
+{
+	const Float3 size = box.maxs - box.mins;
+	return 2.f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
@@ -0,0 +1,385 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description:
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Render/DebugDraw.h"
+#include "Game/Render/DebugDrawBackend.h"
+#include "Game/Framework/Profiler.h"
+#include "Engine/Core/EngineCommon.h"
+#include <algorithm>
+#include <cmath>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+DebugDraw* g_debugDraw = nullptr;
+
+static const int				s_sphereSegmentCount = 16;
+static std::vector<Float3>		s_unitShapes[NUM_DEBUG_DRAW_SHAPES];		// Line lists; lines are their two ends, so have none
+
+static uint32_t					s_nextGeneration = 1;
+static thread_local void*		s_threadStreams = nullptr;				// DebugDraw::ThreadStreams, which is private
+static thread_local uint32_t	s_threadStreamsGeneration = 0;
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static void AddUnitLine(std::vector<Float3>& out_shape, const Float3& start, const Float3& end)
+{
+	out_shape.push_back(start);
+	out_shape.push_back(end);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Everything spans -1 to 1, so the instance scale is a half extent or radius
+static void BuildUnitShapes()
+{
+	std::vector<Float3>& point = s_unitShapes[DEBUG_DRAW_SHAPE_POINT];
+	point.clear();
+	AddUnitLine(point, Float3(-1.f, 0.f, 0.f), Float3(1.f, 0.f, 0.f));
+	AddUnitLine(point, Float3(0.f, -1.f, 0.f), Float3(0.f, 1.f, 0.f));
+	AddUnitLine(point, Float3(0.f, 0.f, -1.f), Float3(0.f, 0.f, 1.f));
+
+	// Four edges along each axis
+	std::vector<Float3>& box = s_unitShapes[DEBUG_DRAW_SHAPE_WIRE_BOX];
+	box.clear();
+	for (int edgeIndex = 0; edgeIndex < 4; ++edgeIndex)
+	{
+		const float a = ((edgeIndex & 1) != 0 ? 1.f : -1.f);
+		const float b = ((edgeIndex & 2) != 0 ? 1.f : -1.f);
+
+		AddUnitLine(box, Float3(-1.f, a, b), Float3(1.f, a, b));
+		AddUnitLine(box, Float3(a, -1.f, b), Float3(a, 1.f, b));
+		AddUnitLine(box, Float3(a, b, -1.f), Float3(a, b, 1.f));
+	}
+
+	// A circle around each axis
+	std::vector<Float3>& sphere = s_unitShapes[DEBUG_DRAW_SHAPE_WIRE_SPHERE];
+	sphere.clear();
+	for (int segmentIndex = 0; segmentIndex < s_sphereSegmentCount; ++segmentIndex)
+	{
+		const float startRadians = (2.f * PHYSICS_PI * (float)segmentIndex) / (float)s_sphereSegmentCount;
+		const float endRadians = (2.f * PHYSICS_PI * (float)(segmentIndex + 1)) / (float)s_sphereSegmentCount;
+		const float c0 = cosf(startRadians);
+		const float s0 = sinf(startRadians);
+		const float c1 = cosf(endRadians);
+		const float s1 = sinf(endRadians);
+
+		AddUnitLine(sphere, Float3(0.f, c0, s0), Float3(0.f, c1, s1));
+		AddUnitLine(sphere, Float3(c0, 0.f, s0), Float3(c1, 0.f, s1));
+		AddUnitLine(sphere, Float3(c0, s0, 0.f), Float3(c1, s1, 0.f));
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static int GetBatchIndex(DebugDrawShape shape, DebugDrawDepthMode depthMode)
+{
+	return (int)shape * NUM_DEBUG_DRAW_DEPTH_MODES + (int)depthMode;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void DebugDraw::Initialize()
+{
+	ASSERT_OR_DIE(g_debugDraw == nullptr, "DebugDraw initialized twice!");
+
+	BuildUnitShapes();
+	g_debugDraw = new DebugDraw();
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DebugDraw::Shutdown()
+{
+	SAFE_DELETE(g_debugDraw);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+DebugDraw::DebugDraw()
+	: m_generation(s_nextGeneration++)
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DebugDraw::DrawLine(const Float3& start, const Float3& end, uint32_t color, DebugDrawDepthMode depthMode /*= DEBUG_DRAW_DEPTH_TESTED*/)
+{
+	DebugDrawInstance instance;
+	instance.position = start;
+	instance.scale = end;
+	instance.color = color;
+
+	AddInstance(DEBUG_DRAW_SHAPE_LINE, depthMode, instance);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DebugDraw::DrawPoint(const Float3& position, float size, uint32_t color, DebugDrawDepthMode depthMode /*= DEBUG_DRAW_DEPTH_TESTED*/)
+{
+	DebugDrawInstance instance;
+	instance.position = position;
+	instance.scale = Float3(size, size, size) * 0.5f;
+	instance.color = color;
+
+	AddInstance(DEBUG_DRAW_SHAPE_POINT, depthMode, instance);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DebugDraw::DrawWireBox(const Float3& center, const Float3& halfExtents, const FloatQuat& rotation, uint32_t color, DebugDrawDepthMode depthMode /*= DEBUG_DRAW_DEPTH_TESTED*/)
+{
+	DebugDrawInstance instance;
+	instance.position = center;
+	instance.scale = halfExtents;
+	instance.rotation = rotation;
+	instance.color = color;
+
+	AddInstance(DEBUG_DRAW_SHAPE_WIRE_BOX, depthMode, instance);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DebugDraw::DrawWireAabb(const FloatAabb& bounds, uint32_t color, DebugDrawDepthMode depthMode /*= DEBUG_DRAW_DEPTH_TESTED*/)
+{
+	DrawWireBox((bounds.mins + bounds.maxs) * 0.5f, (bounds.maxs - bounds.mins) * 0.5f, FloatQuat(), color, depthMode);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DebugDraw::DrawWireSphere(const Float3& center, float radius, uint32_t color, DebugDrawDepthMode depthMode /*= DEBUG_DRAW_DEPTH_TESTED*/)
+{
+	DebugDrawInstance instance;
+	instance.position = center;
+	instance.scale = Float3(radius, radius, radius);
+	instance.color = color;
+
+	AddInstance(DEBUG_DRAW_SHAPE_WIRE_SPHERE, depthMode, instance);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// A point with its normal sticking out of it
+void DebugDraw::DrawContact(const Float3& position, const Float3& normal, float size, uint32_t color, DebugDrawDepthMode depthMode /*= DEBUG_DRAW_DEPTH_ALWAYS*/)
+{
+	DrawPoint(position, size, color, depthMode);
+	DrawLine(position, position + normal * (2.f * size), color, depthMode);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Instanced if the backend can, otherwise expanded into line lists here
+DebugDrawStats DebugDraw::Flush(DebugDrawBackend& backend)
+{
+	PROFILE_SCOPE("Debug Draw Flush");
+
+	DebugDrawStats stats;
+	stats.primitiveCount = MergeThreadStreams();
+	stats.threadCount = (int)m_threadStreams.size();
+
+	backend.BeginFlush();
+
+	if (backend.SupportsInstancing())
+	{
+		FlushInstanced(backend, stats);
+	}
+	else
+	{
+		FlushExpanded(backend, stats);
+	}
+
+	backend.EndFlush();
+
+	m_lastFlushStats = stats;
+	return stats;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Drops everything drawn since the last flush, for frames that don't render (headless)
+void DebugDraw::Discard()
+{
+	std::lock_guard<std::mutex> lock(m_threadStreamsMutex);
+
+	for (std::unique_ptr<ThreadStreams>& threadStreams : m_threadStreams)
+	{
+		for (int batchIndex = 0; batchIndex < NUM_DEBUG_DRAW_BATCHES; ++batchIndex)
+		{
+			threadStreams->batches[batchIndex].clear();
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+int DebugDraw::GetShapeVertexCount(DebugDrawShape shape)
+{
+	return (shape == DEBUG_DRAW_SHAPE_LINE ? 2 : (int)s_unitShapes[shape].size());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// What the instanced draw does on the GPU; out_vertices needs room for GetShapeVertexCount
+void DebugDraw::ExpandInstance(DebugDrawShape shape, const DebugDrawInstance& instance, DebugDrawVertex* out_vertices)
+{
+	if (shape == DEBUG_DRAW_SHAPE_LINE)
+	{
+		out_vertices[0].position = instance.position;
+		out_vertices[0].color = instance.color;
+		out_vertices[1].position = instance.scale;
+		out_vertices[1].color = instance.color;
+		return;
+	}
+
+	Float3 xAxis, yAxis, zAxis;
+	GetAxes(instance.rotation, xAxis, yAxis, zAxis);
+	xAxis = xAxis * instance.scale.x;
+	yAxis = yAxis * instance.scale.y;
+	zAxis = zAxis * instance.scale.z;
+
+	const std::vector<Float3>& unitShape = s_unitShapes[shape];
+	const int vertexCount = (int)unitShape.size();
+
+	for (int vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+	{
+		const Float3& unitVertex = unitShape[vertexIndex];
+		out_vertices[vertexIndex].position = instance.position + xAxis * unitVertex.x + yAxis * unitVertex.y + zAxis * unitVertex.z;
+		out_vertices[vertexIndex].color = instance.color;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Cached per thread, so the lock is only taken the first time a thread draws into this DebugDraw
+void DebugDraw::AddInstance(DebugDrawShape shape, DebugDrawDepthMode depthMode, const DebugDrawInstance& instance)
+{
+	if (s_threadStreams == nullptr || s_threadStreamsGeneration != m_generation)
+	{
+		std::lock_guard<std::mutex> lock(m_threadStreamsMutex);
+
+		m_threadStreams.emplace_back(new ThreadStreams());
+		s_threadStreams = m_threadStreams.back().get();
+		s_threadStreamsGeneration = m_generation;
+	}
+
+	ThreadStreams* threadStreams = (ThreadStreams*)s_threadStreams;
+	threadStreams->batches[GetBatchIndex(shape, depthMode)].push_back(instance);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Every thread's stream for a batch, one after another, into that batch; returns how many instances there are
+int DebugDraw::MergeThreadStreams()
+{
+	std::lock_guard<std::mutex> lock(m_threadStreamsMutex);
+
+	int instanceCount = 0;
+	for (int batchIndex = 0; batchIndex < NUM_DEBUG_DRAW_BATCHES; ++batchIndex)
+	{
+		std::vector<DebugDrawInstance>& mergedBatch = m_mergedBatches[batchIndex];
+		mergedBatch.clear();
+
+		for (std::unique_ptr<ThreadStreams>& threadStreams : m_threadStreams)
+		{
+			std::vector<DebugDrawInstance>& threadBatch = threadStreams->batches[batchIndex];
+			mergedBatch.insert(mergedBatch.end(), threadBatch.begin(), threadBatch.end());
+			threadBatch.clear();
+		}
+
+		instanceCount += (int)mergedBatch.size();
+	}
+
+	return instanceCount;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void DebugDraw::FlushInstanced(DebugDrawBackend& backend, DebugDrawStats& stats)
+{
+	for (int shapeIndex = 0; shapeIndex < NUM_DEBUG_DRAW_SHAPES; ++shapeIndex)
+	{
+		const DebugDrawShape shape = (DebugDrawShape)shapeIndex;
+		const int shapeVertexCount = GetShapeVertexCount(shape);
+
+		for (int depthModeIndex = 0; depthModeIndex < NUM_DEBUG_DRAW_DEPTH_MODES; ++depthModeIndex)
+		{
+			const DebugDrawDepthMode depthMode = (DebugDrawDepthMode)depthModeIndex;
+			const std::vector<DebugDrawInstance>& batch = m_mergedBatches[GetBatchIndex(shape, depthMode)];
+			const int instanceCount = (int)batch.size();
+
+			for (int firstInstance = 0; firstInstance < instanceCount; firstInstance += DEBUG_DRAW_MAX_INSTANCES_PER_DRAW)
+			{
+				const int drawInstanceCount = std::min(instanceCount - firstInstance, DEBUG_DRAW_MAX_INSTANCES_PER_DRAW);
+				backend.DrawInstances(shape, depthMode, batch.data() + firstInstance, drawInstanceCount);
+
+				stats.drawCount++;
+				stats.instanceCount += drawInstanceCount;
+				stats.vertexCount += drawInstanceCount * shapeVertexCount;
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shapes don't matter once expanded, so each depth mode is one line list, split only to fit the vertex buffer.
+// Every shape has an even vertex count, so no line is split across draws
+void DebugDraw::FlushExpanded(DebugDrawBackend& backend, DebugDrawStats& stats)
+{
+	for (int depthModeIndex = 0; depthModeIndex < NUM_DEBUG_DRAW_DEPTH_MODES; ++depthModeIndex)
+	{
+		const DebugDrawDepthMode depthMode = (DebugDrawDepthMode)depthModeIndex;
+
+		size_t vertexCount = 0;
+		for (int shapeIndex = 0; shapeIndex < NUM_DEBUG_DRAW_SHAPES; ++shapeIndex)
+		{
+			const DebugDrawShape shape = (DebugDrawShape)shapeIndex;
+			vertexCount += m_mergedBatches[GetBatchIndex(shape, depthMode)].size() * (size_t)GetShapeVertexCount(shape);
+		}
+
+		m_expandedVertices.resize(vertexCount);
+		DebugDrawVertex* vertices = m_expandedVertices.data();
+
+		for (int shapeIndex = 0; shapeIndex < NUM_DEBUG_DRAW_SHAPES; ++shapeIndex)
+		{
+			const DebugDrawShape shape = (DebugDrawShape)shapeIndex;
+			const int shapeVertexCount = GetShapeVertexCount(shape);
+
+			for (const DebugDrawInstance& instance : m_mergedBatches[GetBatchIndex(shape, depthMode)])
+			{
+				ExpandInstance(shape, instance, vertices);
+				vertices += shapeVertexCount;
+			}
+		}
+
+		for (size_t firstVertex = 0; firstVertex < vertexCount; firstVertex += DEBUG_DRAW_MAX_VERTICES_PER_DRAW)
+		{
+			const int drawVertexCount = (int)std::min(vertexCount - firstVertex, (size_t)DEBUG_DRAW_MAX_VERTICES_PER_DRAW);
+			backend.DrawLineList(depthMode, m_expandedVertices.data() + firstVertex, drawVertexCount);
+
+			stats.drawCount++;
+			stats.vertexCount += drawVertexCount;
+		}
+	}
+}
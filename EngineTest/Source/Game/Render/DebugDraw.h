@@ -0,0 +1,156 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: Immediate mode debug drawing from any thread, merged into a few batched draws per frame
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Physics/PhysicsMath.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class DebugDrawBackend;
+
+// Each is a unit line list mesh, instanced with the instance's transform
+enum DebugDrawShape
+{
+	DEBUG_DRAW_SHAPE_LINE,			// Not scaled or rotated; the instance's position and scale are its two ends
+	DEBUG_DRAW_SHAPE_POINT,			// Three axis lines crossing at the position, scale long
+	DEBUG_DRAW_SHAPE_WIRE_BOX,		// Scale is the half extents
+	DEBUG_DRAW_SHAPE_WIRE_SPHERE,	// A circle around each axis, scale is the radius
+	NUM_DEBUG_DRAW_SHAPES
+};
+
+enum DebugDrawDepthMode
+{
+	DEBUG_DRAW_DEPTH_TESTED,
+	DEBUG_DRAW_DEPTH_ALWAYS,		// Drawn over everything, for things that mustn't get lost inside geometry
+	NUM_DEBUG_DRAW_DEPTH_MODES
+};
+
+// Per instance data of the instanced batches
+struct DebugDrawInstance
+{
+	Float3		position;
+	Float3		scale;
+	FloatQuat	rotation;
+	uint32_t	color = 0xFFFFFFFF;	// RGBA8, like VoxelVertex
+};
+
+// What batches are expanded into when the backend can't instance; line lists, so every two make a line
+struct DebugDrawVertex
+{
+	Float3		position;
+	uint32_t	color = 0xFFFFFFFF;
+};
+
+struct DebugDrawStats
+{
+	int primitiveCount = 0;		// What was drawn this frame, i.e. how many draws it would have been one at a time
+	int drawCount = 0;
+	int instanceCount = 0;		// 0 when the batches were expanded
+	int vertexCount = 0;		// Line list vertices, drawn as instances or expanded
+	int threadCount = 0;		// Threads that have drawn since startup
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class DebugDraw;
+extern DebugDraw* g_debugDraw;			// Flushed once a frame by the App, to whichever backend it brought up
+
+const uint32_t	DEBUG_DRAW_WHITE = 0xFFFFFFFF;
+const uint32_t	DEBUG_DRAW_RED = 0xFF0000FF;
+const uint32_t	DEBUG_DRAW_GREEN = 0xFF00FF00;
+const uint32_t	DEBUG_DRAW_BLUE = 0xFFFF0000;
+const uint32_t	DEBUG_DRAW_YELLOW = 0xFF00FFFF;
+
+const int		DEBUG_DRAW_MAX_INSTANCES_PER_DRAW = 16384;
+const int		DEBUG_DRAW_MAX_VERTICES_PER_DRAW = 65536;		// 1 MB of vertex buffer
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Each thread that draws appends to its own streams, one per shape and depth mode, so drawing never locks and
+// jobs can draw what they're working on as they go. Flush merges every thread's streams into one instanced
+// batch per shape and depth mode (split only if one gets past the max instances), all with debug.shader, so
+// thousands of colliders, contacts and tree nodes are a handful of draws rather than one each.
+// Backends that can't instance get the batches expanded on the CPU into one line list per depth mode instead.
+// Everything drawn lasts one flush. Like the FrameArena, drawing has to be done by flush time, so only from
+// work that finishes within the frame. Streams keep their memory, so once grown, drawing doesn't allocate
+class DebugDraw
+{
+public:
+	//-----Public Methods-----
+
+	static void		Initialize();
+	static void		Shutdown();
+
+	// Any thread
+	void			DrawLine(const Float3& start, const Float3& end, uint32_t color, DebugDrawDepthMode depthMode = DEBUG_DRAW_DEPTH_TESTED);
+	void			DrawPoint(const Float3& position, float size, uint32_t color, DebugDrawDepthMode depthMode = DEBUG_DRAW_DEPTH_TESTED);
+	void			DrawWireBox(const Float3& center, const Float3& halfExtents, const FloatQuat& rotation, uint32_t color, DebugDrawDepthMode depthMode = DEBUG_DRAW_DEPTH_TESTED);
+	void			DrawWireAabb(const FloatAabb& bounds, uint32_t color, DebugDrawDepthMode depthMode = DEBUG_DRAW_DEPTH_TESTED);
+	void			DrawWireSphere(const Float3& center, float radius, uint32_t color, DebugDrawDepthMode depthMode = DEBUG_DRAW_DEPTH_TESTED);
+	void			DrawContact(const Float3& position, const Float3& normal, float size, uint32_t color, DebugDrawDepthMode depthMode = DEBUG_DRAW_DEPTH_ALWAYS);
+
+	// Main thread only, with nothing drawing
+	DebugDrawStats	Flush(DebugDrawBackend& backend);
+	void			Discard();
+
+	const DebugDrawStats& GetLastFlushStats() const { return m_lastFlushStats; }
+
+	static int		GetShapeVertexCount(DebugDrawShape shape);
+	static void		ExpandInstance(DebugDrawShape shape, const DebugDrawInstance& instance, DebugDrawVertex* out_vertices);
+
+
+private:
+	//-----Private Methods-----
+
+	DebugDraw();
+	~DebugDraw() {}
+	DebugDraw(const DebugDraw& copy) = delete;
+
+	void			AddInstance(DebugDrawShape shape, DebugDrawDepthMode depthMode, const DebugDrawInstance& instance);
+	int				MergeThreadStreams();
+	void			FlushInstanced(DebugDrawBackend& backend, DebugDrawStats& stats);
+	void			FlushExpanded(DebugDrawBackend& backend, DebugDrawStats& stats);
+
+
+private:
+	//-----Private Data-----
+
+	static const int NUM_DEBUG_DRAW_BATCHES = NUM_DEBUG_DRAW_SHAPES * NUM_DEBUG_DRAW_DEPTH_MODES;
+
+	struct ThreadStreams
+	{
+		std::vector<DebugDrawInstance> batches[NUM_DEBUG_DRAW_BATCHES];
+	};
+
+	mutable std::mutex								m_threadStreamsMutex;	// Only taken when a thread draws for the first time, and by flush
+	std::vector<std::unique_ptr<ThreadStreams>>		m_threadStreams;
+	uint32_t										m_generation = 0;		// Tells threads their cached streams belong to an earlier DebugDraw
+
+	std::vector<DebugDrawInstance>					m_mergedBatches[NUM_DEBUG_DRAW_BATCHES];
+	std::vector<DebugDrawVertex>					m_expandedVertices;
+	DebugDrawStats									m_lastFlushStats;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,62 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Render/DebugDrawBackend.h"
+#include "Engine/Core/EngineCommon.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void NullDebugDrawBackend::BeginFlush()
+{
+	m_drawCount = 0;
+	m_instanceCount = 0;
+	m_vertexCount = 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void NullDebugDrawBackend::DrawInstances(DebugDrawShape shape, DebugDrawDepthMode depthMode, const DebugDrawInstance* instances, int instanceCount)
+{
+	UNUSED(depthMode);
+	UNUSED(instances);
+
+	m_drawCount++;
+	m_instanceCount += instanceCount;
+	m_vertexCount += instanceCount * DebugDraw::GetShapeVertexCount(shape);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void NullDebugDrawBackend::DrawLineList(DebugDrawDepthMode depthMode, const DebugDrawVertex* vertices, int vertexCount)
+{
+	UNUSED(depthMode);
+	UNUSED(vertices);
+
+	m_drawCount++;
+	m_vertexCount += vertexCount;
+}
@@ -0,0 +1,80 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: Where DebugDraw's batches go at flush, and a backend that only counts them
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Render/DebugDraw.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// A renderer draws every batch with debug.shader, depth tested or not per the batch; instanced batches with the
+// shape's unit line list mesh and the instances as a second vertex stream. The data is only valid during the call
+class DebugDrawBackend
+{
+public:
+	//-----Public Methods-----
+
+	virtual ~DebugDrawBackend() {}
+
+	virtual bool	SupportsInstancing() const = 0;
+	virtual void	BeginFlush() {}
+	virtual void	DrawInstances(DebugDrawShape shape, DebugDrawDepthMode depthMode, const DebugDrawInstance* instances, int instanceCount) = 0;
+	virtual void	DrawLineList(DebugDrawDepthMode depthMode, const DebugDrawVertex* vertices, int vertexCount) = 0;
+	virtual void	EndFlush() {}
+
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Draws nothing, just counts what it's given, so the batching can be run and checked headless
+class NullDebugDrawBackend : public DebugDrawBackend
+{
+public:
+	//-----Public Methods-----
+
+	NullDebugDrawBackend(bool supportsInstancing = true) : m_supportsInstancing(supportsInstancing) {}
+
+	virtual bool	SupportsInstancing() const override { return m_supportsInstancing; }
+	virtual void	BeginFlush() override;
+	virtual void	DrawInstances(DebugDrawShape shape, DebugDrawDepthMode depthMode, const DebugDrawInstance* instances, int instanceCount) override;
+	virtual void	DrawLineList(DebugDrawDepthMode depthMode, const DebugDrawVertex* vertices, int vertexCount) override;
+
+	// For the last flush
+	int				GetDrawCount() const { return m_drawCount; }
+	int				GetInstanceCount() const { return m_instanceCount; }
+	int				GetVertexCount() const { return m_vertexCount; }
+
+
+private:
+	//-----Private Data-----
+
+	bool		m_supportsInstancing = true;
+	int			m_drawCount = 0;
+	int			m_instanceCount = 0;
+	int			m_vertexCount = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,67 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Render/DebugRenderSystemBackend.h"
+#include "Game/Physics/BodyEngineConversions.h"
+#include "Engine/Core/EngineCommon.h"
+#include "Engine/Render/Debug/DebugRenderSystem.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// DebugDraw colors are RGBA8, red in the low byte
+static Rgba ToRgba(uint32_t color)
+{
+	return Rgba((float)(color & 0xFF) / 255.f, (float)((color >> 8) & 0xFF) / 255.f, (float)((color >> 16) & 0xFF) / 255.f, (float)((color >> 24) & 0xFF) / 255.f);
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+void DebugRenderSystemBackend::DrawInstances(DebugDrawShape shape, DebugDrawDepthMode depthMode, const DebugDrawInstance* instances, int instanceCount)
+{
+	UNUSED(shape);
+	UNUSED(depthMode);
+	UNUSED(instances);
+	UNUSED(instanceCount);
+	ERROR_AND_DIE("DebugRenderSystemBackend can't instance, batches should come expanded!");
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Lasting no time, so each line is drawn the one frame it's flushed in
+void DebugRenderSystemBackend::DrawLineList(DebugDrawDepthMode depthMode, const DebugDrawVertex* vertices, int vertexCount)
+{
+	UNUSED(depthMode);
+
+	for (int vertexIndex = 0; vertexIndex + 1 < vertexCount; vertexIndex += 2)
+	{
+		const DebugDrawVertex& start = vertices[vertexIndex];
+		const DebugDrawVertex& end = vertices[vertexIndex + 1];
+
+		DebugDrawLine3D(ToVector3(start.position), ToVector3(end.position), ToRgba(start.color), 0.f);
+	}
+}
@@ -0,0 +1,45 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 17th, 2026
+/// Description: Flushes DebugDraw to the engine's DebugRenderSystem, for windowed builds
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Render/DebugDrawBackend.h"
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// The DebugRenderSystem only takes single lines, so batches come expanded and each line is handed over for one
+// frame; it draws them with the game camera when the App renders it. Its lines are always depth tested
+class DebugRenderSystemBackend : public DebugDrawBackend
+{
+public:
+	//-----Public Methods-----
+
+	virtual bool	SupportsInstancing() const override { return false; }
+	virtual void	DrawInstances(DebugDrawShape shape, DebugDrawDepthMode depthMode, const DebugDrawInstance* instances, int instanceCount) override;
+	virtual void	DrawLineList(DebugDrawDepthMode depthMode, const DebugDrawVertex* vertices, int vertexCount) override;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,480 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Voxel/VoxelMesher.h"
+#include "Game/Voxel/VoxelModel.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef VOXEL_SIMD_SSE_AVAILABLE
+#include <emmintrin.h>
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char* s_voxelMeshModeNames[] = { "all_faces", "exposed_faces", "greedy" };
+static const uint8_t s_voxelFaces[] = { VOXEL_FACE_NEG_X, VOXEL_FACE_POS_X, VOXEL_FACE_NEG_Y, VOXEL_FACE_POS_Y, VOXEL_FACE_NEG_Z, VOXEL_FACE_POS_Z };
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+const char* GetVoxelMeshModeName(VoxelMeshMode mode)
+{
+	return (mode >= 0 && mode < NUM_VOXEL_MESH_MODES ? s_voxelMeshModeNames[mode] : "unknown");
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// 0 for x, 1 for y, 2 for z
+static int GetFaceAxis(uint8_t face)
+{
+	if ((face & (VOXEL_FACE_NEG_X | VOXEL_FACE_POS_X)) != 0)
+	{
+		return 0;
+	}
+
+	return ((face & (VOXEL_FACE_NEG_Y | VOXEL_FACE_POS_Y)) != 0 ? 1 : 2);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool IsPositiveFace(uint8_t face)
+{
+	return (face & (VOXEL_FACE_POS_X | VOXEL_FACE_POS_Y | VOXEL_FACE_POS_Z)) != 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// out = a & ~b; none of the ranges may overlap
+static void AndNotRange(uint64_t* out, const uint64_t* a, const uint64_t* b, size_t count, bool useSimd)
+{
+	size_t index = 0;
+
+#ifdef VOXEL_SIMD_SSE_AVAILABLE
+	if (useSimd)
+	{
+		for (; index + 2 <= count; index += 2)
+		{
+			const __m128i aWords = _mm_loadu_si128((const __m128i*)(a + index));
+			const __m128i bWords = _mm_loadu_si128((const __m128i*)(b + index));
+			_mm_storeu_si128((__m128i*)(out + index), _mm_andnot_si128(bWords, aWords));
+		}
+	}
+#else
+	(void)useSimd;
+#endif
+
+	for (; index < count; ++index)
+	{
+		out[index] = a[index] & ~b[index];
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bits with no solid bit below them (negative) or above them (positive) in the same row, carrying across
+// words. Rows of a single word are the usual case and run two at a time in SSE
+static void CullRowsAlongX(uint64_t* out, const uint64_t* occupancy, size_t rowCount, int rowWordCount, bool positive, bool useSimd)
+{
+	size_t index = 0;
+	const size_t wordCount = rowCount * rowWordCount;
+
+#ifdef VOXEL_SIMD_SSE_AVAILABLE
+	if (useSimd && rowWordCount == 1)
+	{
+		for (; index + 2 <= wordCount; index += 2)
+		{
+			const __m128i words = _mm_loadu_si128((const __m128i*)(occupancy + index));
+			const __m128i neighbors = (positive ? _mm_srli_epi64(words, 1) : _mm_slli_epi64(words, 1));
+			_mm_storeu_si128((__m128i*)(out + index), _mm_andnot_si128(neighbors, words));
+		}
+	}
+#else
+	(void)useSimd;
+#endif
+
+	for (; index < wordCount; ++index)
+	{
+		const int wordInRow = (int)(index % rowWordCount);
+		const uint64_t word = occupancy[index];
+
+		if (positive)
+		{
+			const uint64_t nextWord = (wordInRow < rowWordCount - 1 ? occupancy[index + 1] : 0);
+			out[index] = word & ~((word >> 1) | (nextWord << 63));
+		}
+		else
+		{
+			const uint64_t previousWord = (wordInRow > 0 ? occupancy[index - 1] : 0);
+			out[index] = word & ~((word << 1) | (previousWord >> 63));
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bits [start, start + count) of a row
+static void ClearBitRange(uint64_t* row, int start, int count)
+{
+	while (count > 0)
+	{
+		const int bitInWord = (start & 63);
+		const int bitsInWord = std::min(count, 64 - bitInWord);
+		const uint64_t mask = (bitsInWord == 64 ? ~(uint64_t)0 : (((uint64_t)1 << bitsInWord) - 1) << bitInWord);
+
+		row[start >> 6] &= ~mask;
+		start += bitsInWord;
+		count -= bitsInWord;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static bool IsBitSet(const uint64_t* row, int bit)
+{
+	return (row[bit >> 6] & ((uint64_t)1 << (bit & 63))) != 0;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+VoxelMesher::VoxelMesher(const VoxelMeshSettings& settings /*= VoxelMeshSettings()*/)
+	: m_settings(settings)
+{
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void VoxelMesher::Build(const VoxelModel& model, VoxelMeshData& out_mesh)
+{
+	out_mesh.Clear();
+
+	if (!model.IsLoaded() || model.GetSolidCount() == 0)
+	{
+		return;
+	}
+
+	m_pivot = Vector3(0.5f * (float)model.GetWidth(), 0.f, 0.5f * (float)model.GetDepth());
+
+	if (m_settings.mode == VOXEL_MESH_ALL_FACES)
+	{
+		BuildAllFaces(model, out_mesh);
+		return;
+	}
+
+	const int dimensions[3] = { model.GetWidth(), model.GetHeight(), model.GetDepth() };
+
+	for (uint8_t face : s_voxelFaces)
+	{
+		BuildFaceRows(model, face);
+
+		const int axis = GetFaceAxis(face);
+		for (int slice = 0; slice < dimensions[axis]; ++slice)
+		{
+			BuildSlicePlane(model, face, slice);
+			MeshSlicePlane(model, face, slice, out_mesh);
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void VoxelMesher::BuildAllFaces(const VoxelModel& model, VoxelMeshData& out_mesh) const
+{
+	const uint32_t* palette = model.GetPalette();
+	const uint8_t* colorIndices = model.GetColorIndices();
+	const int maxColorIndex = std::max(model.GetPaletteCount() - 1, 0);
+	int solidIndex = 0;
+
+	for (int z = 0; z < model.GetDepth(); ++z)
+	{
+		for (int y = 0; y < model.GetHeight(); ++y)
+		{
+			const uint64_t* row = model.GetOccupancyRow(y, z);
+
+			for (int wordIndex = 0; wordIndex < model.GetRowWordCount(); ++wordIndex)
+			{
+				for (uint64_t bits = row[wordIndex]; bits != 0; bits &= bits - 1)
+				{
+					const int x = wordIndex * 64 + GetLowestSetBit(bits);
+					const uint32_t color = (model.GetPaletteCount() > 0 ? palette[std::min((int)colorIndices[solidIndex], maxColorIndex)] : 0xFFFFFFFF);
+
+					AddQuad(VOXEL_FACE_NEG_X, x, y, z, 1, 1, color, out_mesh);
+					AddQuad(VOXEL_FACE_POS_X, x, y, z, 1, 1, color, out_mesh);
+					AddQuad(VOXEL_FACE_NEG_Y, y, x, z, 1, 1, color, out_mesh);
+					AddQuad(VOXEL_FACE_POS_Y, y, x, z, 1, 1, color, out_mesh);
+					AddQuad(VOXEL_FACE_NEG_Z, z, x, y, 1, 1, color, out_mesh);
+					AddQuad(VOXEL_FACE_POS_Z, z, x, y, 1, 1, color, out_mesh);
+					solidIndex++;
+				}
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Leaves only the voxels with nothing solid on the face's side in m_faceRows. For y and z the neighbor
+// rows are a fixed distance away in the occupancy, so whole slabs are culled in one pass
+void VoxelMesher::BuildFaceRows(const VoxelModel& model, uint8_t face)
+{
+	const uint64_t* occupancy = model.GetOccupancyRow(0, 0);
+	const int rowWordCount = model.GetRowWordCount();
+	const size_t rowCount = (size_t)model.GetHeight() * model.GetDepth();
+	const size_t wordCount = rowCount * rowWordCount;
+	const size_t slabWordCount = (size_t)model.GetHeight() * rowWordCount;
+	const bool positive = IsPositiveFace(face);
+
+	m_faceRows.resize(wordCount);
+	uint64_t* faceRows = m_faceRows.data();
+
+	switch (GetFaceAxis(face))
+	{
+	case 0:
+		CullRowsAlongX(faceRows, occupancy, rowCount, rowWordCount, positive, m_settings.useSimd);
+		break;
+	case 1:
+		for (int z = 0; z < model.GetDepth(); ++z)
+		{
+			const uint64_t* slab = occupancy + z * slabWordCount;
+			uint64_t* faceSlab = faceRows + z * slabWordCount;
+
+			if (positive)
+			{
+				AndNotRange(faceSlab, slab, slab + rowWordCount, slabWordCount - rowWordCount, m_settings.useSimd);
+				memcpy(faceSlab + slabWordCount - rowWordCount, slab + slabWordCount - rowWordCount, rowWordCount * sizeof(uint64_t));
+			}
+			else
+			{
+				memcpy(faceSlab, slab, rowWordCount * sizeof(uint64_t));
+				AndNotRange(faceSlab + rowWordCount, slab + rowWordCount, slab, slabWordCount - rowWordCount, m_settings.useSimd);
+			}
+		}
+		break;
+	default:
+		if (positive)
+		{
+			AndNotRange(faceRows, occupancy, occupancy + slabWordCount, wordCount - slabWordCount, m_settings.useSimd);
+			memcpy(faceRows + wordCount - slabWordCount, occupancy + wordCount - slabWordCount, slabWordCount * sizeof(uint64_t));
+		}
+		else
+		{
+			memcpy(faceRows, occupancy, slabWordCount * sizeof(uint64_t));
+			AndNotRange(faceRows + slabWordCount, occupancy + slabWordCount, occupancy, wordCount - slabWordCount, m_settings.useSimd);
+		}
+		break;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Copies one slice of the face rows into m_planeRows, with u and v being y and z for x faces, x and z
+// for y faces, and x and y for z faces. Only y and z slices are whole rows; x slices take one bit per row
+void VoxelMesher::BuildSlicePlane(const VoxelModel& model, uint8_t face, int slice)
+{
+	const int axis = GetFaceAxis(face);
+	const int rowWordCount = model.GetRowWordCount();
+
+	m_planeWidth = (axis == 0 ? model.GetHeight() : model.GetWidth());
+	m_planeHeight = (axis == 2 ? model.GetHeight() : model.GetDepth());
+	m_planeWordCount = (m_planeWidth + 63) / 64;
+
+	m_planeRows.assign((size_t)m_planeHeight * m_planeWordCount, 0);
+	m_planeColors.resize((size_t)m_planeWidth * m_planeHeight);
+
+	for (int v = 0; v < m_planeHeight; ++v)
+	{
+		uint64_t* planeRow = m_planeRows.data() + (size_t)v * m_planeWordCount;
+		uint8_t* planeColors = m_planeColors.data() + (size_t)v * m_planeWidth;
+
+		if (axis == 0)
+		{
+			const int z = v;
+			for (int y = 0; y < model.GetHeight(); ++y)
+			{
+				const uint64_t* faceRow = m_faceRows.data() + (size_t)(y + z * model.GetHeight()) * rowWordCount;
+				if (IsBitSet(faceRow, slice))
+				{
+					planeRow[y >> 6] |= ((uint64_t)1 << (y & 63));
+					planeColors[y] = GetColorIndex(model, slice, y, z);
+				}
+			}
+		}
+		else
+		{
+			const int y = (axis == 1 ? slice : v);
+			const int z = (axis == 1 ? v : slice);
+			const uint64_t* faceRow = m_faceRows.data() + (size_t)(y + z * model.GetHeight()) * rowWordCount;
+			const uint64_t* occupancyRow = model.GetOccupancyRow(y, z);
+			const uint8_t* colorIndices = model.GetColorIndices();
+
+			// Face bits are a subset of the occupancy, so a voxel's color is at the row start plus the solid bits before it
+			int solidIndex = (int)model.GetRowStarts()[y + z * model.GetHeight()];
+
+			for (int wordIndex = 0; wordIndex < rowWordCount; ++wordIndex)
+			{
+				planeRow[wordIndex] = faceRow[wordIndex];
+
+				for (uint64_t bits = faceRow[wordIndex]; bits != 0; bits &= bits - 1)
+				{
+					const int bit = GetLowestSetBit(bits);
+					const uint64_t bitsBefore = occupancyRow[wordIndex] & (((uint64_t)1 << bit) - 1);
+					planeColors[wordIndex * 64 + bit] = colorIndices[solidIndex + CountSetBits(bitsBefore)];
+				}
+
+				solidIndex += CountSetBits(occupancyRow[wordIndex]);
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Takes the lowest set bit, grows it along u while the color matches, then along v while the whole span
+// matches, and clears what it covered. Exposed face mode stops at the first cell
+void VoxelMesher::MeshSlicePlane(const VoxelModel& model, uint8_t face, int slice, VoxelMeshData& out_mesh)
+{
+	const bool greedy = (m_settings.mode == VOXEL_MESH_GREEDY);
+	const uint32_t* palette = model.GetPalette();
+	const int maxColorIndex = std::max(model.GetPaletteCount() - 1, 0);
+
+	for (int v = 0; v < m_planeHeight; ++v)
+	{
+		uint64_t* planeRow = m_planeRows.data() + (size_t)v * m_planeWordCount;
+		const uint8_t* planeColors = m_planeColors.data() + (size_t)v * m_planeWidth;
+
+		for (int wordIndex = 0; wordIndex < m_planeWordCount; ++wordIndex)
+		{
+			while (planeRow[wordIndex] != 0)
+			{
+				const int u = wordIndex * 64 + GetLowestSetBit(planeRow[wordIndex]);
+				const uint8_t colorIndex = planeColors[u];
+
+				int uLength = 1;
+				int vLength = 1;
+
+				if (greedy)
+				{
+					while (u + uLength < m_planeWidth && IsBitSet(planeRow, u + uLength) && planeColors[u + uLength] == colorIndex)
+					{
+						uLength++;
+					}
+
+					for (bool spanMatches = true; spanMatches && v + vLength < m_planeHeight; )
+					{
+						const uint64_t* nextRow = planeRow + (size_t)vLength * m_planeWordCount;
+						const uint8_t* nextColors = planeColors + (size_t)vLength * m_planeWidth;
+
+						for (int spanIndex = u; spanIndex < u + uLength && spanMatches; ++spanIndex)
+						{
+							spanMatches = (IsBitSet(nextRow, spanIndex) && nextColors[spanIndex] == colorIndex);
+						}
+
+						vLength += (spanMatches ? 1 : 0);
+					}
+
+					for (int rowIndex = 0; rowIndex < vLength; ++rowIndex)
+					{
+						ClearBitRange(planeRow + (size_t)rowIndex * m_planeWordCount, u, uLength);
+					}
+				}
+				else
+				{
+					planeRow[wordIndex] &= planeRow[wordIndex] - 1;
+				}
+
+				const uint32_t color = (model.GetPaletteCount() > 0 ? palette[std::min((int)colorIndex, maxColorIndex)] : 0xFFFFFFFF);
+				AddQuad(face, slice, u, v, uLength, vLength, color, out_mesh);
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+uint8_t VoxelMesher::GetColorIndex(const VoxelModel& model, int x, int y, int z) const
+{
+	const int solidIndex = model.GetSolidIndex(x, y, z);
+	return (solidIndex >= 0 ? model.GetColorIndices()[solidIndex] : 0);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Slice, u and v are in voxels on the face's plane (see BuildSlicePlane). Corners go p0, p0 + a, p0 + a + b, p0 + b
+// with a x b along the face normal, which is clockwise from outside in the engine's left handed space
+void VoxelMesher::AddQuad(uint8_t face, int slice, int u, int v, int uLength, int vLength, uint32_t color, VoxelMeshData& out_mesh) const
+{
+	const float planeCoordinate = (float)(slice + (IsPositiveFace(face) ? 1 : 0));
+
+	Vector3 origin;
+	Vector3 uEdge;
+	Vector3 vEdge;
+
+	switch (GetFaceAxis(face))
+	{
+	case 0:
+		origin = Vector3(planeCoordinate, (float)u, (float)v);
+		uEdge = Vector3(0.f, (float)uLength, 0.f);
+		vEdge = Vector3(0.f, 0.f, (float)vLength);
+		break;
+	case 1:
+		origin = Vector3((float)u, planeCoordinate, (float)v);
+		uEdge = Vector3((float)uLength, 0.f, 0.f);
+		vEdge = Vector3(0.f, 0.f, (float)vLength);
+		break;
+	default:
+		origin = Vector3((float)u, (float)v, planeCoordinate);
+		uEdge = Vector3((float)uLength, 0.f, 0.f);
+		vEdge = Vector3(0.f, (float)vLength, 0.f);
+		break;
+	}
+
+	// u x v points down +x and +z but -y, so those faces keep the order and the rest swap
+	const bool keepOrder = (face == VOXEL_FACE_POS_X || face == VOXEL_FACE_NEG_Y || face == VOXEL_FACE_POS_Z);
+	const Vector3 aEdge = (keepOrder ? uEdge : vEdge);
+	const Vector3 bEdge = (keepOrder ? vEdge : uEdge);
+	const float aLength = (float)(keepOrder ? uLength : vLength);
+	const float bLength = (float)(keepOrder ? vLength : uLength);
+
+	const Vector3 corners[4] = { origin, origin + aEdge, origin + aEdge + bEdge, origin + bEdge };
+	const Vector2 uvs[4] = { Vector2(0.f, 0.f), Vector2(aLength, 0.f), Vector2(aLength, bLength), Vector2(0.f, bLength) };
+	const uint32_t firstIndex = (uint32_t)out_mesh.vertices.size();
+
+	for (int cornerIndex = 0; cornerIndex < 4; ++cornerIndex)
+	{
+		VoxelVertex vertex;
+		vertex.position = (corners[cornerIndex] - m_pivot) * m_settings.voxelSize;
+		vertex.color = color;
+		vertex.uv = uvs[cornerIndex];
+
+		out_mesh.vertices.push_back(vertex);
+	}
+
+	const uint32_t quadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+	for (uint32_t index : quadIndices)
+	{
+		out_mesh.indices.push_back(firstIndex + index);
+	}
+
+	out_mesh.faceCount += uLength * vLength;
+}
@@ -0,0 +1,117 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Turns a VoxelModel into vertices and indices, merging same colored faces into larger quads
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Engine/Math/Vector2.h"
+#include "Engine/Math/Vector3.h"
+#include <cstdint>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define VOXEL_SIMD_SSE_AVAILABLE
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+class VoxelModel;
+
+enum VoxelMeshMode
+{
+	VOXEL_MESH_ALL_FACES,		// Six quads per voxel, nothing culled
+	VOXEL_MESH_EXPOSED_FACES,	// One quad per face with nothing solid in front of it, what the .qef visibility mask gives
+	VOXEL_MESH_GREEDY,			// Exposed faces merged into the largest same colored rectangles on each slice
+	NUM_VOXEL_MESH_MODES
+};
+
+// Laid out like the VInput of default.shadersource. Color is RGBA8, read as a normalized float4
+struct VoxelVertex
+{
+	Vector3		position;
+	uint32_t	color = 0xFFFFFFFF;
+	Vector2		uv;
+};
+
+struct VoxelMeshData
+{
+	std::vector<VoxelVertex>	vertices;
+	std::vector<uint32_t>		indices;		// Two clockwise triangles per quad, seen from outside the model
+	int							faceCount = 0;	// Voxel faces covered by the quads, the same for every mode but ALL_FACES
+
+	void	Clear() { vertices.clear(); indices.clear(); faceCount = 0; }
+	int		GetQuadCount() const { return (int)vertices.size() / 4; }
+};
+
+struct VoxelMeshSettings
+{
+	VoxelMeshMode	mode = VOXEL_MESH_GREEDY;
+	bool			useSimd = true;			// SSE2 for the face culling, when the target has it
+	float			voxelSize = 1.f;		// Mesh origin is the center of the bottom of the model
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Works one face direction at a time. Culling is done on whole occupancy rows with bitwise ops, 64 voxels
+// per word (128 with SSE), then each slice across the face's axis is flattened into a bit plane and
+// rectangles are grown out of it. Scratch buffers are kept between builds, so keep a mesher around
+class VoxelMesher
+{
+public:
+	//-----Public Methods-----
+
+	VoxelMesher(const VoxelMeshSettings& settings = VoxelMeshSettings());
+
+	void						Build(const VoxelModel& model, VoxelMeshData& out_mesh);
+	const VoxelMeshSettings&	GetSettings() const { return m_settings; }
+
+
+private:
+	//-----Private Methods-----
+
+	void		BuildAllFaces(const VoxelModel& model, VoxelMeshData& out_mesh) const;
+	void		BuildFaceRows(const VoxelModel& model, uint8_t face);
+	void		BuildSlicePlane(const VoxelModel& model, uint8_t face, int slice);
+	void		MeshSlicePlane(const VoxelModel& model, uint8_t face, int slice, VoxelMeshData& out_mesh);
+
+	uint8_t		GetColorIndex(const VoxelModel& model, int x, int y, int z) const;
+	void		AddQuad(uint8_t face, int slice, int u, int v, int uLength, int vLength, uint32_t color, VoxelMeshData& out_mesh) const;
+
+
+private:
+	//-----Private Data-----
+
+	VoxelMeshSettings		m_settings;
+	Vector3					m_pivot;
+
+	// Scratch, sized for the largest model built so far
+	std::vector<uint64_t>	m_faceRows;			// Occupancy rows with only the voxels showing the current face
+	std::vector<uint64_t>	m_planeRows;		// One slice of m_faceRows, as rows along the plane's u axis
+	std::vector<uint8_t>	m_planeColors;		// Palette index per plane cell
+	int						m_planeWidth = 0;
+	int						m_planeHeight = 0;
+	int						m_planeWordCount = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+const char*		GetVoxelMeshModeName(VoxelMeshMode mode);
@@ -0,0 +1,531 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: 
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Voxel/VoxelModel.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Walks the text of a .qef without copying it; every read fails once the end is reached
+struct QefReader
+{
+	const char* cursor = nullptr;
+	const char* end = nullptr;
+
+	void SkipLine()
+	{
+		while (cursor < end && *cursor != '\n')
+		{
+			cursor++;
+		}
+
+		cursor = (cursor < end ? cursor + 1 : end);
+	}
+
+	bool SkipSpace()
+	{
+		while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r' || *cursor == '\n'))
+		{
+			cursor++;
+		}
+
+		return (cursor < end);
+	}
+
+	bool ReadUInt(uint32_t& out_value)
+	{
+		if (!SkipSpace() || *cursor < '0' || *cursor > '9')
+		{
+			return false;
+		}
+
+		uint32_t value = 0;
+		while (cursor < end && *cursor >= '0' && *cursor <= '9')
+		{
+			value = value * 10 + (uint32_t)(*cursor - '0');
+			cursor++;
+		}
+
+		out_value = value;
+		return true;
+	}
+
+	// Palette entries only, so the token is copied out to give strtof a terminated string
+	bool ReadFloat(float& out_value)
+	{
+		if (!SkipSpace())
+		{
+			return false;
+		}
+
+		char token[32];
+		int length = 0;
+		while (cursor < end && length < (int)sizeof(token) - 1 && *cursor != ' ' && *cursor != '\t' && *cursor != '\r' && *cursor != '\n')
+		{
+			token[length++] = *cursor++;
+		}
+
+		token[length] = '\0';
+		char* tokenEnd = nullptr;
+		out_value = strtof(token, &tokenEnd);
+
+		return (tokenEnd != token);
+	}
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+static const char		s_qefSignature[] = "Qubicle Exchange Format";
+static const uint32_t	s_maxDimension = 4096;
+static const int		s_maxPaletteCount = 256;	// Colors are stored as one byte per voxel
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+static void SetError(std::string* out_error, const std::string& message)
+{
+	if (out_error != nullptr)
+	{
+		*out_error = message;
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint64_t AlignOffset(uint64_t offset)
+{
+	return (offset + 7) & ~(uint64_t)7;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+static uint32_t PackColor(float r, float g, float b)
+{
+	const uint32_t red = (uint32_t)(std::min(std::max(r, 0.f), 1.f) * 255.f + 0.5f);
+	const uint32_t green = (uint32_t)(std::min(std::max(g, 0.f), 1.f) * 255.f + 0.5f);
+	const uint32_t blue = (uint32_t)(std::min(std::max(b, 0.f), 1.f) * 255.f + 0.5f);
+
+	return red | (green << 8) | (blue << 16) | (0xFFu << 24);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Fills in the section offsets and total size for a model of this size; the counts must already be set
+static void LayOutSections(VoxelFileHeader& header)
+{
+	const uint64_t rowCount = (uint64_t)header.dimensions[1] * header.dimensions[2];
+
+	header.paletteOffset = AlignOffset(sizeof(VoxelFileHeader));
+	header.occupancyOffset = AlignOffset(header.paletteOffset + header.paletteCount * sizeof(uint32_t));
+	header.rowStartOffset = AlignOffset(header.occupancyOffset + rowCount * header.rowWordCount * sizeof(uint64_t));
+	header.colorOffset = AlignOffset(header.rowStartOffset + rowCount * sizeof(uint32_t));
+	header.faceMaskOffset = AlignOffset(header.colorOffset + header.solidCount);
+	header.fileSize = AlignOffset(header.faceMaskOffset + header.solidCount);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Faces on a row are the solid bits without a solid neighbor on that side. Along x that's the row shifted by one
+// (carrying across words), along y and z it's the neighboring row, which is all empty past the edge of the model
+static void BuildFaceMasks(const uint64_t* occupancy, int height, int depth, int rowWordCount, const uint32_t* rowStarts, uint8_t* out_faceMasks)
+{
+	std::vector<uint64_t> emptyRow(rowWordCount, 0);
+
+	for (int z = 0; z < depth; ++z)
+	{
+		for (int y = 0; y < height; ++y)
+		{
+			const int rowIndex = y + z * height;
+			const uint64_t* row = occupancy + (size_t)rowIndex * rowWordCount;
+			const uint64_t* below = (y > 0 ? row - rowWordCount : emptyRow.data());
+			const uint64_t* above = (y < height - 1 ? row + rowWordCount : emptyRow.data());
+			const uint64_t* back = (z > 0 ? row - (size_t)height * rowWordCount : emptyRow.data());
+			const uint64_t* front = (z < depth - 1 ? row + (size_t)height * rowWordCount : emptyRow.data());
+
+			uint32_t solidIndex = rowStarts[rowIndex];
+
+			for (int wordIndex = 0; wordIndex < rowWordCount; ++wordIndex)
+			{
+				const uint64_t word = row[wordIndex];
+				const uint64_t previousWord = (wordIndex > 0 ? row[wordIndex - 1] : 0);
+				const uint64_t nextWord = (wordIndex < rowWordCount - 1 ? row[wordIndex + 1] : 0);
+
+				const uint64_t negX = word & ~((word << 1) | (previousWord >> 63));
+				const uint64_t posX = word & ~((word >> 1) | (nextWord << 63));
+				const uint64_t negY = word & ~below[wordIndex];
+				const uint64_t posY = word & ~above[wordIndex];
+				const uint64_t negZ = word & ~back[wordIndex];
+				const uint64_t posZ = word & ~front[wordIndex];
+
+				for (uint64_t bits = word; bits != 0; bits &= bits - 1)
+				{
+					const uint64_t bit = bits & (~bits + 1);
+					out_faceMasks[solidIndex++] = (uint8_t)(
+						((negX & bit) != 0 ? VOXEL_FACE_NEG_X : 0) | ((posX & bit) != 0 ? VOXEL_FACE_POS_X : 0) |
+						((negY & bit) != 0 ? VOXEL_FACE_NEG_Y : 0) | ((posY & bit) != 0 ? VOXEL_FACE_POS_Y : 0) |
+						((negZ & bit) != 0 ? VOXEL_FACE_NEG_Z : 0) | ((posZ & bit) != 0 ? VOXEL_FACE_POS_Z : 0));
+				}
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Each row has to start where the one before it ended, counting its solid bits, and the last has to end at
+// solidCount - otherwise a corrupt file would send color and face lookups past their sections
+static bool AreRowStartsValid(const VoxelFileHeader& header, const uint64_t* occupancy, const uint32_t* rowStarts)
+{
+	const size_t rowCount = (size_t)header.dimensions[1] * header.dimensions[2];
+	uint32_t expectedStart = 0;
+
+	for (size_t rowIndex = 0; rowIndex < rowCount; ++rowIndex)
+	{
+		if (rowStarts[rowIndex] != expectedStart)
+		{
+			return false;
+		}
+
+		uint64_t rowSolidCount = 0;
+		for (uint32_t wordIndex = 0; wordIndex < header.rowWordCount; ++wordIndex)
+		{
+			rowSolidCount += CountSetBits(occupancy[rowIndex * header.rowWordCount + wordIndex]);
+		}
+
+		if (expectedStart + rowSolidCount > header.solidCount)
+		{
+			return false;
+		}
+
+		expectedStart += (uint32_t)rowSolidCount;
+	}
+
+	return (expectedStart == header.solidCount);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+std::string GetCookedVoxelPath(const std::string& qefPath)
+{
+	const size_t extensionStart = qefPath.find_last_of('.');
+	const size_t directoryEnd = qefPath.find_last_of("/\\");
+
+	if (extensionStart == std::string::npos || (directoryEnd != std::string::npos && extensionStart < directoryEnd))
+	{
+		return qefPath + VOXEL_COOKED_EXTENSION;
+	}
+
+	return qefPath.substr(0, extensionStart) + VOXEL_COOKED_EXTENSION;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool CookVoxelModel(const std::string& qefPath, const std::string& cookedPath, std::string* out_error /*= nullptr*/)
+{
+	VoxelModel model;
+	if (!model.LoadQef(qefPath, out_error))
+	{
+		return false;
+	}
+
+	if (!model.WriteCooked(cookedPath))
+	{
+		SetError(out_error, "Couldn't write " + cookedPath);
+		return false;
+	}
+
+	return true;
+}
+
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS IMPLEMENTATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Uses the cooked file next to the .qef if there is one and it was cooked from the .qef as it is now.
+// A cooked file with no .qef beside it is used as is, so builds can ship without the sources.
+// Both are looked for in the resource pack before the loose files
+bool VoxelModel::Load(const std::string& qefPath, std::string* out_error /*= nullptr*/)
+{
+	const std::string cookedPath = GetCookedVoxelPath(qefPath);
+
+	FileInfo cookedInfo;
+	if (GetResourceFileInfo(cookedPath.c_str(), cookedInfo) && LoadCooked(cookedPath))
+	{
+		FileInfo sourceInfo;
+		const bool hasSource = GetResourceFileInfo(qefPath.c_str(), sourceInfo);
+
+		if (!hasSource || (sourceInfo.size == m_header->sourceSize && sourceInfo.modifiedTime == m_header->sourceModifiedTime))
+		{
+			return true;
+		}
+	}
+
+	return LoadQef(qefPath, out_error);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The text is mapped rather than read in, so the only heap used is the occupancy, one color byte per cell
+// while parsing, and the image itself
+bool VoxelModel::LoadQef(const std::string& qefPath, std::string* out_error /*= nullptr*/)
+{
+	Clear();
+
+	ResourceFile textFile;
+	if (!textFile.Open(qefPath.c_str()))
+	{
+		SetError(out_error, "Couldn't open " + qefPath);
+		return false;
+	}
+
+	QefReader reader;
+	reader.cursor = (const char*)textFile.GetData();
+	reader.end = reader.cursor + textFile.GetSize();
+
+	if (textFile.GetSize() < sizeof(s_qefSignature) - 1 || strncmp(reader.cursor, s_qefSignature, sizeof(s_qefSignature) - 1) != 0)
+	{
+		SetError(out_error, qefPath + " isn't a Qubicle Exchange Format file");
+		return false;
+	}
+
+	// Signature, version and website lines
+	reader.SkipLine();
+	reader.SkipLine();
+	reader.SkipLine();
+
+	VoxelFileHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = VOXEL_FILE_MAGIC;
+	header.version = VOXEL_FILE_VERSION;
+
+	if (!reader.ReadUInt(header.dimensions[0]) || !reader.ReadUInt(header.dimensions[1]) || !reader.ReadUInt(header.dimensions[2]) || !reader.ReadUInt(header.paletteCount))
+	{
+		SetError(out_error, qefPath + " has a malformed header");
+		return false;
+	}
+
+	const uint32_t width = header.dimensions[0];
+	const uint32_t height = header.dimensions[1];
+	const uint32_t depth = header.dimensions[2];
+
+	if (width == 0 || height == 0 || depth == 0 || width > s_maxDimension || height > s_maxDimension || depth > s_maxDimension || header.paletteCount > (uint32_t)s_maxPaletteCount)
+	{
+		SetError(out_error, qefPath + " is too large, or has too many colors");
+		return false;
+	}
+
+	std::vector<uint32_t> palette(header.paletteCount);
+	for (uint32_t& color : palette)
+	{
+		float r, g, b;
+		if (!reader.ReadFloat(r) || !reader.ReadFloat(g) || !reader.ReadFloat(b))
+		{
+			SetError(out_error, qefPath + " has a malformed palette");
+			return false;
+		}
+
+		color = PackColor(r, g, b);
+	}
+
+	// The visibility mask at the end of each line is ignored, face masks are worked out from the occupancy
+	header.rowWordCount = (width + 63) / 64;
+	const size_t rowCount = (size_t)height * depth;
+	std::vector<uint64_t> occupancy(rowCount * header.rowWordCount, 0);
+	std::vector<uint8_t> cellColors((size_t)width * height * depth, 0);
+
+	uint32_t x, y, z, colorIndex, visibilityMask;
+	while (reader.ReadUInt(x) && reader.ReadUInt(y) && reader.ReadUInt(z) && reader.ReadUInt(colorIndex) && reader.ReadUInt(visibilityMask))
+	{
+		if (x >= width || y >= height || z >= depth || colorIndex >= header.paletteCount)
+		{
+			SetError(out_error, qefPath + " has a voxel outside the model or palette");
+			return false;
+		}
+
+		const size_t rowIndex = y + (size_t)z * height;
+		uint64_t& word = occupancy[rowIndex * header.rowWordCount + (x >> 6)];
+		const uint64_t bit = (uint64_t)1 << (x & 63);
+
+		header.solidCount += ((word & bit) == 0 ? 1 : 0);
+		word |= bit;
+		cellColors[rowIndex * width + x] = (uint8_t)colorIndex;
+	}
+
+	if (reader.SkipSpace())
+	{
+		SetError(out_error, qefPath + " has a malformed voxel line");
+		return false;
+	}
+
+	FileInfo sourceInfo;
+	GetResourceFileInfo(qefPath.c_str(), sourceInfo);
+	header.sourceSize = sourceInfo.size;
+	header.sourceModifiedTime = sourceInfo.modifiedTime;
+
+	LayOutSections(header);
+	m_ownedImage.assign((size_t)header.fileSize, 0);
+	m_peakLoadHeapSize = m_ownedImage.capacity() + occupancy.capacity() * sizeof(uint64_t) + cellColors.capacity() + palette.capacity() * sizeof(uint32_t);
+
+	uint8_t* image = m_ownedImage.data();
+	memcpy(image, &header, sizeof(header));
+	memcpy(image + header.paletteOffset, palette.data(), palette.size() * sizeof(uint32_t));
+	memcpy(image + header.occupancyOffset, occupancy.data(), occupancy.size() * sizeof(uint64_t));
+
+	uint32_t* rowStarts = (uint32_t*)(image + header.rowStartOffset);
+	uint8_t* colors = image + header.colorOffset;
+	uint32_t solidIndex = 0;
+
+	for (size_t rowIndex = 0; rowIndex < rowCount; ++rowIndex)
+	{
+		rowStarts[rowIndex] = solidIndex;
+
+		for (uint32_t wordIndex = 0; wordIndex < header.rowWordCount; ++wordIndex)
+		{
+			for (uint64_t bits = occupancy[rowIndex * header.rowWordCount + wordIndex]; bits != 0; bits &= bits - 1)
+			{
+				colors[solidIndex++] = cellColors[rowIndex * width + wordIndex * 64 + GetLowestSetBit(bits)];
+			}
+		}
+	}
+
+	BuildFaceMasks(occupancy.data(), (int)height, (int)depth, (int)header.rowWordCount, rowStarts, image + header.faceMaskOffset);
+
+	m_image = image;
+	m_header = (const VoxelFileHeader*)image;
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The header and section bounds are checked, then one pass over the rows makes sure the row starts agree with the
+// occupancy bits. Color indices aren't range checked here; anything reading them should clamp to the palette
+bool VoxelModel::LoadCooked(const std::string& cookedPath, std::string* out_error /*= nullptr*/)
+{
+	Clear();
+
+	if (!m_file.Open(cookedPath.c_str()))
+	{
+		SetError(out_error, "Couldn't open " + cookedPath);
+		return false;
+	}
+
+	const uint8_t* data = m_file.GetData();
+	const size_t size = m_file.GetSize();
+
+	if (size < sizeof(VoxelFileHeader))
+	{
+		SetError(out_error, cookedPath + " is too small to be a cooked voxel file");
+		m_file.Close();
+		return false;
+	}
+
+	const VoxelFileHeader* fileHeader = (const VoxelFileHeader*)data;
+
+	// Lay out a header from the counts alone and make sure the file agrees with it
+	VoxelFileHeader expected = *fileHeader;
+	const bool dimensionsValid = (expected.dimensions[0] > 0 && expected.dimensions[1] > 0 && expected.dimensions[2] > 0
+		&& expected.dimensions[0] <= s_maxDimension && expected.dimensions[1] <= s_maxDimension && expected.dimensions[2] <= s_maxDimension
+		&& expected.rowWordCount == (expected.dimensions[0] + 63) / 64 && expected.paletteCount <= (uint32_t)s_maxPaletteCount);
+
+	if (dimensionsValid)
+	{
+		LayOutSections(expected);
+	}
+
+	if (fileHeader->magic != VOXEL_FILE_MAGIC || fileHeader->version != VOXEL_FILE_VERSION || !dimensionsValid || memcmp(&expected, fileHeader, sizeof(VoxelFileHeader)) != 0 || fileHeader->fileSize != (uint64_t)size)
+	{
+		SetError(out_error, cookedPath + " is corrupt or from a different version");
+		m_file.Close();
+		return false;
+	}
+
+	if (!AreRowStartsValid(*fileHeader, (const uint64_t*)(data + fileHeader->occupancyOffset), (const uint32_t*)(data + fileHeader->rowStartOffset)))
+	{
+		SetError(out_error, cookedPath + " has row starts that don't match its occupancy");
+		m_file.Close();
+		return false;
+	}
+
+	m_image = data;
+	m_header = fileHeader;
+
+	return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool VoxelModel::WriteCooked(const std::string& cookedPath) const
+{
+	if (m_header == nullptr)
+	{
+		return false;
+	}
+
+	return WriteBinaryFile(cookedPath.c_str(), m_image, (size_t)m_header->fileSize);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void VoxelModel::Clear()
+{
+	m_header = nullptr;
+	m_image = nullptr;
+	m_peakLoadHeapSize = 0;
+	m_file.Close();
+
+	std::vector<uint8_t>().swap(m_ownedImage);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+bool VoxelModel::IsSolid(int x, int y, int z) const
+{
+	if (x < 0 || y < 0 || z < 0 || x >= GetWidth() || y >= GetHeight() || z >= GetDepth())
+	{
+		return false;
+	}
+
+	return (GetOccupancyRow(y, z)[x >> 6] & ((uint64_t)1 << (x & 63))) != 0;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// The row's first solid index plus the solid voxels before x in the row
+int VoxelModel::GetSolidIndex(int x, int y, int z) const
+{
+	if (!IsSolid(x, y, z))
+	{
+		return -1;
+	}
+
+	const uint64_t* row = GetOccupancyRow(y, z);
+	int solidIndex = (int)GetRowStarts()[GetRowIndex(y, z)];
+
+	for (int wordIndex = 0; wordIndex < (x >> 6); ++wordIndex)
+	{
+		solidIndex += CountSetBits(row[wordIndex]);
+	}
+
+	const uint64_t bitsBefore = row[x >> 6] & (((uint64_t)1 << (x & 63)) - 1);
+	return solidIndex + CountSetBits(bitsBefore);
+}
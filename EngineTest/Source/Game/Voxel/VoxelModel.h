@@ -0,0 +1,156 @@
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// Author: Andrew Chase
+/// Date Created: October 16th, 2026
+/// Description: Voxel models loaded from Qubicle .qef text, or memory mapped from the cooked binary made from it
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#pragma once
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// INCLUDES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+#include "Game/Framework/ResourcePack.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// DEFINES
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// ENUMS, TYPEDEFS, STRUCTS, FORWARD DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Set in a voxel's face mask when there's no solid voxel on that side of it
+enum VoxelFace : uint8_t
+{
+	VOXEL_FACE_NEG_X	= (1 << 0),
+	VOXEL_FACE_POS_X	= (1 << 1),
+	VOXEL_FACE_NEG_Y	= (1 << 2),
+	VOXEL_FACE_POS_Y	= (1 << 3),
+	VOXEL_FACE_NEG_Z	= (1 << 4),
+	VOXEL_FACE_POS_Z	= (1 << 5),
+	VOXEL_FACE_ALL		= 0x3F
+};
+
+// Start of a cooked voxel file. Every section is 8 byte aligned, and offsets are from the start of the file.
+// Rows run along x, one per (y, z), indexed y + z * height
+struct VoxelFileHeader
+{
+	uint32_t	magic;
+	uint32_t	version;
+	uint32_t	dimensions[3];
+	uint32_t	paletteCount;
+	uint32_t	solidCount;
+	uint32_t	rowWordCount;			// 64 bit occupancy words per row
+	uint64_t	sourceSize;				// Of the .qef this was cooked from, to tell when the cooked file is stale
+	uint64_t	sourceModifiedTime;
+	uint64_t	paletteOffset;			// uint32_t RGBA8 per palette entry
+	uint64_t	occupancyOffset;		// rowWordCount uint64_t per row, bit x set for each solid voxel
+	uint64_t	rowStartOffset;			// uint32_t per row, the index of the row's first solid voxel
+	uint64_t	colorOffset;			// uint8_t palette index per solid voxel, in x, then y, then z order
+	uint64_t	faceMaskOffset;			// uint8_t VoxelFace bits per solid voxel, same order
+	uint64_t	fileSize;
+};
+
+const uint32_t	VOXEL_FILE_MAGIC = 0x4C584F56;	// "VOXL"
+const uint32_t	VOXEL_FILE_VERSION = 1;
+const char		VOXEL_COOKED_EXTENSION[] = ".voxl";
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// GLOBALS AND STATICS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// CLASS DECLARATIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------------------------------
+// Always reads from an image laid out like the cooked file. A cooked file is mapped and used where it sits;
+// a .qef is parsed into an image on the heap, which is also what gets written out when cooking
+class VoxelModel
+{
+public:
+	//-----Public Methods-----
+
+	bool				Load(const std::string& qefPath, std::string* out_error = nullptr);
+	bool				LoadQef(const std::string& qefPath, std::string* out_error = nullptr);
+	bool				LoadCooked(const std::string& cookedPath, std::string* out_error = nullptr);
+	bool				WriteCooked(const std::string& cookedPath) const;
+	void				Clear();
+
+	bool				IsLoaded() const { return m_header != nullptr; }
+	bool				IsMapped() const { return m_file.IsOpen(); }
+	size_t				GetImageSize() const { return (m_header != nullptr ? (size_t)m_header->fileSize : 0); }
+	size_t				GetHeapSize() const { return m_ownedImage.capacity(); }
+	size_t				GetPeakLoadHeapSize() const { return m_peakLoadHeapSize; }
+
+	int					GetWidth() const { return (int)m_header->dimensions[0]; }
+	int					GetHeight() const { return (int)m_header->dimensions[1]; }
+	int					GetDepth() const { return (int)m_header->dimensions[2]; }
+	int					GetSolidCount() const { return (int)m_header->solidCount; }
+	int					GetPaletteCount() const { return (int)m_header->paletteCount; }
+	int					GetRowWordCount() const { return (int)m_header->rowWordCount; }
+
+	const uint32_t*		GetPalette() const { return GetSection<uint32_t>(m_header->paletteOffset); }
+	const uint64_t*		GetOccupancyRow(int y, int z) const { return GetSection<uint64_t>(m_header->occupancyOffset) + (size_t)GetRowIndex(y, z) * m_header->rowWordCount; }
+	const uint32_t*		GetRowStarts() const { return GetSection<uint32_t>(m_header->rowStartOffset); }
+	const uint8_t*		GetColorIndices() const { return GetSection<uint8_t>(m_header->colorOffset); }
+	const uint8_t*		GetFaceMasks() const { return GetSection<uint8_t>(m_header->faceMaskOffset); }
+
+	bool				IsSolid(int x, int y, int z) const;
+	int					GetSolidIndex(int x, int y, int z) const;		// Into the color and face mask arrays, -1 if empty
+
+
+private:
+	//-----Private Methods-----
+
+	int					GetRowIndex(int y, int z) const { return y + z * (int)m_header->dimensions[1]; }
+	template <typename T>
+	const T*			GetSection(uint64_t offset) const { return (const T*)(m_image + offset); }
+
+
+private:
+	//-----Private Data-----
+
+	const VoxelFileHeader*	m_header = nullptr;
+	const uint8_t*			m_image = nullptr;
+	std::vector<uint8_t>	m_ownedImage;
+	ResourceFile			m_file;				// Holds the cooked image when it's read in place
+	size_t					m_peakLoadHeapSize = 0;
+
+};
+
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+/// C FUNCTIONS
+///--------------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string	GetCookedVoxelPath(const std::string& qefPath);
+bool		CookVoxelModel(const std::string& qefPath, const std::string& cookedPath, std::string* out_error = nullptr);
+
+//-------------------------------------------------------------------------------------------------
+inline int CountSetBits(uint64_t bits)
+{
+#ifdef _MSC_VER
+	return (int)__popcnt64(bits);
+#else
+	return __builtin_popcountll(bits);
+#endif
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Undefined for 0
+inline int GetLowestSetBit(uint64_t bits)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward64(&index, bits);
+	return (int)index;
+#else
+	return __builtin_ctzll(bits);
+#endif
+}